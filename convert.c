@@ -19,6 +19,32 @@
 
 #include "dump1090.h"
 
+// Cutoff frequency of the DC-blocking filter, Hz
+#define DC_FILTER_CUTOFF 1.0
+
+struct converter_state {
+    fc32_t dc;          // current DC estimate, normalized I/Q
+    bool dc_valid;      // false until the first block has been seen
+    double dc_rate;     // filter rate constant, per sample
+};
+
+// Fold the mean of one block into the running DC estimate.
+// This is a single-pole IIR lowpass evaluated once per block, rather than
+// per sample, so that the conversion kernels stay vectorizable; with a
+// cutoff far below the block rate the difference is negligible.
+static void update_dc(struct converter_state *state, const fc32_t *block_mean, unsigned nsamples)
+{
+    if (!state->dc_valid) {
+        state->dc = *block_mean;
+        state->dc_valid = true;
+        return;
+    }
+
+    float alpha = (float) (1.0 - exp(-state->dc_rate * nsamples));
+    state->dc.I += alpha * (block_mean->I - state->dc.I);
+    state->dc.Q += alpha * (block_mean->Q - state->dc.Q);
+}
+
 static void convert_uc8(void *iq_data,
                         uint16_t *mag_data,
                         unsigned nsamples,
@@ -91,17 +117,113 @@ static void convert_sc16q11(void *iq_data,
     }
 }
 
+static void convert_uc8_dc(void *iq_data,
+                           uint16_t *mag_data,
+                           unsigned nsamples,
+                           struct converter_state *state,
+                           double *out_mean_level,
+                           double *out_mean_power)
+{
+    const uc8_t *in = (const uc8_t *) iq_data;
+    fc32_t mean;
+    double level, power;
+
+    if (STARCH_IS_ALIGNED(in) && STARCH_IS_ALIGNED(mag_data))
+        starch_magnitude_dc_uc8_aligned(in, mag_data, nsamples, &state->dc, &mean, &level, &power);
+    else
+        starch_magnitude_dc_uc8(in, mag_data, nsamples, &state->dc, &mean, &level, &power);
+
+    update_dc(state, &mean, nsamples);
+
+    if (out_mean_level && out_mean_power) {
+        *out_mean_level = level;
+        *out_mean_power = power;
+    }
+}
+
+static void convert_sc16_dc(void *iq_data,
+                            uint16_t *mag_data,
+                            unsigned nsamples,
+                            struct converter_state *state,
+                            double *out_mean_level,
+                            double *out_mean_power)
+{
+    const sc16_t *in = (const sc16_t *) iq_data;
+    fc32_t mean;
+    double level, power;
+
+    if (STARCH_IS_ALIGNED(in) && STARCH_IS_ALIGNED(mag_data))
+        starch_magnitude_dc_sc16_aligned(in, mag_data, nsamples, &state->dc, &mean, &level, &power);
+    else
+        starch_magnitude_dc_sc16(in, mag_data, nsamples, &state->dc, &mean, &level, &power);
+
+    update_dc(state, &mean, nsamples);
+
+    if (out_mean_level && out_mean_power) {
+        *out_mean_level = level;
+        *out_mean_power = power;
+    }
+}
+
+static void convert_sc16q11_dc(void *iq_data,
+                               uint16_t *mag_data,
+                               unsigned nsamples,
+                               struct converter_state *state,
+                               double *out_mean_level,
+                               double *out_mean_power)
+{
+    const sc16_t *in = (const sc16_t *) iq_data;
+    fc32_t mean;
+    double level, power;
+
+    if (STARCH_IS_ALIGNED(in) && STARCH_IS_ALIGNED(mag_data))
+        starch_magnitude_dc_sc16q11_aligned(in, mag_data, nsamples, &state->dc, &mean, &level, &power);
+    else
+        starch_magnitude_dc_sc16q11(in, mag_data, nsamples, &state->dc, &mean, &level, &power);
+
+    update_dc(state, &mean, nsamples);
+
+    if (out_mean_level && out_mean_power) {
+        *out_mean_level = level;
+        *out_mean_power = power;
+    }
+}
+
 iq_convert_fn init_converter(input_format_t format,
                              double sample_rate,
                              int filter_dc,
                              struct converter_state **out_state)
 {
-    MODES_NOTUSED(sample_rate);
-    MODES_NOTUSED(out_state);
+    *out_state = NULL;
 
     if (filter_dc) {
-        fprintf(stderr, "DC filtering not supported (yet)\n");
-        return NULL;
+        iq_convert_fn fn;
+
+        switch (format) {
+        case INPUT_UC8:
+            fn = convert_uc8_dc;
+            break;
+        case INPUT_SC16:
+            fn = convert_sc16_dc;
+            break;
+        case INPUT_SC16Q11:
+            fn = convert_sc16q11_dc;
+            break;
+        default:
+            fprintf(stderr, "no suitable DC-filtering converter for format=%u\n", (unsigned) format);
+            return NULL;
+        }
+
+        struct converter_state *state = calloc(1, sizeof(*state));
+        if (!state) {
+            fprintf(stderr, "can't allocate converter state\n");
+            return NULL;
+        }
+
+        state->dc_valid = false;
+        state->dc_rate = 2.0 * M_PI * DC_FILTER_CUTOFF / sample_rate;
+        *out_state = state;
+        return fn;
     }
 
     switch (format) {
@@ -119,5 +241,5 @@ iq_convert_fn init_converter(input_format_t format,
 
 void cleanup_converter(struct converter_state *state)
 {
-    MODES_NOTUSED(state);
+    free(state);
 }
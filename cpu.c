@@ -46,6 +46,16 @@ int cpu_supports_avx2(void)
 #endif
 }
 
+int cpu_supports_pclmul(void)
+{
+#ifdef CPU_FEATURES_ARCH_X86
+    // the carry-less multiply CRC also uses SSE4.1 (pextrq)
+    return x86_info()->features.pclmulqdq && x86_info()->features.sse4_1;
+#else
+    return 0;
+#endif
+}
+
 //
 // ARM
 //
@@ -107,3 +117,12 @@ int cpu_supports_armv8_simd(void)
     return 0;
 #endif
 }
+
+int cpu_supports_armv8_pmull(void)
+{
+#ifdef CPU_FEATURES_ARCH_AARCH64
+    return aarch64_info()->features.pmull;
+#else
+    return 0;
+#endif
+}
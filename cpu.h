@@ -4,6 +4,7 @@
 // x86
 int cpu_supports_avx(void);
 int cpu_supports_avx2(void);
+int cpu_supports_pclmul(void);
 
 // ARM
 int cpu_supports_armv7_neon_vfpv4(void);
@@ -11,5 +12,6 @@ int cpu_supports_armv7_neon_vfpv4(void);
 // AARCH64
 int cpu_supports_armv8_simd(void);
 int cpu_supports_armv8_simd_sve(void);
+int cpu_supports_armv8_pmull(void);
 
 #endif
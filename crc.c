@@ -18,11 +18,13 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "dump1090.h"
+#include "cpu.h"
+#include "crc_tables.h"
 
 #include <assert.h>
 
 // Errorinfo for "no errors"
-static struct errorinfo NO_ERRORS;
+static const struct errorinfo NO_ERRORS;
 
 // Generator polynomial for the Mode S CRC:
 #define MODES_GENERATOR_POLY 0xfff409U
@@ -31,11 +33,333 @@ static struct errorinfo NO_ERRORS;
 // used to speed up CRC calculation.
 static uint32_t crc_table[256];
 
+// Slicing-by-8 tables: crc_slice[j][b] is the CRC contribution of
+// byte b followed by j zero bytes. crc_slice[0] == crc_table.
+static uint32_t crc_slice[8][256];
+
+// Constants for carry-less multiply CRC (see checksum_pclmul):
+//   crc_fold_64 = x^64 mod P
+//   crc_barrett_mu = floor(x^88 / P), less its (implicit) x^64 term
+static uint64_t crc_fold_64;
+static uint64_t crc_barrett_mu;
+
 // Syndrome values for all single-bit errors;
 // used to speed up construction of error-
 // correction tables.
 static uint32_t single_bit_syndrome[112];
 
+// Byte-at-a-time reference implementation
+static uint32_t checksum_bytewise(const uint8_t *message, int bits)
+{
+    uint32_t rem = 0;
+    int i;
+    int n = bits/8;
+
+    assert(bits % 8 == 0);
+    assert(n >= 3);
+
+    for (i = 0; i < n-3; ++i) {
+        rem = (rem << 8) ^ crc_table[message[i] ^ ((rem & 0xff0000) >> 16)];
+        rem = rem & 0xffffff;
+    }
+
+    rem = rem ^ (message[n-3] << 16) ^ (message[n-2] << 8) ^ (message[n-1]);
+    return rem;
+}
+
+// Slicing-by-8: consume 8 (then 4) message bytes per step with
+// independent table lookups, finishing byte-at-a-time
+static uint32_t checksum_sliced(const uint8_t *message, int bits)
+{
+    int n = bits/8;
+    const uint8_t *p = message;
+    const uint8_t *end = message + n - 3;
+    uint32_t rem = 0;
+
+    assert(bits % 8 == 0);
+    assert(n >= 3);
+
+    while (end - p >= 8) {
+        rem = crc_slice[7][p[0] ^ (rem >> 16)] ^
+            crc_slice[6][p[1] ^ ((rem >> 8) & 0xff)] ^
+            crc_slice[5][p[2] ^ (rem & 0xff)] ^
+            crc_slice[4][p[3]] ^
+            crc_slice[3][p[4]] ^
+            crc_slice[2][p[5]] ^
+            crc_slice[1][p[6]] ^
+            crc_slice[0][p[7]];
+        p += 8;
+    }
+
+    if (end - p >= 4) {
+        rem = crc_slice[3][p[0] ^ (rem >> 16)] ^
+            crc_slice[2][p[1] ^ ((rem >> 8) & 0xff)] ^
+            crc_slice[1][p[2] ^ (rem & 0xff)] ^
+            crc_slice[0][p[3]];
+        p += 4;
+    }
+
+    while (p < end) {
+        rem = ((rem << 8) ^ crc_table[*p++ ^ (rem >> 16)]) & 0xffffff;
+    }
+
+    return rem ^ (end[0] << 16) ^ (end[1] << 8) ^ end[2];
+}
+
+// CRC remainder after feeding 4 bytes into a running remainder
+static inline uint32_t crc_step4(uint32_t rem, const uint8_t *p)
+{
+    return crc_slice[3][p[0] ^ (rem >> 16)] ^
+        crc_slice[2][p[1] ^ ((rem >> 8) & 0xff)] ^
+        crc_slice[1][p[2] ^ (rem & 0xff)] ^
+        crc_slice[0][p[3]];
+}
+
+// Batched syndromes using the slicing tables. The 56-bit data field is a
+// prefix of the 112-bit one, so the remainder after the first 4 bytes is
+// shared between both syndromes.
+static void checksum_batch_sliced(const uint8_t *msgs, unsigned count, unsigned short_mask, unsigned long_mask, uint32_t *short_out, uint32_t *long_out)
+{
+    for (unsigned i = 0; i < count; ++i) {
+        const uint8_t *p = msgs + i * MODES_LONG_MSG_BYTES;
+        unsigned bit = 1U << i;
+
+        if (!((short_mask | long_mask) & bit))
+            continue;
+
+        uint32_t rem = crc_step4(0, p);
+        if (short_mask & bit)
+            short_out[i] = rem ^ (p[4] << 16) ^ (p[5] << 8) ^ p[6];
+        if (!(long_mask & bit))
+            continue;
+
+        rem = crc_step4(rem, p + 4);
+        rem = ((rem << 8) ^ crc_table[p[8] ^ (rem >> 16)]) & 0xffffff;
+        rem = ((rem << 8) ^ crc_table[p[9] ^ (rem >> 16)]) & 0xffffff;
+        rem = ((rem << 8) ^ crc_table[p[10] ^ (rem >> 16)]) & 0xffffff;
+        long_out[i] = rem ^ (p[11] << 16) ^ (p[12] << 8) ^ p[13];
+    }
+}
+
+static void checksum_batch_bytewise(const uint8_t *msgs, unsigned count, unsigned short_mask, unsigned long_mask, uint32_t *short_out, uint32_t *long_out)
+{
+    for (unsigned i = 0; i < count; ++i) {
+        if (short_mask & (1U << i))
+            short_out[i] = checksum_bytewise(msgs + i * MODES_LONG_MSG_BYTES, MODES_SHORT_MSG_BITS);
+        if (long_mask & (1U << i))
+            long_out[i] = checksum_bytewise(msgs + i * MODES_LONG_MSG_BYTES, MODES_LONG_MSG_BITS);
+    }
+}
+
+// Load the data part of a message (everything but the trailing 24-bit
+// parity field) as a polynomial of degree < 64 that has the same CRC;
+// returns false if the message is too long for this
+static inline bool checksum_load_folded(const uint8_t *message, int n, uint64_t (*clmul)(uint64_t, uint64_t), uint64_t *out)
+{
+    uint32_t u32;
+    uint64_t u64;
+
+    switch (n) {
+    case MODES_SHORT_MSG_BYTES:
+        // 4 data bytes
+        memcpy(&u32, message, 4);
+        *out = be32toh(u32);
+        return true;
+
+    case MODES_LONG_MSG_BYTES:
+        // 11 data bytes: fold the first 3 down, as A_hi * x^64 == A_hi * (x^64 mod P)
+        memcpy(&u64, message + 3, 8);
+        *out = be64toh(u64) ^ clmul((message[0] << 16) | (message[1] << 8) | message[2], crc_fold_64);
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+// x86_64 only: the 64-bit GPR <-> XMM moves don't exist on 32-bit x86
+#if defined(__x86_64__) && defined(__GNUC__) && defined(ENABLE_CPUFEATURES)
+#define CRC_HAVE_PCLMUL
+#include <immintrin.h>
+
+__attribute__((target("pclmul,sse4.1")))
+static inline uint64_t clmul_lo_pclmul(uint64_t a, uint64_t b)
+{
+    return (uint64_t) _mm_cvtsi128_si64(_mm_clmulepi64_si128(_mm_cvtsi64_si128((long long) a), _mm_cvtsi64_si128((long long) b), 0x00));
+}
+
+__attribute__((target("pclmul,sse4.1")))
+static inline uint64_t clmul_hi_pclmul(uint64_t a, uint64_t b)
+{
+    return (uint64_t) _mm_extract_epi64(_mm_clmulepi64_si128(_mm_cvtsi64_si128((long long) a), _mm_cvtsi64_si128((long long) b), 0x00), 1);
+}
+
+// Carry-less multiply with Barrett reduction. For a data polynomial A
+// (degree < 64), the CRC is A * x^24 mod P, which is the low 24 bits of
+// q * P where q = floor(A * floor(x^88 / P) / x^64).
+__attribute__((target("pclmul,sse4.1")))
+static uint32_t checksum_pclmul(const uint8_t *message, int bits)
+{
+    int n = bits / 8;
+    uint64_t a;
+
+    if (!checksum_load_folded(message, n, clmul_lo_pclmul, &a))
+        return checksum_sliced(message, bits);
+
+    uint64_t q = clmul_hi_pclmul(a, crc_barrett_mu) ^ a;
+    uint32_t rem = clmul_lo_pclmul(q, MODES_GENERATOR_POLY) & 0xffffff;
+
+    const uint8_t *parity = message + n - 3;
+    return rem ^ (parity[0] << 16) ^ (parity[1] << 8) ^ parity[2];
+}
+
+// Batched syndromes. When a candidate needs both, its 56-bit and 112-bit
+// data polynomials share one 128-bit register (one per 64-bit lane) so both
+// Barrett reductions come from the same pair of loads, and the candidates
+// are independent so the multiplies pipeline across them. A candidate that
+// needs only one syndrome gets the single-message path.
+__attribute__((target("pclmul,sse4.1")))
+static void checksum_batch_pclmul(const uint8_t *msgs, unsigned count, unsigned short_mask, unsigned long_mask, uint32_t *short_out, uint32_t *long_out)
+{
+    const __m128i mu = _mm_set_epi64x(0, (long long) crc_barrett_mu);
+    const __m128i fold = _mm_set_epi64x(0, (long long) crc_fold_64);
+    const __m128i poly = _mm_set_epi64x(0, MODES_GENERATOR_POLY);
+
+    for (unsigned i = 0; i < count; ++i) {
+        const uint8_t *p = msgs + i * MODES_LONG_MSG_BYTES;
+        unsigned bit = 1U << i;
+        uint32_t u32;
+        uint64_t u64;
+
+        if (!(short_mask & long_mask & bit)) {
+            if (short_mask & bit)
+                short_out[i] = checksum_pclmul(p, MODES_SHORT_MSG_BITS);
+            if (long_mask & bit)
+                long_out[i] = checksum_pclmul(p, MODES_LONG_MSG_BITS);
+            continue;
+        }
+
+        memcpy(&u32, p, 4);
+        memcpy(&u64, p + 3, 8);
+        __m128i head = _mm_cvtsi32_si128((p[0] << 16) | (p[1] << 8) | p[2]);
+
+        // lane 0: 56-bit data field; lane 1: 112-bit data field
+        __m128i a = _mm_set_epi64x((long long) be64toh(u64), (long long) be32toh(u32));
+        a = _mm_xor_si128(a, _mm_slli_si128(_mm_clmulepi64_si128(head, fold, 0x00), 8));
+
+        __m128i q_short = _mm_clmulepi64_si128(a, mu, 0x00);
+        __m128i q_long = _mm_clmulepi64_si128(a, mu, 0x01);
+        __m128i q = _mm_xor_si128(_mm_unpackhi_epi64(q_short, q_long), a);
+
+        uint32_t rem_short = (uint32_t) _mm_cvtsi128_si32(_mm_clmulepi64_si128(q, poly, 0x00)) & 0xffffff;
+        uint32_t rem_long = (uint32_t) _mm_cvtsi128_si32(_mm_clmulepi64_si128(q, poly, 0x01)) & 0xffffff;
+
+        short_out[i] = rem_short ^ (p[4] << 16) ^ (p[5] << 8) ^ p[6];
+        long_out[i] = rem_long ^ (p[11] << 16) ^ (p[12] << 8) ^ p[13];
+    }
+}
+#endif
+
+#if defined(__aarch64__) && (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES)) && defined(ENABLE_CPUFEATURES)
+#define CRC_HAVE_PMULL
+#include <arm_neon.h>
+
+static inline uint64_t clmul_lo_pmull(uint64_t a, uint64_t b)
+{
+    return vgetq_lane_u64(vreinterpretq_u64_p128(vmull_p64((poly64_t) a, (poly64_t) b)), 0);
+}
+
+static inline uint64_t clmul_hi_pmull(uint64_t a, uint64_t b)
+{
+    return vgetq_lane_u64(vreinterpretq_u64_p128(vmull_p64((poly64_t) a, (poly64_t) b)), 1);
+}
+
+// As checksum_pclmul, using the ARMv8 polynomial multiply instructions
+static uint32_t checksum_pmull(const uint8_t *message, int bits)
+{
+    int n = bits / 8;
+    uint64_t a;
+
+    if (!checksum_load_folded(message, n, clmul_lo_pmull, &a))
+        return checksum_sliced(message, bits);
+
+    uint64_t q = clmul_hi_pmull(a, crc_barrett_mu) ^ a;
+    uint32_t rem = clmul_lo_pmull(q, MODES_GENERATOR_POLY) & 0xffffff;
+
+    const uint8_t *parity = message + n - 3;
+    return rem ^ (parity[0] << 16) ^ (parity[1] << 8) ^ parity[2];
+}
+
+// As checksum_batch_pclmul. The 56-bit and 112-bit data polynomials of a
+// candidate sit in the two lanes of one vector, so each Barrett step is a
+// vmull_p64 / vmull_high_p64 pair on independent data.
+static void checksum_batch_pmull(const uint8_t *msgs, unsigned count, unsigned short_mask, unsigned long_mask, uint32_t *short_out, uint32_t *long_out)
+{
+    const poly64x2_t mu = vreinterpretq_p64_u64(vdupq_n_u64(crc_barrett_mu));
+    const poly64x2_t poly = vreinterpretq_p64_u64(vdupq_n_u64(MODES_GENERATOR_POLY));
+
+    for (unsigned i = 0; i < count; ++i) {
+        const uint8_t *p = msgs + i * MODES_LONG_MSG_BYTES;
+        unsigned bit = 1U << i;
+        uint32_t u32;
+        uint64_t u64;
+
+        if (!(short_mask & long_mask & bit)) {
+            if (short_mask & bit)
+                short_out[i] = checksum_pmull(p, MODES_SHORT_MSG_BITS);
+            if (long_mask & bit)
+                long_out[i] = checksum_pmull(p, MODES_LONG_MSG_BITS);
+            continue;
+        }
+
+        memcpy(&u32, p, 4);
+        memcpy(&u64, p + 3, 8);
+        uint64_t head = (p[0] << 16) | (p[1] << 8) | p[2];
+
+        // lane 0: 56-bit data field; lane 1: 112-bit data field
+        uint64x2_t a = vcombine_u64(vcreate_u64(be32toh(u32)), vcreate_u64(be64toh(u64) ^ clmul_lo_pmull(head, crc_fold_64)));
+        poly64x2_t ap = vreinterpretq_p64_u64(a);
+
+        uint64x2_t q_short = vreinterpretq_u64_p128(vmull_p64(vgetq_lane_p64(ap, 0), vgetq_lane_p64(mu, 0)));
+        uint64x2_t q_long = vreinterpretq_u64_p128(vmull_high_p64(ap, mu));
+        poly64x2_t q = vreinterpretq_p64_u64(veorq_u64(vzip2q_u64(q_short, q_long), a));
+
+        uint32_t rem_short = (uint32_t) vgetq_lane_u64(vreinterpretq_u64_p128(vmull_p64(vgetq_lane_p64(q, 0), vgetq_lane_p64(poly, 0))), 0) & 0xffffff;
+        uint32_t rem_long = (uint32_t) vgetq_lane_u64(vreinterpretq_u64_p128(vmull_high_p64(q, poly)), 0) & 0xffffff;
+
+        short_out[i] = rem_short ^ (p[4] << 16) ^ (p[5] << 8) ^ p[6];
+        long_out[i] = rem_long ^ (p[11] << 16) ^ (p[12] << 8) ^ p[13];
+    }
+}
+#endif
+
+typedef uint32_t (*checksum_fn)(const uint8_t *, int);
+typedef void (*checksum_batch_fn)(const uint8_t *, unsigned, unsigned, unsigned, uint32_t *, uint32_t *);
+
+static const struct {
+    const char *name;
+    checksum_fn fn;
+    checksum_batch_fn batch_fn;
+    int (*supported)(void);
+} checksum_engines[] = {
+#ifdef CRC_HAVE_PCLMUL
+    { "pclmul", checksum_pclmul, checksum_batch_pclmul, cpu_supports_pclmul },
+#endif
+#ifdef CRC_HAVE_PMULL
+    { "pmull", checksum_pmull, checksum_batch_pmull, cpu_supports_armv8_pmull },
+#endif
+    { "sliced8", checksum_sliced, checksum_batch_sliced, NULL },
+    { "bytewise", checksum_bytewise, checksum_batch_bytewise, NULL },
+};
+
+#define CHECKSUM_ENGINE_COUNT (sizeof(checksum_engines) / sizeof(checksum_engines[0]))
+
+// Selected implementation; the lookup tables are built with the reference
+// implementation before anything faster is selected
+static checksum_fn checksum_impl = checksum_bytewise;
+static checksum_batch_fn checksum_batch_impl = checksum_batch_bytewise;
+static const char *checksum_impl_name = "bytewise";
+
 static void initLookupTables()
 {
     int i;
@@ -54,38 +378,235 @@ static void initLookupTables()
         crc_table[i] = c & 0x00ffffff;
     }
 
+    for (i = 0; i < 256; ++i) {
+        int j;
+        crc_slice[0][i] = crc_table[i];
+        for (j = 1; j < 8; ++j) {
+            uint32_t prev = crc_slice[j-1][i];
+            crc_slice[j][i] = ((prev << 8) ^ crc_table[prev >> 16]) & 0xffffff;
+        }
+    }
+
+    {
+        // x^64 mod P
+        uint32_t r = 1;
+        for (i = 0; i < 64; ++i) {
+            r <<= 1;
+            if (r & 0x1000000)
+                r ^= 0x1000000 | MODES_GENERATOR_POLY;
+        }
+        crc_fold_64 = r;
+
+        // floor(x^88 / P) by long division; the window holds the
+        // coefficients of x^(k+24) .. x^k of the running remainder
+        uint32_t window = 0x1000000;
+        uint64_t mu = 0;
+        for (i = 64; i >= 0; --i) {
+            if (window & 0x1000000) {
+                if (i < 64)
+                    mu |= (uint64_t)1 << i;
+                window ^= 0x1000000 | MODES_GENERATOR_POLY;
+            }
+            window <<= 1;
+        }
+        crc_barrett_mu = mu;
+    }
+
     memset(msg, 0, sizeof(msg));
     for (i = 0; i < 112; ++i) {
         msg[i/8] ^= 1 << (7 - (i & 7));
-        single_bit_syndrome[i] = modesChecksum(msg, 112);
+        single_bit_syndrome[i] = checksum_bytewise(msg, 112);
         msg[i/8] ^= 1 << (7 - (i & 7));
     }
+
+    // Pick the first engine (in order of preference) that this CPU supports
+    for (i = 0; i < (int) CHECKSUM_ENGINE_COUNT; ++i) {
+        if (!checksum_engines[i].supported || checksum_engines[i].supported()) {
+            checksum_impl = checksum_engines[i].fn;
+            checksum_batch_impl = checksum_engines[i].batch_fn;
+            checksum_impl_name = checksum_engines[i].name;
+            break;
+        }
+    }
 }
 
 uint32_t modesChecksum(const uint8_t *message, int bits)
 {
-    uint32_t rem = 0;
-    int i;
-    int n = bits/8;
-
-    assert(bits % 8 == 0);
-    assert(n >= 3);
+    return checksum_impl(message, bits);
+}
 
-    for (i = 0; i < n-3; ++i) {
-        rem = (rem << 8) ^ crc_table[message[i] ^ ((rem & 0xff0000) >> 16)];
-        rem = rem & 0xffffff;
-    }
+// Compute syndromes for up to 32 candidate messages stored
+// MODES_LONG_MSG_BYTES apart, e.g. the per-phase output of
+// starch_slice_phases_u16: the 56-bit syndrome of each candidate whose bit
+// is set in short_mask, and the 112-bit syndrome of each candidate whose
+// bit is set in long_mask. Other entries are left untouched.
+void modesChecksumBatch(const uint8_t *msgs, unsigned count, unsigned short_mask, unsigned long_mask, uint32_t *short_syndromes, uint32_t *long_syndromes)
+{
+    assert(count <= 32);
+    checksum_batch_impl(msgs, count, short_mask, long_mask, short_syndromes, long_syndromes);
+}
 
-    rem = rem ^ (message[n-3] << 16) ^ (message[n-2] << 8) ^ (message[n-1]);
-    return rem;
+const char *modesChecksumEngine(void)
+{
+    return checksum_impl_name;
 }
 
-static struct errorinfo *bitErrorTable_short;
+static const struct errorinfo *bitErrorTable_short;
 static int bitErrorTableSize_short;
 
-static struct errorinfo *bitErrorTable_long;
+static const struct errorinfo *bitErrorTable_long;
 static int bitErrorTableSize_long;
 
+// Syndrome -> errorinfo lookup.
+//
+// Most syndromes seen in practice come from noise and are not in the
+// error tables at all, so the lookup is dominated by misses. Rather than
+// bsearch() the sorted tables (~13 dependent, scattered probes for the
+// 2-bit long table) each table is indexed by a bucketed cuckoo hash:
+// every syndrome lives in one of two 64-byte buckets, so a lookup -
+// hit or miss - touches at most two cache lines.
+//
+// Memory footprint: buckets are sized for <= 80% load, rounded up to a
+// power of two. With 2-bit correction (3694 long / 1596 short syndromes)
+// that is 1024 + 256 buckets = 80kB, on top of ~63kB of errorinfo
+// entries; with 1-bit correction it is 32 + 16 buckets = 3kB.
+// `crctests <ncorrect> <ndetect>` reports the exact figures.
+//
+// If the hash can't be built (allocation failure, or no cuckoo placement
+// found) modesChecksumDiagnose falls back to bsearch().
+
+#define SYNDROME_BUCKET_SLOTS 8
+#define SYNDROME_HASH_MAX_KICKS 500
+
+struct syndrome_bucket {
+    uint32_t syndrome[SYNDROME_BUCKET_SLOTS];  // 0 = empty slot (syndrome 0 is never stored)
+    uint32_t index[SYNDROME_BUCKET_SLOTS];     // index into the errorinfo table
+};
+
+struct syndrome_hash {
+    struct syndrome_bucket *buckets;
+    unsigned bits;           // log2 of the number of buckets
+    uint32_t mul1, mul2;     // multipliers of the two hash functions
+};
+
+static struct syndrome_hash syndromeHash_short;
+static struct syndrome_hash syndromeHash_long;
+
+static inline unsigned syndromeHash(uint32_t syndrome, uint32_t mul, unsigned bits)
+{
+    return (syndrome * mul) >> (32 - bits);
+}
+
+// Try to place table[index] into h, evicting entries to their alternate
+// bucket as needed. Returns false if no placement was found.
+static bool syndromeHashInsert(struct syndrome_hash *h, const struct errorinfo *table, uint32_t index)
+{
+    uint32_t syndrome = table[index].syndrome;
+    unsigned b = syndromeHash(syndrome, h->mul1, h->bits);
+    int kick;
+
+    for (kick = 0; kick < SYNDROME_HASH_MAX_KICKS; ++kick) {
+        unsigned alt = syndromeHash(syndrome, h->mul2, h->bits);
+        if (alt == b)
+            alt = syndromeHash(syndrome, h->mul1, h->bits);
+
+        for (unsigned pass = 0; pass < 2; ++pass) {
+            struct syndrome_bucket *bucket = &h->buckets[pass ? alt : b];
+            for (unsigned slot = 0; slot < SYNDROME_BUCKET_SLOTS; ++slot) {
+                if (!bucket->syndrome[slot]) {
+                    bucket->syndrome[slot] = syndrome;
+                    bucket->index[slot] = index;
+                    return true;
+                }
+            }
+        }
+
+        // both buckets full: evict a victim from b and move it to its other bucket
+        struct syndrome_bucket *bucket = &h->buckets[b];
+        unsigned slot = kick % SYNDROME_BUCKET_SLOTS;
+        uint32_t victim_syndrome = bucket->syndrome[slot];
+        uint32_t victim_index = bucket->index[slot];
+        bucket->syndrome[slot] = syndrome;
+        bucket->index[slot] = index;
+
+        syndrome = victim_syndrome;
+        index = victim_index;
+        unsigned b1 = syndromeHash(syndrome, h->mul1, h->bits);
+        b = (b1 == b ? syndromeHash(syndrome, h->mul2, h->bits) : b1);
+    }
+
+    return false;
+}
+
+// Build the hash index for a (deduplicated) errorinfo table
+static bool buildSyndromeHash(struct syndrome_hash *h, const struct errorinfo *table, int tablesize)
+{
+    static const uint32_t multipliers[] = {
+        0x9E3779B1U, 0x85EBCA77U, 0xC2B2AE3DU, 0x27D4EB2FU, 0x165667B1U, 0xD3A2646DU, 0xFD7046C5U, 0xB55A4F09U
+    };
+    const unsigned nmul = sizeof(multipliers) / sizeof(multipliers[0]);
+
+    memset(h, 0, sizeof(*h));
+    if (!table || tablesize <= 0)
+        return false;
+
+    // size for <= 80% load
+    unsigned min_buckets = (tablesize * 5 / 4 + SYNDROME_BUCKET_SLOTS - 1) / SYNDROME_BUCKET_SLOTS;
+    h->bits = 1;
+    while ((1U << h->bits) < min_buckets)
+        ++h->bits;
+
+    for (unsigned attempt = 0; attempt < 2 * nmul; ++attempt) {
+        size_t nbuckets = (size_t)1 << h->bits;
+        void *mem;
+        if (posix_memalign(&mem, 64, nbuckets * sizeof(struct syndrome_bucket)) != 0)
+            return false;
+        h->buckets = mem;
+        memset(h->buckets, 0, nbuckets * sizeof(struct syndrome_bucket));
+        h->mul1 = multipliers[attempt % nmul];
+        h->mul2 = multipliers[(attempt + 1) % nmul];
+
+        int i;
+        for (i = 0; i < tablesize; ++i) {
+            if (!syndromeHashInsert(h, table, i))
+                break;
+        }
+
+        if (i == tablesize)
+            return true;
+
+        // try again with the next pair of hash functions, then with more room
+        free(h->buckets);
+        h->buckets = NULL;
+        if (attempt == nmul - 1)
+            ++h->bits;
+    }
+
+    return false;
+}
+
+static void freeSyndromeHash(struct syndrome_hash *h)
+{
+    free(h->buckets);
+    memset(h, 0, sizeof(*h));
+}
+
+static inline const struct errorinfo *lookupSyndromeHash(const struct syndrome_hash *h, const struct errorinfo *table, uint32_t syndrome)
+{
+    const struct syndrome_bucket *b1 = &h->buckets[syndromeHash(syndrome, h->mul1, h->bits)];
+    const struct syndrome_bucket *b2 = &h->buckets[syndromeHash(syndrome, h->mul2, h->bits)];
+
+    for (unsigned slot = 0; slot < SYNDROME_BUCKET_SLOTS; ++slot) {
+        if (b1->syndrome[slot] == syndrome)
+            return &table[b1->index[slot]];
+    }
+    for (unsigned slot = 0; slot < SYNDROME_BUCKET_SLOTS; ++slot) {
+        if (b2->syndrome[slot] == syndrome)
+            return &table[b2->index[slot]];
+    }
+    return NULL;
+}
+
 // compare two errorinfo structures
 static int syndrome_compare(const void *x, const void *y) {
     struct errorinfo *ex = (struct errorinfo*)x;
@@ -131,7 +652,7 @@ static int prepareSubtable(struct errorinfo *table, int n, int maxsize, int offs
 {
     int i = 0;
 
-    if (error_bit >= max_errors)
+    if (error_bit >= max_errors || error_bit >= MODES_MAX_BITERRORS)
         return n;
 
     for (i = startbit; i < endbit; ++i) {
@@ -351,11 +872,57 @@ static struct errorinfo *prepareErrorTable(int bits, int max_correct, int max_de
     return table;
 }
 
+// Find the build-time table for a given configuration, if there is one
+static const struct errorinfo *findPrecomputedErrorTable(int bits, int max_correct, int max_detect, int *size_out)
+{
+#ifdef CRCGEN
+    // The table generator is linked without crc_tables.o, so that it can
+    // still be built when crc_tables.c is stale or doesn't compile
+    MODES_NOTUSED(bits);
+    MODES_NOTUSED(max_correct);
+    MODES_NOTUSED(max_detect);
+    MODES_NOTUSED(size_out);
+    return NULL;
+#else
+    for (unsigned i = 0; i < modesPrecomputedErrorTableCount; ++i) {
+        const struct precomputed_error_table *p = &modesPrecomputedErrorTables[i];
+        if (p->bits == bits && p->max_correct == max_correct && p->max_detect == max_detect) {
+            *size_out = p->size;
+            return p->table;
+        }
+    }
+
+    return NULL;
+#endif
+}
+
+// Use the build-time syndrome table for this configuration if available,
+// else compute it now (this can take a while on slow hardware)
+static const struct errorinfo *loadErrorTable(int bits, int max_correct, int max_detect, int *size_out)
+{
+    const struct errorinfo *table;
+
+#ifndef CRCDEBUG
+    if ((table = findPrecomputedErrorTable(bits, max_correct, max_detect, size_out)))
+        return table;
+#endif
+
+    if (max_correct > 1)
+        fprintf(stderr, "Preparing error correction tables.. ");
+    table = prepareErrorTable(bits, max_correct, max_detect, size_out);
+    if (max_correct > 1)
+        fprintf(stderr, "done.\n");
+    return table;
+}
+
 // Precompute syndrome tables for 56- and 112-bit messages.
 void modesChecksumInit(int fixBits)
 {
     initLookupTables();
 
+    freeSyndromeHash(&syndromeHash_short);
+    freeSyndromeHash(&syndromeHash_long);
+
     switch (fixBits) {
     case 0:
         bitErrorTable_short = bitErrorTable_long = NULL;
@@ -365,28 +932,30 @@ void modesChecksumInit(int fixBits)
     case 1:
         // For 1 bit correction, we have 100% coverage up to 4 bit detection, so don't bother
         // with flagging collisions there.
-        bitErrorTable_short = prepareErrorTable(MODES_SHORT_MSG_BITS, 1, 1, &bitErrorTableSize_short);
-        bitErrorTable_long = prepareErrorTable(MODES_LONG_MSG_BITS, 1, 1, &bitErrorTableSize_long);
+        bitErrorTable_short = loadErrorTable(MODES_SHORT_MSG_BITS, 1, 1, &bitErrorTableSize_short);
+        bitErrorTable_long = loadErrorTable(MODES_LONG_MSG_BITS, 1, 1, &bitErrorTableSize_long);
         break;
 
     default:
         // Detect out to 4 bit errors; this reduces our 2-bit coverage to about 65%.
-        // This can take a little while - tell the user.
-        fprintf(stderr, "Preparing error correction tables.. ");
-        bitErrorTable_short = prepareErrorTable(MODES_SHORT_MSG_BITS, 2, 4, &bitErrorTableSize_short);
-        bitErrorTable_long = prepareErrorTable(MODES_LONG_MSG_BITS, 2, 4, &bitErrorTableSize_long);
-        fprintf(stderr, "done.\n");
+        bitErrorTable_short = loadErrorTable(MODES_SHORT_MSG_BITS, 2, 4, &bitErrorTableSize_short);
+        bitErrorTable_long = loadErrorTable(MODES_LONG_MSG_BITS, 2, 4, &bitErrorTableSize_long);
         break;
     }
+
+    // failure here is not fatal, modesChecksumDiagnose falls back to bsearch
+    buildSyndromeHash(&syndromeHash_short, bitErrorTable_short, bitErrorTableSize_short);
+    buildSyndromeHash(&syndromeHash_long, bitErrorTable_long, bitErrorTableSize_long);
 }
 
 // Given an error syndrome and message length, return
 // an error-correction descriptor, or NULL if the
 // syndrome is uncorrectable
-struct errorinfo *modesChecksumDiagnose(uint32_t syndrome, int bitlen)
+const struct errorinfo *modesChecksumDiagnose(uint32_t syndrome, int bitlen)
 {
-    struct errorinfo *table;
+    const struct errorinfo *table;
     int tablesize;
+    const struct syndrome_hash *hash;
 
     struct errorinfo ei;
 
@@ -394,19 +963,22 @@ struct errorinfo *modesChecksumDiagnose(uint32_t syndrome, int bitlen)
         return &NO_ERRORS;
 
     assert (bitlen == 56 || bitlen == 112);
-    if (bitlen == 56) { table = bitErrorTable_short; tablesize = bitErrorTableSize_short; }
-    else { table = bitErrorTable_long; tablesize = bitErrorTableSize_long; }
+    if (bitlen == 56) { table = bitErrorTable_short; tablesize = bitErrorTableSize_short; hash = &syndromeHash_short; }
+    else { table = bitErrorTable_long; tablesize = bitErrorTableSize_long; hash = &syndromeHash_long; }
 
     if (!table)
         return NULL;
 
+    if (hash->buckets)
+        return lookupSyndromeHash(hash, table, syndrome);
+
     ei.syndrome = syndrome;
     return bsearch(&ei, table, tablesize, sizeof(struct errorinfo), syndrome_compare);
 }
 
 // Given a message and an error-correction descriptor,
 // apply the error correction to the given message.
-void modesChecksumFix(uint8_t *msg, struct errorinfo *info)
+void modesChecksumFix(uint8_t *msg, const struct errorinfo *info)
 {
     int i;
 
@@ -418,14 +990,265 @@ void modesChecksumFix(uint8_t *msg, struct errorinfo *info)
 }
 
 #ifdef CRCDEBUG
+#define BENCHMARK_MESSAGES 4096
+#define BENCHMARK_ROUNDS 2000
+
+// Time each available checksum engine on random 56- and 112-bit messages,
+// checking each against the byte-at-a-time reference first
+static int benchmarkChecksum(void)
+{
+    static uint8_t messages[BENCHMARK_MESSAGES][MODES_LONG_MSG_BYTES];
+    int i, bits, errors = 0;
+
+    initLookupTables();
+    srand(12345);
+    for (i = 0; i < BENCHMARK_MESSAGES; ++i) {
+        for (unsigned j = 0; j < MODES_LONG_MSG_BYTES; ++j)
+            messages[i][j] = rand() & 0xff;
+    }
+
+    fprintf(stderr, "default engine: %s\n", modesChecksumEngine());
+
+    for (unsigned e = 0; e < CHECKSUM_ENGINE_COUNT; ++e) {
+        if (checksum_engines[e].supported && !checksum_engines[e].supported()) {
+            fprintf(stderr, "  %-10s not supported on this CPU\n", checksum_engines[e].name);
+            continue;
+        }
+
+        for (bits = MODES_SHORT_MSG_BITS; bits <= MODES_LONG_MSG_BITS; bits += MODES_LONG_MSG_BITS - MODES_SHORT_MSG_BITS) {
+            int mismatches = 0;
+            for (i = 0; i < BENCHMARK_MESSAGES; ++i) {
+                if (checksum_engines[e].fn(messages[i], bits) != checksum_bytewise(messages[i], bits))
+                    ++mismatches;
+            }
+
+            // accumulate results so the calls can't be optimized away
+            volatile uint32_t sink = 0;
+            uint32_t acc = 0;
+            struct timespec start, end;
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            for (int round = 0; round < BENCHMARK_ROUNDS; ++round) {
+                for (i = 0; i < BENCHMARK_MESSAGES; ++i)
+                    acc ^= checksum_engines[e].fn(messages[i], bits);
+            }
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            sink = acc;
+            (void) sink;
+
+            double elapsed_ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+            fprintf(stderr, "  %-10s %3d bits: %6.2f ns/message%s\n",
+                    checksum_engines[e].name, bits,
+                    elapsed_ns / ((double) BENCHMARK_ROUNDS * BENCHMARK_MESSAGES),
+                    mismatches ? "  ** MISMATCH **" : "");
+            if (mismatches)
+                errors = 1;
+        }
+
+        // batched scoring of 5 phase candidates (both lengths each); the
+        // check also uses a different pair of masks for every batch, and
+        // entries outside them must be left alone
+        {
+            uint32_t short_syn[5], long_syn[5];
+            int mismatches = 0;
+            for (i = 0; i + 5 <= BENCHMARK_MESSAGES; i += 5) {
+                unsigned short_mask = (i / 5) & 0x1f;
+                unsigned long_mask = ((i / 5) >> 5) & 0x1f;
+                for (int k = 0; k < 5; ++k)
+                    short_syn[k] = long_syn[k] = 0xFFFFFFFF;
+                checksum_engines[e].batch_fn(messages[i], 5, short_mask, long_mask, short_syn, long_syn);
+                for (int k = 0; k < 5; ++k) {
+                    uint32_t short_want = (short_mask & (1U << k)) ? checksum_bytewise(messages[i + k], MODES_SHORT_MSG_BITS) : 0xFFFFFFFF;
+                    uint32_t long_want = (long_mask & (1U << k)) ? checksum_bytewise(messages[i + k], MODES_LONG_MSG_BITS) : 0xFFFFFFFF;
+                    if (short_syn[k] != short_want || long_syn[k] != long_want)
+                        ++mismatches;
+                }
+            }
+
+            volatile uint32_t sink = 0;
+            uint32_t acc = 0;
+            struct timespec start, end;
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            for (int round = 0; round < BENCHMARK_ROUNDS; ++round) {
+                for (i = 0; i + 5 <= BENCHMARK_MESSAGES; i += 5) {
+                    checksum_engines[e].batch_fn(messages[i], 5, 0x1f, 0x1f, short_syn, long_syn);
+                    acc ^= short_syn[0] ^ long_syn[4];
+                }
+            }
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            sink = acc;
+            (void) sink;
+
+            double elapsed_ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+            fprintf(stderr, "  %-10s batch x5: %6.2f ns/batch%s\n",
+                    checksum_engines[e].name,
+                    elapsed_ns / ((double) BENCHMARK_ROUNDS * (BENCHMARK_MESSAGES / 5)),
+                    mismatches ? "  ** MISMATCH **" : "");
+            if (mismatches)
+                errors = 1;
+        }
+    }
+
+    return errors;
+}
+
+// Build the syndrome hash for a table, check that every entry can be
+// found, and compare lookup cost against bsearch on random syndromes
+// (mostly misses, like noise)
+static void checkSyndromeHash(const char *name, struct syndrome_hash *h, const struct errorinfo *table, int tablesize)
+{
+    if (!buildSyndromeHash(h, table, tablesize)) {
+        fprintf(stderr, "%s: failed to build syndrome hash\n", name);
+        return;
+    }
+
+    size_t hash_bytes = ((size_t)1 << h->bits) * sizeof(struct syndrome_bucket);
+    fprintf(stderr, "%s: %d syndromes, %zu bytes of errorinfo, %u hash buckets (%zu bytes, %.0f%% load)\n",
+            name, tablesize, tablesize * sizeof(struct errorinfo), 1U << h->bits, hash_bytes,
+            100.0 * tablesize / ((1U << h->bits) * SYNDROME_BUCKET_SLOTS));
+
+    for (int i = 0; i < tablesize; ++i) {
+        if (lookupSyndromeHash(h, table, table[i].syndrome) != &table[i])
+            fprintf(stderr, "PROBLEM: %s syndrome %06x not found in hash\n", name, table[i].syndrome);
+    }
+
+    enum { NLOOKUPS = 1 << 20 };
+    static uint32_t syndromes[NLOOKUPS];
+    srand(54321);
+    for (int i = 0; i < NLOOKUPS; ++i)
+        syndromes[i] = ((rand() << 12) ^ rand()) & 0xffffff;
+
+    struct timespec start, end;
+    uintptr_t hash_acc = 0, bsearch_acc = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int i = 0; i < NLOOKUPS; ++i)
+        hash_acc += (uintptr_t) lookupSyndromeHash(h, table, syndromes[i] ? syndromes[i] : 1);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double hash_ns = ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) / NLOOKUPS;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int i = 0; i < NLOOKUPS; ++i) {
+        struct errorinfo ei;
+        ei.syndrome = syndromes[i] ? syndromes[i] : 1;
+        bsearch_acc += (uintptr_t) bsearch(&ei, table, tablesize, sizeof(struct errorinfo), syndrome_compare);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double bsearch_ns = ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) / NLOOKUPS;
+
+    fprintf(stderr, "%s: lookup %.1f ns (hash) vs %.1f ns (bsearch)%s\n",
+            name, hash_ns, bsearch_ns, hash_acc != bsearch_acc ? "  ** MISMATCH **" : "");
+}
+
+// The syndrome table configurations used by modesChecksumInit
+static const struct {
+    int max_correct;
+    int max_detect;
+} table_configs[] = {
+    { 1, 1 },
+    { 2, 4 },
+};
+
+#define TABLE_CONFIG_COUNT (sizeof(table_configs) / sizeof(table_configs[0]))
+
+// Write the C source for crc_tables.c to stdout
+static int generateErrorTables(void)
+{
+    static const int lengths[2] = { MODES_SHORT_MSG_BITS, MODES_LONG_MSG_BITS };
+
+    initLookupTables();
+
+    printf("/* Generated by `make crctables` (crctests --generate). Do not edit. */\n");
+    printf("\n");
+    printf("#include \"crc.h\"\n");
+    printf("#include \"crc_tables.h\"\n");
+
+    for (unsigned c = 0; c < TABLE_CONFIG_COUNT; ++c) {
+        for (unsigned l = 0; l < 2; ++l) {
+            int size;
+            struct errorinfo *table = prepareErrorTable(lengths[l], table_configs[c].max_correct, table_configs[c].max_detect, &size);
+
+            printf("\nstatic const struct errorinfo table_%d_%d_%d[%d] = {\n", lengths[l], table_configs[c].max_correct, table_configs[c].max_detect, size);
+            for (int i = 0; i < size; ++i) {
+                printf("    { 0x%06X, %d, {", table[i].syndrome, table[i].errors);
+                for (int j = 0; j < MODES_MAX_BITERRORS; ++j)
+                    printf(" %d%s", table[i].bit[j], j + 1 < MODES_MAX_BITERRORS ? "," : " ");
+                printf("} },\n");
+            }
+            printf("};\n");
+            free(table);
+        }
+    }
+
+    printf("\nconst struct precomputed_error_table modesPrecomputedErrorTables[] = {\n");
+    for (unsigned c = 0; c < TABLE_CONFIG_COUNT; ++c) {
+        for (unsigned l = 0; l < 2; ++l) {
+            printf("    { %d, %d, %d, table_%d_%d_%d, sizeof(table_%d_%d_%d) / sizeof(struct errorinfo) },\n",
+                   lengths[l], table_configs[c].max_correct, table_configs[c].max_detect,
+                   lengths[l], table_configs[c].max_correct, table_configs[c].max_detect,
+                   lengths[l], table_configs[c].max_correct, table_configs[c].max_detect);
+        }
+    }
+    printf("};\n");
+    printf("\nconst unsigned modesPrecomputedErrorTableCount = sizeof(modesPrecomputedErrorTables) / sizeof(modesPrecomputedErrorTables[0]);\n");
+
+    return 0;
+}
+
+// Check that the build-time tables match what prepareErrorTable computes now
+static int checkPrecomputedTables(void)
+{
+    static const int lengths[2] = { MODES_SHORT_MSG_BITS, MODES_LONG_MSG_BITS };
+    int errors = 0;
+
+    initLookupTables();
+
+    for (unsigned c = 0; c < TABLE_CONFIG_COUNT; ++c) {
+        for (unsigned l = 0; l < 2; ++l) {
+            int size, precomputed_size = 0;
+            struct errorinfo *table = prepareErrorTable(lengths[l], table_configs[c].max_correct, table_configs[c].max_detect, &size);
+            const struct errorinfo *precomputed = findPrecomputedErrorTable(lengths[l], table_configs[c].max_correct, table_configs[c].max_detect, &precomputed_size);
+
+            bool match = (precomputed && precomputed_size == size);
+            for (int i = 0; match && i < size; ++i) {
+                match = (precomputed[i].syndrome == table[i].syndrome &&
+                         precomputed[i].errors == table[i].errors &&
+                         !memcmp(precomputed[i].bit, table[i].bit, sizeof(table[i].bit)));
+            }
+
+            if (!match) {
+                printf("PROBLEM: precomputed table for %d bits, %d/%d errors is stale; run `make crctables`\n",
+                        lengths[l], table_configs[c].max_correct, table_configs[c].max_detect);
+                errors = 1;
+            }
+            free(table);
+        }
+    }
+
+    if (!errors)
+        printf("precomputed error correction tables are up to date\n");
+    return errors;
+}
+
 int main(int argc, char **argv)
 {
     int shortlen, longlen;
     int i;
     struct errorinfo *shorttable, *longtable;
 
+    if (argc == 2 && !strcmp(argv[1], "--benchmark"))
+        return benchmarkChecksum();
+
+    if (argc == 2 && !strcmp(argv[1], "--generate"))
+        return generateErrorTables();
+
+    if (argc == 2 && !strcmp(argv[1], "--check-tables"))
+        return checkPrecomputedTables();
+
     if (argc < 3) {
         fprintf(stderr, "syntax: crctests <ncorrect> <ndetect>\n");
+        fprintf(stderr, "        crctests --benchmark\n");
+        fprintf(stderr, "        crctests --generate > crc_tables.c\n");
+        fprintf(stderr, "        crctests --check-tables\n");
         return 1;
     }
 
@@ -433,6 +1256,9 @@ int main(int argc, char **argv)
     shorttable = prepareErrorTable(MODES_SHORT_MSG_BITS, atoi(argv[1]), atoi(argv[2]), &shortlen);
     longtable = prepareErrorTable(MODES_LONG_MSG_BITS, atoi(argv[1]), atoi(argv[2]), &longlen);
 
+    checkSyndromeHash("short", &syndromeHash_short, shorttable, shortlen);
+    checkSyndromeHash("long", &syndromeHash_long, longtable, longlen);
+
     // check for DF11 correction syndromes where there is a syndrome with lower 7 bits all zero
     // (which would be used for DF11 error correction), but there's also a syndrome which has
     // the same upper 17 bits but nonzero lower 7 bits.
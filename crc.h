@@ -33,7 +33,9 @@ struct errorinfo {
 
 void modesChecksumInit(int fixBits);
 uint32_t modesChecksum(const uint8_t *msg, int bitlen);
-struct errorinfo *modesChecksumDiagnose(uint32_t syndrome, int bitlen);
-void modesChecksumFix(uint8_t *msg, struct errorinfo *info);
+void modesChecksumBatch(const uint8_t *msgs, unsigned count, unsigned short_mask, unsigned long_mask, uint32_t *short_syndromes, uint32_t *long_syndromes);
+const char *modesChecksumEngine(void);
+const struct errorinfo *modesChecksumDiagnose(uint32_t syndrome, int bitlen);
+void modesChecksumFix(uint8_t *msg, const struct errorinfo *info);
 
 #endif
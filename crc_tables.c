@@ -0,0 +1,5483 @@
+/* Generated by `make crctables` (crctests --generate). Do not edit. */
+
+#include "crc.h"
+#include "crc_tables.h"
+
+static const struct errorinfo table_56_1_1[56] = {
+    { 0x000001, 1, { 55, -1 } },
+    { 0x000002, 1, { 54, -1 } },
+    { 0x000004, 1, { 53, -1 } },
+    { 0x000008, 1, { 52, -1 } },
+    { 0x000010, 1, { 51, -1 } },
+    { 0x000020, 1, { 50, -1 } },
+    { 0x000040, 1, { 49, -1 } },
+    { 0x000080, 1, { 48, -1 } },
+    { 0x000100, 1, { 47, -1 } },
+    { 0x000200, 1, { 46, -1 } },
+    { 0x000400, 1, { 45, -1 } },
+    { 0x000800, 1, { 44, -1 } },
+    { 0x001000, 1, { 43, -1 } },
+    { 0x001C1B, 1, { 30, -1 } },
+    { 0x002000, 1, { 42, -1 } },
+    { 0x003836, 1, { 29, -1 } },
+    { 0x004000, 1, { 41, -1 } },
+    { 0x00706C, 1, { 28, -1 } },
+    { 0x008000, 1, { 40, -1 } },
+    { 0x00E0D8, 1, { 27, -1 } },
+    { 0x010000, 1, { 39, -1 } },
+    { 0x018567, 1, { 0, -1 } },
+    { 0x01C1B0, 1, { 26, -1 } },
+    { 0x020000, 1, { 38, -1 } },
+    { 0x038360, 1, { 25, -1 } },
+    { 0x040000, 1, { 37, -1 } },
+    { 0x0706C0, 1, { 24, -1 } },
+    { 0x080000, 1, { 36, -1 } },
+    { 0x0DD441, 1, { 15, -1 } },
+    { 0x0E0D80, 1, { 23, -1 } },
+    { 0x100000, 1, { 35, -1 } },
+    { 0x1BA882, 1, { 14, -1 } },
+    { 0x1C1B00, 1, { 22, -1 } },
+    { 0x200000, 1, { 34, -1 } },
+    { 0x2BFD53, 1, { 7, -1 } },
+    { 0x375104, 1, { 13, -1 } },
+    { 0x383600, 1, { 21, -1 } },
+    { 0x3E4409, 1, { 18, -1 } },
+    { 0x400000, 1, { 33, -1 } },
+    { 0x457C29, 1, { 10, -1 } },
+    { 0x57FAA6, 1, { 6, -1 } },
+    { 0x6EA208, 1, { 12, -1 } },
+    { 0x706C00, 1, { 20, -1 } },
+    { 0x7C8812, 1, { 17, -1 } },
+    { 0x800000, 1, { 32, -1 } },
+    { 0x80665F, 1, { 2, -1 } },
+    { 0x8AF852, 1, { 9, -1 } },
+    { 0xA01E91, 1, { 4, -1 } },
+    { 0xAFF54C, 1, { 5, -1 } },
+    { 0xBFC92B, 1, { 3, -1 } },
+    { 0xDD4410, 1, { 11, -1 } },
+    { 0xE0D800, 1, { 19, -1 } },
+    { 0xEA04AD, 1, { 8, -1 } },
+    { 0xF91024, 1, { 16, -1 } },
+    { 0xFF38B7, 1, { 1, -1 } },
+    { 0xFFF409, 1, { 31, -1 } },
+};
+
+static const struct errorinfo table_112_1_1[112] = {
+    { 0x000001, 1, { 111, -1 } },
+    { 0x000002, 1, { 110, -1 } },
+    { 0x000004, 1, { 109, -1 } },
+    { 0x000008, 1, { 108, -1 } },
+    { 0x000010, 1, { 107, -1 } },
+    { 0x000020, 1, { 106, -1 } },
+    { 0x000040, 1, { 105, -1 } },
+    { 0x000080, 1, { 104, -1 } },
+    { 0x000100, 1, { 103, -1 } },
+    { 0x000200, 1, { 102, -1 } },
+    { 0x000400, 1, { 101, -1 } },
+    { 0x000800, 1, { 100, -1 } },
+    { 0x001000, 1, { 99, -1 } },
+    { 0x001C1B, 1, { 86, -1 } },
+    { 0x002000, 1, { 98, -1 } },
+    { 0x003836, 1, { 85, -1 } },
+    { 0x004000, 1, { 97, -1 } },
+    { 0x00706C, 1, { 84, -1 } },
+    { 0x008000, 1, { 96, -1 } },
+    { 0x00E0D8, 1, { 83, -1 } },
+    { 0x010000, 1, { 95, -1 } },
+    { 0x018567, 1, { 56, -1 } },
+    { 0x01C1B0, 1, { 82, -1 } },
+    { 0x020000, 1, { 94, -1 } },
+    { 0x030ACE, 1, { 55, -1 } },
+    { 0x038360, 1, { 81, -1 } },
+    { 0x040000, 1, { 93, -1 } },
+    { 0x049C81, 1, { 29, -1 } },
+    { 0x06159C, 1, { 54, -1 } },
+    { 0x0706C0, 1, { 80, -1 } },
+    { 0x080000, 1, { 92, -1 } },
+    { 0x093902, 1, { 28, -1 } },
+    { 0x0B0E2F, 1, { 10, -1 } },
+    { 0x0C2B38, 1, { 53, -1 } },
+    { 0x0DD441, 1, { 71, -1 } },
+    { 0x0E0D80, 1, { 79, -1 } },
+    { 0x100000, 1, { 91, -1 } },
+    { 0x127204, 1, { 27, -1 } },
+    { 0x15B82D, 1, { 46, -1 } },
+    { 0x161C5E, 1, { 9, -1 } },
+    { 0x185670, 1, { 52, -1 } },
+    { 0x1BA882, 1, { 70, -1 } },
+    { 0x1C1B00, 1, { 78, -1 } },
+    { 0x1C9AF5, 1, { 1, -1 } },
+    { 0x200000, 1, { 90, -1 } },
+    { 0x24E408, 1, { 26, -1 } },
+    { 0x2B705A, 1, { 45, -1 } },
+    { 0x2BFD53, 1, { 63, -1 } },
+    { 0x2C38BC, 1, { 8, -1 } },
+    { 0x30ACE0, 1, { 51, -1 } },
+    { 0x341705, 1, { 17, -1 } },
+    { 0x375104, 1, { 69, -1 } },
+    { 0x381323, 1, { 35, -1 } },
+    { 0x383600, 1, { 77, -1 } },
+    { 0x3935EA, 1, { 0, -1 } },
+    { 0x3E4409, 1, { 74, -1 } },
+    { 0x3F6D11, 1, { 32, -1 } },
+    { 0x400000, 1, { 89, -1 } },
+    { 0x457C29, 1, { 66, -1 } },
+    { 0x4701E7, 1, { 38, -1 } },
+    { 0x49C810, 1, { 25, -1 } },
+    { 0x4E5C9B, 1, { 22, -1 } },
+    { 0x56E0B4, 1, { 44, -1 } },
+    { 0x57FAA6, 1, { 62, -1 } },
+    { 0x587178, 1, { 7, -1 } },
+    { 0x5F4C21, 1, { 14, -1 } },
+    { 0x6159C0, 1, { 50, -1 } },
+    { 0x682E0A, 1, { 16, -1 } },
+    { 0x6EA208, 1, { 68, -1 } },
+    { 0x702646, 1, { 34, -1 } },
+    { 0x706C00, 1, { 76, -1 } },
+    { 0x72F8C3, 1, { 19, -1 } },
+    { 0x78DBBF, 1, { 3, -1 } },
+    { 0x7A9309, 1, { 48, -1 } },
+    { 0x7C8812, 1, { 73, -1 } },
+    { 0x7EDA22, 1, { 31, -1 } },
+    { 0x800000, 1, { 88, -1 } },
+    { 0x80665F, 1, { 58, -1 } },
+    { 0x82C48D, 1, { 12, -1 } },
+    { 0x8AF852, 1, { 65, -1 } },
+    { 0x8E03CE, 1, { 37, -1 } },
+    { 0x91C77F, 1, { 40, -1 } },
+    { 0x939020, 1, { 24, -1 } },
+    { 0x9CB936, 1, { 21, -1 } },
+    { 0x9E31E9, 1, { 5, -1 } },
+    { 0xA01E91, 1, { 60, -1 } },
+    { 0xA476D9, 1, { 42, -1 } },
+    { 0xADC168, 1, { 43, -1 } },
+    { 0xAFF54C, 1, { 61, -1 } },
+    { 0xB0E2F0, 1, { 6, -1 } },
+    { 0xB719BB, 1, { 41, -1 } },
+    { 0xBE9842, 1, { 13, -1 } },
+    { 0xBFC92B, 1, { 59, -1 } },
+    { 0xC2B380, 1, { 49, -1 } },
+    { 0xC397DB, 1, { 4, -1 } },
+    { 0xC68665, 1, { 20, -1 } },
+    { 0xD05C14, 1, { 15, -1 } },
+    { 0xD8D449, 1, { 23, -1 } },
+    { 0xDC7AF7, 1, { 39, -1 } },
+    { 0xDD4410, 1, { 67, -1 } },
+    { 0xE04C8C, 1, { 33, -1 } },
+    { 0xE0D800, 1, { 75, -1 } },
+    { 0xE3F395, 1, { 36, -1 } },
+    { 0xE5F186, 1, { 18, -1 } },
+    { 0xEA04AD, 1, { 64, -1 } },
+    { 0xF1B77E, 1, { 2, -1 } },
+    { 0xF52612, 1, { 47, -1 } },
+    { 0xF91024, 1, { 72, -1 } },
+    { 0xFA7D13, 1, { 11, -1 } },
+    { 0xFDB444, 1, { 30, -1 } },
+    { 0xFF38B7, 1, { 57, -1 } },
+    { 0xFFF409, 1, { 87, -1 } },
+};
+
+static const struct errorinfo table_56_2_4[1596] = {
+    { 0x000001, 1, { 55, -1 } },
+    { 0x000002, 1, { 54, -1 } },
+    { 0x000003, 2, { 54, 55 } },
+    { 0x000004, 1, { 53, -1 } },
+    { 0x000005, 2, { 53, 55 } },
+    { 0x000006, 2, { 53, 54 } },
+    { 0x000008, 1, { 52, -1 } },
+    { 0x000009, 2, { 52, 55 } },
+    { 0x00000A, 2, { 52, 54 } },
+    { 0x00000C, 2, { 52, 53 } },
+    { 0x000010, 1, { 51, -1 } },
+    { 0x000011, 2, { 51, 55 } },
+    { 0x000012, 2, { 51, 54 } },
+    { 0x000014, 2, { 51, 53 } },
+    { 0x000018, 2, { 51, 52 } },
+    { 0x000020, 1, { 50, -1 } },
+    { 0x000021, 2, { 50, 55 } },
+    { 0x000022, 2, { 50, 54 } },
+    { 0x000024, 2, { 50, 53 } },
+    { 0x000028, 2, { 50, 52 } },
+    { 0x000030, 2, { 50, 51 } },
+    { 0x000040, 1, { 49, -1 } },
+    { 0x000041, 2, { 49, 55 } },
+    { 0x000042, 2, { 49, 54 } },
+    { 0x000044, 2, { 49, 53 } },
+    { 0x000048, 2, { 49, 52 } },
+    { 0x000050, 2, { 49, 51 } },
+    { 0x000060, 2, { 49, 50 } },
+    { 0x000080, 1, { 48, -1 } },
+    { 0x000081, 2, { 48, 55 } },
+    { 0x000082, 2, { 48, 54 } },
+    { 0x000084, 2, { 48, 53 } },
+    { 0x000088, 2, { 48, 52 } },
+    { 0x000090, 2, { 48, 51 } },
+    { 0x0000A0, 2, { 48, 50 } },
+    { 0x0000C0, 2, { 48, 49 } },
+    { 0x000100, 1, { 47, -1 } },
+    { 0x000101, 2, { 47, 55 } },
+    { 0x000102, 2, { 47, 54 } },
+    { 0x000104, 2, { 47, 53 } },
+    { 0x000108, 2, { 47, 52 } },
+    { 0x000110, 2, { 47, 51 } },
+    { 0x000120, 2, { 47, 50 } },
+    { 0x000140, 2, { 47, 49 } },
+    { 0x000180, 2, { 47, 48 } },
+    { 0x000200, 1, { 46, -1 } },
+    { 0x000201, 2, { 46, 55 } },
+    { 0x000202, 2, { 46, 54 } },
+    { 0x000204, 2, { 46, 53 } },
+    { 0x000208, 2, { 46, 52 } },
+    { 0x000210, 2, { 46, 51 } },
+    { 0x000220, 2, { 46, 50 } },
+    { 0x000240, 2, { 46, 49 } },
+    { 0x000280, 2, { 46, 48 } },
+    { 0x000300, 2, { 46, 47 } },
+    { 0x000400, 1, { 45, -1 } },
+    { 0x000401, 2, { 45, 55 } },
+    { 0x000402, 2, { 45, 54 } },
+    { 0x000404, 2, { 45, 53 } },
+    { 0x000408, 2, { 45, 52 } },
+    { 0x000410, 2, { 45, 51 } },
+    { 0x000420, 2, { 45, 50 } },
+    { 0x000440, 2, { 45, 49 } },
+    { 0x000480, 2, { 45, 48 } },
+    { 0x000500, 2, { 45, 47 } },
+    { 0x000600, 2, { 45, 46 } },
+    { 0x000800, 1, { 44, -1 } },
+    { 0x000801, 2, { 44, 55 } },
+    { 0x000802, 2, { 44, 54 } },
+    { 0x000804, 2, { 44, 53 } },
+    { 0x000808, 2, { 44, 52 } },
+    { 0x000810, 2, { 44, 51 } },
+    { 0x000820, 2, { 44, 50 } },
+    { 0x000840, 2, { 44, 49 } },
+    { 0x000880, 2, { 44, 48 } },
+    { 0x000900, 2, { 44, 47 } },
+    { 0x000A00, 2, { 44, 46 } },
+    { 0x000C00, 2, { 44, 45 } },
+    { 0x000C1B, 2, { 30, 43 } },
+    { 0x001000, 1, { 43, -1 } },
+    { 0x001001, 2, { 43, 55 } },
+    { 0x001002, 2, { 43, 54 } },
+    { 0x001004, 2, { 43, 53 } },
+    { 0x001008, 2, { 43, 52 } },
+    { 0x001010, 2, { 43, 51 } },
+    { 0x001020, 2, { 43, 50 } },
+    { 0x001040, 2, { 43, 49 } },
+    { 0x001080, 2, { 43, 48 } },
+    { 0x001100, 2, { 43, 47 } },
+    { 0x001200, 2, { 43, 46 } },
+    { 0x001400, 2, { 43, 45 } },
+    { 0x00141B, 2, { 30, 44 } },
+    { 0x001800, 2, { 43, 44 } },
+    { 0x00181B, 2, { 30, 45 } },
+    { 0x001836, 2, { 29, 42 } },
+    { 0x001C0B, 2, { 30, 51 } },
+    { 0x001C13, 2, { 30, 52 } },
+    { 0x001C19, 2, { 30, 54 } },
+    { 0x001C1A, 2, { 30, 55 } },
+    { 0x001C1B, 1, { 30, -1 } },
+    { 0x001C1F, 2, { 30, 53 } },
+    { 0x001C3B, 2, { 30, 50 } },
+    { 0x001C5B, 2, { 30, 49 } },
+    { 0x001C9B, 2, { 30, 48 } },
+    { 0x001D1B, 2, { 30, 47 } },
+    { 0x001E1B, 2, { 30, 46 } },
+    { 0x002000, 1, { 42, -1 } },
+    { 0x002001, 2, { 42, 55 } },
+    { 0x002002, 2, { 42, 54 } },
+    { 0x002004, 2, { 42, 53 } },
+    { 0x002008, 2, { 42, 52 } },
+    { 0x002010, 2, { 42, 51 } },
+    { 0x002020, 2, { 42, 50 } },
+    { 0x002040, 2, { 42, 49 } },
+    { 0x002080, 2, { 42, 48 } },
+    { 0x002100, 2, { 42, 47 } },
+    { 0x002200, 2, { 42, 46 } },
+    { 0x002400, 2, { 42, 45 } },
+    { 0x00242D, 2, { 29, 30 } },
+    { 0x002800, 2, { 42, 44 } },
+    { 0x002836, 2, { 29, 43 } },
+    { 0x003000, 2, { 42, 43 } },
+    { 0x003036, 2, { 29, 44 } },
+    { 0x00306C, 2, { 28, 41 } },
+    { 0x003816, 2, { 29, 50 } },
+    { 0x003826, 2, { 29, 51 } },
+    { 0x003832, 2, { 29, 53 } },
+    { 0x003834, 2, { 29, 54 } },
+    { 0x003836, 1, { 29, -1 } },
+    { 0x003837, 2, { 29, 55 } },
+    { 0x00383E, 2, { 29, 52 } },
+    { 0x003876, 2, { 29, 49 } },
+    { 0x0038B6, 2, { 29, 48 } },
+    { 0x003936, 2, { 29, 47 } },
+    { 0x003A36, 2, { 29, 46 } },
+    { 0x003C1B, 2, { 30, 42 } },
+    { 0x003C36, 2, { 29, 45 } },
+    { 0x004000, 1, { 41, -1 } },
+    { 0x004001, 2, { 41, 55 } },
+    { 0x004002, 2, { 41, 54 } },
+    { 0x004004, 2, { 41, 53 } },
+    { 0x004008, 2, { 41, 52 } },
+    { 0x004010, 2, { 41, 51 } },
+    { 0x004020, 2, { 41, 50 } },
+    { 0x004040, 2, { 41, 49 } },
+    { 0x004080, 2, { 41, 48 } },
+    { 0x004100, 2, { 41, 47 } },
+    { 0x004200, 2, { 41, 46 } },
+    { 0x004400, 2, { 41, 45 } },
+    { 0x0044D7, 2, { 0, 26 } },
+    { 0x004800, 2, { 41, 44 } },
+    { 0x00485A, 2, { 28, 29 } },
+    { 0x005000, 2, { 41, 43 } },
+    { 0x00506C, 2, { 28, 42 } },
+    { 0x005C1B, 2, { 30, 41 } },
+    { 0x006000, 2, { 41, 42 } },
+    { 0x00606C, 2, { 28, 43 } },
+    { 0x0060D8, 2, { 27, 40 } },
+    { 0x00665F, 2, { 2, 32 } },
+    { 0x006C77, 2, { 28, 30 } },
+    { 0x00702C, 2, { 28, 49 } },
+    { 0x00704C, 2, { 28, 50 } },
+    { 0x007064, 2, { 28, 52 } },
+    { 0x007068, 2, { 28, 53 } },
+    { 0x00706C, 1, { 28, -1 } },
+    { 0x00706D, 2, { 28, 55 } },
+    { 0x00706E, 2, { 28, 54 } },
+    { 0x00707C, 2, { 28, 51 } },
+    { 0x0070EC, 2, { 28, 48 } },
+    { 0x00716C, 2, { 28, 47 } },
+    { 0x00726C, 2, { 28, 46 } },
+    { 0x00746C, 2, { 28, 45 } },
+    { 0x007836, 2, { 29, 41 } },
+    { 0x00786C, 2, { 28, 44 } },
+    { 0x008000, 1, { 40, -1 } },
+    { 0x008001, 2, { 40, 55 } },
+    { 0x008002, 2, { 40, 54 } },
+    { 0x008004, 2, { 40, 53 } },
+    { 0x008008, 2, { 40, 52 } },
+    { 0x008010, 2, { 40, 51 } },
+    { 0x008020, 2, { 40, 50 } },
+    { 0x008040, 2, { 40, 49 } },
+    { 0x008080, 2, { 40, 48 } },
+    { 0x008100, 2, { 40, 47 } },
+    { 0x008200, 2, { 40, 46 } },
+    { 0x008400, 2, { 40, 45 } },
+    { 0x008567, 2, { 0, 39 } },
+    { 0x008800, 2, { 40, 44 } },
+    { 0x009000, 2, { 40, 43 } },
+    { 0x0090B4, 2, { 27, 28 } },
+    { 0x009C1B, 2, { 30, 40 } },
+    { 0x00A000, 2, { 40, 42 } },
+    { 0x00A0D8, 2, { 27, 41 } },
+    { 0x00B836, 2, { 29, 40 } },
+    { 0x00C000, 2, { 40, 41 } },
+    { 0x00C0D8, 2, { 27, 42 } },
+    { 0x00C1B0, 2, { 26, 39 } },
+    { 0x00CCBE, 2, { 1, 31 } },
+    { 0x00D8EE, 2, { 27, 29 } },
+    { 0x00E058, 2, { 27, 48 } },
+    { 0x00E098, 2, { 27, 49 } },
+    { 0x00E0C8, 2, { 27, 51 } },
+    { 0x00E0D0, 2, { 27, 52 } },
+    { 0x00E0D8, 1, { 27, -1 } },
+    { 0x00E0D9, 2, { 27, 55 } },
+    { 0x00E0DA, 2, { 27, 54 } },
+    { 0x00E0DC, 2, { 27, 53 } },
+    { 0x00E0F8, 2, { 27, 50 } },
+    { 0x00E1D8, 2, { 27, 47 } },
+    { 0x00E2D8, 2, { 27, 46 } },
+    { 0x00E4D8, 2, { 27, 45 } },
+    { 0x00E8D8, 2, { 27, 44 } },
+    { 0x00F06C, 2, { 28, 40 } },
+    { 0x00F0D8, 2, { 27, 43 } },
+    { 0x00FCC3, 2, { 27, 30 } },
+    { 0x010000, 1, { 39, -1 } },
+    { 0x010001, 2, { 39, 55 } },
+    { 0x010002, 2, { 39, 54 } },
+    { 0x010004, 2, { 39, 53 } },
+    { 0x010008, 2, { 39, 52 } },
+    { 0x010010, 2, { 39, 51 } },
+    { 0x010020, 2, { 39, 50 } },
+    { 0x010040, 2, { 39, 49 } },
+    { 0x010080, 2, { 39, 48 } },
+    { 0x010100, 2, { 39, 47 } },
+    { 0x010200, 2, { 39, 46 } },
+    { 0x010400, 2, { 39, 45 } },
+    { 0x010567, 2, { 0, 40 } },
+    { 0x010800, 2, { 39, 44 } },
+    { 0x011000, 2, { 39, 43 } },
+    { 0x011C1B, 2, { 30, 39 } },
+    { 0x012000, 2, { 39, 42 } },
+    { 0x012168, 2, { 26, 27 } },
+    { 0x013836, 2, { 29, 39 } },
+    { 0x014000, 2, { 39, 41 } },
+    { 0x0141B0, 2, { 26, 40 } },
+    { 0x0165BF, 2, { 0, 27 } },
+    { 0x01706C, 2, { 28, 39 } },
+    { 0x018000, 2, { 39, 40 } },
+    { 0x018167, 2, { 0, 45 } },
+    { 0x0181B0, 2, { 26, 41 } },
+    { 0x018360, 2, { 25, 38 } },
+    { 0x018467, 2, { 0, 47 } },
+    { 0x018527, 2, { 0, 49 } },
+    { 0x018547, 2, { 0, 50 } },
+    { 0x018563, 2, { 0, 53 } },
+    { 0x018565, 2, { 0, 54 } },
+    { 0x018566, 2, { 0, 55 } },
+    { 0x018567, 1, { 0, -1 } },
+    { 0x01856F, 2, { 0, 52 } },
+    { 0x018577, 2, { 0, 51 } },
+    { 0x0185E7, 2, { 0, 48 } },
+    { 0x018767, 2, { 0, 46 } },
+    { 0x018D67, 2, { 0, 44 } },
+    { 0x019567, 2, { 0, 43 } },
+    { 0x01997C, 2, { 0, 30 } },
+    { 0x01A567, 2, { 0, 42 } },
+    { 0x01B1DC, 2, { 26, 28 } },
+    { 0x01BD51, 2, { 0, 29 } },
+    { 0x01C0B0, 2, { 26, 47 } },
+    { 0x01C130, 2, { 26, 48 } },
+    { 0x01C190, 2, { 26, 50 } },
+    { 0x01C1A0, 2, { 26, 51 } },
+    { 0x01C1B0, 1, { 26, -1 } },
+    { 0x01C1B1, 2, { 26, 55 } },
+    { 0x01C1B2, 2, { 26, 54 } },
+    { 0x01C1B4, 2, { 26, 53 } },
+    { 0x01C1B8, 2, { 26, 52 } },
+    { 0x01C1F0, 2, { 26, 49 } },
+    { 0x01C3B0, 2, { 26, 46 } },
+    { 0x01C567, 2, { 0, 41 } },
+    { 0x01C5B0, 2, { 26, 45 } },
+    { 0x01C9B0, 2, { 26, 44 } },
+    { 0x01D1B0, 2, { 26, 43 } },
+    { 0x01DDAB, 2, { 26, 30 } },
+    { 0x01E0D8, 2, { 27, 39 } },
+    { 0x01E1B0, 2, { 26, 42 } },
+    { 0x01F50B, 2, { 0, 28 } },
+    { 0x01F986, 2, { 26, 29 } },
+    { 0x020000, 1, { 38, -1 } },
+    { 0x020001, 2, { 38, 55 } },
+    { 0x020002, 2, { 38, 54 } },
+    { 0x020004, 2, { 38, 53 } },
+    { 0x020008, 2, { 38, 52 } },
+    { 0x020010, 2, { 38, 51 } },
+    { 0x020020, 2, { 38, 50 } },
+    { 0x020040, 2, { 38, 49 } },
+    { 0x020080, 2, { 38, 48 } },
+    { 0x020100, 2, { 38, 47 } },
+    { 0x020200, 2, { 38, 46 } },
+    { 0x020400, 2, { 38, 45 } },
+    { 0x020607, 2, { 0, 25 } },
+    { 0x020800, 2, { 38, 44 } },
+    { 0x021000, 2, { 38, 43 } },
+    { 0x021C1B, 2, { 30, 38 } },
+    { 0x022000, 2, { 38, 42 } },
+    { 0x023836, 2, { 29, 38 } },
+    { 0x024000, 2, { 38, 41 } },
+    { 0x0242D0, 2, { 25, 26 } },
+    { 0x02706C, 2, { 28, 38 } },
+    { 0x028000, 2, { 38, 40 } },
+    { 0x028360, 2, { 25, 39 } },
+    { 0x02E0D8, 2, { 27, 38 } },
+    { 0x030000, 2, { 38, 39 } },
+    { 0x030360, 2, { 25, 40 } },
+    { 0x0306C0, 2, { 24, 37 } },
+    { 0x0363B8, 2, { 25, 27 } },
+    { 0x038160, 2, { 25, 46 } },
+    { 0x038260, 2, { 25, 47 } },
+    { 0x038320, 2, { 25, 49 } },
+    { 0x038340, 2, { 25, 50 } },
+    { 0x038360, 1, { 25, -1 } },
+    { 0x038361, 2, { 25, 55 } },
+    { 0x038362, 2, { 25, 54 } },
+    { 0x038364, 2, { 25, 53 } },
+    { 0x038368, 2, { 25, 52 } },
+    { 0x038370, 2, { 25, 51 } },
+    { 0x0383E0, 2, { 25, 48 } },
+    { 0x038567, 2, { 0, 38 } },
+    { 0x038760, 2, { 25, 45 } },
+    { 0x038B60, 2, { 25, 44 } },
+    { 0x039360, 2, { 25, 43 } },
+    { 0x039F7B, 2, { 25, 30 } },
+    { 0x03A360, 2, { 25, 42 } },
+    { 0x03BB56, 2, { 25, 29 } },
+    { 0x03C1B0, 2, { 26, 38 } },
+    { 0x03C360, 2, { 25, 41 } },
+    { 0x03D9C1, 2, { 15, 23 } },
+    { 0x03F30C, 2, { 25, 28 } },
+    { 0x040000, 1, { 37, -1 } },
+    { 0x040001, 2, { 37, 55 } },
+    { 0x040002, 2, { 37, 54 } },
+    { 0x040004, 2, { 37, 53 } },
+    { 0x040008, 2, { 37, 52 } },
+    { 0x040010, 2, { 37, 51 } },
+    { 0x040020, 2, { 37, 50 } },
+    { 0x040040, 2, { 37, 49 } },
+    { 0x040080, 2, { 37, 48 } },
+    { 0x040100, 2, { 37, 47 } },
+    { 0x040200, 2, { 37, 46 } },
+    { 0x040400, 2, { 37, 45 } },
+    { 0x040800, 2, { 37, 44 } },
+    { 0x041000, 2, { 37, 43 } },
+    { 0x041C1B, 2, { 30, 37 } },
+    { 0x042000, 2, { 37, 42 } },
+    { 0x043836, 2, { 29, 37 } },
+    { 0x044000, 2, { 37, 41 } },
+    { 0x04706C, 2, { 28, 37 } },
+    { 0x048000, 2, { 37, 40 } },
+    { 0x0485A0, 2, { 24, 25 } },
+    { 0x04E0D8, 2, { 27, 37 } },
+    { 0x050000, 2, { 37, 39 } },
+    { 0x0506C0, 2, { 24, 38 } },
+    { 0x057C29, 2, { 10, 33 } },
+    { 0x058567, 2, { 0, 37 } },
+    { 0x05C1B0, 2, { 26, 37 } },
+    { 0x05D441, 2, { 15, 36 } },
+    { 0x060000, 2, { 37, 38 } },
+    { 0x0606C0, 2, { 24, 39 } },
+    { 0x060D80, 2, { 23, 36 } },
+    { 0x062893, 2, { 1, 16 } },
+    { 0x067209, 2, { 18, 21 } },
+    { 0x0683A7, 2, { 0, 24 } },
+    { 0x06C770, 2, { 24, 26 } },
+    { 0x06E42D, 2, { 16, 31 } },
+    { 0x0702C0, 2, { 24, 45 } },
+    { 0x0704C0, 2, { 24, 46 } },
+    { 0x070640, 2, { 24, 48 } },
+    { 0x070680, 2, { 24, 49 } },
+    { 0x0706C0, 1, { 24, -1 } },
+    { 0x0706C1, 2, { 24, 55 } },
+    { 0x0706C2, 2, { 24, 54 } },
+    { 0x0706C4, 2, { 24, 53 } },
+    { 0x0706C8, 2, { 24, 52 } },
+    { 0x0706D0, 2, { 24, 51 } },
+    { 0x0706E0, 2, { 24, 50 } },
+    { 0x0707C0, 2, { 24, 47 } },
+    { 0x070EC0, 2, { 24, 44 } },
+    { 0x0716C0, 2, { 24, 43 } },
+    { 0x071ADB, 2, { 24, 30 } },
+    { 0x0726C0, 2, { 24, 42 } },
+    { 0x073EF6, 2, { 24, 29 } },
+    { 0x0746C0, 2, { 24, 41 } },
+    { 0x0776AC, 2, { 24, 28 } },
+    { 0x078360, 2, { 25, 37 } },
+    { 0x0786C0, 2, { 24, 40 } },
+    { 0x07B382, 2, { 14, 22 } },
+    { 0x07E618, 2, { 24, 27 } },
+    { 0x080000, 1, { 36, -1 } },
+    { 0x080001, 2, { 36, 55 } },
+    { 0x080002, 2, { 36, 54 } },
+    { 0x080004, 2, { 36, 53 } },
+    { 0x080008, 2, { 36, 52 } },
+    { 0x080010, 2, { 36, 51 } },
+    { 0x080020, 2, { 36, 50 } },
+    { 0x080040, 2, { 36, 49 } },
+    { 0x080080, 2, { 36, 48 } },
+    { 0x080100, 2, { 36, 47 } },
+    { 0x080200, 2, { 36, 46 } },
+    { 0x080400, 2, { 36, 45 } },
+    { 0x080800, 2, { 36, 44 } },
+    { 0x081000, 2, { 36, 43 } },
+    { 0x081C1B, 2, { 30, 36 } },
+    { 0x082000, 2, { 36, 42 } },
+    { 0x083836, 2, { 29, 36 } },
+    { 0x084000, 2, { 36, 41 } },
+    { 0x08706C, 2, { 28, 36 } },
+    { 0x088000, 2, { 36, 40 } },
+    { 0x08E0D8, 2, { 27, 36 } },
+    { 0x090000, 2, { 36, 39 } },
+    { 0x090B40, 2, { 23, 24 } },
+    { 0x09150D, 2, { 13, 18 } },
+    { 0x098567, 2, { 0, 36 } },
+    { 0x09C1B0, 2, { 26, 36 } },
+    { 0x09D441, 2, { 15, 37 } },
+    { 0x0A0000, 2, { 36, 38 } },
+    { 0x0A0D80, 2, { 23, 37 } },
+    { 0x0A9E0D, 2, { 2, 9 } },
+    { 0x0AD281, 2, { 15, 24 } },
+    { 0x0ADCAD, 2, { 8, 19 } },
+    { 0x0AF852, 2, { 9, 32 } },
+    { 0x0B8360, 2, { 25, 36 } },
+    { 0x0BA882, 2, { 14, 35 } },
+    { 0x0BFD53, 2, { 7, 34 } },
+    { 0x0C0000, 2, { 36, 37 } },
+    { 0x0C0D80, 2, { 23, 38 } },
+    { 0x0C15F1, 2, { 15, 26 } },
+    { 0x0C1B00, 2, { 22, 35 } },
+    { 0x0C5126, 2, { 0, 15 } },
+    { 0x0CD441, 2, { 15, 39 } },
+    { 0x0CE412, 2, { 17, 20 } },
+    { 0x0D3499, 2, { 15, 27 } },
+    { 0x0D5441, 2, { 15, 40 } },
+    { 0x0D8EE0, 2, { 23, 25 } },
+    { 0x0D9441, 2, { 15, 41 } },
+    { 0x0DA42D, 2, { 15, 28 } },
+    { 0x0DC441, 2, { 15, 43 } },
+    { 0x0DC85A, 2, { 15, 30 } },
+    { 0x0DD041, 2, { 15, 45 } },
+    { 0x0DD401, 2, { 15, 49 } },
+    { 0x0DD440, 2, { 15, 55 } },
+    { 0x0DD441, 1, { 15, -1 } },
+    { 0x0DD443, 2, { 15, 54 } },
+    { 0x0DD445, 2, { 15, 53 } },
+    { 0x0DD449, 2, { 15, 52 } },
+    { 0x0DD451, 2, { 15, 51 } },
+    { 0x0DD461, 2, { 15, 50 } },
+    { 0x0DD4C1, 2, { 15, 48 } },
+    { 0x0DD541, 2, { 15, 47 } },
+    { 0x0DD641, 2, { 15, 46 } },
+    { 0x0DDC41, 2, { 15, 44 } },
+    { 0x0DEC77, 2, { 15, 29 } },
+    { 0x0DF441, 2, { 15, 42 } },
+    { 0x0E0580, 2, { 23, 44 } },
+    { 0x0E0980, 2, { 23, 45 } },
+    { 0x0E0C80, 2, { 23, 47 } },
+    { 0x0E0D00, 2, { 23, 48 } },
+    { 0x0E0D80, 1, { 23, -1 } },
+    { 0x0E0D81, 2, { 23, 55 } },
+    { 0x0E0D82, 2, { 23, 54 } },
+    { 0x0E0D84, 2, { 23, 53 } },
+    { 0x0E0D88, 2, { 23, 52 } },
+    { 0x0E0D90, 2, { 23, 51 } },
+    { 0x0E0DA0, 2, { 23, 50 } },
+    { 0x0E0DC0, 2, { 23, 49 } },
+    { 0x0E0F80, 2, { 23, 46 } },
+    { 0x0E119B, 2, { 23, 30 } },
+    { 0x0E1D80, 2, { 23, 43 } },
+    { 0x0E2D80, 2, { 23, 42 } },
+    { 0x0E35B6, 2, { 23, 29 } },
+    { 0x0E4D80, 2, { 23, 41 } },
+    { 0x0E5721, 2, { 15, 25 } },
+    { 0x0E7DEC, 2, { 23, 28 } },
+    { 0x0E8D80, 2, { 23, 40 } },
+    { 0x0EED58, 2, { 23, 27 } },
+    { 0x0F06C0, 2, { 24, 36 } },
+    { 0x0F0D80, 2, { 23, 39 } },
+    { 0x0F6704, 2, { 13, 21 } },
+    { 0x0F88E7, 2, { 0, 23 } },
+    { 0x0FCC30, 2, { 23, 26 } },
+    { 0x0FD441, 2, { 15, 38 } },
+    { 0x0FEBDD, 2, { 4, 5 } },
+    { 0x100000, 1, { 35, -1 } },
+    { 0x100001, 2, { 35, 55 } },
+    { 0x100002, 2, { 35, 54 } },
+    { 0x100004, 2, { 35, 53 } },
+    { 0x100008, 2, { 35, 52 } },
+    { 0x100010, 2, { 35, 51 } },
+    { 0x100020, 2, { 35, 50 } },
+    { 0x100040, 2, { 35, 49 } },
+    { 0x100080, 2, { 35, 48 } },
+    { 0x100100, 2, { 35, 47 } },
+    { 0x100200, 2, { 35, 46 } },
+    { 0x100400, 2, { 35, 45 } },
+    { 0x100800, 2, { 35, 44 } },
+    { 0x101000, 2, { 35, 43 } },
+    { 0x101C1B, 2, { 30, 35 } },
+    { 0x102000, 2, { 35, 42 } },
+    { 0x103836, 2, { 29, 35 } },
+    { 0x103C67, 2, { 3, 5 } },
+    { 0x104000, 2, { 35, 41 } },
+    { 0x10706C, 2, { 28, 35 } },
+    { 0x108000, 2, { 35, 40 } },
+    { 0x10E0D8, 2, { 27, 35 } },
+    { 0x110000, 2, { 35, 39 } },
+    { 0x118567, 2, { 0, 35 } },
+    { 0x11C1B0, 2, { 26, 35 } },
+    { 0x11CF41, 2, { 15, 22 } },
+    { 0x120000, 2, { 35, 38 } },
+    { 0x121680, 2, { 22, 23 } },
+    { 0x122A1A, 2, { 12, 17 } },
+    { 0x12868F, 2, { 6, 10 } },
+    { 0x131489, 2, { 8, 16 } },
+    { 0x138360, 2, { 25, 35 } },
+    { 0x13A882, 2, { 14, 36 } },
+    { 0x13CB53, 2, { 7, 21 } },
+    { 0x140000, 2, { 35, 37 } },
+    { 0x141B00, 2, { 22, 36 } },
+    { 0x153C1A, 2, { 1, 8 } },
+    { 0x15A502, 2, { 14, 23 } },
+    { 0x15B95A, 2, { 7, 18 } },
+    { 0x15F0A4, 2, { 8, 31 } },
+    { 0x167CC3, 2, { 14, 15 } },
+    { 0x1706C0, 2, { 24, 35 } },
+    { 0x175104, 2, { 13, 34 } },
+    { 0x17FAA6, 2, { 6, 33 } },
+    { 0x180000, 2, { 35, 36 } },
+    { 0x181B00, 2, { 22, 37 } },
+    { 0x182BE2, 2, { 14, 25 } },
+    { 0x183600, 2, { 21, 34 } },
+    { 0x19A882, 2, { 14, 38 } },
+    { 0x19C824, 2, { 16, 19 } },
+    { 0x1A2DE5, 2, { 0, 14 } },
+    { 0x1A6932, 2, { 14, 26 } },
+    { 0x1AA882, 2, { 14, 39 } },
+    { 0x1B1DC0, 2, { 22, 24 } },
+    { 0x1B2882, 2, { 14, 40 } },
+    { 0x1B485A, 2, { 14, 27 } },
+    { 0x1B8882, 2, { 14, 42 } },
+    { 0x1B90B4, 2, { 14, 29 } },
+    { 0x1BA082, 2, { 14, 44 } },
+    { 0x1BA802, 2, { 14, 48 } },
+    { 0x1BA880, 2, { 14, 54 } },
+    { 0x1BA882, 1, { 14, -1 } },
+    { 0x1BA883, 2, { 14, 55 } },
+    { 0x1BA886, 2, { 14, 53 } },
+    { 0x1BA88A, 2, { 14, 52 } },
+    { 0x1BA892, 2, { 14, 51 } },
+    { 0x1BA8A2, 2, { 14, 50 } },
+    { 0x1BA8C2, 2, { 14, 49 } },
+    { 0x1BA982, 2, { 14, 47 } },
+    { 0x1BAA82, 2, { 14, 46 } },
+    { 0x1BAC82, 2, { 14, 45 } },
+    { 0x1BB499, 2, { 14, 30 } },
+    { 0x1BB882, 2, { 14, 43 } },
+    { 0x1BD8EE, 2, { 14, 28 } },
+    { 0x1BE882, 2, { 14, 41 } },
+    { 0x1C071B, 2, { 22, 30 } },
+    { 0x1C0B00, 2, { 22, 43 } },
+    { 0x1C1300, 2, { 22, 44 } },
+    { 0x1C1900, 2, { 22, 46 } },
+    { 0x1C1A00, 2, { 22, 47 } },
+    { 0x1C1B00, 1, { 22, -1 } },
+    { 0x1C1B01, 2, { 22, 55 } },
+    { 0x1C1B02, 2, { 22, 54 } },
+    { 0x1C1B04, 2, { 22, 53 } },
+    { 0x1C1B08, 2, { 22, 52 } },
+    { 0x1C1B10, 2, { 22, 51 } },
+    { 0x1C1B20, 2, { 22, 50 } },
+    { 0x1C1B40, 2, { 22, 49 } },
+    { 0x1C1B80, 2, { 22, 48 } },
+    { 0x1C1F00, 2, { 22, 45 } },
+    { 0x1C2336, 2, { 22, 29 } },
+    { 0x1C3B00, 2, { 22, 42 } },
+    { 0x1C5B00, 2, { 22, 41 } },
+    { 0x1C6B6C, 2, { 22, 28 } },
+    { 0x1C9B00, 2, { 22, 40 } },
+    { 0x1CAC57, 2, { 7, 13 } },
+    { 0x1CAE42, 2, { 14, 24 } },
+    { 0x1CFBD8, 2, { 22, 27 } },
+    { 0x1D1B00, 2, { 22, 39 } },
+    { 0x1D9E67, 2, { 0, 22 } },
+    { 0x1DD441, 2, { 15, 35 } },
+    { 0x1DDAB0, 2, { 22, 26 } },
+    { 0x1E0D80, 2, { 23, 35 } },
+    { 0x1E1B00, 2, { 22, 38 } },
+    { 0x1E4409, 2, { 18, 34 } },
+    { 0x1ECE08, 2, { 12, 20 } },
+    { 0x1F2C09, 2, { 19, 31 } },
+    { 0x1F9860, 2, { 22, 25 } },
+    { 0x1FA882, 2, { 14, 37 } },
+    { 0x1FD7BA, 2, { 3, 4 } },
+    { 0x1FE0B7, 2, { 1, 19 } },
+    { 0x200000, 1, { 34, -1 } },
+    { 0x200001, 2, { 34, 55 } },
+    { 0x200002, 2, { 34, 54 } },
+    { 0x200004, 2, { 34, 53 } },
+    { 0x200008, 2, { 34, 52 } },
+    { 0x200010, 2, { 34, 51 } },
+    { 0x200020, 2, { 34, 50 } },
+    { 0x200040, 2, { 34, 49 } },
+    { 0x200080, 2, { 34, 48 } },
+    { 0x200100, 2, { 34, 47 } },
+    { 0x200200, 2, { 34, 46 } },
+    { 0x200400, 2, { 34, 45 } },
+    { 0x200800, 2, { 34, 44 } },
+    { 0x201000, 2, { 34, 43 } },
+    { 0x201C1B, 2, { 30, 34 } },
+    { 0x201E91, 2, { 4, 32 } },
+    { 0x202000, 2, { 34, 42 } },
+    { 0x203836, 2, { 29, 34 } },
+    { 0x204000, 2, { 34, 41 } },
+    { 0x20706C, 2, { 28, 34 } },
+    { 0x2078CE, 2, { 2, 4 } },
+    { 0x208000, 2, { 34, 40 } },
+    { 0x20E0D8, 2, { 27, 34 } },
+    { 0x210000, 2, { 34, 39 } },
+    { 0x218567, 2, { 0, 34 } },
+    { 0x21C1B0, 2, { 26, 34 } },
+    { 0x220000, 2, { 34, 38 } },
+    { 0x225F09, 2, { 18, 22 } },
+    { 0x227CA7, 2, { 1, 11 } },
+    { 0x22B019, 2, { 11, 31 } },
+    { 0x238360, 2, { 25, 34 } },
+    { 0x239E82, 2, { 14, 21 } },
+    { 0x23FD53, 2, { 7, 36 } },
+    { 0x240000, 2, { 34, 37 } },
+    { 0x242D00, 2, { 21, 22 } },
+    { 0x245434, 2, { 11, 16 } },
+    { 0x250D1E, 2, { 5, 9 } },
+    { 0x25EC8B, 2, { 14, 18 } },
+    { 0x25F0D3, 2, { 7, 23 } },
+    { 0x262912, 2, { 7, 15 } },
+    { 0x2706C0, 2, { 24, 34 } },
+    { 0x275104, 2, { 13, 35 } },
+    { 0x2796A6, 2, { 6, 20 } },
+    { 0x280000, 2, { 34, 36 } },
+    { 0x283600, 2, { 21, 35 } },
+    { 0x287E33, 2, { 7, 25 } },
+    { 0x29FD53, 2, { 7, 38 } },
+    { 0x2A3CE3, 2, { 7, 26 } },
+    { 0x2A7834, 2, { 0, 7 } },
+    { 0x2AE6C3, 2, { 4, 9 } },
+    { 0x2AFD53, 2, { 7, 39 } },
+    { 0x2B1D8B, 2, { 7, 27 } },
+    { 0x2B4A04, 2, { 13, 22 } },
+    { 0x2B72B4, 2, { 6, 17 } },
+    { 0x2B7D53, 2, { 7, 40 } },
+    { 0x2B8D3F, 2, { 7, 28 } },
+    { 0x2BBD53, 2, { 7, 41 } },
+    { 0x2BC565, 2, { 7, 29 } },
+    { 0x2BDD53, 2, { 7, 42 } },
+    { 0x2BDE21, 2, { 10, 12 } },
+    { 0x2BE148, 2, { 7, 30 } },
+    { 0x2BED53, 2, { 7, 43 } },
+    { 0x2BF553, 2, { 7, 44 } },
+    { 0x2BF953, 2, { 7, 45 } },
+    { 0x2BFC53, 2, { 7, 47 } },
+    { 0x2BFD13, 2, { 7, 49 } },
+    { 0x2BFD43, 2, { 7, 51 } },
+    { 0x2BFD51, 2, { 7, 54 } },
+    { 0x2BFD52, 2, { 7, 55 } },
+    { 0x2BFD53, 1, { 7, -1 } },
+    { 0x2BFD57, 2, { 7, 53 } },
+    { 0x2BFD5B, 2, { 7, 52 } },
+    { 0x2BFD73, 2, { 7, 50 } },
+    { 0x2BFDD3, 2, { 7, 48 } },
+    { 0x2BFF53, 2, { 7, 46 } },
+    { 0x2CF986, 2, { 13, 14 } },
+    { 0x2CFB93, 2, { 7, 24 } },
+    { 0x2DD441, 2, { 15, 34 } },
+    { 0x2E0D80, 2, { 23, 34 } },
+    { 0x2E4409, 2, { 18, 35 } },
+    { 0x2EA208, 2, { 12, 33 } },
+    { 0x2F9313, 2, { 2, 5 } },
+    { 0x2FF54C, 2, { 5, 32 } },
+    { 0x2FFD53, 2, { 7, 37 } },
+    { 0x300000, 2, { 34, 35 } },
+    { 0x303600, 2, { 21, 36 } },
+    { 0x304989, 2, { 18, 23 } },
+    { 0x3055D1, 2, { 7, 14 } },
+    { 0x3057C4, 2, { 13, 24 } },
+    { 0x306C00, 2, { 20, 33 } },
+    { 0x335104, 2, { 13, 37 } },
+    { 0x339048, 2, { 15, 18 } },
+    { 0x34D264, 2, { 13, 25 } },
+    { 0x351029, 2, { 10, 20 } },
+    { 0x353179, 2, { 3, 9 } },
+    { 0x355104, 2, { 13, 38 } },
+    { 0x35E241, 2, { 15, 21 } },
+    { 0x363B80, 2, { 21, 23 } },
+    { 0x364409, 2, { 18, 36 } },
+    { 0x365104, 2, { 13, 39 } },
+    { 0x3690B4, 2, { 13, 26 } },
+    { 0x36D463, 2, { 0, 13 } },
+    { 0x371104, 2, { 13, 41 } },
+    { 0x372168, 2, { 13, 28 } },
+    { 0x3740BD, 2, { 8, 11 } },
+    { 0x374104, 2, { 13, 43 } },
+    { 0x374D1F, 2, { 13, 30 } },
+    { 0x375004, 2, { 13, 47 } },
+    { 0x375100, 2, { 13, 53 } },
+    { 0x375104, 1, { 13, -1 } },
+    { 0x375105, 2, { 13, 55 } },
+    { 0x375106, 2, { 13, 54 } },
+    { 0x37510C, 2, { 13, 52 } },
+    { 0x375114, 2, { 13, 51 } },
+    { 0x375124, 2, { 13, 50 } },
+    { 0x375144, 2, { 13, 49 } },
+    { 0x375184, 2, { 13, 48 } },
+    { 0x375304, 2, { 13, 46 } },
+    { 0x375504, 2, { 13, 45 } },
+    { 0x375904, 2, { 13, 44 } },
+    { 0x376932, 2, { 13, 29 } },
+    { 0x377104, 2, { 13, 42 } },
+    { 0x37B1DC, 2, { 13, 27 } },
+    { 0x37D104, 2, { 13, 40 } },
+    { 0x37E653, 2, { 7, 22 } },
+    { 0x380E36, 2, { 21, 29 } },
+    { 0x381600, 2, { 21, 42 } },
+    { 0x382600, 2, { 21, 43 } },
+    { 0x382A1B, 2, { 21, 30 } },
+    { 0x383200, 2, { 21, 45 } },
+    { 0x383400, 2, { 21, 46 } },
+    { 0x383600, 1, { 21, -1 } },
+    { 0x383601, 2, { 21, 55 } },
+    { 0x383602, 2, { 21, 54 } },
+    { 0x383604, 2, { 21, 53 } },
+    { 0x383608, 2, { 21, 52 } },
+    { 0x383610, 2, { 21, 51 } },
+    { 0x383620, 2, { 21, 50 } },
+    { 0x383640, 2, { 21, 49 } },
+    { 0x383680, 2, { 21, 48 } },
+    { 0x383700, 2, { 21, 47 } },
+    { 0x383E00, 2, { 21, 44 } },
+    { 0x38466C, 2, { 21, 28 } },
+    { 0x387600, 2, { 21, 41 } },
+    { 0x38B600, 2, { 21, 40 } },
+    { 0x38D6D8, 2, { 21, 27 } },
+    { 0x393600, 2, { 21, 39 } },
+    { 0x3942C9, 2, { 18, 24 } },
+    { 0x3958AE, 2, { 6, 12 } },
+    { 0x395C84, 2, { 13, 23 } },
+    { 0x39B367, 2, { 0, 21 } },
+    { 0x39F43B, 2, { 10, 17 } },
+    { 0x39F7B0, 2, { 21, 26 } },
+    { 0x3A3600, 2, { 21, 38 } },
+    { 0x3A4409, 2, { 18, 37 } },
+    { 0x3A8545, 2, { 13, 15 } },
+    { 0x3BA882, 2, { 14, 34 } },
+    { 0x3BB560, 2, { 21, 25 } },
+    { 0x3BFD53, 2, { 7, 35 } },
+    { 0x3C1B00, 2, { 22, 34 } },
+    { 0x3C3600, 2, { 21, 37 } },
+    { 0x3C4409, 2, { 18, 38 } },
+    { 0x3C8812, 2, { 17, 33 } },
+    { 0x3D9C10, 2, { 11, 19 } },
+    { 0x3DC769, 2, { 18, 25 } },
+    { 0x3E0409, 2, { 18, 41 } },
+    { 0x3E3465, 2, { 18, 28 } },
+    { 0x3E4009, 2, { 18, 45 } },
+    { 0x3E4401, 2, { 18, 52 } },
+    { 0x3E4408, 2, { 18, 55 } },
+    { 0x3E4409, 1, { 18, -1 } },
+    { 0x3E440B, 2, { 18, 54 } },
+    { 0x3E440D, 2, { 18, 53 } },
+    { 0x3E4419, 2, { 18, 51 } },
+    { 0x3E4429, 2, { 18, 50 } },
+    { 0x3E4449, 2, { 18, 49 } },
+    { 0x3E4489, 2, { 18, 48 } },
+    { 0x3E4509, 2, { 18, 47 } },
+    { 0x3E4609, 2, { 18, 46 } },
+    { 0x3E4C09, 2, { 18, 44 } },
+    { 0x3E5409, 2, { 18, 43 } },
+    { 0x3E5812, 2, { 18, 30 } },
+    { 0x3E6409, 2, { 18, 42 } },
+    { 0x3E7C3F, 2, { 18, 29 } },
+    { 0x3EA4D1, 2, { 18, 27 } },
+    { 0x3EC409, 2, { 18, 40 } },
+    { 0x3F30C0, 2, { 21, 24 } },
+    { 0x3F4409, 2, { 18, 39 } },
+    { 0x3F5104, 2, { 13, 36 } },
+    { 0x3F85B9, 2, { 18, 26 } },
+    { 0x3FAF74, 2, { 2, 3 } },
+    { 0x3FC16E, 2, { 0, 18 } },
+    { 0x3FC92B, 2, { 3, 32 } },
+    { 0x400000, 1, { 33, -1 } },
+    { 0x400001, 2, { 33, 55 } },
+    { 0x400002, 2, { 33, 54 } },
+    { 0x400004, 2, { 33, 53 } },
+    { 0x400008, 2, { 33, 52 } },
+    { 0x400010, 2, { 33, 51 } },
+    { 0x400020, 2, { 33, 50 } },
+    { 0x400040, 2, { 33, 49 } },
+    { 0x400080, 2, { 33, 48 } },
+    { 0x400100, 2, { 33, 47 } },
+    { 0x400200, 2, { 33, 46 } },
+    { 0x400400, 2, { 33, 45 } },
+    { 0x400800, 2, { 33, 44 } },
+    { 0x401000, 2, { 33, 43 } },
+    { 0x401C1B, 2, { 30, 33 } },
+    { 0x402000, 2, { 33, 42 } },
+    { 0x403836, 2, { 29, 33 } },
+    { 0x403D22, 2, { 3, 31 } },
+    { 0x404000, 2, { 33, 41 } },
+    { 0x40706C, 2, { 28, 33 } },
+    { 0x408000, 2, { 33, 40 } },
+    { 0x40C691, 2, { 4, 19 } },
+    { 0x40E0D8, 2, { 27, 33 } },
+    { 0x40F19C, 2, { 1, 3 } },
+    { 0x410000, 2, { 33, 39 } },
+    { 0x417C29, 2, { 10, 37 } },
+    { 0x418567, 2, { 0, 33 } },
+    { 0x41C1B0, 2, { 26, 33 } },
+    { 0x420000, 2, { 33, 38 } },
+    { 0x427AE9, 2, { 10, 24 } },
+    { 0x42CC1B, 2, { 17, 18 } },
+    { 0x438360, 2, { 25, 33 } },
+    { 0x440000, 2, { 33, 37 } },
+    { 0x447C29, 2, { 10, 39 } },
+    { 0x44BD99, 2, { 10, 26 } },
+    { 0x44BE12, 2, { 17, 21 } },
+    { 0x44F94E, 2, { 0, 10 } },
+    { 0x450C45, 2, { 10, 28 } },
+    { 0x453C29, 2, { 10, 41 } },
+    { 0x45441F, 2, { 10, 29 } },
+    { 0x455C29, 2, { 10, 42 } },
+    { 0x455F5B, 2, { 7, 12 } },
+    { 0x456032, 2, { 10, 30 } },
+    { 0x456C29, 2, { 10, 43 } },
+    { 0x457429, 2, { 10, 44 } },
+    { 0x457829, 2, { 10, 45 } },
+    { 0x457C09, 2, { 10, 50 } },
+    { 0x457C21, 2, { 10, 52 } },
+    { 0x457C28, 2, { 10, 55 } },
+    { 0x457C29, 1, { 10, -1 } },
+    { 0x457C2B, 2, { 10, 54 } },
+    { 0x457C2D, 2, { 10, 53 } },
+    { 0x457C39, 2, { 10, 51 } },
+    { 0x457C69, 2, { 10, 49 } },
+    { 0x457CA9, 2, { 10, 48 } },
+    { 0x457D29, 2, { 10, 47 } },
+    { 0x457E29, 2, { 10, 46 } },
+    { 0x459CF1, 2, { 10, 27 } },
+    { 0x45F1E1, 2, { 5, 8 } },
+    { 0x45FC29, 2, { 10, 40 } },
+    { 0x46D90F, 2, { 3, 16 } },
+    { 0x46FF49, 2, { 10, 25 } },
+    { 0x4706C0, 2, { 24, 33 } },
+    { 0x473D04, 2, { 13, 20 } },
+    { 0x477C29, 2, { 10, 38 } },
+    { 0x47FAA6, 2, { 6, 35 } },
+    { 0x480000, 2, { 33, 36 } },
+    { 0x485A00, 2, { 20, 21 } },
+    { 0x48A868, 2, { 10, 15 } },
+    { 0x4A1A3C, 2, { 4, 8 } },
+    { 0x4B71A9, 2, { 10, 23 } },
+    { 0x4BD916, 2, { 13, 17 } },
+    { 0x4BE1A6, 2, { 6, 22 } },
+    { 0x4C5224, 2, { 6, 14 } },
+    { 0x4D7C29, 2, { 10, 36 } },
+    { 0x4DD441, 2, { 15, 33 } },
+    { 0x4E0D80, 2, { 23, 33 } },
+    { 0x4E2809, 2, { 18, 20 } },
+    { 0x4EA208, 2, { 12, 34 } },
+    { 0x4F2D4C, 2, { 5, 19 } },
+    { 0x500000, 2, { 33, 35 } },
+    { 0x500145, 2, { 5, 31 } },
+    { 0x506C00, 2, { 20, 34 } },
+    { 0x50CDFB, 2, { 1, 5 } },
+    { 0x50E601, 2, { 12, 18 } },
+    { 0x50FC66, 2, { 6, 24 } },
+    { 0x53FAA6, 2, { 6, 37 } },
+    { 0x5479C6, 2, { 6, 25 } },
+    { 0x557C29, 2, { 10, 35 } },
+    { 0x55CD86, 2, { 3, 8 } },
+    { 0x55FAA6, 2, { 6, 38 } },
+    { 0x563B16, 2, { 6, 26 } },
+    { 0x567FC1, 2, { 0, 6 } },
+    { 0x569408, 2, { 12, 21 } },
+    { 0x56E568, 2, { 5, 16 } },
+    { 0x56FAA6, 2, { 6, 39 } },
+    { 0x571A7E, 2, { 6, 27 } },
+    { 0x577541, 2, { 7, 17 } },
+    { 0x577AA6, 2, { 6, 40 } },
+    { 0x578ACA, 2, { 6, 28 } },
+    { 0x57BAA6, 2, { 6, 41 } },
+    { 0x57BC42, 2, { 9, 11 } },
+    { 0x57C290, 2, { 6, 29 } },
+    { 0x57DAA6, 2, { 6, 42 } },
+    { 0x57E6BD, 2, { 6, 30 } },
+    { 0x57EAA6, 2, { 6, 43 } },
+    { 0x57F2A6, 2, { 6, 44 } },
+    { 0x57F8A6, 2, { 6, 46 } },
+    { 0x57FA26, 2, { 6, 48 } },
+    { 0x57FA86, 2, { 6, 50 } },
+    { 0x57FAA2, 2, { 6, 53 } },
+    { 0x57FAA4, 2, { 6, 54 } },
+    { 0x57FAA6, 1, { 6, -1 } },
+    { 0x57FAA7, 2, { 6, 55 } },
+    { 0x57FAAE, 2, { 6, 52 } },
+    { 0x57FAB6, 2, { 6, 51 } },
+    { 0x57FAE6, 2, { 6, 49 } },
+    { 0x57FBA6, 2, { 6, 47 } },
+    { 0x57FEA6, 2, { 6, 45 } },
+    { 0x590EB5, 2, { 4, 16 } },
+    { 0x596729, 2, { 10, 22 } },
+    { 0x59F30C, 2, { 12, 13 } },
+    { 0x59F726, 2, { 6, 23 } },
+    { 0x5A2EE7, 2, { 6, 15 } },
+    { 0x5B9153, 2, { 7, 20 } },
+    { 0x5BA882, 2, { 14, 33 } },
+    { 0x5C1B00, 2, { 22, 33 } },
+    { 0x5C8812, 2, { 17, 34 } },
+    { 0x5D224F, 2, { 2, 11 } },
+    { 0x5D4410, 2, { 11, 32 } },
+    { 0x5ED4AB, 2, { 10, 14 } },
+    { 0x5F112B, 2, { 3, 19 } },
+    { 0x5F2626, 2, { 1, 4 } },
+    { 0x5FEA98, 2, { 4, 31 } },
+    { 0x5FFAA6, 2, { 6, 36 } },
+    { 0x600000, 2, { 33, 34 } },
+    { 0x606C00, 2, { 20, 35 } },
+    { 0x609312, 2, { 17, 22 } },
+    { 0x60ABA2, 2, { 6, 13 } },
+    { 0x60AF88, 2, { 12, 23 } },
+    { 0x60BE5F, 2, { 2, 19 } },
+    { 0x60D800, 2, { 19, 32 } },
+    { 0x60FCFF, 2, { 8, 9 } },
+    { 0x628D3B, 2, { 3, 11 } },
+    { 0x637649, 2, { 12, 15 } },
+    { 0x657C29, 2, { 10, 34 } },
+    { 0x66A208, 2, { 12, 36 } },
+    { 0x672090, 2, { 14, 17 } },
+    { 0x69A4C8, 2, { 12, 24 } },
+    { 0x69BEAF, 2, { 6, 18 } },
+    { 0x6A04AD, 2, { 8, 32 } },
+    { 0x6A2052, 2, { 9, 19 } },
+    { 0x6A62F2, 2, { 2, 8 } },
+    { 0x6AA208, 2, { 12, 37 } },
+    { 0x6BC482, 2, { 14, 20 } },
+    { 0x6BFD53, 2, { 7, 33 } },
+    { 0x6C7700, 2, { 20, 22 } },
+    { 0x6C8812, 2, { 17, 35 } },
+    { 0x6CA208, 2, { 12, 38 } },
+    { 0x6D2168, 2, { 12, 25 } },
+    { 0x6E2208, 2, { 12, 40 } },
+    { 0x6E42D0, 2, { 12, 27 } },
+    { 0x6E817A, 2, { 7, 10 } },
+    { 0x6E8208, 2, { 12, 42 } },
+    { 0x6E9A3E, 2, { 12, 29 } },
+    { 0x6EA008, 2, { 12, 46 } },
+    { 0x6EA200, 2, { 12, 52 } },
+    { 0x6EA208, 1, { 12, -1 } },
+    { 0x6EA209, 2, { 12, 55 } },
+    { 0x6EA20A, 2, { 12, 54 } },
+    { 0x6EA20C, 2, { 12, 53 } },
+    { 0x6EA218, 2, { 12, 51 } },
+    { 0x6EA228, 2, { 12, 50 } },
+    { 0x6EA248, 2, { 12, 49 } },
+    { 0x6EA288, 2, { 12, 48 } },
+    { 0x6EA308, 2, { 12, 47 } },
+    { 0x6EA608, 2, { 12, 45 } },
+    { 0x6EAA08, 2, { 12, 44 } },
+    { 0x6EB208, 2, { 12, 43 } },
+    { 0x6EBE13, 2, { 12, 30 } },
+    { 0x6ED264, 2, { 12, 28 } },
+    { 0x6EE208, 2, { 12, 41 } },
+    { 0x6F276F, 2, { 0, 12 } },
+    { 0x6F63B8, 2, { 12, 26 } },
+    { 0x6FA208, 2, { 12, 39 } },
+    { 0x6FCCA6, 2, { 6, 21 } },
+    { 0x701C6C, 2, { 20, 28 } },
+    { 0x702C00, 2, { 20, 41 } },
+    { 0x704C00, 2, { 20, 42 } },
+    { 0x705436, 2, { 20, 29 } },
+    { 0x706400, 2, { 20, 44 } },
+    { 0x706800, 2, { 20, 45 } },
+    { 0x706C00, 1, { 20, -1 } },
+    { 0x706C01, 2, { 20, 55 } },
+    { 0x706C02, 2, { 20, 54 } },
+    { 0x706C04, 2, { 20, 53 } },
+    { 0x706C08, 2, { 20, 52 } },
+    { 0x706C10, 2, { 20, 51 } },
+    { 0x706C20, 2, { 20, 50 } },
+    { 0x706C40, 2, { 20, 49 } },
+    { 0x706C80, 2, { 20, 48 } },
+    { 0x706D00, 2, { 20, 47 } },
+    { 0x706E00, 2, { 20, 46 } },
+    { 0x70701B, 2, { 20, 30 } },
+    { 0x707C00, 2, { 20, 43 } },
+    { 0x708CD8, 2, { 20, 27 } },
+    { 0x70EC00, 2, { 20, 40 } },
+    { 0x715C53, 2, { 15, 17 } },
+    { 0x716C00, 2, { 20, 39 } },
+    { 0x71ADB0, 2, { 20, 26 } },
+    { 0x71E967, 2, { 0, 20 } },
+    { 0x722D2D, 2, { 10, 13 } },
+    { 0x726C00, 2, { 20, 38 } },
+    { 0x728592, 2, { 17, 23 } },
+    { 0x72B15C, 2, { 5, 11 } },
+    { 0x72B908, 2, { 12, 22 } },
+    { 0x73E876, 2, { 9, 16 } },
+    { 0x73EF60, 2, { 20, 25 } },
+    { 0x746C00, 2, { 20, 37 } },
+    { 0x748812, 2, { 17, 36 } },
+    { 0x750A8A, 2, { 12, 14 } },
+    { 0x750C5B, 2, { 9, 31 } },
+    { 0x75C0E5, 2, { 1, 9 } },
+    { 0x775104, 2, { 13, 33 } },
+    { 0x776AC0, 2, { 20, 24 } },
+    { 0x77FAA6, 2, { 6, 34 } },
+    { 0x783600, 2, { 21, 33 } },
+    { 0x786C00, 2, { 20, 36 } },
+    { 0x788812, 2, { 17, 37 } },
+    { 0x791024, 2, { 16, 32 } },
+    { 0x79767B, 2, { 2, 16 } },
+    { 0x7B3820, 2, { 10, 18 } },
+    { 0x7B8ED2, 2, { 17, 24 } },
+    { 0x7C07F5, 2, { 6, 7 } },
+    { 0x7C0812, 2, { 17, 40 } },
+    { 0x7C68CA, 2, { 17, 27 } },
+    { 0x7C8012, 2, { 17, 44 } },
+    { 0x7C8802, 2, { 17, 51 } },
+    { 0x7C8810, 2, { 17, 54 } },
+    { 0x7C8812, 1, { 17, -1 } },
+    { 0x7C8813, 2, { 17, 55 } },
+    { 0x7C8816, 2, { 17, 53 } },
+    { 0x7C881A, 2, { 17, 52 } },
+    { 0x7C8832, 2, { 17, 50 } },
+    { 0x7C8852, 2, { 17, 49 } },
+    { 0x7C8892, 2, { 17, 48 } },
+    { 0x7C8912, 2, { 17, 47 } },
+    { 0x7C8A12, 2, { 17, 46 } },
+    { 0x7C8C12, 2, { 17, 45 } },
+    { 0x7C9409, 2, { 17, 30 } },
+    { 0x7C9812, 2, { 17, 43 } },
+    { 0x7CA812, 2, { 17, 42 } },
+    { 0x7CB024, 2, { 17, 29 } },
+    { 0x7CC812, 2, { 17, 41 } },
+    { 0x7CF87E, 2, { 17, 28 } },
+    { 0x7D0D75, 2, { 0, 17 } },
+    { 0x7D49A2, 2, { 17, 26 } },
+    { 0x7D4A29, 2, { 10, 21 } },
+    { 0x7D5A81, 2, { 4, 11 } },
+    { 0x7D8812, 2, { 17, 39 } },
+    { 0x7DB841, 2, { 15, 20 } },
+    { 0x7E4409, 2, { 18, 33 } },
+    { 0x7E6180, 2, { 20, 23 } },
+    { 0x7E8812, 2, { 17, 38 } },
+    { 0x7EA208, 2, { 12, 35 } },
+    { 0x7F0B72, 2, { 17, 25 } },
+    { 0x7F38B7, 2, { 1, 32 } },
+    { 0x7F5EE8, 2, { 1, 2 } },
+    { 0x7F9256, 2, { 2, 31 } },
+    { 0x7FF409, 2, { 31, 32 } },
+    { 0x800000, 1, { 32, -1 } },
+    { 0x800001, 2, { 32, 55 } },
+    { 0x800002, 2, { 32, 54 } },
+    { 0x800004, 2, { 32, 53 } },
+    { 0x800008, 2, { 32, 52 } },
+    { 0x800010, 2, { 32, 51 } },
+    { 0x800020, 2, { 32, 50 } },
+    { 0x800040, 2, { 32, 49 } },
+    { 0x800080, 2, { 32, 48 } },
+    { 0x800100, 2, { 32, 47 } },
+    { 0x800200, 2, { 32, 46 } },
+    { 0x800400, 2, { 32, 45 } },
+    { 0x800800, 2, { 32, 44 } },
+    { 0x801000, 2, { 32, 43 } },
+    { 0x801633, 2, { 2, 28 } },
+    { 0x801C1B, 2, { 30, 32 } },
+    { 0x801E91, 2, { 4, 34 } },
+    { 0x802000, 2, { 32, 42 } },
+    { 0x80265F, 2, { 2, 41 } },
+    { 0x803836, 2, { 29, 32 } },
+    { 0x804000, 2, { 32, 41 } },
+    { 0x80465F, 2, { 2, 42 } },
+    { 0x805E69, 2, { 2, 29 } },
+    { 0x80625F, 2, { 2, 45 } },
+    { 0x80645F, 2, { 2, 46 } },
+    { 0x80661F, 2, { 2, 49 } },
+    { 0x80664F, 2, { 2, 51 } },
+    { 0x806657, 2, { 2, 52 } },
+    { 0x80665B, 2, { 2, 53 } },
+    { 0x80665D, 2, { 2, 54 } },
+    { 0x80665E, 2, { 2, 55 } },
+    { 0x80665F, 1, { 2, -1 } },
+    { 0x80667F, 2, { 2, 50 } },
+    { 0x8066DF, 2, { 2, 48 } },
+    { 0x80675F, 2, { 2, 47 } },
+    { 0x806E5F, 2, { 2, 44 } },
+    { 0x80706C, 2, { 28, 32 } },
+    { 0x80765F, 2, { 2, 43 } },
+    { 0x807A44, 2, { 2, 30 } },
+    { 0x808000, 2, { 32, 40 } },
+    { 0x808687, 2, { 2, 27 } },
+    { 0x80E0D8, 2, { 27, 32 } },
+    { 0x80E65F, 2, { 2, 40 } },
+    { 0x810000, 2, { 32, 39 } },
+    { 0x81665F, 2, { 2, 39 } },
+    { 0x818567, 2, { 0, 32 } },
+    { 0x818D22, 2, { 3, 18 } },
+    { 0x81A7EF, 2, { 2, 26 } },
+    { 0x81C1B0, 2, { 26, 32 } },
+    { 0x81E338, 2, { 0, 2 } },
+    { 0x820000, 2, { 32, 38 } },
+    { 0x82665F, 2, { 2, 38 } },
+    { 0x82F852, 2, { 9, 36 } },
+    { 0x837C1B, 2, { 17, 31 } },
+    { 0x838360, 2, { 25, 32 } },
+    { 0x83B0A5, 2, { 1, 17 } },
+    { 0x83E53F, 2, { 2, 25 } },
+    { 0x840000, 2, { 32, 37 } },
+    { 0x84081F, 2, { 5, 7 } },
+    { 0x84665F, 2, { 2, 37 } },
+    { 0x84A6A5, 2, { 8, 12 } },
+    { 0x84F5D2, 2, { 9, 23 } },
+    { 0x859836, 2, { 16, 17 } },
+    { 0x8706C0, 2, { 24, 32 } },
+    { 0x872C13, 2, { 9, 15 } },
+    { 0x87609F, 2, { 2, 24 } },
+    { 0x87FF2B, 2, { 3, 21 } },
+    { 0x880000, 2, { 32, 36 } },
+    { 0x88665F, 2, { 2, 36 } },
+    { 0x88982F, 2, { 3, 13 } },
+    { 0x88F852, 2, { 9, 38 } },
+    { 0x897B32, 2, { 9, 25 } },
+    { 0x897C24, 2, { 16, 20 } },
+    { 0x8A188A, 2, { 9, 27 } },
+    { 0x8A7852, 2, { 9, 40 } },
+    { 0x8A883E, 2, { 9, 28 } },
+    { 0x8AB852, 2, { 9, 41 } },
+    { 0x8ABEB6, 2, { 6, 11 } },
+    { 0x8AC064, 2, { 9, 29 } },
+    { 0x8AD852, 2, { 9, 42 } },
+    { 0x8AE449, 2, { 9, 30 } },
+    { 0x8AE852, 2, { 9, 43 } },
+    { 0x8AF052, 2, { 9, 44 } },
+    { 0x8AF812, 2, { 9, 49 } },
+    { 0x8AF842, 2, { 9, 51 } },
+    { 0x8AF850, 2, { 9, 54 } },
+    { 0x8AF852, 1, { 9, -1 } },
+    { 0x8AF853, 2, { 9, 55 } },
+    { 0x8AF856, 2, { 9, 53 } },
+    { 0x8AF85A, 2, { 9, 52 } },
+    { 0x8AF872, 2, { 9, 50 } },
+    { 0x8AF8D2, 2, { 9, 48 } },
+    { 0x8AF952, 2, { 9, 47 } },
+    { 0x8AFA52, 2, { 9, 46 } },
+    { 0x8AFC52, 2, { 9, 45 } },
+    { 0x8B39E2, 2, { 9, 26 } },
+    { 0x8B7D35, 2, { 0, 9 } },
+    { 0x8BE3C2, 2, { 4, 7 } },
+    { 0x8BF852, 2, { 9, 39 } },
+    { 0x8DB21E, 2, { 2, 15 } },
+    { 0x8DD441, 2, { 15, 32 } },
+    { 0x8DFE92, 2, { 9, 24 } },
+    { 0x8E0D80, 2, { 23, 32 } },
+    { 0x8E6BDF, 2, { 2, 23 } },
+    { 0x8E7A08, 2, { 12, 19 } },
+    { 0x8EF852, 2, { 9, 37 } },
+    { 0x8F54B7, 2, { 1, 20 } },
+    { 0x8F9809, 2, { 20, 31 } },
+    { 0x8FF54C, 2, { 5, 34 } },
+    { 0x900000, 2, { 32, 35 } },
+    { 0x90665F, 2, { 2, 35 } },
+    { 0x90B400, 2, { 19, 20 } },
+    { 0x9150D0, 2, { 9, 14 } },
+    { 0x915601, 2, { 12, 31 } },
+    { 0x919ABF, 2, { 1, 12 } },
+    { 0x91B145, 2, { 5, 18 } },
+    { 0x943478, 2, { 3, 7 } },
+    { 0x968CBF, 2, { 8, 17 } },
+    { 0x96E352, 2, { 9, 22 } },
+    { 0x974F95, 2, { 4, 13 } },
+    { 0x97B22C, 2, { 12, 16 } },
+    { 0x97C34C, 2, { 5, 21 } },
+    { 0x982891, 2, { 4, 21 } },
+    { 0x983839, 2, { 10, 11 } },
+    { 0x98A448, 2, { 5, 13 } },
+    { 0x9A68AD, 2, { 8, 20 } },
+    { 0x9AF852, 2, { 9, 35 } },
+    { 0x9BA882, 2, { 14, 32 } },
+    { 0x9BCEDD, 2, { 2, 14 } },
+    { 0x9C1B00, 2, { 22, 32 } },
+    { 0x9C5012, 2, { 17, 19 } },
+    { 0x9C7D5F, 2, { 2, 22 } },
+    { 0x9D4410, 2, { 11, 33 } },
+    { 0x9E5A98, 2, { 4, 18 } },
+    { 0x9FC92B, 2, { 3, 34 } },
+    { 0xA00000, 2, { 32, 34 } },
+    { 0xA0028A, 2, { 4, 30 } },
+    { 0xA00E91, 2, { 4, 43 } },
+    { 0xA01691, 2, { 4, 44 } },
+    { 0xA01A91, 2, { 4, 45 } },
+    { 0xA01C91, 2, { 4, 46 } },
+    { 0xA01E11, 2, { 4, 48 } },
+    { 0xA01E81, 2, { 4, 51 } },
+    { 0xA01E90, 2, { 4, 55 } },
+    { 0xA01E91, 1, { 4, -1 } },
+    { 0xA01E93, 2, { 4, 54 } },
+    { 0xA01E95, 2, { 4, 53 } },
+    { 0xA01E99, 2, { 4, 52 } },
+    { 0xA01EB1, 2, { 4, 50 } },
+    { 0xA01ED1, 2, { 4, 49 } },
+    { 0xA01F91, 2, { 4, 47 } },
+    { 0xA026A7, 2, { 4, 29 } },
+    { 0xA03E91, 2, { 4, 42 } },
+    { 0xA05E91, 2, { 4, 41 } },
+    { 0xA0665F, 2, { 2, 34 } },
+    { 0xA06EFD, 2, { 4, 28 } },
+    { 0xA09E91, 2, { 4, 40 } },
+    { 0xA0D800, 2, { 19, 33 } },
+    { 0xA0FE49, 2, { 4, 27 } },
+    { 0xA10501, 2, { 7, 9 } },
+    { 0xA11E91, 2, { 4, 39 } },
+    { 0xA19BF6, 2, { 0, 4 } },
+    { 0xA1CC02, 2, { 11, 17 } },
+    { 0xA1DF21, 2, { 4, 26 } },
+    { 0xA1F8CC, 2, { 5, 23 } },
+    { 0xA21E91, 2, { 4, 38 } },
+    { 0xA2210D, 2, { 5, 15 } },
+    { 0xA39DF1, 2, { 4, 25 } },
+    { 0xA3D22B, 2, { 3, 22 } },
+    { 0xA41E91, 2, { 4, 37 } },
+    { 0xA461A9, 2, { 3, 14 } },
+    { 0xA5A429, 2, { 10, 19 } },
+    { 0xA71851, 2, { 4, 24 } },
+    { 0xA7F54C, 2, { 5, 36 } },
+    { 0xA80EAF, 2, { 6, 31 } },
+    { 0xA81E91, 2, { 4, 36 } },
+    { 0xA8C211, 2, { 1, 6 } },
+    { 0xA8F38C, 2, { 5, 24 } },
+    { 0xAA04AD, 2, { 8, 33 } },
+    { 0xAAF852, 2, { 9, 34 } },
+    { 0xAB9B0C, 2, { 2, 7 } },
+    { 0xABF54C, 2, { 5, 37 } },
+    { 0xABFD53, 2, { 7, 32 } },
+    { 0xAC762C, 2, { 5, 25 } },
+    { 0xAD2810, 2, { 11, 20 } },
+    { 0xADCAD0, 2, { 4, 15 } },
+    { 0xADF54C, 2, { 5, 38 } },
+    { 0xAE1311, 2, { 4, 23 } },
+    { 0xAE34FC, 2, { 5, 26 } },
+    { 0xAE702B, 2, { 0, 5 } },
+    { 0xAEEA82, 2, { 6, 16 } },
+    { 0xAEF54C, 2, { 5, 39 } },
+    { 0xAF1594, 2, { 5, 27 } },
+    { 0xAF754C, 2, { 5, 40 } },
+    { 0xAF7884, 2, { 8, 10 } },
+    { 0xAF8520, 2, { 5, 28 } },
+    { 0xAFB54C, 2, { 5, 41 } },
+    { 0xAFC92B, 2, { 3, 35 } },
+    { 0xAFCD7A, 2, { 5, 29 } },
+    { 0xAFD54C, 2, { 5, 42 } },
+    { 0xAFE54C, 2, { 5, 43 } },
+    { 0xAFE957, 2, { 5, 30 } },
+    { 0xAFF14C, 2, { 5, 45 } },
+    { 0xAFF44C, 2, { 5, 47 } },
+    { 0xAFF50C, 2, { 5, 49 } },
+    { 0xAFF544, 2, { 5, 52 } },
+    { 0xAFF548, 2, { 5, 53 } },
+    { 0xAFF54C, 1, { 5, -1 } },
+    { 0xAFF54D, 2, { 5, 55 } },
+    { 0xAFF54E, 2, { 5, 54 } },
+    { 0xAFF55C, 2, { 5, 51 } },
+    { 0xAFF56C, 2, { 5, 50 } },
+    { 0xAFF5CC, 2, { 5, 48 } },
+    { 0xAFF74C, 2, { 5, 46 } },
+    { 0xAFFD4C, 2, { 5, 44 } },
+    { 0xB01E91, 2, { 4, 35 } },
+    { 0xB1C4AB, 2, { 3, 23 } },
+    { 0xB21D6A, 2, { 3, 15 } },
+    { 0xB2CE52, 2, { 9, 21 } },
+    { 0xB3E618, 2, { 11, 12 } },
+    { 0xB3EE4C, 2, { 5, 22 } },
+    { 0xB45DCE, 2, { 5, 14 } },
+    { 0xB4BC5B, 2, { 9, 18 } },
+    { 0xB722A6, 2, { 6, 19 } },
+    { 0xB7375B, 2, { 2, 13 } },
+    { 0xB75104, 2, { 13, 32 } },
+    { 0xB7C92B, 2, { 3, 36 } },
+    { 0xB83600, 2, { 21, 32 } },
+    { 0xB8505F, 2, { 2, 21 } },
+    { 0xB8CFEB, 2, { 3, 24 } },
+    { 0xB91024, 2, { 16, 33 } },
+    { 0xBA449E, 2, { 1, 10 } },
+    { 0xBA8820, 2, { 10, 31 } },
+    { 0xBBB613, 2, { 4, 14 } },
+    { 0xBBC92B, 2, { 3, 37 } },
+    { 0xBC0591, 2, { 4, 22 } },
+    { 0xBC4A4B, 2, { 3, 25 } },
+    { 0xBC6C0D, 2, { 10, 16 } },
+    { 0xBDA956, 2, { 9, 13 } },
+    { 0xBDC92B, 2, { 3, 38 } },
+    { 0xBDFE0B, 2, { 6, 8 } },
+    { 0xBE089B, 2, { 3, 26 } },
+    { 0xBE2256, 2, { 2, 18 } },
+    { 0xBE4409, 2, { 18, 32 } },
+    { 0xBE4C4C, 2, { 0, 3 } },
+    { 0xBEC92B, 2, { 3, 39 } },
+    { 0xBF29F3, 2, { 3, 27 } },
+    { 0xBF38B7, 2, { 1, 33 } },
+    { 0xBF492B, 2, { 3, 40 } },
+    { 0xBF892B, 2, { 3, 41 } },
+    { 0xBFB947, 2, { 3, 28 } },
+    { 0xBFC12B, 2, { 3, 44 } },
+    { 0xBFC82B, 2, { 3, 47 } },
+    { 0xBFC90B, 2, { 3, 50 } },
+    { 0xBFC923, 2, { 3, 52 } },
+    { 0xBFC929, 2, { 3, 54 } },
+    { 0xBFC92A, 2, { 3, 55 } },
+    { 0xBFC92B, 1, { 3, -1 } },
+    { 0xBFC92F, 2, { 3, 53 } },
+    { 0xBFC93B, 2, { 3, 51 } },
+    { 0xBFC96B, 2, { 3, 49 } },
+    { 0xBFC9AB, 2, { 3, 48 } },
+    { 0xBFCB2B, 2, { 3, 46 } },
+    { 0xBFCD2B, 2, { 3, 45 } },
+    { 0xBFD530, 2, { 3, 30 } },
+    { 0xBFD92B, 2, { 3, 43 } },
+    { 0xBFE92B, 2, { 3, 42 } },
+    { 0xBFF11D, 2, { 3, 29 } },
+    { 0xBFF409, 2, { 31, 33 } },
+    { 0xBFF54C, 2, { 5, 35 } },
+    { 0xC00000, 2, { 32, 33 } },
+    { 0xC0665F, 2, { 2, 33 } },
+    { 0xC0D800, 2, { 19, 34 } },
+    { 0xC12624, 2, { 16, 21 } },
+    { 0xC15744, 2, { 5, 12 } },
+    { 0xC15F10, 2, { 11, 22 } },
+    { 0xC17CBE, 2, { 1, 18 } },
+    { 0xC1B000, 2, { 18, 31 } },
+    { 0xC1F9FE, 2, { 7, 8 } },
+    { 0xC34139, 2, { 3, 17 } },
+    { 0xC51A76, 2, { 2, 10 } },
+    { 0xC57C29, 2, { 10, 32 } },
+    { 0xC6EC92, 2, { 11, 14 } },
+    { 0xC70EB7, 2, { 1, 21 } },
+    { 0xC7542D, 2, { 16, 18 } },
+    { 0xC7C209, 2, { 21, 31 } },
+    { 0xC869B3, 2, { 1, 13 } },
+    { 0xC8A50D, 2, { 13, 31 } },
+    { 0xCA04AD, 2, { 8, 34 } },
+    { 0xCAF852, 2, { 9, 33 } },
+    { 0xCB2553, 2, { 7, 19 } },
+    { 0xCD4410, 2, { 11, 35 } },
+    { 0xCE4120, 2, { 13, 16 } },
+    { 0xCEBC99, 2, { 4, 12 } },
+    { 0xCF847B, 2, { 9, 10 } },
+    { 0xCFA52B, 2, { 3, 20 } },
+    { 0xD07291, 2, { 4, 20 } },
+    { 0xD09051, 2, { 11, 15 } },
+    { 0xD16B23, 2, { 3, 12 } },
+    { 0xD232AD, 2, { 8, 21 } },
+    { 0xD2ED77, 2, { 7, 16 } },
+    { 0xD34990, 2, { 11, 23 } },
+    { 0xD37D5E, 2, { 5, 17 } },
+    { 0xD4095A, 2, { 7, 31 } },
+    { 0xD440A4, 2, { 8, 18 } },
+    { 0xD4C5E4, 2, { 1, 7 } },
+    { 0xD54410, 2, { 11, 36 } },
+    { 0xD78904, 2, { 13, 19 } },
+    { 0xD79CF9, 2, { 2, 6 } },
+    { 0xD7FAA6, 2, { 6, 32 } },
+    { 0xD8EE00, 2, { 19, 21 } },
+    { 0xD91024, 2, { 16, 34 } },
+    { 0xD94410, 2, { 11, 37 } },
+    { 0xDA42D0, 2, { 11, 24 } },
+    { 0xDC4410, 2, { 11, 39 } },
+    { 0xDC85A0, 2, { 11, 26 } },
+    { 0xDC9683, 2, { 4, 17 } },
+    { 0xDCC177, 2, { 0, 11 } },
+    { 0xDD02F4, 2, { 6, 9 } },
+    { 0xDD0410, 2, { 11, 41 } },
+    { 0xDD347C, 2, { 11, 28 } },
+    { 0xDD4010, 2, { 11, 45 } },
+    { 0xDD4400, 2, { 11, 51 } },
+    { 0xDD4410, 1, { 11, -1 } },
+    { 0xDD4411, 2, { 11, 55 } },
+    { 0xDD4412, 2, { 11, 54 } },
+    { 0xDD4414, 2, { 11, 53 } },
+    { 0xDD4418, 2, { 11, 52 } },
+    { 0xDD4430, 2, { 11, 50 } },
+    { 0xDD4450, 2, { 11, 49 } },
+    { 0xDD4490, 2, { 11, 48 } },
+    { 0xDD4510, 2, { 11, 47 } },
+    { 0xDD4610, 2, { 11, 46 } },
+    { 0xDD4C10, 2, { 11, 44 } },
+    { 0xDD5410, 2, { 11, 43 } },
+    { 0xDD55A9, 2, { 8, 13 } },
+    { 0xDD580B, 2, { 11, 30 } },
+    { 0xDD6410, 2, { 11, 42 } },
+    { 0xDD7C26, 2, { 11, 29 } },
+    { 0xDDA4C8, 2, { 11, 27 } },
+    { 0xDDC410, 2, { 11, 40 } },
+    { 0xDE9C09, 2, { 18, 19 } },
+    { 0xDEC770, 2, { 11, 25 } },
+    { 0xDF38B7, 2, { 1, 34 } },
+    { 0xDF4410, 2, { 11, 38 } },
+    { 0xDF994C, 2, { 5, 20 } },
+    { 0xDFF409, 2, { 31, 34 } },
+    { 0xE01E91, 2, { 4, 33 } },
+    { 0xE038D8, 2, { 19, 27 } },
+    { 0xE05800, 2, { 19, 40 } },
+    { 0xE09800, 2, { 19, 41 } },
+    { 0xE0A86C, 2, { 19, 28 } },
+    { 0xE0C41B, 2, { 19, 30 } },
+    { 0xE0C800, 2, { 19, 43 } },
+    { 0xE0D000, 2, { 19, 44 } },
+    { 0xE0D800, 1, { 19, -1 } },
+    { 0xE0D801, 2, { 19, 55 } },
+    { 0xE0D802, 2, { 19, 54 } },
+    { 0xE0D804, 2, { 19, 53 } },
+    { 0xE0D808, 2, { 19, 52 } },
+    { 0xE0D810, 2, { 19, 51 } },
+    { 0xE0D820, 2, { 19, 50 } },
+    { 0xE0D840, 2, { 19, 49 } },
+    { 0xE0D880, 2, { 19, 48 } },
+    { 0xE0D900, 2, { 19, 47 } },
+    { 0xE0DA00, 2, { 19, 46 } },
+    { 0xE0DC00, 2, { 19, 45 } },
+    { 0xE0E036, 2, { 19, 29 } },
+    { 0xE0F800, 2, { 19, 42 } },
+    { 0xE119B0, 2, { 19, 26 } },
+    { 0xE15D67, 2, { 0, 19 } },
+    { 0xE1D800, 2, { 19, 39 } },
+    { 0xE204AD, 2, { 8, 36 } },
+    { 0xE2B8A6, 2, { 14, 16 } },
+    { 0xE2D800, 2, { 19, 38 } },
+    { 0xE30019, 2, { 11, 18 } },
+    { 0xE323B7, 2, { 1, 22 } },
+    { 0xE35B60, 2, { 19, 25 } },
+    { 0xE3EF09, 2, { 22, 31 } },
+    { 0xE4092D, 2, { 8, 23 } },
+    { 0xE45A5A, 2, { 9, 12 } },
+    { 0xE45C8B, 2, { 14, 31 } },
+    { 0xE49035, 2, { 1, 14 } },
+    { 0xE4D800, 2, { 19, 37 } },
+    { 0xE50B24, 2, { 16, 22 } },
+    { 0xE562B8, 2, { 4, 10 } },
+    { 0xE57210, 2, { 11, 21 } },
+    { 0xE7D0EC, 2, { 8, 15 } },
+    { 0xE7DEC0, 2, { 19, 24 } },
+    { 0xE804AD, 2, { 8, 38 } },
+    { 0xE8338D, 2, { 3, 6 } },
+    { 0xE8D800, 2, { 19, 36 } },
+    { 0xE91024, 2, { 16, 35 } },
+    { 0xE987CD, 2, { 8, 25 } },
+    { 0xEA00AD, 2, { 8, 45 } },
+    { 0xEA042D, 2, { 8, 48 } },
+    { 0xEA048D, 2, { 8, 50 } },
+    { 0xEA04A5, 2, { 8, 52 } },
+    { 0xEA04A9, 2, { 8, 53 } },
+    { 0xEA04AC, 2, { 8, 55 } },
+    { 0xEA04AD, 1, { 8, -1 } },
+    { 0xEA04AF, 2, { 8, 54 } },
+    { 0xEA04BD, 2, { 8, 51 } },
+    { 0xEA04ED, 2, { 8, 49 } },
+    { 0xEA05AD, 2, { 8, 47 } },
+    { 0xEA06AD, 2, { 8, 46 } },
+    { 0xEA0CAD, 2, { 8, 44 } },
+    { 0xEA14AD, 2, { 8, 43 } },
+    { 0xEA1514, 2, { 11, 13 } },
+    { 0xEA18B6, 2, { 8, 30 } },
+    { 0xEA24AD, 2, { 8, 42 } },
+    { 0xEA3C9B, 2, { 8, 29 } },
+    { 0xEA44AD, 2, { 8, 41 } },
+    { 0xEA74C1, 2, { 8, 28 } },
+    { 0xEA84AD, 2, { 8, 40 } },
+    { 0xEA8965, 2, { 5, 10 } },
+    { 0xEAE475, 2, { 8, 27 } },
+    { 0xEB04AD, 2, { 8, 39 } },
+    { 0xEB81CA, 2, { 0, 8 } },
+    { 0xEBC51D, 2, { 8, 26 } },
+    { 0xED026D, 2, { 8, 24 } },
+    { 0xED0C41, 2, { 15, 19 } },
+    { 0xEE04AD, 2, { 8, 37 } },
+    { 0xEEA208, 2, { 12, 32 } },
+    { 0xEEC457, 2, { 2, 12 } },
+    { 0xEED580, 2, { 19, 23 } },
+    { 0xEF38B7, 2, { 1, 35 } },
+    { 0xEFF409, 2, { 31, 35 } },
+    { 0xEFF54C, 2, { 5, 33 } },
+    { 0xF00A5F, 2, { 2, 20 } },
+    { 0xF06C00, 2, { 20, 32 } },
+    { 0xF0D800, 2, { 19, 35 } },
+    { 0xF11024, 2, { 16, 36 } },
+    { 0xF13537, 2, { 1, 23 } },
+    { 0xF1AC2F, 2, { 8, 14 } },
+    { 0xF1F989, 2, { 23, 31 } },
+    { 0xF22048, 2, { 15, 31 } },
+    { 0xF2ECF6, 2, { 1, 15 } },
+    { 0xF4C465, 2, { 15, 16 } },
+    { 0xF61FAD, 2, { 8, 22 } },
+    { 0xF67040, 2, { 9, 17 } },
+    { 0xF6B943, 2, { 7, 11 } },
+    { 0xF71DA4, 2, { 16, 23 } },
+    { 0xF738B7, 2, { 1, 36 } },
+    { 0xF7E437, 2, { 4, 6 } },
+    { 0xF7F409, 2, { 31, 36 } },
+    { 0xF80FEA, 2, { 5, 6 } },
+    { 0xF81024, 2, { 16, 39 } },
+    { 0xF83E77, 2, { 1, 24 } },
+    { 0xF89543, 2, { 0, 16 } },
+    { 0xF8D194, 2, { 16, 26 } },
+    { 0xF8F2C9, 2, { 24, 31 } },
+    { 0xF90024, 2, { 16, 43 } },
+    { 0xF90C3F, 2, { 16, 30 } },
+    { 0xF91004, 2, { 16, 50 } },
+    { 0xF91020, 2, { 16, 53 } },
+    { 0xF91024, 1, { 16, -1 } },
+    { 0xF91025, 2, { 16, 55 } },
+    { 0xF91026, 2, { 16, 54 } },
+    { 0xF9102C, 2, { 16, 52 } },
+    { 0xF91034, 2, { 16, 51 } },
+    { 0xF91064, 2, { 16, 49 } },
+    { 0xF910A4, 2, { 16, 48 } },
+    { 0xF91124, 2, { 16, 47 } },
+    { 0xF91224, 2, { 16, 46 } },
+    { 0xF91424, 2, { 16, 45 } },
+    { 0xF91824, 2, { 16, 44 } },
+    { 0xF92812, 2, { 16, 29 } },
+    { 0xF93024, 2, { 16, 42 } },
+    { 0xF95024, 2, { 16, 41 } },
+    { 0xF96048, 2, { 16, 28 } },
+    { 0xF99024, 2, { 16, 40 } },
+    { 0xF9F0FC, 2, { 16, 27 } },
+    { 0xFA04AD, 2, { 8, 35 } },
+    { 0xFA9344, 2, { 16, 25 } },
+    { 0xFA9452, 2, { 9, 20 } },
+    { 0xFAB502, 2, { 3, 10 } },
+    { 0xFB1024, 2, { 16, 38 } },
+    { 0xFB38B7, 2, { 1, 37 } },
+    { 0xFB7082, 2, { 14, 19 } },
+    { 0xFBF409, 2, { 31, 37 } },
+    { 0xFC7769, 2, { 25, 31 } },
+    { 0xFC8812, 2, { 17, 32 } },
+    { 0xFCBBD7, 2, { 1, 25 } },
+    { 0xFCC300, 2, { 19, 22 } },
+    { 0xFCEE4D, 2, { 2, 17 } },
+    { 0xFD1024, 2, { 16, 37 } },
+    { 0xFD38B7, 2, { 1, 38 } },
+    { 0xFD4410, 2, { 11, 34 } },
+    { 0xFDF409, 2, { 31, 38 } },
+    { 0xFE16E4, 2, { 16, 24 } },
+    { 0xFE35B9, 2, { 26, 31 } },
+    { 0xFE38B7, 2, { 1, 39 } },
+    { 0xFE716E, 2, { 0, 31 } },
+    { 0xFEBDD0, 2, { 0, 1 } },
+    { 0xFEF409, 2, { 31, 39 } },
+    { 0xFEF907, 2, { 1, 26 } },
+    { 0xFF0081, 2, { 1, 29 } },
+    { 0xFF14D1, 2, { 27, 31 } },
+    { 0xFF18B7, 2, { 1, 42 } },
+    { 0xFF24AC, 2, { 1, 30 } },
+    { 0xFF28B7, 2, { 1, 43 } },
+    { 0xFF30B7, 2, { 1, 44 } },
+    { 0xFF3837, 2, { 1, 48 } },
+    { 0xFF3897, 2, { 1, 50 } },
+    { 0xFF38A7, 2, { 1, 51 } },
+    { 0xFF38B3, 2, { 1, 53 } },
+    { 0xFF38B5, 2, { 1, 54 } },
+    { 0xFF38B6, 2, { 1, 55 } },
+    { 0xFF38B7, 1, { 1, -1 } },
+    { 0xFF38BF, 2, { 1, 52 } },
+    { 0xFF38F7, 2, { 1, 49 } },
+    { 0xFF39B7, 2, { 1, 47 } },
+    { 0xFF3AB7, 2, { 1, 46 } },
+    { 0xFF3CB7, 2, { 1, 45 } },
+    { 0xFF48DB, 2, { 1, 28 } },
+    { 0xFF7409, 2, { 31, 40 } },
+    { 0xFF78B7, 2, { 1, 41 } },
+    { 0xFF8465, 2, { 28, 31 } },
+    { 0xFFB409, 2, { 31, 41 } },
+    { 0xFFB8B7, 2, { 1, 40 } },
+    { 0xFFC92B, 2, { 3, 33 } },
+    { 0xFFCC3F, 2, { 29, 31 } },
+    { 0xFFD409, 2, { 31, 42 } },
+    { 0xFFD86F, 2, { 1, 27 } },
+    { 0xFFE409, 2, { 31, 43 } },
+    { 0xFFE812, 2, { 30, 31 } },
+    { 0xFFF009, 2, { 31, 45 } },
+    { 0xFFF401, 2, { 31, 52 } },
+    { 0xFFF408, 2, { 31, 55 } },
+    { 0xFFF409, 1, { 31, -1 } },
+    { 0xFFF40B, 2, { 31, 54 } },
+    { 0xFFF40D, 2, { 31, 53 } },
+    { 0xFFF419, 2, { 31, 51 } },
+    { 0xFFF429, 2, { 31, 50 } },
+    { 0xFFF449, 2, { 31, 49 } },
+    { 0xFFF489, 2, { 31, 48 } },
+    { 0xFFF509, 2, { 31, 47 } },
+    { 0xFFF609, 2, { 31, 46 } },
+    { 0xFFFC09, 2, { 31, 44 } },
+};
+
+static const struct errorinfo table_112_2_4[3694] = {
+    { 0x000001, 1, { 111, -1 } },
+    { 0x000002, 1, { 110, -1 } },
+    { 0x000004, 1, { 109, -1 } },
+    { 0x000005, 2, { 109, 111 } },
+    { 0x000008, 1, { 108, -1 } },
+    { 0x000009, 2, { 108, 111 } },
+    { 0x00000A, 2, { 108, 110 } },
+    { 0x000010, 1, { 107, -1 } },
+    { 0x000011, 2, { 107, 111 } },
+    { 0x000012, 2, { 107, 110 } },
+    { 0x000014, 2, { 107, 109 } },
+    { 0x000020, 1, { 106, -1 } },
+    { 0x000021, 2, { 106, 111 } },
+    { 0x000022, 2, { 106, 110 } },
+    { 0x000024, 2, { 106, 109 } },
+    { 0x000028, 2, { 106, 108 } },
+    { 0x000040, 1, { 105, -1 } },
+    { 0x000041, 2, { 105, 111 } },
+    { 0x000042, 2, { 105, 110 } },
+    { 0x000044, 2, { 105, 109 } },
+    { 0x000048, 2, { 105, 108 } },
+    { 0x000050, 2, { 105, 107 } },
+    { 0x000060, 2, { 105, 106 } },
+    { 0x000080, 1, { 104, -1 } },
+    { 0x000081, 2, { 104, 111 } },
+    { 0x000082, 2, { 104, 110 } },
+    { 0x000084, 2, { 104, 109 } },
+    { 0x000088, 2, { 104, 108 } },
+    { 0x000090, 2, { 104, 107 } },
+    { 0x0000A0, 2, { 104, 106 } },
+    { 0x0000C0, 2, { 104, 105 } },
+    { 0x000100, 1, { 103, -1 } },
+    { 0x000101, 2, { 103, 111 } },
+    { 0x000102, 2, { 103, 110 } },
+    { 0x000104, 2, { 103, 109 } },
+    { 0x000108, 2, { 103, 108 } },
+    { 0x000110, 2, { 103, 107 } },
+    { 0x000120, 2, { 103, 106 } },
+    { 0x000140, 2, { 103, 105 } },
+    { 0x000180, 2, { 103, 104 } },
+    { 0x000200, 1, { 102, -1 } },
+    { 0x000202, 2, { 102, 110 } },
+    { 0x000204, 2, { 102, 109 } },
+    { 0x000208, 2, { 102, 108 } },
+    { 0x000210, 2, { 102, 107 } },
+    { 0x000220, 2, { 102, 106 } },
+    { 0x000240, 2, { 102, 105 } },
+    { 0x000280, 2, { 102, 104 } },
+    { 0x000300, 2, { 102, 103 } },
+    { 0x000400, 1, { 101, -1 } },
+    { 0x000404, 2, { 101, 109 } },
+    { 0x000408, 2, { 101, 108 } },
+    { 0x000410, 2, { 101, 107 } },
+    { 0x000420, 2, { 101, 106 } },
+    { 0x000440, 2, { 101, 105 } },
+    { 0x000480, 2, { 101, 104 } },
+    { 0x000500, 2, { 101, 103 } },
+    { 0x000600, 2, { 101, 102 } },
+    { 0x000800, 1, { 100, -1 } },
+    { 0x000801, 2, { 100, 111 } },
+    { 0x000808, 2, { 100, 108 } },
+    { 0x000810, 2, { 100, 107 } },
+    { 0x000820, 2, { 100, 106 } },
+    { 0x000840, 2, { 100, 105 } },
+    { 0x000880, 2, { 100, 104 } },
+    { 0x000900, 2, { 100, 103 } },
+    { 0x000A00, 2, { 100, 102 } },
+    { 0x000C00, 2, { 100, 101 } },
+    { 0x001000, 1, { 99, -1 } },
+    { 0x001002, 2, { 99, 110 } },
+    { 0x001010, 2, { 99, 107 } },
+    { 0x001020, 2, { 99, 106 } },
+    { 0x001040, 2, { 99, 105 } },
+    { 0x001080, 2, { 99, 104 } },
+    { 0x001100, 2, { 99, 103 } },
+    { 0x001200, 2, { 99, 102 } },
+    { 0x00141B, 2, { 86, 100 } },
+    { 0x001800, 2, { 99, 100 } },
+    { 0x001C13, 2, { 86, 108 } },
+    { 0x001C19, 2, { 86, 110 } },
+    { 0x001C1B, 1, { 86, -1 } },
+    { 0x001C3B, 2, { 86, 106 } },
+    { 0x001C5B, 2, { 86, 105 } },
+    { 0x001C9B, 2, { 86, 104 } },
+    { 0x001D1B, 2, { 86, 103 } },
+    { 0x001E1B, 2, { 86, 102 } },
+    { 0x002000, 1, { 98, -1 } },
+    { 0x002004, 2, { 98, 109 } },
+    { 0x002020, 2, { 98, 106 } },
+    { 0x002040, 2, { 98, 105 } },
+    { 0x002080, 2, { 98, 104 } },
+    { 0x002100, 2, { 98, 103 } },
+    { 0x002200, 2, { 98, 102 } },
+    { 0x002400, 2, { 98, 101 } },
+    { 0x00242D, 2, { 85, 86 } },
+    { 0x002836, 2, { 85, 99 } },
+    { 0x003000, 2, { 98, 99 } },
+    { 0x003826, 2, { 85, 107 } },
+    { 0x003832, 2, { 85, 109 } },
+    { 0x003836, 1, { 85, -1 } },
+    { 0x003837, 2, { 85, 111 } },
+    { 0x003876, 2, { 85, 105 } },
+    { 0x0038B6, 2, { 85, 104 } },
+    { 0x003936, 2, { 85, 103 } },
+    { 0x003A36, 2, { 85, 102 } },
+    { 0x003C1B, 2, { 86, 98 } },
+    { 0x003C36, 2, { 85, 101 } },
+    { 0x004000, 1, { 97, -1 } },
+    { 0x004001, 2, { 97, 111 } },
+    { 0x004008, 2, { 97, 108 } },
+    { 0x004010, 2, { 97, 107 } },
+    { 0x004040, 2, { 97, 105 } },
+    { 0x004080, 2, { 97, 104 } },
+    { 0x004100, 2, { 97, 103 } },
+    { 0x004200, 2, { 97, 102 } },
+    { 0x004400, 2, { 97, 101 } },
+    { 0x0044D7, 2, { 56, 82 } },
+    { 0x004800, 2, { 97, 100 } },
+    { 0x00485A, 2, { 84, 85 } },
+    { 0x00506C, 2, { 84, 98 } },
+    { 0x005C1B, 2, { 86, 97 } },
+    { 0x006000, 2, { 97, 98 } },
+    { 0x006C77, 2, { 84, 86 } },
+    { 0x00704C, 2, { 84, 106 } },
+    { 0x007064, 2, { 84, 108 } },
+    { 0x00706C, 1, { 84, -1 } },
+    { 0x00706D, 2, { 84, 111 } },
+    { 0x00706E, 2, { 84, 110 } },
+    { 0x0070EC, 2, { 84, 104 } },
+    { 0x00716C, 2, { 84, 103 } },
+    { 0x00726C, 2, { 84, 102 } },
+    { 0x00746C, 2, { 84, 101 } },
+    { 0x007836, 2, { 85, 97 } },
+    { 0x00786C, 2, { 84, 100 } },
+    { 0x008000, 1, { 96, -1 } },
+    { 0x008002, 2, { 96, 110 } },
+    { 0x008010, 2, { 96, 107 } },
+    { 0x008020, 2, { 96, 106 } },
+    { 0x008080, 2, { 96, 104 } },
+    { 0x008100, 2, { 96, 103 } },
+    { 0x0081F5, 2, { 1, 78 } },
+    { 0x008200, 2, { 96, 102 } },
+    { 0x008400, 2, { 96, 101 } },
+    { 0x008567, 2, { 56, 95 } },
+    { 0x008800, 2, { 96, 100 } },
+    { 0x0089AE, 2, { 55, 81 } },
+    { 0x008D09, 2, { 45, 63 } },
+    { 0x009000, 2, { 96, 99 } },
+    { 0x0090B4, 2, { 83, 84 } },
+    { 0x009C1B, 2, { 86, 96 } },
+    { 0x00A0D8, 2, { 83, 97 } },
+    { 0x00B836, 2, { 85, 96 } },
+    { 0x00C000, 2, { 96, 97 } },
+    { 0x00D8EE, 2, { 83, 85 } },
+    { 0x00E098, 2, { 83, 105 } },
+    { 0x00E0C8, 2, { 83, 107 } },
+    { 0x00E0D0, 2, { 83, 108 } },
+    { 0x00E0D8, 1, { 83, -1 } },
+    { 0x00E0D9, 2, { 83, 111 } },
+    { 0x00E0DA, 2, { 83, 110 } },
+    { 0x00E0DC, 2, { 83, 109 } },
+    { 0x00E1D8, 2, { 83, 103 } },
+    { 0x00E2D8, 2, { 83, 102 } },
+    { 0x00E4D8, 2, { 83, 101 } },
+    { 0x00E8D8, 2, { 83, 100 } },
+    { 0x00F06C, 2, { 84, 96 } },
+    { 0x00F0D8, 2, { 83, 99 } },
+    { 0x00FCC3, 2, { 83, 86 } },
+    { 0x010000, 1, { 95, -1 } },
+    { 0x010001, 2, { 95, 111 } },
+    { 0x010004, 2, { 95, 109 } },
+    { 0x010010, 2, { 95, 107 } },
+    { 0x010020, 2, { 95, 106 } },
+    { 0x010040, 2, { 95, 105 } },
+    { 0x010100, 2, { 95, 103 } },
+    { 0x010200, 2, { 95, 102 } },
+    { 0x0103EA, 2, { 0, 77 } },
+    { 0x010400, 2, { 95, 101 } },
+    { 0x010567, 2, { 56, 96 } },
+    { 0x010800, 2, { 95, 100 } },
+    { 0x010ACE, 2, { 55, 94 } },
+    { 0x011000, 2, { 95, 99 } },
+    { 0x01135C, 2, { 54, 80 } },
+    { 0x011A12, 2, { 44, 62 } },
+    { 0x012000, 2, { 95, 98 } },
+    { 0x012168, 2, { 82, 83 } },
+    { 0x0126C9, 2, { 0, 35 } },
+    { 0x013836, 2, { 85, 95 } },
+    { 0x013EE7, 2, { 39, 67 } },
+    { 0x014000, 2, { 95, 97 } },
+    { 0x0141B0, 2, { 82, 96 } },
+    { 0x015169, 2, { 13, 59 } },
+    { 0x0165BF, 2, { 56, 83 } },
+    { 0x01706C, 2, { 84, 95 } },
+    { 0x018000, 2, { 95, 96 } },
+    { 0x018167, 2, { 56, 101 } },
+    { 0x018467, 2, { 56, 103 } },
+    { 0x018527, 2, { 56, 105 } },
+    { 0x018567, 1, { 56, -1 } },
+    { 0x018577, 2, { 56, 107 } },
+    { 0x018767, 2, { 56, 102 } },
+    { 0x018D67, 2, { 56, 100 } },
+    { 0x01B1DC, 2, { 82, 84 } },
+    { 0x01C130, 2, { 82, 104 } },
+    { 0x01C190, 2, { 82, 106 } },
+    { 0x01C1A0, 2, { 82, 107 } },
+    { 0x01C1B0, 1, { 82, -1 } },
+    { 0x01C1B2, 2, { 82, 110 } },
+    { 0x01C1B4, 2, { 82, 109 } },
+    { 0x01C1B8, 2, { 82, 108 } },
+    { 0x01C3B0, 2, { 82, 102 } },
+    { 0x01C5B0, 2, { 82, 101 } },
+    { 0x01C9B0, 2, { 82, 100 } },
+    { 0x01D1B0, 2, { 82, 99 } },
+    { 0x01DDAB, 2, { 82, 86 } },
+    { 0x01E0D8, 2, { 83, 95 } },
+    { 0x01E1B0, 2, { 82, 98 } },
+    { 0x01F50B, 2, { 56, 84 } },
+    { 0x01F986, 2, { 82, 85 } },
+    { 0x020000, 1, { 94, -1 } },
+    { 0x020001, 2, { 94, 111 } },
+    { 0x020002, 2, { 94, 110 } },
+    { 0x020008, 2, { 94, 108 } },
+    { 0x020020, 2, { 94, 106 } },
+    { 0x020040, 2, { 94, 105 } },
+    { 0x020080, 2, { 94, 104 } },
+    { 0x020200, 2, { 94, 102 } },
+    { 0x020400, 2, { 94, 101 } },
+    { 0x020607, 2, { 56, 81 } },
+    { 0x020800, 2, { 94, 100 } },
+    { 0x020ACE, 2, { 55, 95 } },
+    { 0x021000, 2, { 94, 99 } },
+    { 0x02159C, 2, { 54, 93 } },
+    { 0x021C1B, 2, { 86, 94 } },
+    { 0x022000, 2, { 94, 98 } },
+    { 0x0226B8, 2, { 53, 79 } },
+    { 0x023424, 2, { 43, 61 } },
+    { 0x02372D, 2, { 10, 28 } },
+    { 0x023836, 2, { 85, 94 } },
+    { 0x024000, 2, { 94, 97 } },
+    { 0x0242D0, 2, { 81, 82 } },
+    { 0x02575F, 2, { 24, 40 } },
+    { 0x02706C, 2, { 84, 94 } },
+    { 0x027DCE, 2, { 38, 66 } },
+    { 0x028000, 2, { 94, 96 } },
+    { 0x028360, 2, { 81, 95 } },
+    { 0x02891D, 2, { 29, 54 } },
+    { 0x028CF3, 2, { 30, 57 } },
+    { 0x028FA9, 2, { 55, 56 } },
+    { 0x02A2D2, 2, { 12, 58 } },
+    { 0x02C48D, 2, { 12, 88 } },
+    { 0x02CB7E, 2, { 55, 82 } },
+    { 0x02DE85, 2, { 19, 34 } },
+    { 0x02E0D8, 2, { 83, 94 } },
+    { 0x030000, 2, { 94, 95 } },
+    { 0x0302CE, 2, { 55, 100 } },
+    { 0x0308CE, 2, { 55, 102 } },
+    { 0x030A4E, 2, { 55, 104 } },
+    { 0x030ACE, 1, { 55, -1 } },
+    { 0x030ACF, 2, { 55, 111 } },
+    { 0x030AEE, 2, { 55, 106 } },
+    { 0x030ECE, 2, { 55, 101 } },
+    { 0x0316D5, 2, { 55, 86 } },
+    { 0x031ACE, 2, { 55, 99 } },
+    { 0x032B95, 2, { 36, 75 } },
+    { 0x0363B8, 2, { 81, 83 } },
+    { 0x036D37, 2, { 11, 72 } },
+    { 0x038260, 2, { 81, 103 } },
+    { 0x038320, 2, { 81, 105 } },
+    { 0x038340, 2, { 81, 106 } },
+    { 0x038360, 1, { 81, -1 } },
+    { 0x038364, 2, { 81, 109 } },
+    { 0x038368, 2, { 81, 108 } },
+    { 0x038370, 2, { 81, 107 } },
+    { 0x038567, 2, { 56, 94 } },
+    { 0x038760, 2, { 81, 101 } },
+    { 0x038B60, 2, { 81, 100 } },
+    { 0x039360, 2, { 81, 99 } },
+    { 0x039F7B, 2, { 81, 86 } },
+    { 0x03A360, 2, { 81, 98 } },
+    { 0x03A473, 2, { 9, 46 } },
+    { 0x03BB56, 2, { 81, 85 } },
+    { 0x03C1B0, 2, { 82, 94 } },
+    { 0x03C360, 2, { 81, 97 } },
+    { 0x03EA16, 2, { 55, 83 } },
+    { 0x03F30C, 2, { 81, 84 } },
+    { 0x03FEF2, 2, { 52, 70 } },
+    { 0x040000, 1, { 93, -1 } },
+    { 0x040001, 2, { 93, 111 } },
+    { 0x040002, 2, { 93, 110 } },
+    { 0x040004, 2, { 93, 109 } },
+    { 0x040010, 2, { 93, 107 } },
+    { 0x040040, 2, { 93, 105 } },
+    { 0x040080, 2, { 93, 104 } },
+    { 0x040100, 2, { 93, 103 } },
+    { 0x040400, 2, { 93, 101 } },
+    { 0x040800, 2, { 93, 100 } },
+    { 0x040C0E, 2, { 55, 80 } },
+    { 0x041000, 2, { 93, 99 } },
+    { 0x04159C, 2, { 54, 94 } },
+    { 0x041C1B, 2, { 86, 93 } },
+    { 0x042000, 2, { 93, 98 } },
+    { 0x042B38, 2, { 53, 92 } },
+    { 0x043836, 2, { 85, 93 } },
+    { 0x044000, 2, { 93, 97 } },
+    { 0x044D70, 2, { 52, 78 } },
+    { 0x0453AD, 2, { 3, 73 } },
+    { 0x046848, 2, { 42, 60 } },
+    { 0x046E5A, 2, { 9, 27 } },
+    { 0x04706C, 2, { 84, 93 } },
+    { 0x048000, 2, { 93, 96 } },
+    { 0x0485A0, 2, { 80, 81 } },
+    { 0x049881, 2, { 29, 101 } },
+    { 0x049C81, 1, { 29, -1 } },
+    { 0x049C91, 2, { 29, 107 } },
+    { 0x049CA1, 2, { 29, 106 } },
+    { 0x049CC1, 2, { 29, 105 } },
+    { 0x049D81, 2, { 29, 103 } },
+    { 0x049E81, 2, { 29, 102 } },
+    { 0x04A4B7, 2, { 29, 85 } },
+    { 0x04AEBE, 2, { 23, 39 } },
+    { 0x04BBE5, 2, { 17, 51 } },
+    { 0x04BC81, 2, { 29, 98 } },
+    { 0x04E0D8, 2, { 83, 93 } },
+    { 0x04ED43, 2, { 28, 71 } },
+    { 0x04FB9C, 2, { 37, 65 } },
+    { 0x050000, 2, { 93, 95 } },
+    { 0x0503AF, 2, { 10, 79 } },
+    { 0x0506C0, 2, { 80, 94 } },
+    { 0x05123A, 2, { 28, 53 } },
+    { 0x0519E6, 2, { 29, 56 } },
+    { 0x051F52, 2, { 54, 55 } },
+    { 0x0545A4, 2, { 11, 57 } },
+    { 0x057C29, 2, { 66, 89 } },
+    { 0x058567, 2, { 56, 93 } },
+    { 0x05891A, 2, { 11, 87 } },
+    { 0x0596FC, 2, { 54, 81 } },
+    { 0x05BD0A, 2, { 18, 33 } },
+    { 0x05C1B0, 2, { 82, 93 } },
+    { 0x060000, 2, { 93, 94 } },
+    { 0x060213, 2, { 18, 36 } },
+    { 0x060987, 2, { 54, 86 } },
+    { 0x06149C, 2, { 54, 103 } },
+    { 0x06159C, 1, { 54, -1 } },
+    { 0x0615DC, 2, { 54, 105 } },
+    { 0x061B1B, 2, { 48, 73 } },
+    { 0x061D9C, 2, { 54, 100 } },
+    { 0x062DAA, 2, { 54, 85 } },
+    { 0x06559C, 2, { 54, 97 } },
+    { 0x06572A, 2, { 35, 74 } },
+    { 0x067209, 2, { 74, 77 } },
+    { 0x0683A7, 2, { 56, 80 } },
+    { 0x06C770, 2, { 80, 82 } },
+    { 0x06DA6E, 2, { 10, 71 } },
+    { 0x0704C0, 2, { 80, 102 } },
+    { 0x070640, 2, { 80, 104 } },
+    { 0x070680, 2, { 80, 105 } },
+    { 0x0706C0, 1, { 80, -1 } },
+    { 0x0706C1, 2, { 80, 111 } },
+    { 0x0706C8, 2, { 80, 108 } },
+    { 0x0706D0, 2, { 80, 107 } },
+    { 0x0706E0, 2, { 80, 106 } },
+    { 0x070ACE, 2, { 55, 93 } },
+    { 0x070EC0, 2, { 80, 100 } },
+    { 0x0716C0, 2, { 80, 99 } },
+    { 0x071ADB, 2, { 80, 86 } },
+    { 0x0726C0, 2, { 80, 98 } },
+    { 0x073277, 2, { 1, 70 } },
+    { 0x073EF6, 2, { 80, 85 } },
+    { 0x0746C0, 2, { 80, 97 } },
+    { 0x0748E6, 2, { 8, 45 } },
+    { 0x0771E3, 2, { 0, 74 } },
+    { 0x0776AC, 2, { 80, 84 } },
+    { 0x078360, 2, { 81, 93 } },
+    { 0x0786C0, 2, { 80, 96 } },
+    { 0x0790FB, 2, { 54, 56 } },
+    { 0x07964F, 2, { 29, 55 } },
+    { 0x07C957, 2, { 11, 30 } },
+    { 0x07CA29, 2, { 27, 46 } },
+    { 0x07D42C, 2, { 54, 82 } },
+    { 0x07E618, 2, { 80, 83 } },
+    { 0x07FDE4, 2, { 51, 69 } },
+    { 0x080000, 1, { 92, -1 } },
+    { 0x080001, 2, { 92, 111 } },
+    { 0x080002, 2, { 92, 110 } },
+    { 0x080004, 2, { 92, 109 } },
+    { 0x080008, 2, { 92, 108 } },
+    { 0x080020, 2, { 92, 106 } },
+    { 0x080080, 2, { 92, 104 } },
+    { 0x080100, 2, { 92, 103 } },
+    { 0x080200, 2, { 92, 102 } },
+    { 0x080800, 2, { 92, 100 } },
+    { 0x081000, 2, { 92, 99 } },
+    { 0x08181C, 2, { 54, 79 } },
+    { 0x081C1B, 2, { 86, 92 } },
+    { 0x082000, 2, { 92, 98 } },
+    { 0x082B38, 2, { 53, 93 } },
+    { 0x083836, 2, { 85, 92 } },
+    { 0x083C15, 2, { 32, 69 } },
+    { 0x084000, 2, { 92, 97 } },
+    { 0x085670, 2, { 52, 91 } },
+    { 0x08706C, 2, { 84, 92 } },
+    { 0x088000, 2, { 92, 96 } },
+    { 0x08885D, 2, { 15, 23 } },
+    { 0x089AE0, 2, { 51, 77 } },
+    { 0x08A75A, 2, { 2, 72 } },
+    { 0x08B687, 2, { 14, 62 } },
+    { 0x08BC65, 2, { 28, 56 } },
+    { 0x08BFC3, 2, { 35, 51 } },
+    { 0x08D090, 2, { 41, 59 } },
+    { 0x08DCB4, 2, { 8, 26 } },
+    { 0x08E0D8, 2, { 83, 92 } },
+    { 0x08FDF9, 2, { 3, 34 } },
+    { 0x090000, 2, { 92, 95 } },
+    { 0x090B40, 2, { 79, 80 } },
+    { 0x090E2F, 2, { 10, 94 } },
+    { 0x09150D, 2, { 69, 74 } },
+    { 0x093102, 2, { 28, 100 } },
+    { 0x093902, 1, { 28, -1 } },
+    { 0x093903, 2, { 28, 111 } },
+    { 0x093922, 2, { 28, 106 } },
+    { 0x093942, 2, { 28, 105 } },
+    { 0x093982, 2, { 28, 104 } },
+    { 0x093B02, 2, { 28, 102 } },
+    { 0x093D02, 2, { 28, 101 } },
+    { 0x09496E, 2, { 28, 84 } },
+    { 0x095D7C, 2, { 22, 38 } },
+    { 0x0977CA, 2, { 16, 50 } },
+    { 0x097902, 2, { 28, 97 } },
+    { 0x0981F9, 2, { 13, 41 } },
+    { 0x098567, 2, { 56, 92 } },
+    { 0x09A32D, 2, { 46, 78 } },
+    { 0x09AC95, 2, { 14, 44 } },
+    { 0x09C1B0, 2, { 82, 92 } },
+    { 0x09D441, 2, { 71, 93 } },
+    { 0x09DA86, 2, { 27, 70 } },
+    { 0x09F738, 2, { 36, 64 } },
+    { 0x0A0000, 2, { 92, 94 } },
+    { 0x0A075E, 2, { 9, 78 } },
+    { 0x0A0D80, 2, { 79, 93 } },
+    { 0x0A2474, 2, { 27, 52 } },
+    { 0x0A33CC, 2, { 28, 55 } },
+    { 0x0A4821, 2, { 33, 64 } },
+    { 0x0A86AB, 2, { 1, 9 } },
+    { 0x0A8B48, 2, { 10, 56 } },
+    { 0x0A9101, 2, { 29, 79 } },
+    { 0x0A9E0D, 2, { 58, 65 } },
+    { 0x0AB54F, 2, { 34, 48 } },
+    { 0x0ACF9F, 2, { 10, 82 } },
+    { 0x0AD21B, 2, { 47, 87 } },
+    { 0x0AD281, 2, { 71, 80 } },
+    { 0x0ADCAD, 2, { 64, 75 } },
+    { 0x0AF852, 2, { 65, 88 } },
+    { 0x0AFF09, 2, { 48, 76 } },
+    { 0x0B062F, 2, { 10, 100 } },
+    { 0x0B0ACE, 2, { 55, 92 } },
+    { 0x0B0C2F, 2, { 10, 102 } },
+    { 0x0B0E2B, 2, { 10, 109 } },
+    { 0x0B0E2D, 2, { 10, 110 } },
+    { 0x0B0E2F, 1, { 10, -1 } },
+    { 0x0B0EAF, 2, { 10, 104 } },
+    { 0x0B1234, 2, { 10, 86 } },
+    { 0x0B1E2F, 2, { 10, 99 } },
+    { 0x0B2DF8, 2, { 53, 80 } },
+    { 0x0B4E2F, 2, { 10, 97 } },
+    { 0x0B7A14, 2, { 17, 32 } },
+    { 0x0B7E43, 2, { 10, 84 } },
+    { 0x0B8360, 2, { 81, 92 } },
+    { 0x0B8395, 2, { 42, 61 } },
+    { 0x0BC1DD, 2, { 54, 71 } },
+    { 0x0BFD53, 2, { 63, 90 } },
+    { 0x0C0000, 2, { 92, 93 } },
+    { 0x0C0426, 2, { 17, 35 } },
+    { 0x0C08EF, 2, { 10, 80 } },
+    { 0x0C130E, 2, { 53, 85 } },
+    { 0x0C15F1, 2, { 71, 82 } },
+    { 0x0C2938, 2, { 53, 102 } },
+    { 0x0C2B38, 1, { 53, -1 } },
+    { 0x0C2BB8, 2, { 53, 104 } },
+    { 0x0C3636, 2, { 47, 72 } },
+    { 0x0C3723, 2, { 53, 86 } },
+    { 0x0C3B38, 2, { 53, 99 } },
+    { 0x0C5126, 2, { 56, 71 } },
+    { 0x0C5B54, 2, { 53, 84 } },
+    { 0x0C9AF5, 2, { 1, 91 } },
+    { 0x0C9C81, 2, { 29, 92 } },
+    { 0x0CAB38, 2, { 53, 96 } },
+    { 0x0CAE54, 2, { 34, 73 } },
+    { 0x0CC743, 2, { 12, 37 } },
+    { 0x0CD441, 2, { 71, 95 } },
+    { 0x0CE412, 2, { 73, 76 } },
+    { 0x0D074E, 2, { 55, 79 } },
+    { 0x0D22EF, 2, { 0, 17 } },
+    { 0x0D3499, 2, { 71, 83 } },
+    { 0x0D5441, 2, { 71, 96 } },
+    { 0x0D7E49, 2, { 21, 40 } },
+    { 0x0D8EE0, 2, { 79, 81 } },
+    { 0x0D9441, 2, { 71, 97 } },
+    { 0x0DA1C9, 2, { 5, 24 } },
+    { 0x0DB4DC, 2, { 9, 70 } },
+    { 0x0DC441, 2, { 71, 99 } },
+    { 0x0DD401, 2, { 71, 105 } },
+    { 0x0DD440, 2, { 71, 111 } },
+    { 0x0DD441, 1, { 71, -1 } },
+    { 0x0DD443, 2, { 71, 110 } },
+    { 0x0DD449, 2, { 71, 108 } },
+    { 0x0DD451, 2, { 71, 107 } },
+    { 0x0DD461, 2, { 71, 106 } },
+    { 0x0DD4C1, 2, { 71, 104 } },
+    { 0x0DD541, 2, { 71, 103 } },
+    { 0x0DD641, 2, { 71, 102 } },
+    { 0x0DEC77, 2, { 71, 85 } },
+    { 0x0DF441, 2, { 71, 98 } },
+    { 0x0E0980, 2, { 79, 101 } },
+    { 0x0E0C80, 2, { 79, 103 } },
+    { 0x0E0D00, 2, { 79, 104 } },
+    { 0x0E0D80, 1, { 79, -1 } },
+    { 0x0E0D82, 2, { 79, 110 } },
+    { 0x0E0D90, 2, { 79, 107 } },
+    { 0x0E0DA0, 2, { 79, 106 } },
+    { 0x0E0DC0, 2, { 79, 105 } },
+    { 0x0E10AF, 2, { 46, 70 } },
+    { 0x0E119B, 2, { 79, 86 } },
+    { 0x0E159C, 2, { 54, 92 } },
+    { 0x0E1D80, 2, { 79, 99 } },
+    { 0x0E2D80, 2, { 79, 98 } },
+    { 0x0E35B6, 2, { 79, 85 } },
+    { 0x0E4D80, 2, { 79, 97 } },
+    { 0x0E5721, 2, { 71, 81 } },
+    { 0x0E64EE, 2, { 0, 69 } },
+    { 0x0E6591, 2, { 37, 58 } },
+    { 0x0E7DEC, 2, { 79, 84 } },
+    { 0x0E8D80, 2, { 79, 96 } },
+    { 0x0E91CC, 2, { 7, 44 } },
+    { 0x0EDE8F, 2, { 55, 71 } },
+    { 0x0EED58, 2, { 79, 83 } },
+    { 0x0F06C0, 2, { 80, 92 } },
+    { 0x0F0D80, 2, { 79, 95 } },
+    { 0x0F0E2F, 2, { 10, 93 } },
+    { 0x0F195B, 2, { 26, 63 } },
+    { 0x0F21F6, 2, { 53, 55 } },
+    { 0x0F2C9E, 2, { 28, 54 } },
+    { 0x0F4227, 2, { 35, 69 } },
+    { 0x0F88E7, 2, { 56, 79 } },
+    { 0x0F92AE, 2, { 10, 29 } },
+    { 0x0F9452, 2, { 26, 45 } },
+    { 0x0FA858, 2, { 53, 81 } },
+    { 0x0FC1F1, 2, { 32, 51 } },
+    { 0x0FCC30, 2, { 79, 82 } },
+    { 0x0FD441, 2, { 71, 94 } },
+    { 0x0FEBDD, 2, { 60, 61 } },
+    { 0x0FF52B, 2, { 18, 64 } },
+    { 0x0FFBC8, 2, { 50, 68 } },
+    { 0x100000, 1, { 91, -1 } },
+    { 0x100001, 2, { 91, 111 } },
+    { 0x100002, 2, { 91, 110 } },
+    { 0x100004, 2, { 91, 109 } },
+    { 0x100008, 2, { 91, 108 } },
+    { 0x100010, 2, { 91, 107 } },
+    { 0x100040, 2, { 91, 105 } },
+    { 0x100100, 2, { 91, 103 } },
+    { 0x100200, 2, { 91, 102 } },
+    { 0x100400, 2, { 91, 101 } },
+    { 0x101000, 2, { 91, 99 } },
+    { 0x101C1B, 2, { 86, 91 } },
+    { 0x102000, 2, { 91, 98 } },
+    { 0x103038, 2, { 53, 78 } },
+    { 0x103227, 2, { 5, 37 } },
+    { 0x103836, 2, { 85, 91 } },
+    { 0x103C67, 2, { 59, 61 } },
+    { 0x104000, 2, { 91, 97 } },
+    { 0x105670, 2, { 52, 92 } },
+    { 0x10706C, 2, { 84, 91 } },
+    { 0x10782A, 2, { 31, 68 } },
+    { 0x108000, 2, { 91, 96 } },
+    { 0x10A6AD, 2, { 10, 70 } },
+    { 0x10ACE0, 2, { 51, 90 } },
+    { 0x10E0D8, 2, { 83, 91 } },
+    { 0x10F30D, 2, { 17, 26 } },
+    { 0x10FB41, 2, { 38, 62 } },
+    { 0x10FC61, 2, { 6, 60 } },
+    { 0x110000, 2, { 91, 95 } },
+    { 0x1110BA, 2, { 14, 22 } },
+    { 0x1135C0, 2, { 50, 76 } },
+    { 0x114EB4, 2, { 1, 71 } },
+    { 0x116D0E, 2, { 13, 61 } },
+    { 0x1178CA, 2, { 27, 55 } },
+    { 0x117F86, 2, { 34, 50 } },
+    { 0x118567, 2, { 56, 91 } },
+    { 0x11A120, 2, { 40, 58 } },
+    { 0x11B82D, 2, { 46, 93 } },
+    { 0x11B968, 2, { 7, 25 } },
+    { 0x11C1B0, 2, { 82, 91 } },
+    { 0x11C77F, 2, { 40, 88 } },
+    { 0x11CF41, 2, { 71, 78 } },
+    { 0x11FBF2, 2, { 2, 33 } },
+    { 0x120000, 2, { 91, 94 } },
+    { 0x120843, 2, { 43, 59 } },
+    { 0x121680, 2, { 78, 79 } },
+    { 0x121C5E, 2, { 9, 93 } },
+    { 0x122A1A, 2, { 68, 73 } },
+    { 0x1244EB, 2, { 2, 36 } },
+    { 0x126204, 2, { 27, 99 } },
+    { 0x126E1F, 2, { 27, 86 } },
+    { 0x127200, 2, { 27, 109 } },
+    { 0x127204, 1, { 27, -1 } },
+    { 0x127205, 2, { 27, 111 } },
+    { 0x127206, 2, { 27, 110 } },
+    { 0x127244, 2, { 27, 105 } },
+    { 0x127284, 2, { 27, 104 } },
+    { 0x127304, 2, { 27, 103 } },
+    { 0x127604, 2, { 27, 101 } },
+    { 0x127A04, 2, { 27, 100 } },
+    { 0x12868F, 2, { 62, 66 } },
+    { 0x1292DC, 2, { 27, 83 } },
+    { 0x129775, 2, { 1, 79 } },
+    { 0x12BAF8, 2, { 21, 37 } },
+    { 0x12BD03, 2, { 16, 48 } },
+    { 0x12BEED, 2, { 46, 80 } },
+    { 0x12C8B9, 2, { 0, 63 } },
+    { 0x12EF94, 2, { 15, 49 } },
+    { 0x12F204, 2, { 27, 96 } },
+    { 0x1303F2, 2, { 12, 40 } },
+    { 0x130ACE, 2, { 55, 91 } },
+    { 0x13465A, 2, { 45, 77 } },
+    { 0x13585F, 2, { 10, 52 } },
+    { 0x13592A, 2, { 13, 43 } },
+    { 0x137204, 2, { 27, 95 } },
+    { 0x138360, 2, { 81, 91 } },
+    { 0x13A882, 2, { 70, 92 } },
+    { 0x13B50C, 2, { 26, 69 } },
+    { 0x13CB53, 2, { 63, 77 } },
+    { 0x13EE70, 2, { 35, 63 } },
+    { 0x13F67F, 2, { 24, 58 } },
+    { 0x140000, 2, { 91, 93 } },
+    { 0x140EBC, 2, { 8, 77 } },
+    { 0x141705, 2, { 17, 90 } },
+    { 0x141B00, 2, { 78, 92 } },
+    { 0x142B9F, 2, { 8, 35 } },
+    { 0x143101, 2, { 48, 68 } },
+    { 0x1448E8, 2, { 26, 51 } },
+    { 0x146798, 2, { 27, 54 } },
+    { 0x14799D, 2, { 46, 82 } },
+    { 0x149042, 2, { 32, 63 } },
+    { 0x149AF5, 2, { 1, 92 } },
+    { 0x14B82D, 2, { 46, 95 } },
+    { 0x14C9BB, 2, { 5, 65 } },
+    { 0x150D56, 2, { 0, 8 } },
+    { 0x151690, 2, { 9, 55 } },
+    { 0x152202, 2, { 28, 78 } },
+    { 0x153C1A, 2, { 57, 64 } },
+    { 0x1558F5, 2, { 46, 83 } },
+    { 0x156A9E, 2, { 33, 47 } },
+    { 0x15801B, 2, { 46, 85 } },
+    { 0x158231, 2, { 52, 71 } },
+    { 0x159F3E, 2, { 9, 81 } },
+    { 0x15A3F7, 2, { 1, 28 } },
+    { 0x15A436, 2, { 46, 86 } },
+    { 0x15A502, 2, { 70, 79 } },
+    { 0x15B825, 2, { 46, 108 } },
+    { 0x15B829, 2, { 46, 109 } },
+    { 0x15B82D, 1, { 46, -1 } },
+    { 0x15B83D, 2, { 46, 107 } },
+    { 0x15B86D, 2, { 46, 105 } },
+    { 0x15B95A, 2, { 63, 74 } },
+    { 0x15BA2D, 2, { 46, 102 } },
+    { 0x15C841, 2, { 46, 84 } },
+    { 0x15F0A4, 2, { 64, 87 } },
+    { 0x15FE12, 2, { 47, 75 } },
+    { 0x160045, 2, { 9, 86 } },
+    { 0x160C5E, 2, { 9, 99 } },
+    { 0x16159C, 2, { 54, 91 } },
+    { 0x16185E, 2, { 9, 101 } },
+    { 0x161C56, 2, { 9, 108 } },
+    { 0x161C5A, 2, { 9, 109 } },
+    { 0x161C5E, 1, { 9, -1 } },
+    { 0x161D5E, 2, { 9, 103 } },
+    { 0x162468, 2, { 9, 85 } },
+    { 0x162DE3, 2, { 7, 22 } },
+    { 0x163B4D, 2, { 46, 81 } },
+    { 0x163C5E, 2, { 9, 98 } },
+    { 0x165BF0, 2, { 52, 79 } },
+    { 0x1679B7, 2, { 3, 68 } },
+    { 0x167CC3, 2, { 70, 71 } },
+    { 0x169C5E, 2, { 9, 96 } },
+    { 0x16B2E3, 2, { 46, 55 } },
+    { 0x16F428, 2, { 16, 31 } },
+    { 0x16FC86, 2, { 9, 83 } },
+    { 0x1706C0, 2, { 80, 91 } },
+    { 0x17072A, 2, { 41, 60 } },
+    { 0x17152F, 2, { 10, 78 } },
+    { 0x1783BA, 2, { 53, 70 } },
+    { 0x179939, 2, { 9, 56 } },
+    { 0x17B0E9, 2, { 30, 64 } },
+    { 0x17B82D, 2, { 46, 94 } },
+    { 0x17FAA6, 2, { 62, 89 } },
+    { 0x180000, 2, { 91, 92 } },
+    { 0x18084C, 2, { 16, 34 } },
+    { 0x1811DE, 2, { 9, 79 } },
+    { 0x18261C, 2, { 52, 84 } },
+    { 0x182BE2, 2, { 70, 81 } },
+    { 0x184A6B, 2, { 52, 86 } },
+    { 0x185270, 2, { 52, 101 } },
+    { 0x185670, 1, { 52, -1 } },
+    { 0x185671, 2, { 52, 111 } },
+    { 0x185770, 2, { 52, 103 } },
+    { 0x185E70, 2, { 52, 100 } },
+    { 0x186C6C, 2, { 46, 71 } },
+    { 0x186E46, 2, { 52, 85 } },
+    { 0x187670, 2, { 52, 98 } },
+    { 0x188781, 2, { 29, 78 } },
+    { 0x189AF5, 2, { 1, 93 } },
+    { 0x18A24C, 2, { 55, 70 } },
+    { 0x18B6A8, 2, { 52, 83 } },
+    { 0x18BC2F, 2, { 22, 44 } },
+    { 0x18ECF7, 2, { 41, 61 } },
+    { 0x1935EA, 2, { 0, 90 } },
+    { 0x193902, 2, { 28, 91 } },
+    { 0x195670, 2, { 52, 95 } },
+    { 0x195CA8, 2, { 33, 72 } },
+    { 0x197C2B, 2, { 10, 27 } },
+    { 0x19827F, 2, { 3, 50 } },
+    { 0x198E86, 2, { 11, 36 } },
+    { 0x19A63D, 2, { 22, 62 } },
+    { 0x19A882, 2, { 70, 94 } },
+    { 0x19C824, 2, { 72, 75 } },
+    { 0x1A058F, 2, { 18, 87 } },
+    { 0x1A0E9C, 2, { 54, 78 } },
+    { 0x1A319F, 2, { 11, 33 } },
+    { 0x1A67C9, 2, { 23, 49 } },
+    { 0x1A6932, 2, { 70, 82 } },
+    { 0x1AA001, 2, { 26, 74 } },
+    { 0x1AA882, 2, { 70, 95 } },
+    { 0x1AC931, 2, { 18, 57 } },
+    { 0x1AD8D3, 2, { 41, 43 } },
+    { 0x1AE3B1, 2, { 36, 72 } },
+    { 0x1AFC92, 2, { 20, 39 } },
+    { 0x1B1DC0, 2, { 78, 80 } },
+    { 0x1B2882, 2, { 70, 96 } },
+    { 0x1B3F2D, 2, { 40, 65 } },
+    { 0x1B4392, 2, { 4, 23 } },
+    { 0x1B51B3, 2, { 51, 63 } },
+    { 0x1B69B8, 2, { 8, 69 } },
+    { 0x1B8882, 2, { 70, 98 } },
+    { 0x1BA802, 2, { 70, 104 } },
+    { 0x1BA880, 2, { 70, 110 } },
+    { 0x1BA882, 1, { 70, -1 } },
+    { 0x1BA883, 2, { 70, 111 } },
+    { 0x1BA886, 2, { 70, 109 } },
+    { 0x1BA892, 2, { 70, 107 } },
+    { 0x1BA8A2, 2, { 70, 106 } },
+    { 0x1BA8C2, 2, { 70, 105 } },
+    { 0x1BA982, 2, { 70, 103 } },
+    { 0x1BAA82, 2, { 70, 102 } },
+    { 0x1BAC82, 2, { 70, 101 } },
+    { 0x1BB3D3, 2, { 2, 64 } },
+    { 0x1BB499, 2, { 70, 86 } },
+    { 0x1BB5AD, 2, { 46, 79 } },
+    { 0x1BC275, 2, { 20, 67 } },
+    { 0x1BC81F, 2, { 9, 71 } },
+    { 0x1BCAC9, 2, { 48, 50 } },
+    { 0x1BD8EE, 2, { 70, 84 } },
+    { 0x1BE882, 2, { 70, 97 } },
+    { 0x1C1300, 2, { 78, 100 } },
+    { 0x1C1900, 2, { 78, 102 } },
+    { 0x1C1A00, 2, { 78, 103 } },
+    { 0x1C1B00, 1, { 78, -1 } },
+    { 0x1C1B01, 2, { 78, 111 } },
+    { 0x1C1B02, 2, { 78, 110 } },
+    { 0x1C1B04, 2, { 78, 109 } },
+    { 0x1C1B20, 2, { 78, 106 } },
+    { 0x1C1B40, 2, { 78, 105 } },
+    { 0x1C1B80, 2, { 78, 104 } },
+    { 0x1C215E, 2, { 45, 69 } },
+    { 0x1C2336, 2, { 78, 85 } },
+    { 0x1C2B38, 2, { 53, 91 } },
+    { 0x1C3B00, 2, { 78, 98 } },
+    { 0x1C5ACB, 2, { 19, 68 } },
+    { 0x1C5B00, 2, { 78, 97 } },
+    { 0x1C6B6C, 2, { 78, 84 } },
+    { 0x1C7A2D, 2, { 1, 83 } },
+    { 0x1C812F, 2, { 28, 46 } },
+    { 0x1C92F5, 2, { 1, 100 } },
+    { 0x1C9A75, 2, { 1, 104 } },
+    { 0x1C9AB5, 2, { 1, 105 } },
+    { 0x1C9AD5, 2, { 1, 106 } },
+    { 0x1C9AF5, 1, { 1, -1 } },
+    { 0x1C9B00, 2, { 78, 96 } },
+    { 0x1C9EF5, 2, { 1, 101 } },
+    { 0x1CAC57, 2, { 63, 69 } },
+    { 0x1CAE42, 2, { 70, 80 } },
+    { 0x1CBAF5, 2, { 1, 98 } },
+    { 0x1CCB22, 2, { 36, 57 } },
+    { 0x1CDF69, 2, { 21, 58 } },
+    { 0x1CEA99, 2, { 1, 84 } },
+    { 0x1CF72B, 2, { 26, 35 } },
+    { 0x1CFBD8, 2, { 78, 83 } },
+    { 0x1D1B00, 2, { 78, 95 } },
+    { 0x1D2398, 2, { 6, 43 } },
+    { 0x1D9AF5, 2, { 1, 95 } },
+    { 0x1DB82D, 2, { 46, 92 } },
+    { 0x1DBD1E, 2, { 54, 70 } },
+    { 0x1DD441, 2, { 71, 91 } },
+    { 0x1DDAB0, 2, { 78, 82 } },
+    { 0x1E0D80, 2, { 79, 91 } },
+    { 0x1E1B00, 2, { 78, 94 } },
+    { 0x1E1C5E, 2, { 9, 92 } },
+    { 0x1E31E9, 2, { 5, 88 } },
+    { 0x1E32B6, 2, { 25, 62 } },
+    { 0x1E43EC, 2, { 52, 54 } },
+    { 0x1E4409, 2, { 74, 90 } },
+    { 0x1E593C, 2, { 27, 53 } },
+    { 0x1E7DBB, 2, { 12, 21 } },
+    { 0x1E844E, 2, { 34, 68 } },
+    { 0x1E86D3, 2, { 13, 60 } },
+    { 0x1E9AF5, 2, { 1, 94 } },
+    { 0x1ED3CB, 2, { 4, 67 } },
+    { 0x1F11CE, 2, { 55, 78 } },
+    { 0x1F22BF, 2, { 47, 64 } },
+    { 0x1F255C, 2, { 9, 28 } },
+    { 0x1F28A4, 2, { 25, 44 } },
+    { 0x1F2C09, 2, { 75, 87 } },
+    { 0x1F4C21, 2, { 14, 89 } },
+    { 0x1F50B0, 2, { 52, 80 } },
+    { 0x1F675F, 2, { 17, 45 } },
+    { 0x1F743B, 2, { 33, 57 } },
+    { 0x1F83E2, 2, { 31, 50 } },
+    { 0x1F903B, 2, { 1, 55 } },
+    { 0x1F9860, 2, { 78, 81 } },
+    { 0x1FA882, 2, { 70, 93 } },
+    { 0x1FD7BA, 2, { 59, 60 } },
+    { 0x1FEA56, 2, { 17, 63 } },
+    { 0x1FF790, 2, { 49, 67 } },
+    { 0x200000, 1, { 90, -1 } },
+    { 0x200002, 2, { 90, 110 } },
+    { 0x200004, 2, { 90, 109 } },
+    { 0x200008, 2, { 90, 108 } },
+    { 0x200010, 2, { 90, 107 } },
+    { 0x200020, 2, { 90, 106 } },
+    { 0x200080, 2, { 90, 104 } },
+    { 0x200200, 2, { 90, 102 } },
+    { 0x200400, 2, { 90, 101 } },
+    { 0x200800, 2, { 90, 100 } },
+    { 0x201C1B, 2, { 86, 90 } },
+    { 0x201E91, 2, { 60, 88 } },
+    { 0x202000, 2, { 90, 98 } },
+    { 0x203836, 2, { 85, 90 } },
+    { 0x204000, 2, { 90, 97 } },
+    { 0x206070, 2, { 52, 77 } },
+    { 0x20644E, 2, { 4, 36 } },
+    { 0x20706C, 2, { 84, 90 } },
+    { 0x2078CE, 2, { 58, 60 } },
+    { 0x208000, 2, { 90, 96 } },
+    { 0x20A9AB, 2, { 5, 13 } },
+    { 0x20ACE0, 2, { 51, 91 } },
+    { 0x20E0D8, 2, { 83, 90 } },
+    { 0x20F054, 2, { 30, 67 } },
+    { 0x210000, 2, { 90, 95 } },
+    { 0x21258F, 2, { 6, 40 } },
+    { 0x214015, 2, { 36, 49 } },
+    { 0x214D5A, 2, { 9, 69 } },
+    { 0x2159C0, 2, { 50, 89 } },
+    { 0x218567, 2, { 56, 90 } },
+    { 0x219603, 2, { 14, 31 } },
+    { 0x21C46D, 2, { 23, 72 } },
+    { 0x21CEB3, 2, { 30, 39 } },
+    { 0x21E61A, 2, { 16, 25 } },
+    { 0x21ECFD, 2, { 8, 71 } },
+    { 0x21F682, 2, { 37, 61 } },
+    { 0x21F8C2, 2, { 5, 59 } },
+    { 0x220000, 2, { 90, 94 } },
+    { 0x220B5B, 2, { 9, 17 } },
+    { 0x222174, 2, { 13, 21 } },
+    { 0x225F09, 2, { 74, 78 } },
+    { 0x226B80, 2, { 49, 75 } },
+    { 0x229D68, 2, { 0, 70 } },
+    { 0x22C451, 2, { 28, 63 } },
+    { 0x22DA1C, 2, { 12, 60 } },
+    { 0x22E271, 2, { 7, 48 } },
+    { 0x22E929, 2, { 46, 69 } },
+    { 0x22F194, 2, { 26, 54 } },
+    { 0x22FF0C, 2, { 33, 49 } },
+    { 0x230ACE, 2, { 55, 90 } },
+    { 0x234240, 2, { 39, 57 } },
+    { 0x23705A, 2, { 45, 92 } },
+    { 0x2372D0, 2, { 6, 24 } },
+    { 0x238360, 2, { 81, 90 } },
+    { 0x238EFE, 2, { 39, 87 } },
+    { 0x239E82, 2, { 70, 77 } },
+    { 0x23BBA1, 2, { 35, 70 } },
+    { 0x23DB57, 2, { 4, 33 } },
+    { 0x23F7E4, 2, { 1, 32 } },
+    { 0x240000, 2, { 90, 93 } },
+    { 0x240823, 2, { 35, 78 } },
+    { 0x241086, 2, { 42, 58 } },
+    { 0x241705, 2, { 17, 91 } },
+    { 0x241877, 2, { 19, 44 } },
+    { 0x2425E9, 2, { 50, 66 } },
+    { 0x242D00, 2, { 77, 78 } },
+    { 0x2438BC, 2, { 8, 92 } },
+    { 0x245434, 2, { 67, 72 } },
+    { 0x2489D6, 2, { 1, 35 } },
+    { 0x249C81, 2, { 29, 90 } },
+    { 0x24ACF5, 2, { 1, 77 } },
+    { 0x24C408, 2, { 26, 98 } },
+    { 0x24DC3E, 2, { 26, 85 } },
+    { 0x24E400, 2, { 26, 108 } },
+    { 0x24E408, 1, { 26, -1 } },
+    { 0x24E40A, 2, { 26, 110 } },
+    { 0x24E40C, 2, { 26, 109 } },
+    { 0x24E488, 2, { 26, 104 } },
+    { 0x24E508, 2, { 26, 103 } },
+    { 0x24E608, 2, { 26, 102 } },
+    { 0x24EC08, 2, { 26, 100 } },
+    { 0x24F408, 2, { 26, 99 } },
+    { 0x250265, 2, { 19, 62 } },
+    { 0x250D1E, 2, { 61, 65 } },
+    { 0x2514CD, 2, { 46, 51 } },
+    { 0x2525B8, 2, { 26, 82 } },
+    { 0x252EEA, 2, { 0, 78 } },
+    { 0x25616F, 2, { 26, 56 } },
+    { 0x256AD3, 2, { 39, 72 } },
+    { 0x2575F0, 2, { 20, 36 } },
+    { 0x257A06, 2, { 15, 47 } },
+    { 0x257DDA, 2, { 45, 79 } },
+    { 0x25DF28, 2, { 14, 48 } },
+    { 0x25E408, 2, { 26, 95 } },
+    { 0x25EC8B, 2, { 70, 74 } },
+    { 0x25F0D3, 2, { 63, 79 } },
+    { 0x2607E4, 2, { 11, 39 } },
+    { 0x26159C, 2, { 54, 90 } },
+    { 0x265827, 2, { 38, 50 } },
+    { 0x265E65, 2, { 20, 75 } },
+    { 0x268CB4, 2, { 44, 76 } },
+    { 0x26A41B, 2, { 45, 71 } },
+    { 0x26B254, 2, { 12, 42 } },
+    { 0x26E408, 2, { 26, 94 } },
+    { 0x2706C0, 2, { 80, 90 } },
+    { 0x273903, 2, { 11, 67 } },
+    { 0x273B61, 2, { 32, 52 } },
+    { 0x275104, 2, { 69, 91 } },
+    { 0x276A18, 2, { 25, 68 } },
+    { 0x2796A6, 2, { 62, 76 } },
+    { 0x27DCE0, 2, { 34, 62 } },
+    { 0x27ECFE, 2, { 23, 57 } },
+    { 0x280000, 2, { 90, 92 } },
+    { 0x280C05, 2, { 17, 78 } },
+    { 0x281323, 2, { 35, 91 } },
+    { 0x281D78, 2, { 7, 76 } },
+    { 0x282E0A, 2, { 16, 89 } },
+    { 0x283600, 2, { 77, 91 } },
+    { 0x28573E, 2, { 7, 34 } },
+    { 0x285857, 2, { 9, 74 } },
+    { 0x286202, 2, { 47, 67 } },
+    { 0x2891D0, 2, { 25, 50 } },
+    { 0x28B72D, 2, { 49, 64 } },
+    { 0x28CF30, 2, { 26, 53 } },
+    { 0x28F33A, 2, { 45, 81 } },
+    { 0x28F79D, 2, { 55, 63 } },
+    { 0x292084, 2, { 31, 62 } },
+    { 0x2935EA, 2, { 0, 91 } },
+    { 0x295CE5, 2, { 39, 47 } },
+    { 0x29705A, 2, { 45, 94 } },
+    { 0x29714F, 2, { 9, 32 } },
+    { 0x299376, 2, { 4, 64 } },
+    { 0x29FD53, 2, { 63, 94 } },
+    { 0x2A2D20, 2, { 8, 54 } },
+    { 0x2A3CE3, 2, { 63, 82 } },
+    { 0x2A4404, 2, { 27, 77 } },
+    { 0x2A7517, 2, { 37, 42 } },
+    { 0x2A7834, 2, { 56, 63 } },
+    { 0x2AB1EA, 2, { 45, 82 } },
+    { 0x2AE6C3, 2, { 60, 65 } },
+    { 0x2AFD53, 2, { 63, 95 } },
+    { 0x2B0036, 2, { 45, 84 } },
+    { 0x2B0462, 2, { 51, 70 } },
+    { 0x2B0E2F, 2, { 10, 90 } },
+    { 0x2B3E7C, 2, { 8, 80 } },
+    { 0x2B47EE, 2, { 0, 27 } },
+    { 0x2B486C, 2, { 45, 85 } },
+    { 0x2B4A04, 2, { 69, 78 } },
+    { 0x2B704A, 2, { 45, 107 } },
+    { 0x2B7052, 2, { 45, 108 } },
+    { 0x2B705A, 1, { 45, -1 } },
+    { 0x2B707A, 2, { 45, 106 } },
+    { 0x2B70DA, 2, { 45, 104 } },
+    { 0x2B72B4, 2, { 62, 73 } },
+    { 0x2B745A, 2, { 45, 101 } },
+    { 0x2B7D53, 2, { 63, 96 } },
+    { 0x2B8D3F, 2, { 63, 84 } },
+    { 0x2B9082, 2, { 45, 83 } },
+    { 0x2BA08D, 2, { 21, 41 } },
+    { 0x2BBD53, 2, { 63, 97 } },
+    { 0x2BC565, 2, { 63, 85 } },
+    { 0x2BCBF1, 2, { 1, 69 } },
+    { 0x2BDD53, 2, { 63, 98 } },
+    { 0x2BDE21, 2, { 66, 68 } },
+    { 0x2BE148, 2, { 63, 86 } },
+    { 0x2BED53, 2, { 63, 99 } },
+    { 0x2BF553, 2, { 63, 100 } },
+    { 0x2BF953, 2, { 63, 101 } },
+    { 0x2BFC24, 2, { 46, 74 } },
+    { 0x2BFC53, 2, { 63, 103 } },
+    { 0x2BFD13, 2, { 63, 105 } },
+    { 0x2BFD43, 2, { 63, 107 } },
+    { 0x2BFD51, 2, { 63, 110 } },
+    { 0x2BFD53, 1, { 63, -1 } },
+    { 0x2BFD57, 2, { 63, 109 } },
+    { 0x2BFD5B, 2, { 63, 108 } },
+    { 0x2BFDD3, 2, { 63, 104 } },
+    { 0x2BFF53, 2, { 63, 102 } },
+    { 0x2C008A, 2, { 8, 85 } },
+    { 0x2C18BC, 2, { 8, 98 } },
+    { 0x2C24A7, 2, { 8, 86 } },
+    { 0x2C2B38, 2, { 53, 90 } },
+    { 0x2C30BC, 2, { 8, 100 } },
+    { 0x2C38AC, 2, { 8, 107 } },
+    { 0x2C38B4, 2, { 8, 108 } },
+    { 0x2C38BC, 1, { 8, -1 } },
+    { 0x2C38BD, 2, { 8, 111 } },
+    { 0x2C38FC, 2, { 8, 105 } },
+    { 0x2C3ABC, 2, { 8, 102 } },
+    { 0x2C3CBC, 2, { 8, 101 } },
+    { 0x2C48D0, 2, { 8, 84 } },
+    { 0x2C5BC6, 2, { 6, 21 } },
+    { 0x2C769A, 2, { 45, 80 } },
+    { 0x2C78BC, 2, { 8, 97 } },
+    { 0x2C8DC7, 2, { 0, 46 } },
+    { 0x2CB7E0, 2, { 51, 78 } },
+    { 0x2CF36E, 2, { 2, 67 } },
+    { 0x2CF986, 2, { 69, 70 } },
+    { 0x2CFB93, 2, { 63, 80 } },
+    { 0x2D1F15, 2, { 27, 32 } },
+    { 0x2D38BC, 2, { 8, 95 } },
+    { 0x2D5223, 2, { 16, 66 } },
+    { 0x2D65C6, 2, { 45, 54 } },
+    { 0x2D69AF, 2, { 48, 62 } },
+    { 0x2D8E2D, 2, { 46, 77 } },
+    { 0x2DA737, 2, { 43, 58 } },
+    { 0x2DBDDB, 2, { 8, 56 } },
+    { 0x2DCD89, 2, { 2, 39 } },
+    { 0x2DD441, 2, { 71, 90 } },
+    { 0x2DE850, 2, { 15, 30 } },
+    { 0x2DE8CF, 2, { 54, 63 } },
+    { 0x2DF90C, 2, { 8, 82 } },
+    { 0x2E0D80, 2, { 79, 90 } },
+    { 0x2E0E54, 2, { 40, 59 } },
+    { 0x2E0F7D, 2, { 9, 35 } },
+    { 0x2E1D5F, 2, { 37, 60 } },
+    { 0x2E2A5E, 2, { 9, 77 } },
+    { 0x2E4409, 2, { 74, 91 } },
+    { 0x2E8E8B, 2, { 42, 65 } },
+    { 0x2F055B, 2, { 22, 50 } },
+    { 0x2F0774, 2, { 52, 69 } },
+    { 0x2F2021, 2, { 14, 76 } },
+    { 0x2F2FED, 2, { 16, 38 } },
+    { 0x2F3272, 2, { 8, 55 } },
+    { 0x2F5F3D, 2, { 13, 40 } },
+    { 0x2F61D2, 2, { 29, 63 } },
+    { 0x2F6D11, 2, { 32, 91 } },
+    { 0x2F705A, 2, { 45, 93 } },
+    { 0x2F9313, 2, { 58, 61 } },
+    { 0x2FA81D, 2, { 15, 87 } },
+    { 0x2FECDB, 2, { 29, 45 } },
+    { 0x2FF54C, 2, { 61, 88 } },
+    { 0x2FFD53, 2, { 63, 93 } },
+    { 0x300000, 2, { 90, 91 } },
+    { 0x301098, 2, { 15, 33 } },
+    { 0x301705, 2, { 17, 93 } },
+    { 0x3023BC, 2, { 8, 78 } },
+    { 0x304989, 2, { 74, 79 } },
+    { 0x304C38, 2, { 51, 83 } },
+    { 0x3055D1, 2, { 63, 70 } },
+    { 0x3057C4, 2, { 69, 80 } },
+    { 0x3084AF, 2, { 6, 58 } },
+    { 0x3086B9, 2, { 22, 31 } },
+    { 0x3094D6, 2, { 51, 85 } },
+    { 0x30A4E0, 2, { 51, 100 } },
+    { 0x30ACE0, 1, { 51, -1 } },
+    { 0x30ACE2, 2, { 51, 110 } },
+    { 0x30AEE0, 2, { 51, 102 } },
+    { 0x30B0FB, 2, { 51, 86 } },
+    { 0x30BCE0, 2, { 51, 99 } },
+    { 0x30D8D8, 2, { 45, 70 } },
+    { 0x30DC8C, 2, { 51, 84 } },
+    { 0x30ECE0, 2, { 51, 97 } },
+    { 0x310F02, 2, { 28, 77 } },
+    { 0x3113AF, 2, { 3, 25 } },
+    { 0x312987, 2, { 51, 56 } },
+    { 0x3135EA, 2, { 0, 92 } },
+    { 0x314498, 2, { 54, 69 } },
+    { 0x315C25, 2, { 26, 46 } },
+    { 0x316091, 2, { 32, 79 } },
+    { 0x316D50, 2, { 51, 82 } },
+    { 0x31785E, 2, { 21, 43 } },
+    { 0x31C4A5, 2, { 5, 61 } },
+    { 0x31CAE5, 2, { 37, 59 } },
+    { 0x31D9EE, 2, { 40, 60 } },
+    { 0x320299, 2, { 17, 54 } },
+    { 0x327204, 2, { 27, 90 } },
+    { 0x32ACE0, 2, { 51, 94 } },
+    { 0x32B950, 2, { 32, 71 } },
+    { 0x32F856, 2, { 9, 26 } },
+    { 0x3304FE, 2, { 2, 49 } },
+    { 0x3311C5, 2, { 17, 80 } },
+    { 0x331D0C, 2, { 10, 35 } },
+    { 0x334629, 2, { 32, 53 } },
+    { 0x334C7A, 2, { 21, 61 } },
+    { 0x335104, 2, { 69, 93 } },
+    { 0x335B19, 2, { 25, 48 } },
+    { 0x339048, 2, { 71, 74 } },
+    { 0x33A077, 2, { 20, 47 } },
+    { 0x33AB23, 2, { 52, 63 } },
+    { 0x33CD85, 2, { 29, 69 } },
+    { 0x340B1E, 2, { 17, 86 } },
+    { 0x341305, 2, { 17, 101 } },
+    { 0x341701, 2, { 17, 109 } },
+    { 0x341704, 2, { 17, 111 } },
+    { 0x341705, 1, { 17, -1 } },
+    { 0x341725, 2, { 17, 106 } },
+    { 0x341785, 2, { 17, 104 } },
+    { 0x341D38, 2, { 53, 77 } },
+    { 0x341F05, 2, { 17, 100 } },
+    { 0x342F33, 2, { 17, 85 } },
+    { 0x343061, 2, { 29, 51 } },
+    { 0x34381B, 2, { 35, 53 } },
+    { 0x345705, 2, { 17, 97 } },
+    { 0x346010, 2, { 13, 65 } },
+    { 0x34633E, 2, { 10, 32 } },
+    { 0x34CF92, 2, { 22, 48 } },
+    { 0x34D264, 2, { 69, 81 } },
+    { 0x351029, 2, { 66, 76 } },
+    { 0x351705, 2, { 17, 95 } },
+    { 0x353179, 2, { 59, 65 } },
+    { 0x354002, 2, { 25, 73 } },
+    { 0x355104, 2, { 69, 94 } },
+    { 0x355A6F, 2, { 34, 66 } },
+    { 0x359262, 2, { 17, 56 } },
+    { 0x35B1A6, 2, { 40, 42 } },
+    { 0x35C762, 2, { 35, 71 } },
+    { 0x35E241, 2, { 71, 77 } },
+    { 0x35F924, 2, { 19, 38 } },
+    { 0x361705, 2, { 17, 94 } },
+    { 0x363B80, 2, { 77, 79 } },
+    { 0x364409, 2, { 74, 92 } },
+    { 0x365104, 2, { 69, 95 } },
+    { 0x367E5A, 2, { 39, 64 } },
+    { 0x368724, 2, { 3, 22 } },
+    { 0x36A366, 2, { 50, 62 } },
+    { 0x36D370, 2, { 7, 68 } },
+    { 0x371104, 2, { 69, 97 } },
+    { 0x3719BB, 2, { 41, 88 } },
+    { 0x37311B, 2, { 2, 20 } },
+    { 0x3740BD, 2, { 64, 67 } },
+    { 0x374D1F, 2, { 69, 86 } },
+    { 0x375004, 2, { 69, 103 } },
+    { 0x375100, 2, { 69, 109 } },
+    { 0x375104, 1, { 69, -1 } },
+    { 0x375106, 2, { 69, 110 } },
+    { 0x37510C, 2, { 69, 108 } },
+    { 0x375124, 2, { 69, 106 } },
+    { 0x375144, 2, { 69, 105 } },
+    { 0x375184, 2, { 69, 104 } },
+    { 0x375304, 2, { 69, 102 } },
+    { 0x375504, 2, { 69, 101 } },
+    { 0x375904, 2, { 69, 100 } },
+    { 0x3767A6, 2, { 1, 63 } },
+    { 0x376932, 2, { 69, 85 } },
+    { 0x376B5A, 2, { 45, 78 } },
+    { 0x3784EA, 2, { 19, 66 } },
+    { 0x37903E, 2, { 8, 70 } },
+    { 0x379592, 2, { 47, 49 } },
+    { 0x37B1DC, 2, { 69, 83 } },
+    { 0x37D104, 2, { 69, 96 } },
+    { 0x37E653, 2, { 63, 78 } },
+    { 0x37E6F9, 2, { 24, 42 } },
+    { 0x37EAAF, 2, { 1, 45 } },
+    { 0x381223, 2, { 35, 103 } },
+    { 0x381322, 2, { 35, 111 } },
+    { 0x381323, 1, { 35, -1 } },
+    { 0x381327, 2, { 35, 109 } },
+    { 0x38132B, 2, { 35, 108 } },
+    { 0x381333, 2, { 35, 107 } },
+    { 0x381363, 2, { 35, 105 } },
+    { 0x3813A3, 2, { 35, 104 } },
+    { 0x382600, 2, { 77, 99 } },
+    { 0x382A1B, 2, { 77, 86 } },
+    { 0x382B15, 2, { 35, 85 } },
+    { 0x383200, 2, { 77, 101 } },
+    { 0x383323, 2, { 35, 98 } },
+    { 0x383400, 2, { 77, 102 } },
+    { 0x383600, 1, { 77, -1 } },
+    { 0x383604, 2, { 77, 109 } },
+    { 0x383608, 2, { 77, 108 } },
+    { 0x383640, 2, { 77, 105 } },
+    { 0x383680, 2, { 77, 104 } },
+    { 0x383700, 2, { 77, 103 } },
+    { 0x3842BC, 2, { 44, 68 } },
+    { 0x38466C, 2, { 77, 84 } },
+    { 0x385195, 2, { 54, 74 } },
+    { 0x385670, 2, { 52, 90 } },
+    { 0x38634F, 2, { 35, 84 } },
+    { 0x386BD1, 2, { 32, 80 } },
+    { 0x387600, 2, { 77, 97 } },
+    { 0x387EFD, 2, { 1, 26 } },
+    { 0x389323, 2, { 35, 96 } },
+    { 0x38B08D, 2, { 0, 56 } },
+    { 0x38B596, 2, { 18, 67 } },
+    { 0x38B600, 2, { 77, 96 } },
+    { 0x38D6D8, 2, { 77, 83 } },
+    { 0x38F3FB, 2, { 35, 83 } },
+    { 0x38F45A, 2, { 0, 82 } },
+    { 0x39025E, 2, { 27, 45 } },
+    { 0x390DDC, 2, { 0, 85 } },
+    { 0x3925EA, 2, { 0, 99 } },
+    { 0x3934EA, 2, { 0, 103 } },
+    { 0x39356A, 2, { 0, 104 } },
+    { 0x3935AA, 2, { 0, 105 } },
+    { 0x3935EA, 1, { 0, -1 } },
+    { 0x393600, 2, { 77, 95 } },
+    { 0x393DEA, 2, { 0, 100 } },
+    { 0x3942C9, 2, { 74, 80 } },
+    { 0x3958AE, 2, { 62, 68 } },
+    { 0x395C84, 2, { 69, 79 } },
+    { 0x3975EA, 2, { 0, 97 } },
+    { 0x39788D, 2, { 32, 54 } },
+    { 0x398F57, 2, { 27, 63 } },
+    { 0x399644, 2, { 35, 56 } },
+    { 0x39BED2, 2, { 20, 57 } },
+    { 0x39D293, 2, { 35, 82 } },
+    { 0x39D532, 2, { 0, 83 } },
+    { 0x39EE56, 2, { 25, 34 } },
+    { 0x39F43B, 2, { 66, 73 } },
+    { 0x39F7B0, 2, { 77, 82 } },
+    { 0x3A1323, 2, { 35, 94 } },
+    { 0x3A1A85, 2, { 17, 79 } },
+    { 0x3A3600, 2, { 77, 94 } },
+    { 0x3A4409, 2, { 74, 93 } },
+    { 0x3A4730, 2, { 5, 42 } },
+    { 0x3A58B9, 2, { 15, 64 } },
+    { 0x3A8545, 2, { 69, 71 } },
+    { 0x3A87FF, 2, { 4, 72 } },
+    { 0x3B19ED, 2, { 35, 55 } },
+    { 0x3B35EA, 2, { 0, 94 } },
+    { 0x3B6D11, 2, { 32, 93 } },
+    { 0x3B705A, 2, { 45, 91 } },
+    { 0x3B7A3C, 2, { 53, 69 } },
+    { 0x3B89F5, 2, { 38, 73 } },
+    { 0x3BA3A4, 2, { 49, 72 } },
+    { 0x3BA60B, 2, { 31, 66 } },
+    { 0x3BA882, 2, { 70, 90 } },
+    { 0x3BB560, 2, { 77, 81 } },
+    { 0x3BFD53, 2, { 63, 91 } },
+    { 0x3C1705, 2, { 17, 92 } },
+    { 0x3C1B00, 2, { 78, 90 } },
+    { 0x3C3600, 2, { 77, 93 } },
+    { 0x3C38BC, 2, { 8, 91 } },
+    { 0x3C4409, 2, { 74, 94 } },
+    { 0x3C63D2, 2, { 4, 87 } },
+    { 0x3C656C, 2, { 24, 61 } },
+    { 0x3C67DF, 2, { 32, 55 } },
+    { 0x3C87D8, 2, { 51, 53 } },
+    { 0x3C8812, 2, { 73, 89 } },
+    { 0x3C9AF5, 2, { 1, 90 } },
+    { 0x3CA2F7, 2, { 39, 75 } },
+    { 0x3CA7A7, 2, { 21, 60 } },
+    { 0x3CAA81, 2, { 29, 77 } },
+    { 0x3CB278, 2, { 26, 52 } },
+    { 0x3CEE71, 2, { 32, 81 } },
+    { 0x3CFB76, 2, { 11, 20 } },
+    { 0x3D089C, 2, { 33, 67 } },
+    { 0x3D0DA6, 2, { 12, 59 } },
+    { 0x3D35EA, 2, { 0, 93 } },
+    { 0x3D4789, 2, { 49, 87 } },
+    { 0x3D4EC7, 2, { 55, 74 } },
+    { 0x3D78A1, 2, { 51, 71 } },
+    { 0x3DA796, 2, { 3, 66 } },
+    { 0x3DA96B, 2, { 0, 29 } },
+    { 0x3DC769, 2, { 74, 81 } },
+    { 0x3DE10D, 2, { 9, 63 } },
+    { 0x3DE1E9, 2, { 41, 65 } },
+    { 0x3E0409, 2, { 74, 97 } },
+    { 0x3E06BF, 2, { 35, 54 } },
+    { 0x3E3465, 2, { 74, 84 } },
+    { 0x3E4009, 2, { 74, 101 } },
+    { 0x3E4409, 1, { 74, -1 } },
+    { 0x3E440B, 2, { 74, 110 } },
+    { 0x3E440D, 2, { 74, 109 } },
+    { 0x3E4429, 2, { 74, 106 } },
+    { 0x3E4449, 2, { 74, 105 } },
+    { 0x3E4609, 2, { 74, 102 } },
+    { 0x3E4AB8, 2, { 8, 27 } },
+    { 0x3E4C09, 2, { 74, 100 } },
+    { 0x3E5148, 2, { 24, 43 } },
+    { 0x3E5409, 2, { 74, 99 } },
+    { 0x3E6409, 2, { 74, 98 } },
+    { 0x3E6D11, 2, { 32, 95 } },
+    { 0x3E7ADD, 2, { 22, 34 } },
+    { 0x3E7C3F, 2, { 74, 85 } },
+    { 0x3EA4D1, 2, { 74, 83 } },
+    { 0x3EACA1, 2, { 32, 82 } },
+    { 0x3EB785, 2, { 36, 67 } },
+    { 0x3EC409, 2, { 74, 96 } },
+    { 0x3ECEBE, 2, { 16, 44 } },
+    { 0x3F07C4, 2, { 30, 49 } },
+    { 0x3F2076, 2, { 0, 54 } },
+    { 0x3F30C0, 2, { 77, 80 } },
+    { 0x3F5104, 2, { 69, 92 } },
+    { 0x3F6511, 2, { 32, 100 } },
+    { 0x3F6911, 2, { 32, 101 } },
+    { 0x3F6D11, 1, { 32, -1 } },
+    { 0x3F6D13, 2, { 32, 110 } },
+    { 0x3F6D19, 2, { 32, 108 } },
+    { 0x3F6D31, 2, { 32, 106 } },
+    { 0x3F6D51, 2, { 32, 105 } },
+    { 0x3F6D91, 2, { 32, 104 } },
+    { 0x3FAF74, 2, { 58, 59 } },
+    { 0x3FD4AC, 2, { 16, 62 } },
+    { 0x3FEF20, 2, { 48, 66 } },
+    { 0x400000, 1, { 89, -1 } },
+    { 0x400001, 2, { 89, 111 } },
+    { 0x400004, 2, { 89, 109 } },
+    { 0x400008, 2, { 89, 108 } },
+    { 0x400010, 2, { 89, 107 } },
+    { 0x400020, 2, { 89, 106 } },
+    { 0x400040, 2, { 89, 105 } },
+    { 0x400100, 2, { 89, 103 } },
+    { 0x400400, 2, { 89, 101 } },
+    { 0x400800, 2, { 89, 100 } },
+    { 0x401000, 2, { 89, 99 } },
+    { 0x401C1B, 2, { 86, 89 } },
+    { 0x403836, 2, { 85, 89 } },
+    { 0x403D22, 2, { 59, 87 } },
+    { 0x404000, 2, { 89, 97 } },
+    { 0x40521D, 2, { 33, 60 } },
+    { 0x40706C, 2, { 84, 89 } },
+    { 0x408000, 2, { 89, 96 } },
+    { 0x409E2B, 2, { 31, 74 } },
+    { 0x40C0E0, 2, { 51, 76 } },
+    { 0x40C3C1, 2, { 21, 39 } },
+    { 0x40C691, 2, { 60, 75 } },
+    { 0x40C89C, 2, { 3, 35 } },
+    { 0x40E0D8, 2, { 83, 89 } },
+    { 0x40EDBF, 2, { 3, 77 } },
+    { 0x40F19C, 2, { 57, 59 } },
+    { 0x410000, 2, { 89, 95 } },
+    { 0x41147B, 2, { 38, 54 } },
+    { 0x415356, 2, { 4, 12 } },
+    { 0x4159C0, 2, { 50, 90 } },
+    { 0x416C4B, 2, { 13, 87 } },
+    { 0x417C29, 2, { 66, 93 } },
+    { 0x418567, 2, { 56, 89 } },
+    { 0x419B6B, 2, { 15, 40 } },
+    { 0x41C1B0, 2, { 82, 89 } },
+    { 0x41E0A8, 2, { 29, 66 } },
+    { 0x41EE55, 2, { 0, 3 } },
+    { 0x420000, 2, { 89, 94 } },
+    { 0x42428B, 2, { 46, 62 } },
+    { 0x424B1E, 2, { 5, 39 } },
+    { 0x425423, 2, { 19, 51 } },
+    { 0x427AE9, 2, { 66, 80 } },
+    { 0x42802A, 2, { 35, 48 } },
+    { 0x429AB4, 2, { 8, 68 } },
+    { 0x42B380, 2, { 49, 88 } },
+    { 0x42C63F, 2, { 10, 25 } },
+    { 0x42CC1B, 2, { 73, 74 } },
+    { 0x42D5DF, 2, { 49, 58 } },
+    { 0x430ACE, 2, { 55, 89 } },
+    { 0x432C06, 2, { 13, 30 } },
+    { 0x435899, 2, { 44, 46 } },
+    { 0x4369B5, 2, { 54, 66 } },
+    { 0x4375F9, 2, { 5, 67 } },
+    { 0x4388DA, 2, { 22, 71 } },
+    { 0x4397DB, 2, { 4, 88 } },
+    { 0x439D66, 2, { 29, 38 } },
+    { 0x43CC34, 2, { 15, 24 } },
+    { 0x43D359, 2, { 16, 63 } },
+    { 0x43D9FA, 2, { 7, 70 } },
+    { 0x43ED04, 2, { 36, 60 } },
+    { 0x43F184, 2, { 4, 58 } },
+    { 0x440000, 2, { 89, 93 } },
+    { 0x4416B6, 2, { 8, 16 } },
+    { 0x443143, 2, { 17, 34 } },
+    { 0x443A55, 2, { 33, 42 } },
+    { 0x4442E8, 2, { 12, 20 } },
+    { 0x448287, 2, { 38, 81 } },
+    { 0x44AED9, 2, { 42, 75 } },
+    { 0x44BD99, 2, { 66, 82 } },
+    { 0x44BE12, 2, { 73, 77 } },
+    { 0x44D700, 2, { 48, 74 } },
+    { 0x44E4A3, 2, { 14, 70 } },
+    { 0x4501E7, 2, { 38, 94 } },
+    { 0x450C45, 2, { 66, 84 } },
+    { 0x453C29, 2, { 66, 97 } },
+    { 0x45441F, 2, { 66, 85 } },
+    { 0x455C29, 2, { 66, 98 } },
+    { 0x455F5B, 2, { 63, 68 } },
+    { 0x456C29, 2, { 66, 99 } },
+    { 0x457429, 2, { 66, 100 } },
+    { 0x457829, 2, { 66, 101 } },
+    { 0x457C09, 2, { 66, 106 } },
+    { 0x457C21, 2, { 66, 108 } },
+    { 0x457C29, 1, { 66, -1 } },
+    { 0x457C2B, 2, { 66, 110 } },
+    { 0x457C39, 2, { 66, 107 } },
+    { 0x457C69, 2, { 66, 105 } },
+    { 0x457D29, 2, { 66, 103 } },
+    { 0x457E29, 2, { 66, 102 } },
+    { 0x4588A2, 2, { 27, 62 } },
+    { 0x459CF1, 2, { 66, 83 } },
+    { 0x45A9C7, 2, { 19, 69 } },
+    { 0x45B438, 2, { 11, 59 } },
+    { 0x45C4E2, 2, { 6, 47 } },
+    { 0x45D252, 2, { 45, 68 } },
+    { 0x45E328, 2, { 25, 53 } },
+    { 0x45F1E1, 2, { 61, 64 } },
+    { 0x45FE18, 2, { 32, 48 } },
+    { 0x46159C, 2, { 54, 89 } },
+    { 0x4676E7, 2, { 55, 66 } },
+    { 0x468480, 2, { 38, 56 } },
+    { 0x468665, 2, { 20, 88 } },
+    { 0x46AEC5, 2, { 2, 41 } },
+    { 0x46E0B4, 2, { 44, 91 } },
+    { 0x46E5A0, 2, { 5, 23 } },
+    { 0x4701C7, 2, { 38, 106 } },
+    { 0x4701E5, 2, { 38, 110 } },
+    { 0x4701E6, 2, { 38, 111 } },
+    { 0x4701E7, 1, { 38, -1 } },
+    { 0x4701EF, 2, { 38, 108 } },
+    { 0x4701F7, 2, { 38, 107 } },
+    { 0x4705E7, 2, { 38, 101 } },
+    { 0x4706C0, 2, { 80, 89 } },
+    { 0x4711E7, 2, { 38, 99 } },
+    { 0x471DFC, 2, { 38, 86 } },
+    { 0x4739D1, 2, { 38, 85 } },
+    { 0x473D04, 2, { 69, 76 } },
+    { 0x4741E7, 2, { 38, 97 } },
+    { 0x477742, 2, { 34, 69 } },
+    { 0x477C29, 2, { 66, 94 } },
+    { 0x47B6AE, 2, { 3, 32 } },
+    { 0x47EFC8, 2, { 0, 31 } },
+    { 0x480000, 2, { 89, 92 } },
+    { 0x481046, 2, { 34, 77 } },
+    { 0x48210C, 2, { 41, 57 } },
+    { 0x482E0A, 2, { 16, 90 } },
+    { 0x4830EE, 2, { 18, 43 } },
+    { 0x484907, 2, { 22, 54 } },
+    { 0x484BD2, 2, { 49, 65 } },
+    { 0x485A00, 2, { 76, 77 } },
+    { 0x487178, 2, { 7, 91 } },
+    { 0x48775F, 2, { 3, 51 } },
+    { 0x4885AB, 2, { 20, 37 } },
+    { 0x489F17, 2, { 17, 73 } },
+    { 0x48A868, 2, { 66, 71 } },
+    { 0x4913AC, 2, { 0, 34 } },
+    { 0x493902, 2, { 28, 89 } },
+    { 0x4959EA, 2, { 0, 76 } },
+    { 0x496F89, 2, { 4, 65 } },
+    { 0x498810, 2, { 25, 97 } },
+    { 0x49B87C, 2, { 25, 84 } },
+    { 0x49C800, 2, { 25, 107 } },
+    { 0x49C810, 1, { 25, -1 } },
+    { 0x49C814, 2, { 25, 109 } },
+    { 0x49C818, 2, { 25, 108 } },
+    { 0x49C850, 2, { 25, 105 } },
+    { 0x49C910, 2, { 25, 103 } },
+    { 0x49CA10, 2, { 25, 102 } },
+    { 0x49CC10, 2, { 25, 101 } },
+    { 0x49D40B, 2, { 25, 86 } },
+    { 0x49D810, 2, { 25, 99 } },
+    { 0x49E810, 2, { 25, 98 } },
+    { 0x4A04CA, 2, { 18, 61 } },
+    { 0x4A1A3C, 2, { 60, 64 } },
+    { 0x4A299A, 2, { 45, 50 } },
+    { 0x4A4B70, 2, { 25, 81 } },
+    { 0x4A5C9B, 2, { 22, 93 } },
+    { 0x4A7A41, 2, { 1, 44 } },
+    { 0x4AA493, 2, { 50, 63 } },
+    { 0x4AC2DE, 2, { 25, 55 } },
+    { 0x4AD5A6, 2, { 38, 71 } },
+    { 0x4AEBE0, 2, { 19, 35 } },
+    { 0x4AEF39, 2, { 47, 59 } },
+    { 0x4AFBB4, 2, { 44, 78 } },
+    { 0x4B2ADF, 2, { 38, 53 } },
+    { 0x4B6053, 2, { 1, 62 } },
+    { 0x4BBE50, 2, { 13, 47 } },
+    { 0x4BC810, 2, { 25, 94 } },
+    { 0x4BCD29, 2, { 0, 19 } },
+    { 0x4BD916, 2, { 69, 73 } },
+    { 0x4BE1A6, 2, { 62, 78 } },
+    { 0x4C06D9, 2, { 36, 61 } },
+    { 0x4C0FC8, 2, { 10, 38 } },
+    { 0x4C2B38, 2, { 53, 89 } },
+    { 0x4C5C9B, 2, { 22, 94 } },
+    { 0x4C836F, 2, { 40, 67 } },
+    { 0x4CB04E, 2, { 37, 49 } },
+    { 0x4CBCCA, 2, { 19, 74 } },
+    { 0x4D1968, 2, { 43, 75 } },
+    { 0x4D4836, 2, { 44, 70 } },
+    { 0x4D5655, 2, { 22, 55 } },
+    { 0x4D64A8, 2, { 11, 41 } },
+    { 0x4D7C29, 2, { 66, 92 } },
+    { 0x4D9415, 2, { 4, 37 } },
+    { 0x4DC810, 2, { 25, 93 } },
+    { 0x4DC955, 2, { 7, 46 } },
+    { 0x4DD441, 2, { 71, 89 } },
+    { 0x4E099F, 2, { 41, 72 } },
+    { 0x4E0D80, 2, { 79, 89 } },
+    { 0x4E2809, 2, { 74, 76 } },
+    { 0x4E2CF7, 2, { 22, 84 } },
+    { 0x4E4C9B, 2, { 22, 99 } },
+    { 0x4E549B, 2, { 22, 100 } },
+    { 0x4E5C1B, 2, { 22, 104 } },
+    { 0x4E5C9B, 1, { 22, -1 } },
+    { 0x4E5C9F, 2, { 22, 109 } },
+    { 0x4E5CBB, 2, { 22, 106 } },
+    { 0x4E5CDB, 2, { 22, 105 } },
+    { 0x4E5E9B, 2, { 22, 102 } },
+    { 0x4E64AD, 2, { 22, 85 } },
+    { 0x4E7206, 2, { 10, 66 } },
+    { 0x4E76C2, 2, { 31, 51 } },
+    { 0x4E7C9B, 2, { 22, 98 } },
+    { 0x4EA208, 2, { 68, 90 } },
+    { 0x4EBC43, 2, { 22, 83 } },
+    { 0x4ED430, 2, { 24, 67 } },
+    { 0x4EDC9B, 2, { 22, 96 } },
+    { 0x4F2D4C, 2, { 61, 75 } },
+    { 0x4F4B57, 2, { 32, 34 } },
+    { 0x4F4C21, 2, { 14, 91 } },
+    { 0x4F5C9B, 2, { 22, 95 } },
+    { 0x4FB9C0, 2, { 33, 61 } },
+    { 0x4FD9FC, 2, { 22, 56 } },
+    { 0x500000, 2, { 89, 91 } },
+    { 0x500145, 2, { 61, 87 } },
+    { 0x50180A, 2, { 16, 77 } },
+    { 0x502646, 2, { 34, 90 } },
+    { 0x503AF0, 2, { 6, 75 } },
+    { 0x503D29, 2, { 16, 35 } },
+    { 0x506C00, 2, { 76, 90 } },
+    { 0x50AE7C, 2, { 6, 33 } },
+    { 0x50B0AE, 2, { 8, 73 } },
+    { 0x50C404, 2, { 46, 66 } },
+    { 0x50E601, 2, { 68, 74 } },
+    { 0x5123A0, 2, { 24, 49 } },
+    { 0x5150CB, 2, { 42, 47 } },
+    { 0x516E5A, 2, { 48, 63 } },
+    { 0x519E60, 2, { 25, 52 } },
+    { 0x51CF19, 2, { 32, 68 } },
+    { 0x51E674, 2, { 44, 80 } },
+    { 0x51EF3A, 2, { 54, 62 } },
+    { 0x522C1B, 2, { 23, 65 } },
+    { 0x52479B, 2, { 22, 78 } },
+    { 0x527939, 2, { 37, 39 } },
+    { 0x52B9CA, 2, { 38, 46 } },
+    { 0x52E0B4, 2, { 44, 93 } },
+    { 0x52E29E, 2, { 8, 31 } },
+    { 0x52E83D, 2, { 18, 41 } },
+    { 0x52F8C3, 2, { 19, 90 } },
+    { 0x52F9DF, 2, { 43, 57 } },
+    { 0x531165, 2, { 6, 36 } },
+    { 0x5326EC, 2, { 3, 63 } },
+    { 0x536627, 2, { 29, 62 } },
+    { 0x536719, 2, { 14, 53 } },
+    { 0x5374FF, 2, { 40, 49 } },
+    { 0x53FAA6, 2, { 62, 93 } },
+    { 0x545A40, 2, { 7, 53 } },
+    { 0x5479C6, 2, { 62, 81 } },
+    { 0x548808, 2, { 26, 76 } },
+    { 0x54EA2E, 2, { 36, 41 } },
+    { 0x54F068, 2, { 55, 62 } },
+    { 0x552771, 2, { 31, 63 } },
+    { 0x553883, 2, { 47, 60 } },
+    { 0x5563D4, 2, { 44, 81 } },
+    { 0x557C29, 2, { 66, 91 } },
+    { 0x55885F, 2, { 11, 61 } },
+    { 0x55B82D, 2, { 46, 89 } },
+    { 0x55C1A7, 2, { 2, 42 } },
+    { 0x55CD86, 2, { 59, 64 } },
+    { 0x55F419, 2, { 22, 70 } },
+    { 0x55FAA6, 2, { 62, 94 } },
+    { 0x56006C, 2, { 44, 83 } },
+    { 0x5608C4, 2, { 50, 69 } },
+    { 0x560AEB, 2, { 22, 52 } },
+    { 0x561C5E, 2, { 9, 89 } },
+    { 0x567CF8, 2, { 7, 79 } },
+    { 0x5682A5, 2, { 39, 65 } },
+    { 0x5690D8, 2, { 44, 84 } },
+    { 0x569408, 2, { 68, 77 } },
+    { 0x56ABB5, 2, { 8, 48 } },
+    { 0x56B12B, 2, { 35, 68 } },
+    { 0x56E094, 2, { 44, 106 } },
+    { 0x56E0A4, 2, { 44, 107 } },
+    { 0x56E0B4, 1, { 44, -1 } },
+    { 0x56E0F4, 2, { 44, 105 } },
+    { 0x56E1B4, 2, { 44, 103 } },
+    { 0x56E568, 2, { 61, 72 } },
+    { 0x56E8B4, 2, { 44, 100 } },
+    { 0x56FAA6, 2, { 62, 95 } },
+    { 0x570E2D, 2, { 27, 66 } },
+    { 0x571A7E, 2, { 62, 83 } },
+    { 0x574C21, 2, { 14, 92 } },
+    { 0x575537, 2, { 33, 41 } },
+    { 0x5765D3, 2, { 44, 56 } },
+    { 0x577541, 2, { 63, 73 } },
+    { 0x577AA6, 2, { 62, 96 } },
+    { 0x578ACA, 2, { 62, 84 } },
+    { 0x5797E2, 2, { 0, 68 } },
+    { 0x57BAA6, 2, { 62, 97 } },
+    { 0x57BC42, 2, { 65, 67 } },
+    { 0x57C1BB, 2, { 41, 75 } },
+    { 0x57C290, 2, { 62, 85 } },
+    { 0x57DAA6, 2, { 62, 98 } },
+    { 0x57E6BD, 2, { 62, 86 } },
+    { 0x57EAA6, 2, { 62, 99 } },
+    { 0x57F2A6, 2, { 62, 100 } },
+    { 0x57F848, 2, { 45, 73 } },
+    { 0x57F8A6, 2, { 62, 102 } },
+    { 0x57FA26, 2, { 62, 104 } },
+    { 0x57FA86, 2, { 62, 106 } },
+    { 0x57FAA2, 2, { 62, 109 } },
+    { 0x57FAA6, 1, { 62, -1 } },
+    { 0x57FAA7, 2, { 62, 111 } },
+    { 0x57FAAE, 2, { 62, 108 } },
+    { 0x57FAB6, 2, { 62, 107 } },
+    { 0x57FBA6, 2, { 62, 103 } },
+    { 0x57FEA6, 2, { 62, 101 } },
+    { 0x580114, 2, { 7, 84 } },
+    { 0x583178, 2, { 7, 97 } },
+    { 0x58494E, 2, { 7, 85 } },
+    { 0x585670, 2, { 52, 89 } },
+    { 0x586178, 2, { 7, 99 } },
+    { 0x587158, 2, { 7, 106 } },
+    { 0x587168, 2, { 7, 107 } },
+    { 0x587178, 1, { 7, -1 } },
+    { 0x58717A, 2, { 7, 110 } },
+    { 0x5871F8, 2, { 7, 104 } },
+    { 0x587578, 2, { 7, 101 } },
+    { 0x587978, 2, { 7, 100 } },
+    { 0x5891A0, 2, { 7, 83 } },
+    { 0x58B78C, 2, { 5, 20 } },
+    { 0x58DBBF, 2, { 3, 90 } },
+    { 0x58ED34, 2, { 44, 79 } },
+    { 0x58F178, 2, { 7, 96 } },
+    { 0x590EB5, 2, { 60, 72 } },
+    { 0x5959BD, 2, { 14, 54 } },
+    { 0x596729, 2, { 66, 78 } },
+    { 0x596FC0, 2, { 50, 77 } },
+    { 0x598899, 2, { 19, 45 } },
+    { 0x59C29D, 2, { 30, 42 } },
+    { 0x59E6DC, 2, { 1, 66 } },
+    { 0x59F30C, 2, { 68, 69 } },
+    { 0x59F726, 2, { 62, 79 } },
+    { 0x5A10C4, 2, { 12, 23 } },
+    { 0x5A2EE7, 2, { 62, 71 } },
+    { 0x5A3E2A, 2, { 26, 31 } },
+    { 0x5A7178, 2, { 7, 94 } },
+    { 0x5AA446, 2, { 15, 65 } },
+    { 0x5ACB8C, 2, { 44, 53 } },
+    { 0x5AD35E, 2, { 47, 61 } },
+    { 0x5B1AE7, 2, { 38, 78 } },
+    { 0x5B1C5A, 2, { 45, 76 } },
+    { 0x5B34F5, 2, { 44, 71 } },
+    { 0x5B4E6E, 2, { 42, 57 } },
+    { 0x5B7BB6, 2, { 7, 55 } },
+    { 0x5B9B12, 2, { 1, 38 } },
+    { 0x5BA882, 2, { 70, 89 } },
+    { 0x5BD0A0, 2, { 14, 29 } },
+    { 0x5BD19E, 2, { 53, 62 } },
+    { 0x5BDB15, 2, { 34, 63 } },
+    { 0x5BF218, 2, { 7, 81 } },
+    { 0x5C1B00, 2, { 78, 89 } },
+    { 0x5C1CA8, 2, { 39, 58 } },
+    { 0x5C1EFA, 2, { 8, 34 } },
+    { 0x5C3ABE, 2, { 36, 59 } },
+    { 0x5C3FB7, 2, { 3, 26 } },
+    { 0x5C54BC, 2, { 8, 76 } },
+    { 0x5C703D, 2, { 25, 46 } },
+    { 0x5C7AF7, 2, { 39, 88 } },
+    { 0x5C8269, 2, { 5, 49 } },
+    { 0x5C8812, 2, { 73, 90 } },
+    { 0x5CA965, 2, { 38, 70 } },
+    { 0x5CF489, 2, { 10, 62 } },
+    { 0x5D1D16, 2, { 41, 64 } },
+    { 0x5D224F, 2, { 58, 67 } },
+    { 0x5D4C21, 2, { 14, 94 } },
+    { 0x5D6BD7, 2, { 13, 36 } },
+    { 0x5DAAD5, 2, { 30, 60 } },
+    { 0x5DEE9B, 2, { 10, 44 } },
+    { 0x5E0AB6, 2, { 21, 49 } },
+    { 0x5E0EE8, 2, { 51, 68 } },
+    { 0x5E34D1, 2, { 32, 50 } },
+    { 0x5E4042, 2, { 13, 75 } },
+    { 0x5E5C9B, 2, { 22, 91 } },
+    { 0x5E5FDA, 2, { 15, 37 } },
+    { 0x5E64E4, 2, { 7, 54 } },
+    { 0x5E7701, 2, { 26, 48 } },
+    { 0x5E8D91, 2, { 14, 82 } },
+    { 0x5EBE7A, 2, { 12, 39 } },
+    { 0x5EC3A4, 2, { 28, 62 } },
+    { 0x5ED4AB, 2, { 66, 70 } },
+    { 0x5EDA22, 2, { 31, 90 } },
+    { 0x5EE0B4, 2, { 44, 92 } },
+    { 0x5F0C21, 2, { 14, 97 } },
+    { 0x5F112B, 2, { 59, 75 } },
+    { 0x5F1DC9, 2, { 50, 74 } },
+    { 0x5F2626, 2, { 57, 60 } },
+    { 0x5F2EED, 2, { 4, 21 } },
+    { 0x5F3C4D, 2, { 14, 84 } },
+    { 0x5F4821, 2, { 14, 101 } },
+    { 0x5F4C01, 2, { 14, 106 } },
+    { 0x5F4C21, 1, { 14, -1 } },
+    { 0x5F4C29, 2, { 14, 108 } },
+    { 0x5F4D21, 2, { 14, 103 } },
+    { 0x5F503A, 2, { 14, 86 } },
+    { 0x5F5797, 2, { 38, 52 } },
+    { 0x5F6C21, 2, { 14, 98 } },
+    { 0x5F7417, 2, { 14, 85 } },
+    { 0x5F85A7, 2, { 33, 59 } },
+    { 0x5FACF9, 2, { 14, 83 } },
+    { 0x5FD9B6, 2, { 28, 44 } },
+    { 0x5FEA98, 2, { 60, 87 } },
+    { 0x5FFAA6, 2, { 62, 92 } },
+    { 0x600000, 2, { 89, 90 } },
+    { 0x602130, 2, { 14, 32 } },
+    { 0x602E0A, 2, { 16, 92 } },
+    { 0x604778, 2, { 7, 77 } },
+    { 0x60625B, 2, { 7, 35 } },
+    { 0x609312, 2, { 73, 78 } },
+    { 0x609870, 2, { 50, 82 } },
+    { 0x60ABA2, 2, { 62, 69 } },
+    { 0x60AF88, 2, { 68, 79 } },
+    { 0x60BE5F, 2, { 58, 75 } },
+    { 0x60DCA7, 2, { 50, 56 } },
+    { 0x60FCFF, 2, { 64, 65 } },
+    { 0x610D72, 2, { 21, 30 } },
+    { 0x6119C0, 2, { 50, 97 } },
+    { 0x6129AC, 2, { 50, 84 } },
+    { 0x6145DB, 2, { 50, 86 } },
+    { 0x6149C0, 2, { 50, 99 } },
+    { 0x6159C0, 1, { 50, -1 } },
+    { 0x6159C1, 2, { 50, 111 } },
+    { 0x6159C4, 2, { 50, 109 } },
+    { 0x615DC0, 2, { 50, 101 } },
+    { 0x6161F6, 2, { 50, 85 } },
+    { 0x6179C0, 2, { 50, 98 } },
+    { 0x619821, 2, { 26, 66 } },
+    { 0x61B918, 2, { 50, 83 } },
+    { 0x61D9C0, 2, { 50, 96 } },
+    { 0x621C8D, 2, { 12, 75 } },
+    { 0x621E04, 2, { 27, 76 } },
+    { 0x62275E, 2, { 2, 24 } },
+    { 0x6240D7, 2, { 1, 31 } },
+    { 0x62530E, 2, { 50, 55 } },
+    { 0x628930, 2, { 53, 68 } },
+    { 0x62AD11, 2, { 49, 60 } },
+    { 0x62B84A, 2, { 25, 45 } },
+    { 0x62C122, 2, { 31, 78 } },
+    { 0x62DAA0, 2, { 50, 81 } },
+    { 0x62E2B5, 2, { 13, 39 } },
+    { 0x62F0BC, 2, { 20, 42 } },
+    { 0x62F7B1, 2, { 17, 44 } },
+    { 0x62F8C3, 2, { 19, 91 } },
+    { 0x637649, 2, { 68, 71 } },
+    { 0x6385AD, 2, { 5, 30 } },
+    { 0x63894A, 2, { 4, 60 } },
+    { 0x6395CA, 2, { 36, 58 } },
+    { 0x63B3DC, 2, { 39, 59 } },
+    { 0x63E5EF, 2, { 26, 38 } },
+    { 0x640532, 2, { 16, 53 } },
+    { 0x640763, 2, { 37, 64 } },
+    { 0x64E408, 2, { 26, 89 } },
+    { 0x652CC1, 2, { 22, 45 } },
+    { 0x6559C0, 2, { 50, 93 } },
+    { 0x6572A0, 2, { 31, 70 } },
+    { 0x657C29, 2, { 66, 90 } },
+    { 0x6597D9, 2, { 18, 58 } },
+    { 0x659E6B, 2, { 34, 46 } },
+    { 0x65C541, 2, { 29, 50 } },
+    { 0x65F0AC, 2, { 8, 25 } },
+    { 0x6609FC, 2, { 1, 48 } },
+    { 0x66238A, 2, { 16, 79 } },
+    { 0x663A18, 2, { 9, 34 } },
+    { 0x668C52, 2, { 31, 52 } },
+    { 0x6698F4, 2, { 20, 60 } },
+    { 0x66A208, 2, { 68, 92 } },
+    { 0x66B632, 2, { 24, 47 } },
+    { 0x671C69, 2, { 7, 32 } },
+    { 0x672090, 2, { 70, 73 } },
+    { 0x6740EE, 2, { 19, 46 } },
+    { 0x6745AF, 2, { 15, 41 } },
+    { 0x675646, 2, { 51, 62 } },
+    { 0x677A21, 2, { 14, 77 } },
+    { 0x679B0A, 2, { 28, 68 } },
+    { 0x68163C, 2, { 16, 85 } },
+    { 0x68260A, 2, { 16, 100 } },
+    { 0x682E02, 2, { 16, 108 } },
+    { 0x682E08, 2, { 16, 110 } },
+    { 0x682E0A, 1, { 16, -1 } },
+    { 0x682E4A, 2, { 16, 105 } },
+    { 0x682F0A, 2, { 16, 103 } },
+    { 0x6836B9, 2, { 6, 23 } },
+    { 0x683A70, 2, { 52, 76 } },
+    { 0x683E0A, 2, { 16, 99 } },
+    { 0x685E66, 2, { 16, 84 } },
+    { 0x6860C2, 2, { 28, 50 } },
+    { 0x687036, 2, { 34, 52 } },
+    { 0x6897B7, 2, { 32, 62 } },
+    { 0x68AE0A, 2, { 16, 96 } },
+    { 0x68C020, 2, { 12, 64 } },
+    { 0x68C67C, 2, { 9, 31 } },
+    { 0x68D75B, 2, { 40, 72 } },
+    { 0x68E10D, 2, { 27, 48 } },
+    { 0x690BC7, 2, { 36, 65 } },
+    { 0x69303F, 2, { 46, 73 } },
+    { 0x698DA5, 2, { 32, 44 } },
+    { 0x699F24, 2, { 21, 47 } },
+    { 0x69A4C8, 2, { 68, 80 } },
+    { 0x69AB6D, 2, { 16, 56 } },
+    { 0x69BEAF, 2, { 62, 74 } },
+    { 0x6A04AD, 2, { 64, 88 } },
+    { 0x6A2052, 2, { 65, 75 } },
+    { 0x6A2E0A, 2, { 16, 94 } },
+    { 0x6A3E89, 2, { 29, 68 } },
+    { 0x6A57EF, 2, { 10, 50 } },
+    { 0x6A5DAB, 2, { 41, 67 } },
+    { 0x6A62F2, 2, { 58, 64 } },
+    { 0x6A8004, 2, { 24, 72 } },
+    { 0x6A9309, 2, { 48, 91 } },
+    { 0x6AA208, 2, { 68, 93 } },
+    { 0x6AAEB3, 2, { 19, 52 } },
+    { 0x6AB4DE, 2, { 33, 65 } },
+    { 0x6B24C4, 2, { 16, 55 } },
+    { 0x6B395B, 2, { 8, 38 } },
+    { 0x6B470D, 2, { 20, 43 } },
+    { 0x6B634C, 2, { 39, 41 } },
+    { 0x6B8EC4, 2, { 34, 70 } },
+    { 0x6BC482, 2, { 70, 76 } },
+    { 0x6BF248, 2, { 18, 37 } },
+    { 0x6BFD53, 2, { 63, 89 } },
+    { 0x6C2E0A, 2, { 16, 93 } },
+    { 0x6C6297, 2, { 4, 61 } },
+    { 0x6C6429, 2, { 24, 87 } },
+    { 0x6C7700, 2, { 76, 78 } },
+    { 0x6C8812, 2, { 73, 91 } },
+    { 0x6C8F57, 2, { 9, 48 } },
+    { 0x6C9807, 2, { 6, 39 } },
+    { 0x6CA208, 2, { 68, 94 } },
+    { 0x6CA897, 2, { 24, 57 } },
+    { 0x6CBCB3, 2, { 1, 34 } },
+    { 0x6CFCB4, 2, { 38, 63 } },
+    { 0x6D0E48, 2, { 2, 21 } },
+    { 0x6D46CC, 2, { 49, 61 } },
+    { 0x6DA6E0, 2, { 6, 67 } },
+    { 0x6E2208, 2, { 68, 96 } },
+    { 0x6E3376, 2, { 40, 87 } },
+    { 0x6E56B3, 2, { 4, 43 } },
+    { 0x6E5C9B, 2, { 22, 90 } },
+    { 0x6E6236, 2, { 1, 19 } },
+    { 0x6E817A, 2, { 63, 66 } },
+    { 0x6E9A3E, 2, { 68, 85 } },
+    { 0x6EA008, 2, { 68, 102 } },
+    { 0x6EA200, 2, { 68, 108 } },
+    { 0x6EA208, 1, { 68, -1 } },
+    { 0x6EA20C, 2, { 68, 109 } },
+    { 0x6EA218, 2, { 68, 107 } },
+    { 0x6EA248, 2, { 68, 105 } },
+    { 0x6EA288, 2, { 68, 104 } },
+    { 0x6EA308, 2, { 68, 103 } },
+    { 0x6EA608, 2, { 68, 101 } },
+    { 0x6EAA08, 2, { 68, 100 } },
+    { 0x6EB208, 2, { 68, 99 } },
+    { 0x6EBE13, 2, { 68, 86 } },
+    { 0x6ECF4C, 2, { 0, 62 } },
+    { 0x6ED264, 2, { 68, 84 } },
+    { 0x6ED6B4, 2, { 44, 77 } },
+    { 0x6EF397, 2, { 35, 44 } },
+    { 0x6F09D4, 2, { 18, 65 } },
+    { 0x6F207C, 2, { 7, 69 } },
+    { 0x6F276F, 2, { 56, 68 } },
+    { 0x6F2B24, 2, { 46, 48 } },
+    { 0x6F63B8, 2, { 68, 82 } },
+    { 0x6F8697, 2, { 2, 5 } },
+    { 0x6FA208, 2, { 68, 95 } },
+    { 0x6FCCA6, 2, { 62, 77 } },
+    { 0x6FCDF2, 2, { 23, 41 } },
+    { 0x6FD55E, 2, { 0, 44 } },
+    { 0x6FE0C1, 2, { 14, 51 } },
+    { 0x6FE985, 2, { 35, 62 } },
+    { 0x702446, 2, { 34, 102 } },
+    { 0x702644, 2, { 34, 110 } },
+    { 0x702646, 1, { 34, -1 } },
+    { 0x70264E, 2, { 34, 108 } },
+    { 0x702656, 2, { 34, 107 } },
+    { 0x702666, 2, { 34, 106 } },
+    { 0x7026C6, 2, { 34, 104 } },
+    { 0x702746, 2, { 34, 103 } },
+    { 0x704C00, 2, { 76, 98 } },
+    { 0x7050E3, 2, { 38, 69 } },
+    { 0x705436, 2, { 76, 85 } },
+    { 0x70562A, 2, { 34, 84 } },
+    { 0x7063B5, 2, { 24, 36 } },
+    { 0x706400, 2, { 76, 100 } },
+    { 0x706646, 2, { 34, 97 } },
+    { 0x706800, 2, { 76, 101 } },
+    { 0x706C00, 1, { 76, -1 } },
+    { 0x706C01, 2, { 76, 111 } },
+    { 0x706C08, 2, { 76, 108 } },
+    { 0x706C10, 2, { 76, 107 } },
+    { 0x706C80, 2, { 76, 104 } },
+    { 0x706D00, 2, { 76, 103 } },
+    { 0x706E00, 2, { 76, 102 } },
+    { 0x70701B, 2, { 76, 86 } },
+    { 0x708578, 2, { 43, 67 } },
+    { 0x708CD8, 2, { 76, 83 } },
+    { 0x70A32A, 2, { 53, 73 } },
+    { 0x70ACE0, 2, { 51, 89 } },
+    { 0x70C69E, 2, { 34, 83 } },
+    { 0x70D7A2, 2, { 31, 79 } },
+    { 0x70DBBF, 2, { 3, 92 } },
+    { 0x70EC00, 2, { 76, 96 } },
+    { 0x70F8C3, 2, { 19, 94 } },
+    { 0x711F7F, 2, { 40, 75 } },
+    { 0x712646, 2, { 34, 95 } },
+    { 0x713B79, 2, { 37, 57 } },
+    { 0x715C53, 2, { 71, 73 } },
+    { 0x716B2C, 2, { 17, 66 } },
+    { 0x716C00, 2, { 76, 95 } },
+    { 0x717BA3, 2, { 19, 81 } },
+    { 0x71A321, 2, { 34, 56 } },
+    { 0x71ADB0, 2, { 76, 82 } },
+    { 0x71D121, 2, { 2, 58 } },
+    { 0x71E2BD, 2, { 3, 28 } },
+    { 0x71E7F6, 2, { 34, 82 } },
+    { 0x7204BC, 2, { 26, 44 } },
+    { 0x722D2D, 2, { 66, 69 } },
+    { 0x726C00, 2, { 76, 94 } },
+    { 0x7278C3, 2, { 19, 96 } },
+    { 0x728592, 2, { 73, 79 } },
+    { 0x72B15C, 2, { 61, 67 } },
+    { 0x72B8C3, 2, { 19, 97 } },
+    { 0x72B908, 2, { 68, 78 } },
+    { 0x72E8C3, 2, { 19, 99 } },
+    { 0x72F11A, 2, { 31, 53 } },
+    { 0x72F8C2, 2, { 19, 111 } },
+    { 0x72F8C3, 1, { 19, -1 } },
+    { 0x72F8CB, 2, { 19, 108 } },
+    { 0x72F8E3, 2, { 19, 106 } },
+    { 0x72F9C3, 2, { 19, 103 } },
+    { 0x72FAC3, 2, { 19, 102 } },
+    { 0x730E63, 2, { 31, 71 } },
+    { 0x731EAE, 2, { 26, 62 } },
+    { 0x732BC4, 2, { 27, 50 } },
+    { 0x732C88, 2, { 34, 55 } },
+    { 0x733973, 2, { 19, 82 } },
+    { 0x737DA4, 2, { 19, 56 } },
+    { 0x738C2B, 2, { 7, 63 } },
+    { 0x738FBB, 2, { 39, 61 } },
+    { 0x73A526, 2, { 34, 81 } },
+    { 0x73DCAC, 2, { 24, 33 } },
+    { 0x73E876, 2, { 65, 72 } },
+    { 0x73EF60, 2, { 76, 81 } },
+    { 0x73F8C3, 2, { 19, 95 } },
+    { 0x741705, 2, { 17, 89 } },
+    { 0x742646, 2, { 34, 93 } },
+    { 0x742ACD, 2, { 15, 42 } },
+    { 0x74350A, 2, { 16, 78 } },
+    { 0x7436F9, 2, { 18, 40 } },
+    { 0x746C00, 2, { 76, 93 } },
+    { 0x747EDD, 2, { 11, 37 } },
+    { 0x748812, 2, { 73, 92 } },
+    { 0x748E60, 2, { 4, 41 } },
+    { 0x749E89, 2, { 48, 79 } },
+    { 0x74B4FF, 2, { 1, 16 } },
+    { 0x74BAC7, 2, { 29, 34 } },
+    { 0x750A8A, 2, { 68, 70 } },
+    { 0x750C5B, 2, { 65, 87 } },
+    { 0x750FFE, 2, { 3, 71 } },
+    { 0x751521, 2, { 23, 43 } },
+    { 0x75404D, 2, { 47, 58 } },
+    { 0x75AA3B, 2, { 41, 49 } },
+    { 0x75C0E5, 2, { 57, 65 } },
+    { 0x75FE03, 2, { 19, 80 } },
+    { 0x7633DA, 2, { 34, 54 } },
+    { 0x766A9B, 2, { 22, 77 } },
+    { 0x76B831, 2, { 48, 53 } },
+    { 0x76BD9B, 2, { 21, 64 } },
+    { 0x76D63F, 2, { 3, 79 } },
+    { 0x76DA22, 2, { 31, 92 } },
+    { 0x76F478, 2, { 52, 68 } },
+    { 0x76F8C3, 2, { 19, 93 } },
+    { 0x7713EA, 2, { 37, 72 } },
+    { 0x774748, 2, { 48, 71 } },
+    { 0x774C16, 2, { 30, 65 } },
+    { 0x775104, 2, { 69, 89 } },
+    { 0x776AC0, 2, { 76, 80 } },
+    { 0x77863D, 2, { 10, 73 } },
+    { 0x778C19, 2, { 25, 74 } },
+    { 0x77AD07, 2, { 38, 51 } },
+    { 0x77FAA6, 2, { 62, 90 } },
+    { 0x782E0A, 2, { 16, 91 } },
+    { 0x783600, 2, { 77, 89 } },
+    { 0x783B67, 2, { 3, 83 } },
+    { 0x785BBF, 2, { 3, 96 } },
+    { 0x786C00, 2, { 76, 92 } },
+    { 0x787178, 2, { 7, 90 } },
+    { 0x788812, 2, { 73, 93 } },
+    { 0x789309, 2, { 48, 94 } },
+    { 0x789BBF, 2, { 3, 97 } },
+    { 0x78C7A4, 2, { 3, 86 } },
+    { 0x78CAD8, 2, { 23, 60 } },
+    { 0x78D3BF, 2, { 3, 100 } },
+    { 0x78D9BF, 2, { 3, 102 } },
+    { 0x78DABF, 2, { 3, 103 } },
+    { 0x78DB9F, 2, { 3, 106 } },
+    { 0x78DBAF, 2, { 3, 107 } },
+    { 0x78DBB7, 2, { 3, 108 } },
+    { 0x78DBBF, 1, { 3, -1 } },
+    { 0x78E389, 2, { 3, 85 } },
+    { 0x790D9F, 2, { 22, 69 } },
+    { 0x790FB0, 2, { 50, 52 } },
+    { 0x791024, 2, { 72, 88 } },
+    { 0x791069, 2, { 48, 81 } },
+    { 0x7935EA, 2, { 0, 89 } },
+    { 0x7945EE, 2, { 38, 74 } },
+    { 0x794F4E, 2, { 20, 59 } },
+    { 0x795502, 2, { 28, 76 } },
+    { 0x79948D, 2, { 24, 64 } },
+    { 0x7999C7, 2, { 48, 55 } },
+    { 0x79DBBF, 2, { 3, 95 } },
+    { 0x79DCE2, 2, { 31, 80 } },
+    { 0x79F6EC, 2, { 10, 19 } },
+    { 0x7A1138, 2, { 32, 66 } },
+    { 0x7A1309, 2, { 48, 96 } },
+    { 0x7A1B4C, 2, { 11, 58 } },
+    { 0x7A73D1, 2, { 48, 83 } },
+    { 0x7A7D13, 2, { 11, 88 } },
+    { 0x7A8309, 2, { 48, 99 } },
+    { 0x7A8F12, 2, { 48, 86 } },
+    { 0x7A9308, 2, { 48, 111 } },
+    { 0x7A9309, 1, { 48, -1 } },
+    { 0x7A930D, 2, { 48, 109 } },
+    { 0x7A9319, 2, { 48, 107 } },
+    { 0x7A9389, 2, { 48, 104 } },
+    { 0x7A9B09, 2, { 48, 100 } },
+    { 0x7A9D8E, 2, { 54, 73 } },
+    { 0x7AAB3F, 2, { 48, 85 } },
+    { 0x7AD309, 2, { 48, 97 } },
+    { 0x7ADBBF, 2, { 3, 94 } },
+    { 0x7AE365, 2, { 48, 84 } },
+    { 0x7AF142, 2, { 50, 70 } },
+    { 0x7AF8C3, 2, { 19, 92 } },
+    { 0x7B4F2C, 2, { 2, 65 } },
+    { 0x7B52B9, 2, { 48, 82 } },
+    { 0x7B58DF, 2, { 3, 81 } },
+    { 0x7B8ED2, 2, { 73, 80 } },
+    { 0x7B9309, 2, { 48, 95 } },
+    { 0x7BC1C1, 2, { 19, 28 } },
+    { 0x7BC21A, 2, { 8, 62 } },
+    { 0x7BC3D2, 2, { 40, 64 } },
+    { 0x7C07F5, 2, { 62, 63 } },
+    { 0x7C0812, 2, { 73, 96 } },
+    { 0x7C0D7E, 2, { 34, 53 } },
+    { 0x7C68CA, 2, { 73, 83 } },
+    { 0x7C8012, 2, { 73, 100 } },
+    { 0x7C8695, 2, { 48, 54 } },
+    { 0x7C8812, 1, { 73, -1 } },
+    { 0x7C8816, 2, { 73, 109 } },
+    { 0x7C881A, 2, { 73, 108 } },
+    { 0x7C8852, 2, { 73, 105 } },
+    { 0x7C8892, 2, { 73, 104 } },
+    { 0x7C8C12, 2, { 73, 101 } },
+    { 0x7C9570, 2, { 7, 26 } },
+    { 0x7C9812, 2, { 73, 99 } },
+    { 0x7CA290, 2, { 23, 42 } },
+    { 0x7CA812, 2, { 73, 98 } },
+    { 0x7CC812, 2, { 73, 97 } },
+    { 0x7CDA22, 2, { 31, 94 } },
+    { 0x7CDBBF, 2, { 3, 93 } },
+    { 0x7CF5BA, 2, { 21, 33 } },
+    { 0x7CF87E, 2, { 73, 84 } },
+    { 0x7D0D75, 2, { 56, 73 } },
+    { 0x7D1DE7, 2, { 44, 63 } },
+    { 0x7D42C0, 2, { 50, 78 } },
+    { 0x7D49A2, 2, { 73, 82 } },
+    { 0x7D4A29, 2, { 66, 77 } },
+    { 0x7D5942, 2, { 31, 81 } },
+    { 0x7D5A81, 2, { 60, 67 } },
+    { 0x7D6F0A, 2, { 35, 66 } },
+    { 0x7D8812, 2, { 73, 95 } },
+    { 0x7D95C9, 2, { 48, 80 } },
+    { 0x7D9627, 2, { 16, 46 } },
+    { 0x7D9D7C, 2, { 15, 43 } },
+    { 0x7DB841, 2, { 71, 76 } },
+    { 0x7DD21B, 2, { 30, 58 } },
+    { 0x7DF207, 2, { 34, 71 } },
+    { 0x7E0F88, 2, { 29, 48 } },
+    { 0x7E6180, 2, { 76, 79 } },
+    { 0x7E7D65, 2, { 5, 33 } },
+    { 0x7EA208, 2, { 68, 91 } },
+    { 0x7ED222, 2, { 31, 100 } },
+    { 0x7ED3FB, 2, { 19, 53 } },
+    { 0x7EDA22, 1, { 31, -1 } },
+    { 0x7EDA26, 2, { 31, 109 } },
+    { 0x7EDA2A, 2, { 31, 108 } },
+    { 0x7EDA32, 2, { 31, 107 } },
+    { 0x7EDA62, 2, { 31, 105 } },
+    { 0x7EDAA2, 2, { 31, 104 } },
+    { 0x7EDB22, 2, { 31, 103 } },
+    { 0x7EE9E9, 2, { 5, 75 } },
+    { 0x7F37E7, 2, { 38, 77 } },
+    { 0x7F38B7, 2, { 57, 88 } },
+    { 0x7F4C21, 2, { 14, 90 } },
+    { 0x7F5EE8, 2, { 57, 58 } },
+    { 0x7F5F45, 2, { 31, 56 } },
+    { 0x7F70C9, 2, { 12, 30 } },
+    { 0x7FA958, 2, { 15, 61 } },
+    { 0x7FDD7F, 2, { 3, 80 } },
+    { 0x7FDE40, 2, { 47, 65 } },
+    { 0x7FF409, 2, { 87, 88 } },
+    { 0x800000, 1, { 88, -1 } },
+    { 0x800002, 2, { 88, 110 } },
+    { 0x800008, 2, { 88, 108 } },
+    { 0x800010, 2, { 88, 107 } },
+    { 0x800020, 2, { 88, 106 } },
+    { 0x800040, 2, { 88, 105 } },
+    { 0x800080, 2, { 88, 104 } },
+    { 0x800200, 2, { 88, 102 } },
+    { 0x800800, 2, { 88, 100 } },
+    { 0x801000, 2, { 88, 99 } },
+    { 0x801633, 2, { 58, 84 } },
+    { 0x801C1B, 2, { 86, 88 } },
+    { 0x801E91, 2, { 60, 90 } },
+    { 0x802000, 2, { 88, 98 } },
+    { 0x8023C3, 2, { 1, 21 } },
+    { 0x80265F, 2, { 58, 97 } },
+    { 0x803836, 2, { 85, 88 } },
+    { 0x80465F, 2, { 58, 98 } },
+    { 0x8048BF, 2, { 41, 69 } },
+    { 0x80645F, 2, { 58, 102 } },
+    { 0x80661F, 2, { 58, 105 } },
+    { 0x80664F, 2, { 58, 107 } },
+    { 0x80665B, 2, { 58, 109 } },
+    { 0x80665F, 1, { 58, -1 } },
+    { 0x8066DF, 2, { 58, 104 } },
+    { 0x80675F, 2, { 58, 103 } },
+    { 0x806E5F, 2, { 58, 100 } },
+    { 0x80706C, 2, { 84, 88 } },
+    { 0x80765F, 2, { 58, 99 } },
+    { 0x807A44, 2, { 58, 86 } },
+    { 0x808000, 2, { 88, 96 } },
+    { 0x808687, 2, { 58, 83 } },
+    { 0x8092D1, 2, { 26, 42 } },
+    { 0x80A43A, 2, { 32, 59 } },
+    { 0x80DC4B, 2, { 13, 74 } },
+    { 0x80E0D8, 2, { 83, 88 } },
+    { 0x80E65F, 2, { 58, 96 } },
+    { 0x810000, 2, { 88, 95 } },
+    { 0x812E2B, 2, { 31, 87 } },
+    { 0x813C56, 2, { 30, 73 } },
+    { 0x8147ED, 2, { 12, 81 } },
+    { 0x81665F, 2, { 58, 95 } },
+    { 0x8181C0, 2, { 50, 75 } },
+    { 0x818567, 2, { 56, 88 } },
+    { 0x818782, 2, { 20, 38 } },
+    { 0x81A7EF, 2, { 58, 82 } },
+    { 0x81C1B0, 2, { 82, 88 } },
+    { 0x81CB9B, 2, { 3, 72 } },
+    { 0x81DB7E, 2, { 2, 76 } },
+    { 0x81E295, 2, { 31, 57 } },
+    { 0x81E338, 2, { 56, 58 } },
+    { 0x81F553, 2, { 13, 32 } },
+    { 0x820000, 2, { 88, 94 } },
+    { 0x822455, 2, { 12, 83 } },
+    { 0x8228F6, 2, { 37, 53 } },
+    { 0x822AA7, 2, { 16, 64 } },
+    { 0x82448D, 2, { 12, 96 } },
+    { 0x82665F, 2, { 58, 94 } },
+    { 0x82A6AC, 2, { 3, 11 } },
+    { 0x82AA55, 2, { 36, 50 } },
+    { 0x82B380, 2, { 49, 89 } },
+    { 0x82B4E1, 2, { 12, 84 } },
+    { 0x82C08D, 2, { 12, 101 } },
+    { 0x82C40D, 2, { 12, 104 } },
+    { 0x82C48D, 1, { 12, -1 } },
+    { 0x82C4AD, 2, { 12, 106 } },
+    { 0x82D48D, 2, { 12, 99 } },
+    { 0x82D896, 2, { 12, 86 } },
+    { 0x82F852, 2, { 65, 92 } },
+    { 0x83053D, 2, { 12, 82 } },
+    { 0x830ACE, 2, { 55, 88 } },
+    { 0x8336D6, 2, { 14, 39 } },
+    { 0x834FBD, 2, { 2, 19 } },
+    { 0x836C91, 2, { 55, 58 } },
+    { 0x837C1B, 2, { 73, 87 } },
+    { 0x83832D, 2, { 48, 72 } },
+    { 0x838360, 2, { 81, 88 } },
+    { 0x83B0A5, 2, { 57, 73 } },
+    { 0x83C150, 2, { 28, 65 } },
+    { 0x83C48D, 2, { 12, 95 } },
+    { 0x83D78F, 2, { 37, 71 } },
+    { 0x83E53F, 2, { 58, 81 } },
+    { 0x83FA4C, 2, { 20, 66 } },
+    { 0x840000, 2, { 88, 93 } },
+    { 0x84081F, 2, { 61, 63 } },
+    { 0x840B8F, 2, { 7, 39 } },
+    { 0x84665F, 2, { 58, 93 } },
+    { 0x8476D9, 2, { 42, 90 } },
+    { 0x848516, 2, { 45, 61 } },
+    { 0x84963C, 2, { 4, 38 } },
+    { 0x849C81, 2, { 29, 88 } },
+    { 0x84A6A5, 2, { 64, 68 } },
+    { 0x84A846, 2, { 18, 50 } },
+    { 0x84F5D2, 2, { 65, 79 } },
+    { 0x84FA99, 2, { 26, 60 } },
+    { 0x850054, 2, { 34, 47 } },
+    { 0x850DE1, 2, { 10, 37 } },
+    { 0x853568, 2, { 7, 67 } },
+    { 0x856700, 2, { 48, 87 } },
+    { 0x856FFB, 2, { 3, 30 } },
+    { 0x858C7E, 2, { 9, 24 } },
+    { 0x859836, 2, { 72, 73 } },
+    { 0x85996B, 2, { 5, 70 } },
+    { 0x85ABBE, 2, { 48, 57 } },
+    { 0x85C24D, 2, { 12, 80 } },
+    { 0x86159C, 2, { 54, 88 } },
+    { 0x86280D, 2, { 24, 46 } },
+    { 0x863C3B, 2, { 43, 63 } },
+    { 0x866799, 2, { 5, 52 } },
+    { 0x868665, 2, { 20, 89 } },
+    { 0x868B61, 2, { 13, 35 } },
+    { 0x86B132, 2, { 43, 45 } },
+    { 0x86D36A, 2, { 53, 65 } },
+    { 0x86EBF2, 2, { 4, 66 } },
+    { 0x86F501, 2, { 11, 73 } },
+    { 0x8711B4, 2, { 21, 70 } },
+    { 0x87274D, 2, { 30, 48 } },
+    { 0x872C13, 2, { 65, 71 } },
+    { 0x872FB6, 2, { 3, 87 } },
+    { 0x873ACC, 2, { 28, 37 } },
+    { 0x879868, 2, { 14, 23 } },
+    { 0x87A6B2, 2, { 15, 62 } },
+    { 0x87B3F4, 2, { 6, 69 } },
+    { 0x87CFA9, 2, { 49, 66 } },
+    { 0x87DA08, 2, { 35, 59 } },
+    { 0x87DED1, 2, { 19, 47 } },
+    { 0x87E308, 2, { 3, 57 } },
+    { 0x880000, 2, { 88, 92 } },
+    { 0x882D6C, 2, { 7, 15 } },
+    { 0x884E65, 2, { 8, 42 } },
+    { 0x886286, 2, { 16, 33 } },
+    { 0x88665F, 2, { 58, 92 } },
+    { 0x8874AA, 2, { 32, 41 } },
+    { 0x8885D0, 2, { 11, 19 } },
+    { 0x88982F, 2, { 59, 69 } },
+    { 0x88F1D3, 2, { 6, 35 } },
+    { 0x89011B, 2, { 21, 46 } },
+    { 0x89050E, 2, { 37, 80 } },
+    { 0x895DB2, 2, { 41, 74 } },
+    { 0x895F5D, 2, { 28, 58 } },
+    { 0x897B32, 2, { 65, 81 } },
+    { 0x897C24, 2, { 72, 76 } },
+    { 0x89910F, 2, { 40, 52 } },
+    { 0x89AE00, 2, { 47, 73 } },
+    { 0x89C946, 2, { 13, 69 } },
+    { 0x8A03CE, 2, { 37, 93 } },
+    { 0x8A1113, 2, { 11, 76 } },
+    { 0x8A188A, 2, { 65, 83 } },
+    { 0x8A5B55, 2, { 11, 34 } },
+    { 0x8A7852, 2, { 65, 96 } },
+    { 0x8A883E, 2, { 65, 84 } },
+    { 0x8A9A43, 2, { 39, 44 } },
+    { 0x8AB852, 2, { 65, 97 } },
+    { 0x8ABEB6, 2, { 62, 67 } },
+    { 0x8AC48D, 2, { 12, 92 } },
+    { 0x8AD852, 2, { 65, 98 } },
+    { 0x8AE449, 2, { 65, 86 } },
+    { 0x8AE852, 2, { 65, 99 } },
+    { 0x8AF052, 2, { 65, 100 } },
+    { 0x8AF812, 2, { 65, 105 } },
+    { 0x8AF842, 2, { 65, 107 } },
+    { 0x8AF850, 2, { 65, 110 } },
+    { 0x8AF852, 1, { 65, -1 } },
+    { 0x8AF853, 2, { 65, 111 } },
+    { 0x8AF856, 2, { 65, 109 } },
+    { 0x8AF872, 2, { 65, 106 } },
+    { 0x8AF8D2, 2, { 65, 104 } },
+    { 0x8AFA52, 2, { 65, 102 } },
+    { 0x8AFC52, 2, { 65, 101 } },
+    { 0x8B0E2F, 2, { 10, 88 } },
+    { 0x8B2477, 2, { 2, 48 } },
+    { 0x8B39E2, 2, { 65, 82 } },
+    { 0x8B538E, 2, { 18, 68 } },
+    { 0x8B6870, 2, { 10, 58 } },
+    { 0x8B6ECB, 2, { 45, 60 } },
+    { 0x8B7D35, 2, { 56, 65 } },
+    { 0x8B8051, 2, { 39, 62 } },
+    { 0x8BA4A4, 2, { 44, 67 } },
+    { 0x8BC650, 2, { 24, 52 } },
+    { 0x8BE3C2, 2, { 60, 63 } },
+    { 0x8BF852, 2, { 65, 95 } },
+    { 0x8BFC30, 2, { 31, 47 } },
+    { 0x8C262D, 2, { 8, 60 } },
+    { 0x8C2B38, 2, { 53, 88 } },
+    { 0x8C43ED, 2, { 5, 27 } },
+    { 0x8C4D67, 2, { 53, 58 } },
+    { 0x8CEDCE, 2, { 54, 65 } },
+    { 0x8CEF1B, 2, { 22, 49 } },
+    { 0x8D0900, 2, { 37, 55 } },
+    { 0x8D0CCA, 2, { 19, 87 } },
+    { 0x8D519D, 2, { 36, 68 } },
+    { 0x8D5D8A, 2, { 1, 40 } },
+    { 0x8DC168, 2, { 43, 90 } },
+    { 0x8DCB40, 2, { 4, 22 } },
+    { 0x8DD441, 2, { 71, 88 } },
+    { 0x8DFDAD, 2, { 3, 47 } },
+    { 0x8DFE92, 2, { 65, 80 } },
+    { 0x8E038E, 2, { 37, 105 } },
+    { 0x8E03CA, 2, { 37, 109 } },
+    { 0x8E03CC, 2, { 37, 110 } },
+    { 0x8E03CE, 1, { 37, -1 } },
+    { 0x8E03CF, 2, { 37, 111 } },
+    { 0x8E03DE, 2, { 37, 107 } },
+    { 0x8E03EE, 2, { 37, 106 } },
+    { 0x8E0BCE, 2, { 37, 100 } },
+    { 0x8E0D80, 2, { 79, 88 } },
+    { 0x8E1FD5, 2, { 37, 86 } },
+    { 0x8E23CE, 2, { 37, 98 } },
+    { 0x8E3BF8, 2, { 37, 85 } },
+    { 0x8E64D3, 2, { 29, 65 } },
+    { 0x8E73A2, 2, { 37, 84 } },
+    { 0x8E7A08, 2, { 68, 75 } },
+    { 0x8E83CE, 2, { 37, 96 } },
+    { 0x8EA6F9, 2, { 6, 74 } },
+    { 0x8EEE84, 2, { 33, 68 } },
+    { 0x8EF852, 2, { 65, 93 } },
+    { 0x8F0AD5, 2, { 1, 24 } },
+    { 0x8F1EF1, 2, { 34, 57 } },
+    { 0x8F2EEF, 2, { 23, 62 } },
+    { 0x8F2FBB, 2, { 41, 77 } },
+    { 0x8F54B7, 2, { 57, 76 } },
+    { 0x8F6D5C, 2, { 2, 31 } },
+    { 0x8F86A9, 2, { 37, 56 } },
+    { 0x8F8FE1, 2, { 6, 32 } },
+    { 0x8F9809, 2, { 76, 87 } },
+    { 0x900000, 2, { 88, 91 } },
+    { 0x90208C, 2, { 33, 76 } },
+    { 0x903C69, 2, { 5, 79 } },
+    { 0x904218, 2, { 40, 56 } },
+    { 0x905C14, 2, { 15, 89 } },
+    { 0x9061DC, 2, { 17, 42 } },
+    { 0x90665F, 2, { 58, 91 } },
+    { 0x90920E, 2, { 21, 53 } },
+    { 0x9097A4, 2, { 48, 64 } },
+    { 0x90B271, 2, { 51, 60 } },
+    { 0x90B400, 2, { 75, 76 } },
+    { 0x90B689, 2, { 12, 27 } },
+    { 0x90E2F0, 2, { 6, 90 } },
+    { 0x90EEBE, 2, { 2, 50 } },
+    { 0x910B56, 2, { 19, 36 } },
+    { 0x9127A7, 2, { 40, 83 } },
+    { 0x913E2E, 2, { 16, 72 } },
+    { 0x91477F, 2, { 40, 96 } },
+    { 0x9150D0, 2, { 65, 70 } },
+    { 0x915601, 2, { 68, 87 } },
+    { 0x916D77, 2, { 21, 71 } },
+    { 0x919ABF, 2, { 57, 68 } },
+    { 0x91C37F, 2, { 40, 101 } },
+    { 0x91C67F, 2, { 40, 103 } },
+    { 0x91C777, 2, { 40, 108 } },
+    { 0x91C77B, 2, { 40, 109 } },
+    { 0x91C77D, 2, { 40, 110 } },
+    { 0x91C77F, 1, { 40, -1 } },
+    { 0x91D77F, 2, { 40, 99 } },
+    { 0x921547, 2, { 24, 56 } },
+    { 0x921AD1, 2, { 5, 53 } },
+    { 0x9220C3, 2, { 19, 75 } },
+    { 0x927204, 2, { 27, 88 } },
+    { 0x92CDB1, 2, { 40, 55 } },
+    { 0x92DF12, 2, { 3, 64 } },
+    { 0x931020, 2, { 24, 96 } },
+    { 0x9327DD, 2, { 42, 69 } },
+    { 0x9370F8, 2, { 24, 83 } },
+    { 0x938561, 2, { 43, 74 } },
+    { 0x939000, 2, { 24, 106 } },
+    { 0x939020, 1, { 24, -1 } },
+    { 0x939021, 2, { 24, 111 } },
+    { 0x939028, 2, { 24, 108 } },
+    { 0x939030, 2, { 24, 107 } },
+    { 0x9390A0, 2, { 24, 104 } },
+    { 0x939220, 2, { 24, 102 } },
+    { 0x939420, 2, { 24, 101 } },
+    { 0x939820, 2, { 24, 100 } },
+    { 0x939F95, 2, { 36, 76 } },
+    { 0x93A816, 2, { 24, 85 } },
+    { 0x93B020, 2, { 24, 98 } },
+    { 0x93D020, 2, { 24, 97 } },
+    { 0x93D5D3, 2, { 34, 36 } },
+    { 0x940994, 2, { 17, 60 } },
+    { 0x945334, 2, { 44, 49 } },
+    { 0x9496E0, 2, { 24, 80 } },
+    { 0x94B936, 2, { 21, 92 } },
+    { 0x94B971, 2, { 45, 59 } },
+    { 0x94DA39, 2, { 42, 51 } },
+    { 0x94DE8F, 2, { 31, 64 } },
+    { 0x94F482, 2, { 0, 43 } },
+    { 0x954926, 2, { 49, 62 } },
+    { 0x956511, 2, { 13, 63 } },
+    { 0x95776F, 2, { 4, 44 } },
+    { 0x9585BC, 2, { 24, 54 } },
+    { 0x95AB4C, 2, { 37, 70 } },
+    { 0x95D24B, 2, { 35, 43 } },
+    { 0x95D7C0, 2, { 18, 34 } },
+    { 0x95DE72, 2, { 46, 58 } },
+    { 0x95F768, 2, { 43, 77 } },
+    { 0x9631E9, 2, { 5, 92 } },
+    { 0x9655BE, 2, { 37, 52 } },
+    { 0x968CBF, 2, { 64, 73 } },
+    { 0x96C0A6, 2, { 0, 61 } },
+    { 0x96C1BF, 2, { 40, 80 } },
+    { 0x9708EB, 2, { 5, 28 } },
+    { 0x9719BB, 2, { 41, 90 } },
+    { 0x974F95, 2, { 60, 69 } },
+    { 0x975DF3, 2, { 15, 38 } },
+    { 0x977CA0, 2, { 12, 46 } },
+    { 0x979020, 2, { 24, 93 } },
+    { 0x97B22C, 2, { 68, 72 } },
+    { 0x97C34C, 2, { 61, 77 } },
+    { 0x97D2E3, 2, { 40, 54 } },
+    { 0x97DA03, 2, { 16, 87 } },
+    { 0x97E66F, 2, { 35, 61 } },
+    { 0x9803BF, 2, { 3, 75 } },
+    { 0x980DB2, 2, { 35, 60 } },
+    { 0x981F90, 2, { 9, 37 } },
+    { 0x982891, 2, { 60, 77 } },
+    { 0x983839, 2, { 66, 67 } },
+    { 0x985670, 2, { 52, 88 } },
+    { 0x989733, 2, { 3, 33 } },
+    { 0x98B936, 2, { 21, 93 } },
+    { 0x98FE7D, 2, { 28, 40 } },
+    { 0x9906DE, 2, { 39, 66 } },
+    { 0x992B7B, 2, { 0, 60 } },
+    { 0x99609C, 2, { 36, 48 } },
+    { 0x99D66D, 2, { 17, 43 } },
+    { 0x9A22EB, 2, { 34, 64 } },
+    { 0x9A32D0, 2, { 42, 74 } },
+    { 0x9A4B09, 2, { 48, 75 } },
+    { 0x9A68AD, 2, { 64, 76 } },
+    { 0x9A906C, 2, { 43, 69 } },
+    { 0x9A92FD, 2, { 12, 52 } },
+    { 0x9AACAA, 2, { 21, 54 } },
+    { 0x9AC950, 2, { 10, 40 } },
+    { 0x9AF852, 2, { 65, 91 } },
+    { 0x9B1FA3, 2, { 6, 63 } },
+    { 0x9B2107, 2, { 8, 41 } },
+    { 0x9B24D3, 2, { 11, 50 } },
+    { 0x9B282A, 2, { 3, 36 } },
+    { 0x9B2D23, 2, { 26, 59 } },
+    { 0x9B9020, 2, { 24, 92 } },
+    { 0x9B92AA, 2, { 6, 45 } },
+    { 0x9BA882, 2, { 70, 88 } },
+    { 0x9BBBE3, 2, { 37, 46 } },
+    { 0x9BCEDD, 2, { 58, 70 } },
+    { 0x9BE6A3, 2, { 4, 7 } },
+    { 0x9C133E, 2, { 40, 71 } },
+    { 0x9C1B00, 2, { 78, 88 } },
+    { 0x9C31E9, 2, { 5, 94 } },
+    { 0x9C40D9, 2, { 42, 77 } },
+    { 0x9C5012, 2, { 73, 75 } },
+    { 0x9C59EE, 2, { 21, 83 } },
+    { 0x9C9936, 2, { 21, 98 } },
+    { 0x9C9AF5, 2, { 1, 88 } },
+    { 0x9CA936, 2, { 21, 99 } },
+    { 0x9CB836, 2, { 21, 103 } },
+    { 0x9CB934, 2, { 21, 110 } },
+    { 0x9CB936, 1, { 21, -1 } },
+    { 0x9CB93E, 2, { 21, 108 } },
+    { 0x9CB976, 2, { 21, 105 } },
+    { 0x9CB9B6, 2, { 21, 104 } },
+    { 0x9CBD36, 2, { 21, 101 } },
+    { 0x9CC95A, 2, { 21, 84 } },
+    { 0x9CE40C, 2, { 9, 65 } },
+    { 0x9CE4E8, 2, { 41, 63 } },
+    { 0x9CED84, 2, { 30, 50 } },
+    { 0x9CF936, 2, { 21, 97 } },
+    { 0x9D29B7, 2, { 31, 36 } },
+    { 0x9D2A39, 2, { 3, 18 } },
+    { 0x9D4410, 2, { 67, 89 } },
+    { 0x9D7886, 2, { 21, 82 } },
+    { 0x9DA860, 2, { 23, 66 } },
+    { 0x9DB289, 2, { 5, 81 } },
+    { 0x9DB936, 2, { 21, 95 } },
+    { 0x9DEC47, 2, { 40, 53 } },
+    { 0x9E09DF, 2, { 5, 85 } },
+    { 0x9E11E9, 2, { 5, 98 } },
+    { 0x9E21E9, 2, { 5, 99 } },
+    { 0x9E3169, 2, { 5, 104 } },
+    { 0x9E31A9, 2, { 5, 105 } },
+    { 0x9E31E1, 2, { 5, 108 } },
+    { 0x9E31E9, 1, { 5, -1 } },
+    { 0x9E31EB, 2, { 5, 110 } },
+    { 0x9E31ED, 2, { 5, 109 } },
+    { 0x9E33E9, 2, { 5, 102 } },
+    { 0x9E4461, 2, { 24, 71 } },
+    { 0x9E5A98, 2, { 60, 74 } },
+    { 0x9E6177, 2, { 50, 57 } },
+    { 0x9E71E9, 2, { 5, 97 } },
+    { 0x9E96AE, 2, { 31, 33 } },
+    { 0x9E9842, 2, { 13, 90 } },
+    { 0x9EADC9, 2, { 50, 87 } },
+    { 0x9EB936, 2, { 21, 94 } },
+    { 0x9ED131, 2, { 5, 83 } },
+    { 0x9F31E9, 2, { 5, 95 } },
+    { 0x9F407F, 2, { 46, 65 } },
+    { 0x9F628F, 2, { 18, 48 } },
+    { 0x9F7380, 2, { 32, 60 } },
+    { 0x9F7B87, 2, { 36, 73 } },
+    { 0x9FB3F8, 2, { 21, 55 } },
+    { 0x9FC92B, 2, { 59, 90 } },
+    { 0x9FCAFF, 2, { 40, 79 } },
+    { 0x9FF059, 2, { 5, 82 } },
+    { 0xA00000, 2, { 88, 90 } },
+    { 0xA0028A, 2, { 60, 86 } },
+    { 0xA00E91, 2, { 60, 99 } },
+    { 0xA00FF6, 2, { 3, 23 } },
+    { 0xA01529, 2, { 43, 71 } },
+    { 0xA01691, 2, { 60, 100 } },
+    { 0xA01A91, 2, { 60, 101 } },
+    { 0xA01C91, 2, { 60, 102 } },
+    { 0xA01E11, 2, { 60, 104 } },
+    { 0xA01E81, 2, { 60, 107 } },
+    { 0xA01E90, 2, { 60, 111 } },
+    { 0xA01E91, 1, { 60, -1 } },
+    { 0xA01E95, 2, { 60, 109 } },
+    { 0xA01EB1, 2, { 60, 106 } },
+    { 0xA01ED1, 2, { 60, 105 } },
+    { 0xA026A7, 2, { 60, 85 } },
+    { 0xA03014, 2, { 15, 76 } },
+    { 0xA03E91, 2, { 60, 98 } },
+    { 0xA04C8C, 2, { 33, 89 } },
+    { 0xA05E91, 2, { 60, 97 } },
+    { 0xA0665F, 2, { 58, 90 } },
+    { 0xA06EFD, 2, { 60, 84 } },
+    { 0xA075E0, 2, { 5, 74 } },
+    { 0xA07A52, 2, { 15, 34 } },
+    { 0xA08DAF, 2, { 18, 66 } },
+    { 0xA09E91, 2, { 60, 96 } },
+    { 0xA0D800, 2, { 75, 89 } },
+    { 0xA0F2E5, 2, { 39, 73 } },
+    { 0xA0FE49, 2, { 60, 83 } },
+    { 0xA10501, 2, { 63, 65 } },
+    { 0xA11E91, 2, { 60, 95 } },
+    { 0xA15CF8, 2, { 5, 32 } },
+    { 0xA1615C, 2, { 7, 72 } },
+    { 0xA18808, 2, { 45, 65 } },
+    { 0xA1CC02, 2, { 67, 73 } },
+    { 0xA1DF21, 2, { 60, 82 } },
+    { 0xA202B7, 2, { 1, 13 } },
+    { 0xA21E91, 2, { 60, 94 } },
+    { 0xA2210D, 2, { 61, 71 } },
+    { 0xA24740, 2, { 23, 48 } },
+    { 0xA26345, 2, { 42, 54 } },
+    { 0xA28342, 2, { 13, 78 } },
+    { 0xA2A196, 2, { 41, 46 } },
+    { 0xA2C48D, 2, { 12, 90 } },
+    { 0xA2CE1B, 2, { 4, 50 } },
+    { 0xA2DCB4, 2, { 47, 62 } },
+    { 0xA3145F, 2, { 55, 60 } },
+    { 0xA33CC0, 2, { 24, 51 } },
+    { 0xA39E32, 2, { 31, 67 } },
+    { 0xA3CCBD, 2, { 25, 64 } },
+    { 0xA3CCE8, 2, { 43, 79 } },
+    { 0xA3D22B, 2, { 59, 78 } },
+    { 0xA3DE74, 2, { 53, 61 } },
+    { 0xA41E91, 2, { 60, 93 } },
+    { 0xA44EEF, 2, { 42, 85 } },
+    { 0xA456D9, 2, { 42, 98 } },
+    { 0xA45836, 2, { 22, 64 } },
+    { 0xA45C5B, 2, { 23, 73 } },
+    { 0xA461A9, 2, { 59, 70 } },
+    { 0xA472D9, 2, { 42, 101 } },
+    { 0xA47659, 2, { 42, 104 } },
+    { 0xA47699, 2, { 42, 105 } },
+    { 0xA476D8, 2, { 42, 111 } },
+    { 0xA476D9, 1, { 42, -1 } },
+    { 0xA476DB, 2, { 42, 110 } },
+    { 0xA477D9, 2, { 42, 103 } },
+    { 0xA48257, 2, { 26, 58 } },
+    { 0xA48F36, 2, { 21, 77 } },
+    { 0xA4F272, 2, { 36, 38 } },
+    { 0xA530A5, 2, { 33, 66 } },
+    { 0xA55ADD, 2, { 6, 46 } },
+    { 0xA57394, 2, { 37, 45 } },
+    { 0xA5A429, 2, { 66, 75 } },
+    { 0xA5B769, 2, { 42, 82 } },
+    { 0xA5C168, 2, { 43, 92 } },
+    { 0xA5C53C, 2, { 7, 30 } },
+    { 0xA5D07A, 2, { 17, 40 } },
+    { 0xA5F186, 2, { 18, 89 } },
+    { 0xA5F3BE, 2, { 42, 56 } },
+    { 0xA5FE9D, 2, { 37, 63 } },
+    { 0xA607E9, 2, { 5, 77 } },
+    { 0xA622CA, 2, { 5, 35 } },
+    { 0xA64DD8, 2, { 2, 62 } },
+    { 0xA6CC4E, 2, { 28, 61 } },
+    { 0xA6CE32, 2, { 13, 52 } },
+    { 0xA6E9FE, 2, { 39, 48 } },
+    { 0xA6FEAE, 2, { 6, 9 } },
+    { 0xA74D6B, 2, { 33, 38 } },
+    { 0xA77C17, 2, { 42, 55 } },
+    { 0xA78571, 2, { 7, 87 } },
+    { 0xA79F5B, 2, { 52, 59 } },
+    { 0xA7D719, 2, { 48, 67 } },
+    { 0xA7D9E7, 2, { 38, 75 } },
+    { 0xA7DFA5, 2, { 20, 50 } },
+    { 0xA7F54C, 2, { 61, 92 } },
+    { 0xA7F5B9, 2, { 42, 81 } },
+    { 0xA80EAF, 2, { 62, 87 } },
+    { 0xA81E91, 2, { 60, 92 } },
+    { 0xA8246D, 2, { 20, 68 } },
+    { 0xA887AB, 2, { 3, 15 } },
+    { 0xA8B480, 2, { 6, 52 } },
+    { 0xA8C211, 2, { 57, 62 } },
+    { 0xA8F295, 2, { 0, 40 } },
+    { 0xA8F38C, 2, { 61, 80 } },
+    { 0xA91010, 2, { 25, 75 } },
+    { 0xA914BD, 2, { 44, 87 } },
+    { 0xA92793, 2, { 28, 60 } },
+    { 0xA9D45C, 2, { 35, 40 } },
+    { 0xA9D803, 2, { 44, 57 } },
+    { 0xA9E0D0, 2, { 54, 61 } },
+    { 0xA9F17F, 2, { 40, 77 } },
+    { 0xAA04AD, 2, { 64, 89 } },
+    { 0xAA4EE2, 2, { 30, 62 } },
+    { 0xAA7106, 2, { 46, 59 } },
+    { 0xAA7B59, 2, { 42, 79 } },
+    { 0xAAC7A8, 2, { 43, 80 } },
+    { 0xAAF852, 2, { 65, 90 } },
+    { 0xAB02BB, 2, { 41, 78 } },
+    { 0xAB10BE, 2, { 10, 60 } },
+    { 0xAB1605, 2, { 45, 58 } },
+    { 0xAB69CD, 2, { 29, 61 } },
+    { 0xAB705A, 2, { 45, 88 } },
+    { 0xAB834E, 2, { 1, 41 } },
+    { 0xAB9B0C, 2, { 58, 63 } },
+    { 0xABE832, 2, { 21, 69 } },
+    { 0xABF54C, 2, { 61, 93 } },
+    { 0xABFD53, 2, { 63, 88 } },
+    { 0xAC00D8, 2, { 43, 82 } },
+    { 0xAC1188, 2, { 49, 68 } },
+    { 0xAC16F7, 2, { 39, 76 } },
+    { 0xAC35A9, 2, { 53, 60 } },
+    { 0xAC38BC, 2, { 8, 88 } },
+    { 0xAC440F, 2, { 43, 56 } },
+    { 0xAC5CB1, 2, { 34, 39 } },
+    { 0xACF9F0, 2, { 6, 78 } },
+    { 0xAD054A, 2, { 38, 64 } },
+    { 0xAD21B0, 2, { 43, 83 } },
+    { 0xAD2810, 2, { 67, 76 } },
+    { 0xAD576A, 2, { 7, 47 } },
+    { 0xAD6256, 2, { 34, 67 } },
+    { 0xADBB2F, 2, { 27, 59 } },
+    { 0xADC128, 2, { 43, 105 } },
+    { 0xADC148, 2, { 43, 106 } },
+    { 0xADC168, 1, { 43, -1 } },
+    { 0xADC169, 2, { 43, 111 } },
+    { 0xADC1E8, 2, { 43, 104 } },
+    { 0xADC368, 2, { 43, 102 } },
+    { 0xADCAD0, 2, { 60, 71 } },
+    { 0xADD168, 2, { 43, 99 } },
+    { 0xADD429, 2, { 24, 74 } },
+    { 0xADDD73, 2, { 43, 86 } },
+    { 0xADF54C, 2, { 61, 94 } },
+    { 0xAE1311, 2, { 60, 79 } },
+    { 0xAE1C5A, 2, { 26, 65 } },
+    { 0xAE702B, 2, { 56, 61 } },
+    { 0xAE9842, 2, { 13, 91 } },
+    { 0xAE9D09, 2, { 5, 51 } },
+    { 0xAECBA6, 2, { 43, 55 } },
+    { 0xAEEA82, 2, { 62, 72 } },
+    { 0xAEF54C, 2, { 61, 95 } },
+    { 0xAEFB5F, 2, { 2, 14 } },
+    { 0xAF1594, 2, { 61, 83 } },
+    { 0xAF754C, 2, { 61, 96 } },
+    { 0xAF7884, 2, { 64, 66 } },
+    { 0xAF8376, 2, { 40, 74 } },
+    { 0xAF8520, 2, { 61, 84 } },
+    { 0xAFB54C, 2, { 61, 97 } },
+    { 0xAFBCD3, 2, { 19, 67 } },
+    { 0xAFC92B, 2, { 59, 91 } },
+    { 0xAFCD7A, 2, { 61, 85 } },
+    { 0xAFD54C, 2, { 61, 98 } },
+    { 0xAFE54C, 2, { 61, 99 } },
+    { 0xAFE957, 2, { 61, 86 } },
+    { 0xAFF090, 2, { 44, 72 } },
+    { 0xAFF14C, 2, { 61, 101 } },
+    { 0xAFF44C, 2, { 61, 103 } },
+    { 0xAFF50C, 2, { 61, 105 } },
+    { 0xAFF544, 2, { 61, 108 } },
+    { 0xAFF54C, 1, { 61, -1 } },
+    { 0xAFF54E, 2, { 61, 110 } },
+    { 0xAFF55C, 2, { 61, 107 } },
+    { 0xAFF56C, 2, { 61, 106 } },
+    { 0xAFF74C, 2, { 61, 102 } },
+    { 0xAFFD4C, 2, { 61, 100 } },
+    { 0xB00228, 2, { 6, 83 } },
+    { 0xB01E91, 2, { 60, 91 } },
+    { 0xB01F7B, 2, { 41, 80 } },
+    { 0xB047C7, 2, { 37, 74 } },
+    { 0xB04B43, 2, { 19, 49 } },
+    { 0xB05A3B, 2, { 47, 66 } },
+    { 0xB062F0, 2, { 6, 96 } },
+    { 0xB0929C, 2, { 6, 84 } },
+    { 0xB0ACE0, 2, { 51, 88 } },
+    { 0xB0C2F0, 2, { 6, 98 } },
+    { 0xB0CABF, 2, { 51, 58 } },
+    { 0xB0D834, 2, { 25, 72 } },
+    { 0xB0E2B0, 2, { 6, 105 } },
+    { 0xB0E2D0, 2, { 6, 106 } },
+    { 0xB0E2F0, 1, { 6, -1 } },
+    { 0xB0E2F1, 2, { 6, 111 } },
+    { 0xB0E2F4, 2, { 6, 109 } },
+    { 0xB0E3F0, 2, { 6, 103 } },
+    { 0xB0EAF0, 2, { 6, 100 } },
+    { 0xB0F2F0, 2, { 6, 99 } },
+    { 0xB0FEEB, 2, { 6, 86 } },
+    { 0xB10C27, 2, { 41, 54 } },
+    { 0xB12340, 2, { 6, 82 } },
+    { 0xB16EDF, 2, { 32, 37 } },
+    { 0xB16F18, 2, { 4, 19 } },
+    { 0xB1B77E, 2, { 2, 89 } },
+    { 0xB1DA68, 2, { 43, 78 } },
+    { 0xB1E2F0, 2, { 6, 95 } },
+    { 0xB20955, 2, { 5, 8 } },
+    { 0xB21D6A, 2, { 59, 71 } },
+    { 0xB227F5, 2, { 38, 47 } },
+    { 0xB2686D, 2, { 12, 51 } },
+    { 0xB26C95, 2, { 27, 60 } },
+    { 0xB2B37A, 2, { 13, 53 } },
+    { 0xB2CE52, 2, { 65, 77 } },
+    { 0xB2DF80, 2, { 49, 76 } },
+    { 0xB2EB71, 2, { 35, 65 } },
+    { 0xB31132, 2, { 18, 44 } },
+    { 0xB36FB9, 2, { 1, 61 } },
+    { 0xB3853A, 2, { 29, 41 } },
+    { 0xB3B19D, 2, { 4, 34 } },
+    { 0xB3CDB8, 2, { 0, 65 } },
+    { 0xB3E618, 2, { 67, 68 } },
+    { 0xB3EE4C, 2, { 61, 78 } },
+    { 0xB3FBDB, 2, { 4, 76 } },
+    { 0xB40933, 2, { 36, 62 } },
+    { 0xB41375, 2, { 41, 55 } },
+    { 0xB41705, 2, { 17, 88 } },
+    { 0xB42188, 2, { 11, 22 } },
+    { 0xB454FD, 2, { 16, 39 } },
+    { 0xB45DCE, 2, { 61, 70 } },
+    { 0xB476D9, 2, { 42, 91 } },
+    { 0xB47E71, 2, { 6, 29 } },
+    { 0xB49ADB, 2, { 41, 81 } },
+    { 0xB4BC5B, 2, { 65, 74 } },
+    { 0xB4E2F0, 2, { 6, 93 } },
+    { 0xB51321, 2, { 36, 44 } },
+    { 0xB541B3, 2, { 5, 45 } },
+    { 0xB5488C, 2, { 14, 64 } },
+    { 0xB59543, 2, { 32, 65 } },
+    { 0xB59718, 2, { 43, 52 } },
+    { 0xB5A6BC, 2, { 46, 60 } },
+    { 0xB610ED, 2, { 35, 37 } },
+    { 0xB635CE, 2, { 37, 77 } },
+    { 0xB638B4, 2, { 44, 75 } },
+    { 0xB669EA, 2, { 43, 70 } },
+    { 0xB69CDC, 2, { 41, 56 } },
+    { 0xB6EA65, 2, { 20, 76 } },
+    { 0xB6F0A7, 2, { 25, 57 } },
+    { 0xB6F76C, 2, { 6, 54 } },
+    { 0xB711BB, 2, { 41, 100 } },
+    { 0xB718BB, 2, { 41, 103 } },
+    { 0xB7193B, 2, { 41, 104 } },
+    { 0xB719B9, 2, { 41, 110 } },
+    { 0xB719BA, 2, { 41, 111 } },
+    { 0xB719BB, 1, { 41, -1 } },
+    { 0xB719BF, 2, { 41, 109 } },
+    { 0xB71BBB, 2, { 41, 102 } },
+    { 0xB73624, 2, { 0, 37 } },
+    { 0xB7375B, 2, { 58, 69 } },
+    { 0xB74CBF, 2, { 22, 72 } },
+    { 0xB75104, 2, { 69, 88 } },
+    { 0xB759BB, 2, { 41, 97 } },
+    { 0xB769D7, 2, { 41, 84 } },
+    { 0xB7A140, 2, { 13, 28 } },
+    { 0xB7A33C, 2, { 52, 61 } },
+    { 0xB7B62A, 2, { 33, 62 } },
+    { 0xB7C92B, 2, { 59, 92 } },
+    { 0xB7E430, 2, { 6, 80 } },
+    { 0xB83600, 2, { 77, 88 } },
+    { 0xB83950, 2, { 38, 57 } },
+    { 0xB83DF4, 2, { 7, 33 } },
+    { 0xB848E1, 2, { 52, 60 } },
+    { 0xB8505F, 2, { 58, 77 } },
+    { 0xB86D73, 2, { 24, 63 } },
+    { 0xB86DD9, 2, { 42, 78 } },
+    { 0xB8757C, 2, { 35, 58 } },
+    { 0xB87F6E, 2, { 2, 25 } },
+    { 0xB8A978, 2, { 7, 75 } },
+    { 0xB8C86D, 2, { 30, 66 } },
+    { 0xB8E07A, 2, { 24, 45 } },
+    { 0xB8F5EE, 2, { 38, 87 } },
+    { 0xB904D2, 2, { 4, 48 } },
+    { 0xB91024, 2, { 72, 89 } },
+    { 0xB952CA, 2, { 37, 69 } },
+    { 0xB98D89, 2, { 23, 50 } },
+    { 0xB9DCB7, 2, { 54, 59 } },
+    { 0xB9E912, 2, { 9, 61 } },
+    { 0xBA3A2C, 2, { 40, 63 } },
+    { 0xBA449E, 2, { 57, 66 } },
+    { 0xBA4D61, 2, { 46, 61 } },
+    { 0xBA683F, 2, { 3, 49 } },
+    { 0xBA7D13, 2, { 11, 89 } },
+    { 0xBA8820, 2, { 66, 87 } },
+    { 0xBA9842, 2, { 13, 93 } },
+    { 0xBAB725, 2, { 40, 45 } },
+    { 0xBAD7AE, 2, { 12, 35 } },
+    { 0xBAF28D, 2, { 12, 77 } },
+    { 0xBB3283, 2, { 41, 53 } },
+    { 0xBB55AA, 2, { 29, 59 } },
+    { 0xBB7A89, 2, { 22, 47 } },
+    { 0xBBB613, 2, { 60, 70 } },
+    { 0xBBC92B, 2, { 59, 93 } },
+    { 0xBBDD36, 2, { 9, 43 } },
+    { 0xBBF167, 2, { 0, 12 } },
+    { 0xBC156C, 2, { 20, 48 } },
+    { 0xBC1DD0, 2, { 50, 67 } },
+    { 0xBC69A2, 2, { 31, 49 } },
+    { 0xBC6C0D, 2, { 66, 72 } },
+    { 0xBC8084, 2, { 12, 74 } },
+    { 0xBCB936, 2, { 21, 90 } },
+    { 0xBCBFB4, 2, { 14, 36 } },
+    { 0xBCC9C8, 2, { 6, 53 } },
+    { 0xBCE419, 2, { 44, 64 } },
+    { 0xBCEE02, 2, { 25, 47 } },
+    { 0xBD1B22, 2, { 13, 81 } },
+    { 0xBD36B1, 2, { 6, 71 } },
+    { 0xBD4DF9, 2, { 4, 31 } },
+    { 0xBD7CF4, 2, { 11, 38 } },
+    { 0xBD8748, 2, { 27, 61 } },
+    { 0xBDA956, 2, { 65, 69 } },
+    { 0xBDB444, 2, { 30, 89 } },
+    { 0xBDC168, 2, { 43, 91 } },
+    { 0xBDC92B, 2, { 59, 94 } },
+    { 0xBDFE0B, 2, { 62, 64 } },
+    { 0xBDFFC3, 2, { 8, 40 } },
+    { 0xBE089B, 2, { 59, 82 } },
+    { 0xBE11C3, 2, { 38, 72 } },
+    { 0xBE1842, 2, { 13, 96 } },
+    { 0xBE2256, 2, { 58, 74 } },
+    { 0xBE3B92, 2, { 49, 73 } },
+    { 0xBE4409, 2, { 74, 88 } },
+    { 0xBE4C4C, 2, { 56, 59 } },
+    { 0xBE5DDA, 2, { 3, 20 } },
+    { 0xBE789A, 2, { 13, 83 } },
+    { 0xBE9042, 2, { 13, 100 } },
+    { 0xBE9802, 2, { 13, 105 } },
+    { 0xBE9842, 1, { 13, -1 } },
+    { 0xBE9852, 2, { 13, 107 } },
+    { 0xBE9A42, 2, { 13, 102 } },
+    { 0xBEA074, 2, { 13, 85 } },
+    { 0xBEAF2E, 2, { 37, 51 } },
+    { 0xBEC92B, 2, { 59, 95 } },
+    { 0xBED842, 2, { 13, 97 } },
+    { 0xBEE82E, 2, { 13, 84 } },
+    { 0xBEEF57, 2, { 17, 65 } },
+    { 0xBF00AD, 2, { 14, 33 } },
+    { 0xBF0B4E, 2, { 32, 58 } },
+    { 0xBF1FC9, 2, { 4, 73 } },
+    { 0xBF29F3, 2, { 59, 83 } },
+    { 0xBF38B7, 2, { 57, 89 } },
+    { 0xBF492B, 2, { 59, 96 } },
+    { 0xBF59F2, 2, { 13, 82 } },
+    { 0xBF6D11, 2, { 32, 88 } },
+    { 0xBF892B, 2, { 59, 97 } },
+    { 0xBF9421, 2, { 14, 75 } },
+    { 0xBFB36C, 2, { 27, 43 } },
+    { 0xBFB947, 2, { 59, 84 } },
+    { 0xBFC12B, 2, { 59, 100 } },
+    { 0xBFC82B, 2, { 59, 103 } },
+    { 0xBFC90B, 2, { 59, 106 } },
+    { 0xBFC923, 2, { 59, 108 } },
+    { 0xBFC929, 2, { 59, 110 } },
+    { 0xBFC92B, 1, { 59, -1 } },
+    { 0xBFC96B, 2, { 59, 105 } },
+    { 0xBFC9AB, 2, { 59, 104 } },
+    { 0xBFCD2B, 2, { 59, 101 } },
+    { 0xBFD92B, 2, { 59, 99 } },
+    { 0xBFDE5B, 2, { 42, 70 } },
+    { 0xBFE92B, 2, { 59, 98 } },
+    { 0xBFEBE5, 2, { 2, 22 } },
+    { 0xBFF11D, 2, { 59, 85 } },
+    { 0xBFF409, 2, { 87, 89 } },
+    { 0xBFF54C, 2, { 61, 91 } },
+    { 0xC00000, 2, { 88, 89 } },
+    { 0xC014BB, 2, { 4, 81 } },
+    { 0xC04260, 2, { 13, 31 } },
+    { 0xC05C14, 2, { 15, 91 } },
+    { 0xC061F7, 2, { 39, 78 } },
+    { 0xC0665F, 2, { 58, 89 } },
+    { 0xC08EF0, 2, { 6, 76 } },
+    { 0xC093F9, 2, { 20, 54 } },
+    { 0xC0C4B6, 2, { 6, 34 } },
+    { 0xC10307, 2, { 35, 72 } },
+    { 0xC11309, 2, { 31, 59 } },
+    { 0xC12624, 2, { 72, 77 } },
+    { 0xC130E0, 2, { 49, 81 } },
+    { 0xC13117, 2, { 17, 47 } },
+    { 0xC15744, 2, { 61, 68 } },
+    { 0xC15F10, 2, { 67, 78 } },
+    { 0xC174F7, 2, { 45, 64 } },
+    { 0xC17CBE, 2, { 57, 74 } },
+    { 0xC197DB, 2, { 4, 94 } },
+    { 0xC1B94E, 2, { 49, 55 } },
+    { 0xC1F9FE, 2, { 63, 64 } },
+    { 0xC21AE4, 2, { 20, 29 } },
+    { 0xC23380, 2, { 49, 96 } },
+    { 0xC25358, 2, { 49, 83 } },
+    { 0xC2566B, 2, { 4, 82 } },
+    { 0xC28665, 2, { 20, 93 } },
+    { 0xC28BB6, 2, { 49, 85 } },
+    { 0xC29380, 2, { 49, 98 } },
+    { 0xC2AF9B, 2, { 49, 86 } },
+    { 0xC2B380, 1, { 49, -1 } },
+    { 0xC2B382, 2, { 49, 110 } },
+    { 0xC2B388, 2, { 49, 108 } },
+    { 0xC2B3C0, 2, { 49, 105 } },
+    { 0xC2BB80, 2, { 49, 100 } },
+    { 0xC2C3EC, 2, { 49, 84 } },
+    { 0xC2C48D, 2, { 12, 89 } },
+    { 0xC2F380, 2, { 49, 97 } },
+    { 0xC317DB, 2, { 4, 96 } },
+    { 0xC33042, 2, { 25, 65 } },
+    { 0xC336E7, 2, { 49, 56 } },
+    { 0xC37230, 2, { 49, 82 } },
+    { 0xC37CCB, 2, { 23, 70 } },
+    { 0xC393DB, 2, { 4, 101 } },
+    { 0xC396DB, 2, { 4, 103 } },
+    { 0xC3975B, 2, { 4, 104 } },
+    { 0xC397CB, 2, { 4, 107 } },
+    { 0xC397D3, 2, { 4, 108 } },
+    { 0xC397DB, 1, { 4, -1 } },
+    { 0xC397DF, 2, { 4, 109 } },
+    { 0xC3B380, 2, { 49, 95 } },
+    { 0xC3B7DB, 2, { 4, 98 } },
+    { 0xC3D7DB, 2, { 4, 97 } },
+    { 0xC3E7B7, 2, { 4, 84 } },
+    { 0xC42C87, 2, { 39, 52 } },
+    { 0xC4391A, 2, { 11, 74 } },
+    { 0xC43C08, 2, { 26, 75 } },
+    { 0xC44EBC, 2, { 1, 23 } },
+    { 0xC481AE, 2, { 0, 30 } },
+    { 0xC48665, 2, { 20, 94 } },
+    { 0xC4911B, 2, { 4, 80 } },
+    { 0xC4A4C9, 2, { 22, 65 } },
+    { 0xC4A61C, 2, { 49, 54 } },
+    { 0xC4CF49, 2, { 23, 78 } },
+    { 0xC50505, 2, { 20, 81 } },
+    { 0xC51260, 2, { 52, 67 } },
+    { 0xC51A76, 2, { 58, 66 } },
+    { 0xC55A22, 2, { 48, 59 } },
+    { 0xC57094, 2, { 24, 44 } },
+    { 0xC57C29, 2, { 66, 88 } },
+    { 0xC5A07B, 2, { 2, 17 } },
+    { 0xC5A767, 2, { 30, 35 } },
+    { 0xC5B540, 2, { 49, 80 } },
+    { 0xC5C56A, 2, { 12, 38 } },
+    { 0xC5E178, 2, { 19, 41 } },
+    { 0xC5EF62, 2, { 16, 43 } },
+    { 0xC5F186, 2, { 18, 90 } },
+    { 0xC60665, 2, { 20, 96 } },
+    { 0xC63C11, 2, { 8, 64 } },
+    { 0xC63DD9, 2, { 40, 62 } },
+    { 0xC666BD, 2, { 20, 83 } },
+    { 0xC68661, 2, { 20, 109 } },
+    { 0xC68665, 1, { 20, -1 } },
+    { 0xC68675, 2, { 20, 107 } },
+    { 0xC686E5, 2, { 20, 104 } },
+    { 0xC68765, 2, { 20, 103 } },
+    { 0xC68E65, 2, { 20, 100 } },
+    { 0xC6A665, 2, { 20, 98 } },
+    { 0xC6C1E3, 2, { 0, 87 } },
+    { 0xC6C665, 2, { 20, 97 } },
+    { 0xC6EC92, 2, { 67, 70 } },
+    { 0xC70B5A, 2, { 4, 29 } },
+    { 0xC71294, 2, { 3, 59 } },
+    { 0xC72B94, 2, { 35, 57 } },
+    { 0xC747D5, 2, { 20, 82 } },
+    { 0xC7542D, 2, { 72, 74 } },
+    { 0xC767B8, 2, { 38, 58 } },
+    { 0xC775BB, 2, { 41, 76 } },
+    { 0xC78665, 2, { 20, 95 } },
+    { 0xC797DB, 2, { 4, 93 } },
+    { 0xC7C209, 2, { 77, 87 } },
+    { 0xC7CBDE, 2, { 25, 37 } },
+    { 0xC7D275, 2, { 39, 70 } },
+    { 0xC80A64, 2, { 15, 52 } },
+    { 0xC80EC6, 2, { 36, 63 } },
+    { 0xC8394F, 2, { 3, 6 } },
+    { 0xC869B3, 2, { 57, 69 } },
+    { 0xC883CF, 2, { 36, 45 } },
+    { 0xC8A50D, 2, { 69, 87 } },
+    { 0xC8D15D, 2, { 5, 44 } },
+    { 0xC8D449, 2, { 23, 91 } },
+    { 0xC9A45D, 2, { 2, 35 } },
+    { 0xC9AE4F, 2, { 25, 58 } },
+    { 0xC9B607, 2, { 7, 40 } },
+    { 0xC9BDAF, 2, { 10, 49 } },
+    { 0xC9C810, 2, { 25, 88 } },
+    { 0xC9CB4F, 2, { 5, 62 } },
+    { 0xCA04AD, 2, { 64, 90 } },
+    { 0xCA5982, 2, { 21, 44 } },
+    { 0xCA66A9, 2, { 9, 39 } },
+    { 0xCAAD5D, 2, { 20, 53 } },
+    { 0xCAB380, 2, { 49, 92 } },
+    { 0xCAD1F3, 2, { 11, 51 } },
+    { 0xCAD4D1, 2, { 42, 68 } },
+    { 0xCAE540, 2, { 30, 69 } },
+    { 0xCAF852, 2, { 65, 89 } },
+    { 0xCB2553, 2, { 63, 75 } },
+    { 0xCB2FB2, 2, { 17, 57 } },
+    { 0xCB3CD6, 2, { 33, 45 } },
+    { 0xCB621B, 2, { 47, 74 } },
+    { 0xCB7FE7, 2, { 37, 66 } },
+    { 0xCB8A82, 2, { 28, 49 } },
+    { 0xCB91A9, 2, { 41, 73 } },
+    { 0xCBB1DF, 2, { 33, 63 } },
+    { 0xCBE158, 2, { 7, 24 } },
+    { 0xCC13F8, 2, { 0, 47 } },
+    { 0xCC4714, 2, { 15, 78 } },
+    { 0xCC58D3, 2, { 16, 42 } },
+    { 0xCC7430, 2, { 8, 33 } },
+    { 0xCD18A4, 2, { 30, 51 } },
+    { 0xCD31E8, 2, { 19, 59 } },
+    { 0xCD3531, 2, { 35, 47 } },
+    { 0xCD4410, 2, { 67, 91 } },
+    { 0xCD6C64, 2, { 23, 46 } },
+    { 0xCDF9B5, 2, { 38, 65 } },
+    { 0xCE08F3, 2, { 27, 39 } },
+    { 0xCE38D2, 2, { 6, 31 } },
+    { 0xCE4120, 2, { 69, 72 } },
+    { 0xCE81DC, 2, { 18, 45 } },
+    { 0xCE8665, 2, { 20, 92 } },
+    { 0xCE8B5E, 2, { 14, 40 } },
+    { 0xCEAC8C, 2, { 50, 61 } },
+    { 0xCEDA6F, 2, { 2, 32 } },
+    { 0xCEF442, 2, { 13, 76 } },
+    { 0xCF3614, 2, { 27, 67 } },
+    { 0xCF58E9, 2, { 51, 87 } },
+    { 0xCF847B, 2, { 65, 66 } },
+    { 0xCF9457, 2, { 51, 57 } },
+    { 0xCFA52B, 2, { 59, 76 } },
+    { 0xCFCB29, 2, { 8, 36 } },
+    { 0xD02C78, 2, { 15, 84 } },
+    { 0xD038D7, 2, { 34, 60 } },
+    { 0xD0400F, 2, { 15, 86 } },
+    { 0xD04C14, 2, { 15, 99 } },
+    { 0xD051CF, 2, { 39, 53 } },
+    { 0xD05C04, 2, { 15, 107 } },
+    { 0xD05C10, 2, { 15, 109 } },
+    { 0xD05C14, 1, { 15, -1 } },
+    { 0xD05C94, 2, { 15, 104 } },
+    { 0xD05E14, 2, { 15, 102 } },
+    { 0xD06422, 2, { 15, 85 } },
+    { 0xD06D72, 2, { 5, 22 } },
+    { 0xD07291, 2, { 60, 76 } },
+    { 0xD074E0, 2, { 51, 75 } },
+    { 0xD07C14, 2, { 15, 98 } },
+    { 0xD09051, 2, { 67, 71 } },
+    { 0xD0BCCC, 2, { 15, 83 } },
+    { 0xD0C184, 2, { 27, 49 } },
+    { 0xD0D449, 2, { 23, 92 } },
+    { 0xD0E06C, 2, { 33, 51 } },
+    { 0xD10D49, 2, { 11, 45 } },
+    { 0xD12F6E, 2, { 31, 61 } },
+    { 0xD14FEF, 2, { 14, 37 } },
+    { 0xD15C14, 2, { 15, 95 } },
+    { 0xD16B23, 2, { 59, 68 } },
+    { 0xD18040, 2, { 11, 63 } },
+    { 0xD18CF8, 2, { 8, 30 } },
+    { 0xD1AEB6, 2, { 39, 71 } },
+    { 0xD1BB30, 2, { 6, 50 } },
+    { 0xD1C21A, 2, { 26, 47 } },
+    { 0xD1C77F, 2, { 40, 89 } },
+    { 0xD1E5DF, 2, { 4, 27 } },
+    { 0xD2178E, 2, { 35, 64 } },
+    { 0xD2607E, 2, { 45, 72 } },
+    { 0xD27777, 2, { 39, 79 } },
+    { 0xD2ED77, 2, { 63, 72 } },
+    { 0xD31B4A, 2, { 31, 43 } },
+    { 0xD33E48, 2, { 20, 46 } },
+    { 0xD34990, 2, { 67, 79 } },
+    { 0xD356DA, 2, { 15, 55 } },
+    { 0xD37D5E, 2, { 61, 73 } },
+    { 0xD397DB, 2, { 4, 91 } },
+    { 0xD4095A, 2, { 63, 87 } },
+    { 0xD41AD9, 2, { 42, 76 } },
+    { 0xD440A4, 2, { 64, 74 } },
+    { 0xD448ED, 2, { 45, 57 } },
+    { 0xD4509F, 2, { 34, 42 } },
+    { 0xD45B89, 2, { 17, 33 } },
+    { 0xD45C14, 2, { 15, 93 } },
+    { 0xD47D12, 2, { 28, 67 } },
+    { 0xD4A291, 2, { 36, 69 } },
+    { 0xD4AFDE, 2, { 9, 49 } },
+    { 0xD4BB56, 2, { 40, 66 } },
+    { 0xD4FF71, 2, { 23, 53 } },
+    { 0xD50008, 2, { 23, 71 } },
+    { 0xD51AD7, 2, { 3, 43 } },
+    { 0xD52612, 2, { 47, 90 } },
+    { 0xD53E2B, 2, { 12, 62 } },
+    { 0xD54410, 2, { 67, 92 } },
+    { 0xD56645, 2, { 48, 61 } },
+    { 0xD569BC, 2, { 32, 64 } },
+    { 0xD6407B, 2, { 41, 50 } },
+    { 0xD64917, 2, { 30, 63 } },
+    { 0xD64988, 2, { 15, 54 } },
+    { 0xD672B6, 2, { 7, 37 } },
+    { 0xD68665, 2, { 20, 91 } },
+    { 0xD686EB, 2, { 44, 58 } },
+    { 0xD68E1A, 2, { 19, 42 } },
+    { 0xD6C698, 2, { 38, 40 } },
+    { 0xD6D9C9, 2, { 23, 79 } },
+    { 0xD71D88, 2, { 33, 69 } },
+    { 0xD75261, 2, { 43, 48 } },
+    { 0xD78904, 2, { 69, 75 } },
+    { 0xD7E490, 2, { 17, 36 } },
+    { 0xD7E721, 2, { 16, 59 } },
+    { 0xD7FAA6, 2, { 62, 88 } },
+    { 0xD85449, 2, { 23, 96 } },
+    { 0xD85C14, 2, { 15, 92 } },
+    { 0xD85FAF, 2, { 33, 35 } },
+    { 0xD89449, 2, { 23, 97 } },
+    { 0xD8A425, 2, { 23, 84 } },
+    { 0xD8C449, 2, { 23, 99 } },
+    { 0xD8C52E, 2, { 3, 60 } },
+    { 0xD8C852, 2, { 23, 86 } },
+    { 0xD8CB23, 2, { 35, 75 } },
+    { 0xD8D049, 2, { 23, 101 } },
+    { 0xD8D409, 2, { 23, 105 } },
+    { 0xD8D449, 1, { 23, -1 } },
+    { 0xD8D44B, 2, { 23, 110 } },
+    { 0xD8D459, 2, { 23, 107 } },
+    { 0xD8D469, 2, { 23, 106 } },
+    { 0xD8D549, 2, { 23, 103 } },
+    { 0xD8DC49, 2, { 23, 100 } },
+    { 0xD8EC7F, 2, { 23, 85 } },
+    { 0xD8EE00, 2, { 75, 77 } },
+    { 0xD8FECB, 2, { 42, 73 } },
+    { 0xD91024, 2, { 72, 90 } },
+    { 0xD91EAE, 2, { 8, 47 } },
+    { 0xD9300E, 2, { 5, 38 } },
+    { 0xD94410, 2, { 67, 93 } },
+    { 0xD9512E, 2, { 23, 56 } },
+    { 0xD97966, 2, { 0, 33 } },
+    { 0xD9BBB3, 2, { 41, 68 } },
+    { 0xD9D449, 2, { 23, 95 } },
+    { 0xD9F968, 2, { 37, 62 } },
+    { 0xDA1C90, 2, { 1, 20 } },
+    { 0xDA4A2D, 2, { 2, 63 } },
+    { 0xDA6F6B, 2, { 39, 54 } },
+    { 0xDA8D98, 2, { 48, 60 } },
+    { 0xDAD449, 2, { 23, 94 } },
+    { 0xDB1001, 2, { 26, 87 } },
+    { 0xDB4DC0, 2, { 5, 66 } },
+    { 0xDBB58F, 2, { 18, 74 } },
+    { 0xDBC1AB, 2, { 4, 52 } },
+    { 0xDBDE87, 2, { 23, 55 } },
+    { 0xDC4410, 2, { 67, 95 } },
+    { 0xDC5AF7, 2, { 39, 98 } },
+    { 0xDC66EC, 2, { 39, 86 } },
+    { 0xDC72F7, 2, { 39, 100 } },
+    { 0xDC78F7, 2, { 39, 102 } },
+    { 0xDC7AE7, 2, { 39, 107 } },
+    { 0xDC7AF3, 2, { 39, 109 } },
+    { 0xDC7AF6, 2, { 39, 111 } },
+    { 0xDC7AF7, 1, { 39, -1 } },
+    { 0xDC7AFF, 2, { 39, 108 } },
+    { 0xDCAD66, 2, { 3, 42 } },
+    { 0xDCB936, 2, { 21, 89 } },
+    { 0xDCC177, 2, { 56, 67 } },
+    { 0xDCC46C, 2, { 0, 18 } },
+    { 0xDD02F4, 2, { 62, 65 } },
+    { 0xDD2EE7, 2, { 20, 70 } },
+    { 0xDD347C, 2, { 67, 84 } },
+    { 0xDD4010, 2, { 67, 101 } },
+    { 0xDD4400, 2, { 67, 107 } },
+    { 0xDD4410, 1, { 67, -1 } },
+    { 0xDD4411, 2, { 67, 111 } },
+    { 0xDD4418, 2, { 67, 108 } },
+    { 0xDD4430, 2, { 67, 106 } },
+    { 0xDD4490, 2, { 67, 104 } },
+    { 0xDD4510, 2, { 67, 103 } },
+    { 0xDD4610, 2, { 67, 102 } },
+    { 0xDD4C10, 2, { 67, 100 } },
+    { 0xDD5410, 2, { 67, 99 } },
+    { 0xDD55A9, 2, { 64, 69 } },
+    { 0xDD580B, 2, { 67, 86 } },
+    { 0xDD6410, 2, { 67, 98 } },
+    { 0xDD7AF7, 2, { 39, 95 } },
+    { 0xDD7C26, 2, { 67, 85 } },
+    { 0xDD8855, 2, { 15, 71 } },
+    { 0xDDA4C8, 2, { 67, 83 } },
+    { 0xDDAD68, 2, { 43, 76 } },
+    { 0xDDBB47, 2, { 39, 82 } },
+    { 0xDDE2A5, 2, { 18, 35 } },
+    { 0xDDE72E, 2, { 34, 43 } },
+    { 0xDE13A8, 2, { 17, 64 } },
+    { 0xDE31E9, 2, { 5, 89 } },
+    { 0xDE40F8, 2, { 6, 68 } },
+    { 0xDE4EDE, 2, { 55, 67 } },
+    { 0xDE5648, 2, { 45, 47 } },
+    { 0xDE90EB, 2, { 50, 59 } },
+    { 0xDE991B, 2, { 11, 26 } },
+    { 0xDE9C09, 2, { 74, 75 } },
+    { 0xDEC770, 2, { 67, 81 } },
+    { 0xDED015, 2, { 20, 52 } },
+    { 0xDEDB41, 2, { 47, 63 } },
+    { 0xDF0D2E, 2, { 1, 4 } },
+    { 0xDF37B1, 2, { 16, 41 } },
+    { 0xDF38B7, 2, { 57, 90 } },
+    { 0xDF4410, 2, { 67, 94 } },
+    { 0xDF4C21, 2, { 14, 88 } },
+    { 0xDF7039, 2, { 39, 55 } },
+    { 0xDF8CDB, 2, { 4, 78 } },
+    { 0xDF994C, 2, { 61, 76 } },
+    { 0xDF9BE4, 2, { 22, 40 } },
+    { 0xDFB511, 2, { 32, 75 } },
+    { 0xDFC182, 2, { 13, 50 } },
+    { 0xDFD30A, 2, { 34, 61 } },
+    { 0xDFF409, 2, { 87, 90 } },
+    { 0xE0488C, 2, { 33, 101 } },
+    { 0xE04C88, 2, { 33, 109 } },
+    { 0xE04C8C, 1, { 33, -1 } },
+    { 0xE04C8D, 2, { 33, 111 } },
+    { 0xE04C9C, 2, { 33, 107 } },
+    { 0xE04CAC, 2, { 33, 106 } },
+    { 0xE04CCC, 2, { 33, 105 } },
+    { 0xE04D8C, 2, { 33, 103 } },
+    { 0xE04E8C, 2, { 33, 102 } },
+    { 0xE09800, 2, { 75, 97 } },
+    { 0xE0A1C6, 2, { 37, 68 } },
+    { 0xE0A86C, 2, { 75, 84 } },
+    { 0xE0AC54, 2, { 33, 83 } },
+    { 0xE0C41B, 2, { 75, 86 } },
+    { 0xE0C76A, 2, { 23, 35 } },
+    { 0xE0C800, 2, { 75, 99 } },
+    { 0xE0CC8C, 2, { 33, 96 } },
+    { 0xE0D000, 2, { 75, 100 } },
+    { 0xE0D800, 1, { 75, -1 } },
+    { 0xE0D801, 2, { 75, 111 } },
+    { 0xE0D802, 2, { 75, 110 } },
+    { 0xE0D810, 2, { 75, 107 } },
+    { 0xE0D820, 2, { 75, 106 } },
+    { 0xE0D900, 2, { 75, 103 } },
+    { 0xE0DA00, 2, { 75, 102 } },
+    { 0xE0DC00, 2, { 75, 101 } },
+    { 0xE0E036, 2, { 75, 85 } },
+    { 0xE0EBCB, 2, { 5, 31 } },
+    { 0xE0F95B, 2, { 36, 55 } },
+    { 0xE10AF0, 2, { 42, 66 } },
+    { 0xE119B0, 2, { 75, 82 } },
+    { 0xE12EB1, 2, { 1, 30 } },
+    { 0xE14654, 2, { 52, 72 } },
+    { 0xE159C0, 2, { 50, 88 } },
+    { 0xE15D67, 2, { 56, 75 } },
+    { 0xE18D3C, 2, { 33, 82 } },
+    { 0xE1A9D7, 2, { 22, 61 } },
+    { 0xE1AB7F, 2, { 40, 76 } },
+    { 0xE1AF44, 2, { 30, 78 } },
+    { 0xE1B77E, 2, { 2, 91 } },
+    { 0xE1C9EB, 2, { 33, 56 } },
+    { 0xE1D800, 2, { 75, 95 } },
+    { 0xE1E1A3, 2, { 0, 23 } },
+    { 0xE1F186, 2, { 18, 93 } },
+    { 0xE204AD, 2, { 64, 92 } },
+    { 0xE22901, 2, { 32, 67 } },
+    { 0xE23EFE, 2, { 39, 74 } },
+    { 0xE24C8C, 2, { 33, 94 } },
+    { 0xE276F2, 2, { 36, 56 } },
+    { 0xE2B8A6, 2, { 70, 72 } },
+    { 0xE2B9FB, 2, { 5, 73 } },
+    { 0xE2D658, 2, { 16, 65 } },
+    { 0xE2D800, 2, { 75, 94 } },
+    { 0xE2F395, 2, { 36, 95 } },
+    { 0xE2F746, 2, { 18, 80 } },
+    { 0xE30019, 2, { 67, 74 } },
+    { 0xE3134D, 2, { 36, 83 } },
+    { 0xE33DAF, 2, { 28, 64 } },
+    { 0xE34642, 2, { 33, 55 } },
+    { 0xE35B60, 2, { 75, 81 } },
+    { 0xE383F9, 2, { 36, 84 } },
+    { 0xE3A242, 2, { 1, 57 } },
+    { 0xE3B395, 2, { 36, 97 } },
+    { 0xE3C57A, 2, { 2, 27 } },
+    { 0xE3CBA3, 2, { 36, 85 } },
+    { 0xE3CFEC, 2, { 33, 81 } },
+    { 0xE3E395, 2, { 36, 99 } },
+    { 0xE3EF09, 2, { 78, 87 } },
+    { 0xE3F315, 2, { 36, 104 } },
+    { 0xE3F391, 2, { 36, 109 } },
+    { 0xE3F395, 1, { 36, -1 } },
+    { 0xE3F397, 2, { 36, 110 } },
+    { 0xE3F39D, 2, { 36, 108 } },
+    { 0xE3F3B5, 2, { 36, 106 } },
+    { 0xE3F3D5, 2, { 36, 105 } },
+    { 0xE4092D, 2, { 64, 79 } },
+    { 0xE40978, 2, { 25, 43 } },
+    { 0xE40F53, 2, { 2, 46 } },
+    { 0xE45A5A, 2, { 65, 68 } },
+    { 0xE45C8B, 2, { 70, 87 } },
+    { 0xE46289, 2, { 3, 21 } },
+    { 0xE476D9, 2, { 42, 89 } },
+    { 0xE4D800, 2, { 75, 93 } },
+    { 0xE4F186, 2, { 18, 95 } },
+    { 0xE50B24, 2, { 72, 78 } },
+    { 0xE54F1D, 2, { 0, 39 } },
+    { 0xE55733, 2, { 35, 67 } },
+    { 0xE562B8, 2, { 60, 66 } },
+    { 0xE57186, 2, { 18, 96 } },
+    { 0xE57210, 2, { 67, 77 } },
+    { 0xE5D186, 2, { 18, 98 } },
+    { 0xE5E234, 2, { 30, 52 } },
+    { 0xE5E609, 2, { 36, 54 } },
+    { 0xE5ED9D, 2, { 18, 86 } },
+    { 0xE5F184, 2, { 18, 110 } },
+    { 0xE5F186, 1, { 18, -1 } },
+    { 0xE5F196, 2, { 18, 107 } },
+    { 0xE5F1C6, 2, { 18, 105 } },
+    { 0xE5F386, 2, { 18, 102 } },
+    { 0xE5F586, 2, { 18, 101 } },
+    { 0xE61CC6, 2, { 30, 70 } },
+    { 0xE62A3F, 2, { 21, 48 } },
+    { 0xE62F95, 2, { 53, 64 } },
+    { 0xE65788, 2, { 26, 49 } },
+    { 0xE65910, 2, { 33, 54 } },
+    { 0xE672E6, 2, { 18, 81 } },
+    { 0xE6FB48, 2, { 18, 55 } },
+    { 0xE71856, 2, { 6, 62 } },
+    { 0xE71F76, 2, { 38, 60 } },
+    { 0xE74A4C, 2, { 33, 80 } },
+    { 0xE75416, 2, { 27, 47 } },
+    { 0xE76EC7, 2, { 52, 57 } },
+    { 0xE773D3, 2, { 4, 26 } },
+    { 0xE7A279, 2, { 52, 87 } },
+    { 0xE7B853, 2, { 7, 59 } },
+    { 0xE7B958, 2, { 23, 32 } },
+    { 0xE7D0EC, 2, { 64, 71 } },
+    { 0xE7DEC0, 2, { 75, 80 } },
+    { 0xE7F186, 2, { 18, 94 } },
+    { 0xE804AD, 2, { 64, 94 } },
+    { 0xE80C69, 2, { 30, 46 } },
+    { 0xE82E0A, 2, { 16, 88 } },
+    { 0xE8338D, 2, { 59, 62 } },
+    { 0xE84C8C, 2, { 33, 92 } },
+    { 0xE8559A, 2, { 14, 41 } },
+    { 0xE86A14, 2, { 15, 77 } },
+    { 0xE86DF2, 2, { 17, 39 } },
+    { 0xE878A9, 2, { 23, 51 } },
+    { 0xE8BD41, 2, { 43, 66 } },
+    { 0xE8D800, 2, { 75, 92 } },
+    { 0xE8F4AB, 2, { 38, 61 } },
+    { 0xE8FDBA, 2, { 10, 36 } },
+    { 0xE90E63, 2, { 55, 64 } },
+    { 0xE91024, 2, { 72, 91 } },
+    { 0xE91CC0, 2, { 3, 40 } },
+    { 0xE924E9, 2, { 9, 57 } },
+    { 0xE9299F, 2, { 44, 59 } },
+    { 0xE93D12, 2, { 47, 78 } },
+    { 0xE94ED3, 2, { 49, 63 } },
+    { 0xE95315, 2, { 17, 67 } },
+    { 0xE9758E, 2, { 28, 33 } },
+    { 0xE987CD, 2, { 64, 81 } },
+    { 0xE9BCE7, 2, { 1, 47 } },
+    { 0xE9E857, 2, { 9, 87 } },
+    { 0xEA00AD, 2, { 64, 101 } },
+    { 0xEA042D, 2, { 64, 104 } },
+    { 0xEA048D, 2, { 64, 106 } },
+    { 0xEA04A5, 2, { 64, 108 } },
+    { 0xEA04A9, 2, { 64, 109 } },
+    { 0xEA04AC, 2, { 64, 111 } },
+    { 0xEA04AD, 1, { 64, -1 } },
+    { 0xEA04AF, 2, { 64, 110 } },
+    { 0xEA04ED, 2, { 64, 105 } },
+    { 0xEA05AD, 2, { 64, 103 } },
+    { 0xEA0CAD, 2, { 64, 100 } },
+    { 0xEA14AD, 2, { 64, 99 } },
+    { 0xEA1514, 2, { 67, 69 } },
+    { 0xEA18B6, 2, { 64, 86 } },
+    { 0xEA1FFC, 2, { 2, 70 } },
+    { 0xEA24AD, 2, { 64, 98 } },
+    { 0xEA2A42, 2, { 22, 42 } },
+    { 0xEA3C9B, 2, { 64, 85 } },
+    { 0xEA44AD, 2, { 64, 97 } },
+    { 0xEA7D13, 2, { 11, 91 } },
+    { 0xEA84AD, 2, { 64, 96 } },
+    { 0xEA8965, 2, { 61, 66 } },
+    { 0xEAC08F, 2, { 38, 43 } },
+    { 0xEAE475, 2, { 64, 83 } },
+    { 0xEB04AD, 2, { 64, 95 } },
+    { 0xEB42A3, 2, { 10, 33 } },
+    { 0xEB5476, 2, { 40, 48 } },
+    { 0xEB81CA, 2, { 56, 64 } },
+    { 0xEBA192, 2, { 50, 65 } },
+    { 0xEBC51D, 2, { 64, 82 } },
+    { 0xEBD62F, 2, { 10, 75 } },
+    { 0xEBF395, 2, { 36, 92 } },
+    { 0xEBFC06, 2, { 18, 79 } },
+    { 0xEC6685, 2, { 12, 68 } },
+    { 0xEC67B4, 2, { 33, 53 } },
+    { 0xECA809, 2, { 46, 72 } },
+    { 0xECD536, 2, { 21, 76 } },
+    { 0xECD617, 2, { 39, 51 } },
+    { 0xED026D, 2, { 64, 80 } },
+    { 0xED0C41, 2, { 71, 75 } },
+    { 0xED4AB3, 2, { 27, 57 } },
+    { 0xED4F6D, 2, { 40, 73 } },
+    { 0xED7062, 2, { 47, 52 } },
+    { 0xED7B36, 2, { 20, 63 } },
+    { 0xEDAC7E, 2, { 2, 78 } },
+    { 0xEDB444, 2, { 30, 91 } },
+    { 0xEDE8F0, 2, { 51, 67 } },
+    { 0xEDF186, 2, { 18, 92 } },
+    { 0xEDF63F, 2, { 20, 45 } },
+    { 0xEDFE15, 2, { 36, 79 } },
+    { 0xEE17AF, 2, { 5, 34 } },
+    { 0xEE27D4, 2, { 36, 71 } },
+    { 0xEE8B3C, 2, { 8, 49 } },
+    { 0xEE8E90, 2, { 47, 70 } },
+    { 0xEE982C, 2, { 29, 64 } },
+    { 0xEED580, 2, { 75, 79 } },
+    { 0xEEFFA9, 2, { 10, 18 } },
+    { 0xEF0C7A, 2, { 9, 72 } },
+    { 0xEF1832, 2, { 24, 73 } },
+    { 0xEF1D5D, 2, { 31, 40 } },
+    { 0xEF3105, 2, { 15, 32 } },
+    { 0xEF38B7, 2, { 57, 91 } },
+    { 0xEF5A0E, 2, { 37, 50 } },
+    { 0xEF68C3, 2, { 7, 41 } },
+    { 0xEFAED1, 2, { 6, 14 } },
+    { 0xEFF409, 2, { 87, 91 } },
+    { 0xEFF54C, 2, { 61, 89 } },
+    { 0xF03219, 2, { 2, 56 } },
+    { 0xF04019, 2, { 34, 58 } },
+    { 0xF049AB, 2, { 18, 46 } },
+    { 0xF05C14, 2, { 15, 90 } },
+    { 0xF06B5B, 2, { 48, 65 } },
+    { 0xF06C00, 2, { 76, 88 } },
+    { 0xF093E1, 2, { 5, 68 } },
+    { 0xF0B77E, 2, { 2, 95 } },
+    { 0xF0B96D, 2, { 14, 61 } },
+    { 0xF0C4D9, 2, { 13, 22 } },
+    { 0xF0D800, 2, { 75, 91 } },
+    { 0xF0E2F0, 2, { 6, 89 } },
+    { 0xF11024, 2, { 72, 92 } },
+    { 0xF12612, 2, { 47, 93 } },
+    { 0xF1377E, 2, { 2, 96 } },
+    { 0xF18191, 2, { 27, 36 } },
+    { 0xF18F48, 2, { 2, 85 } },
+    { 0xF195B0, 2, { 22, 59 } },
+    { 0xF1A77E, 2, { 2, 99 } },
+    { 0xF1AC2F, 2, { 64, 70 } },
+    { 0xF1B37E, 2, { 2, 101 } },
+    { 0xF1B57E, 2, { 2, 102 } },
+    { 0xF1B73E, 2, { 2, 105 } },
+    { 0xF1B75E, 2, { 2, 106 } },
+    { 0xF1B76E, 2, { 2, 107 } },
+    { 0xF1B77E, 1, { 2, -1 } },
+    { 0xF1BA93, 2, { 29, 47 } },
+    { 0xF1C712, 2, { 2, 84 } },
+    { 0xF1D761, 2, { 20, 69 } },
+    { 0xF21B3E, 2, { 21, 68 } },
+    { 0xF21E0B, 2, { 10, 72 } },
+    { 0xF21F60, 2, { 49, 51 } },
+    { 0xF22048, 2, { 71, 87 } },
+    { 0xF220D2, 2, { 47, 80 } },
+    { 0xF223ED, 2, { 3, 65 } },
+    { 0xF252DD, 2, { 52, 64 } },
+    { 0xF26592, 2, { 41, 66 } },
+    { 0xF28BDC, 2, { 37, 73 } },
+    { 0xF2966D, 2, { 42, 44 } },
+    { 0xF29E9C, 2, { 19, 58 } },
+    { 0xF2AA04, 2, { 27, 75 } },
+    { 0xF2C9E0, 2, { 24, 50 } },
+    { 0xF2E2CB, 2, { 12, 34 } },
+    { 0xF2F8C3, 2, { 19, 88 } },
+    { 0xF3291A, 2, { 23, 63 } },
+    { 0xF33B3B, 2, { 4, 51 } },
+    { 0xF38C7F, 2, { 42, 62 } },
+    { 0xF3A413, 2, { 23, 45 } },
+    { 0xF3B77E, 2, { 2, 94 } },
+    { 0xF3B9C4, 2, { 30, 79 } },
+    { 0xF3DF31, 2, { 53, 87 } },
+    { 0xF42270, 2, { 31, 65 } },
+    { 0xF42612, 2, { 47, 95 } },
+    { 0xF43698, 2, { 10, 57 } },
+    { 0xF47093, 2, { 11, 79 } },
+    { 0xF4A375, 2, { 47, 56 } },
+    { 0xF4C465, 2, { 71, 72 } },
+    { 0xF4C6DF, 2, { 4, 69 } },
+    { 0xF4E7A2, 2, { 47, 82 } },
+    { 0xF4ECF5, 2, { 8, 23 } },
+    { 0xF4FA26, 2, { 10, 87 } },
+    { 0xF51E24, 2, { 47, 85 } },
+    { 0xF52610, 2, { 47, 110 } },
+    { 0xF52612, 1, { 47, -1 } },
+    { 0xF52616, 2, { 47, 109 } },
+    { 0xF5261A, 2, { 47, 108 } },
+    { 0xF52632, 2, { 47, 106 } },
+    { 0xF52712, 2, { 47, 103 } },
+    { 0xF52BFF, 2, { 2, 29 } },
+    { 0xF53612, 2, { 47, 99 } },
+    { 0xF53A09, 2, { 47, 86 } },
+    { 0xF53B1C, 2, { 53, 72 } },
+    { 0xF5567E, 2, { 47, 84 } },
+    { 0xF59ED9, 2, { 6, 66 } },
+    { 0xF5A612, 2, { 47, 96 } },
+    { 0xF5B77E, 2, { 2, 93 } },
+    { 0xF5C6CA, 2, { 47, 83 } },
+    { 0xF5E284, 2, { 49, 69 } },
+    { 0xF5EFCB, 2, { 9, 36 } },
+    { 0xF5F186, 2, { 18, 91 } },
+    { 0xF5F4A1, 2, { 33, 46 } },
+    { 0xF6013B, 2, { 25, 59 } },
+    { 0xF61FAD, 2, { 64, 78 } },
+    { 0xF69E58, 2, { 1, 64 } },
+    { 0xF6A485, 2, { 17, 49 } },
+    { 0xF6A572, 2, { 47, 81 } },
+    { 0xF6B1BE, 2, { 2, 80 } },
+    { 0xF6B943, 2, { 63, 67 } },
+    { 0xF6CD0B, 2, { 28, 87 } },
+    { 0xF6D871, 2, { 3, 37 } },
+    { 0xF6FE25, 2, { 44, 60 } },
+    { 0xF719BB, 2, { 41, 89 } },
+    { 0xF71DA4, 2, { 72, 79 } },
+    { 0xF72612, 2, { 47, 94 } },
+    { 0xF738B7, 2, { 57, 92 } },
+    { 0xF78382, 2, { 18, 27 } },
+    { 0xF78434, 2, { 7, 61 } },
+    { 0xF787A4, 2, { 39, 63 } },
+    { 0xF7E317, 2, { 6, 38 } },
+    { 0xF7E437, 2, { 60, 62 } },
+    { 0xF7F409, 2, { 87, 92 } },
+    { 0xF80091, 2, { 19, 65 } },
+    { 0xF80FEA, 2, { 61, 62 } },
+    { 0xF81024, 2, { 72, 95 } },
+    { 0xF81AFC, 2, { 33, 52 } },
+    { 0xF83E77, 2, { 57, 80 } },
+    { 0xF85B17, 2, { 36, 70 } },
+    { 0xF876A9, 2, { 27, 64 } },
+    { 0xF87D13, 2, { 11, 94 } },
+    { 0xF89543, 2, { 56, 72 } },
+    { 0xF8D194, 2, { 72, 82 } },
+    { 0xF8F253, 2, { 47, 71 } },
+    { 0xF8F2C9, 2, { 80, 87 } },
+    { 0xF90024, 2, { 72, 99 } },
+    { 0xF90C3F, 2, { 72, 86 } },
+    { 0xF91004, 2, { 72, 106 } },
+    { 0xF91024, 1, { 72, -1 } },
+    { 0xF91025, 2, { 72, 111 } },
+    { 0xF9102C, 2, { 72, 108 } },
+    { 0xF91034, 2, { 72, 107 } },
+    { 0xF91064, 2, { 72, 105 } },
+    { 0xF910A4, 2, { 72, 104 } },
+    { 0xF91124, 2, { 72, 103 } },
+    { 0xF91824, 2, { 72, 100 } },
+    { 0xF92AE0, 2, { 6, 25 } },
+    { 0xF93024, 2, { 72, 98 } },
+    { 0xF94520, 2, { 22, 41 } },
+    { 0xF95024, 2, { 72, 97 } },
+    { 0xF96B73, 2, { 1, 18 } },
+    { 0xF99024, 2, { 72, 96 } },
+    { 0xF999A5, 2, { 13, 38 } },
+    { 0xF9B444, 2, { 30, 93 } },
+    { 0xF9B77E, 2, { 2, 92 } },
+    { 0xF9E195, 2, { 54, 87 } },
+    { 0xF9F0FC, 2, { 72, 83 } },
+    { 0xF9FE73, 2, { 11, 81 } },
+    { 0xFA04AD, 2, { 64, 91 } },
+    { 0xFA1AEA, 2, { 55, 72 } },
+    { 0xFA3BCE, 2, { 43, 62 } },
+    { 0xFA4525, 2, { 11, 85 } },
+    { 0xFA5D13, 2, { 11, 98 } },
+    { 0xFA7513, 2, { 11, 100 } },
+    { 0xFA7C13, 2, { 11, 103 } },
+    { 0xFA7D12, 2, { 11, 111 } },
+    { 0xFA7D13, 1, { 11, -1 } },
+    { 0xFA7D53, 2, { 11, 105 } },
+    { 0xFA8580, 2, { 49, 77 } },
+    { 0xFA9309, 2, { 48, 88 } },
+    { 0xFA9344, 2, { 72, 81 } },
+    { 0xFA9452, 2, { 65, 76 } },
+    { 0xFA9DCB, 2, { 11, 83 } },
+    { 0xFAA0A3, 2, { 35, 49 } },
+    { 0xFAB284, 2, { 30, 80 } },
+    { 0xFAB502, 2, { 59, 66 } },
+    { 0xFAB951, 2, { 2, 10 } },
+    { 0xFADE14, 2, { 34, 65 } },
+    { 0xFB1024, 2, { 72, 94 } },
+    { 0xFB2B92, 2, { 47, 79 } },
+    { 0xFB2C4E, 2, { 15, 45 } },
+    { 0xFB38B7, 2, { 57, 93 } },
+    { 0xFB3AF8, 2, { 14, 42 } },
+    { 0xFB7082, 2, { 70, 75 } },
+    { 0xFB7D13, 2, { 11, 95 } },
+    { 0xFB84F8, 2, { 4, 35 } },
+    { 0xFBA147, 2, { 15, 63 } },
+    { 0xFBA436, 2, { 29, 57 } },
+    { 0xFBA5E5, 2, { 36, 52 } },
+    { 0xFBBCA3, 2, { 11, 82 } },
+    { 0xFBE40E, 2, { 33, 70 } },
+    { 0xFBF409, 2, { 87, 93 } },
+    { 0xFC1EAF, 2, { 12, 31 } },
+    { 0xFC1F10, 2, { 28, 47 } },
+    { 0xFC3123, 2, { 30, 56 } },
+    { 0xFC3279, 2, { 55, 57 } },
+    { 0xFC42F5, 2, { 1, 75 } },
+    { 0xFC633F, 2, { 2, 71 } },
+    { 0xFC7769, 2, { 81, 87 } },
+    { 0xFCBBD7, 2, { 57, 81 } },
+    { 0xFCC300, 2, { 75, 78 } },
+    { 0xFCF789, 2, { 49, 74 } },
+    { 0xFCFACA, 2, { 4, 32 } },
+    { 0xFCFB0D, 2, { 19, 37 } },
+    { 0xFCFEC7, 2, { 55, 87 } },
+    { 0xFD38B7, 2, { 57, 94 } },
+    { 0xFD4410, 2, { 67, 90 } },
+    { 0xFD7BD3, 2, { 11, 80 } },
+    { 0xFD8CA5, 2, { 29, 72 } },
+    { 0xFDA444, 2, { 30, 99 } },
+    { 0xFDA7F6, 2, { 18, 52 } },
+    { 0xFDA85F, 2, { 30, 86 } },
+    { 0xFDB444, 1, { 30, -1 } },
+    { 0xFDB44C, 2, { 30, 108 } },
+    { 0xFDB454, 2, { 30, 107 } },
+    { 0xFDB464, 2, { 30, 106 } },
+    { 0xFDB4C4, 2, { 30, 104 } },
+    { 0xFDB544, 2, { 30, 103 } },
+    { 0xFDB644, 2, { 30, 102 } },
+    { 0xFDD3D2, 2, { 4, 74 } },
+    { 0xFDF409, 2, { 87, 94 } },
+    { 0xFE283D, 2, { 10, 47 } },
+    { 0xFE35B9, 2, { 82, 87 } },
+    { 0xFE38B7, 2, { 57, 95 } },
+    { 0xFE4C9F, 2, { 12, 73 } },
+    { 0xFE6FCE, 2, { 37, 76 } },
+    { 0xFE716E, 2, { 56, 87 } },
+    { 0xFE9546, 2, { 20, 35 } },
+    { 0xFE9842, 2, { 13, 89 } },
+    { 0xFEBC7D, 2, { 31, 58 } },
+    { 0xFEBDD0, 2, { 56, 57 } },
+    { 0xFEBE8A, 2, { 30, 55 } },
+    { 0xFED1AB, 2, { 25, 41 } },
+    { 0xFEE192, 2, { 11, 29 } },
+    { 0xFEF409, 2, { 87, 95 } },
+    { 0xFEF907, 2, { 57, 82 } },
+    { 0xFF0081, 2, { 57, 85 } },
+    { 0xFF14D1, 2, { 83, 87 } },
+    { 0xFF28B7, 2, { 57, 99 } },
+    { 0xFF3837, 2, { 57, 104 } },
+    { 0xFF3897, 2, { 57, 106 } },
+    { 0xFF38B7, 1, { 57, -1 } },
+    { 0xFF38BF, 2, { 57, 108 } },
+    { 0xFF39B7, 2, { 57, 103 } },
+    { 0xFF3AB7, 2, { 57, 102 } },
+    { 0xFF3CB7, 2, { 57, 101 } },
+    { 0xFF52B0, 2, { 14, 60 } },
+    { 0xFF6577, 2, { 40, 68 } },
+    { 0xFF78B7, 2, { 57, 97 } },
+    { 0xFF8465, 2, { 84, 87 } },
+    { 0xFFB38F, 2, { 0, 20 } },
+    { 0xFFB409, 2, { 87, 97 } },
+    { 0xFFB8B7, 2, { 57, 96 } },
+    { 0xFFBAFE, 2, { 2, 79 } },
+    { 0xFFBC80, 2, { 46, 64 } },
+    { 0xFFC92B, 2, { 59, 89 } },
+    { 0xFFCC3F, 2, { 85, 87 } },
+    { 0xFFD409, 2, { 87, 98 } },
+    { 0xFFD86F, 2, { 57, 83 } },
+    { 0xFFE409, 2, { 87, 99 } },
+    { 0xFFE812, 2, { 86, 87 } },
+    { 0xFFF009, 2, { 87, 101 } },
+    { 0xFFF408, 2, { 87, 111 } },
+    { 0xFFF409, 1, { 87, -1 } },
+    { 0xFFF40D, 2, { 87, 109 } },
+    { 0xFFF419, 2, { 87, 107 } },
+    { 0xFFF429, 2, { 87, 106 } },
+    { 0xFFF449, 2, { 87, 105 } },
+    { 0xFFF489, 2, { 87, 104 } },
+    { 0xFFF509, 2, { 87, 103 } },
+};
+
+const struct precomputed_error_table modesPrecomputedErrorTables[] = {
+    { 56, 1, 1, table_56_1_1, sizeof(table_56_1_1) / sizeof(struct errorinfo) },
+    { 112, 1, 1, table_112_1_1, sizeof(table_112_1_1) / sizeof(struct errorinfo) },
+    { 56, 2, 4, table_56_2_4, sizeof(table_56_2_4) / sizeof(struct errorinfo) },
+    { 112, 2, 4, table_112_2_4, sizeof(table_112_2_4) / sizeof(struct errorinfo) },
+};
+
+const unsigned modesPrecomputedErrorTableCount = sizeof(modesPrecomputedErrorTables) / sizeof(modesPrecomputedErrorTables[0]);
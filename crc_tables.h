@@ -0,0 +1,38 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// crc_tables.h: build-time error correction tables (see crc_tables.c)
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DUMP1090_CRC_TABLES_H
+#define DUMP1090_CRC_TABLES_H
+
+#include "crc.h"
+
+// A sorted, collision-free syndrome table as built by prepareErrorTable()
+// in crc.c, for one message length and correction/detection setting.
+// crc_tables.c is generated by `make crctables`; `make test` checks that
+// it is up to date.
+struct precomputed_error_table {
+    int bits;
+    int max_correct;
+    int max_detect;
+    const struct errorinfo *table;
+    int size;
+};
+
+extern const struct precomputed_error_table modesPrecomputedErrorTables[];
+extern const unsigned modesPrecomputedErrorTableCount;
+
+#endif
@@ -33,30 +33,10 @@
 // We maintain a phase offset that is expressed in units of 1/5 of a sample i.e. 1/6 of a symbol, 83.333ns
 // Each symbol we process advances the phase offset by 6 i.e. 6/5 of a sample, 500ns
 //
-// The correlation functions below correlate a 1-0 pair of symbols (i.e. manchester encoded 1 bit)
-// starting at the given sample, and assuming that the symbol starts at a fixed 0-5 phase offset within
-// m[0]. They return a correlation value, generally interpreted as >0 = 1 bit, <0 = 0 bit
-
-// TODO check if there are better (or more balanced) correlation functions to use here
-
-// nb: the correlation functions sum to zero, so we do not need to adjust for the DC offset in the input signal
-// (adding any constant value to all of m[0..3] does not change the result)
-
-static inline int slice_phase0(uint16_t *m) {
-    return 5 * m[0] - 3 * m[1] - 2 * m[2];
-}
-static inline int slice_phase1(uint16_t *m) {
-    return 4 * m[0] - m[1] - 3 * m[2];
-}
-static inline int slice_phase2(uint16_t *m) {
-    return 3 * m[0] + m[1] - 4 * m[2];
-}
-static inline int slice_phase3(uint16_t *m) {
-    return 2 * m[0] + 3 * m[1] - 5 * m[2];
-}
-static inline int slice_phase4(uint16_t *m) {
-    return m[0] + 5 * m[1] - 5 * m[2] - m[3];
-}
+// The correlation functions (see dsp/impl/slice_phases_u16.c) correlate a 1-0 pair of symbols
+// (i.e. manchester encoded 1 bit) starting at the given sample, and assuming that the symbol starts
+// at a fixed 0-5 phase offset within m[0]. They return a correlation value, generally interpreted
+// as >0 = 1 bit, <0 = 0 bit
 
 static uint32_t valid_df_short_bitset;        // set of acceptable DF values for short messages
 static uint32_t valid_df_long_bitset;         // set of acceptable DF values for long messages
@@ -92,259 +72,307 @@ static void init_bitsets()
     }
 }
 
+// Demodulator counters that are collected locally (possibly on a worker
+// thread) and merged into Modes.stats_current afterwards
+struct demod_counters {
+    uint32_t preambles;
+    uint32_t rejected_bad;
+};
+
 //
-// Given 'mlen' magnitude samples in 'm', sampled at 2.4MHz,
-// try to demodulate some Mode S messages.
+// Look for a Mode S preamble starting at m[j]. If one is found, demodulate
+// the following 112 bits at each possible phase offset and score the results.
 //
-void demodulate2400(struct mag_buf *mag)
+// sliced is a scratch buffer of 5 * MODES_LONG_MSG_BYTES for the
+// demodulated bits at each phase; on return, *bestmsg points to the best
+// candidate within it (or NULL if every phase was rejected early by the
+// DF filter).
+//
+// Returns false if there was no plausible preamble at m[j].
+//
+// This does not touch any global state other than reading the ICAO filter
+// via scoreModesMessageBatch(), so it is safe to run on a demodulator worker
+// thread while the main thread is waiting for it.
+//
+static bool demodulate_preamble(uint16_t *m, uint32_t j,
+                                unsigned char *sliced,
+                                unsigned char **bestmsg, int *bestscore, int *bestphase,
+                                struct demod_counters *counters)
 {
-    static struct modesMessage zeroMessage;
-    struct modesMessage mm;
-    unsigned char msg1[MODES_LONG_MSG_BYTES], msg2[MODES_LONG_MSG_BYTES], *msg;
-    uint32_t j;
+    uint16_t *preamble = &m[j];
+    int high;
+    uint32_t base_signal, base_noise;
+    int try_phase;
+
+    // Look for a message starting at around sample 0 with phase offset 3..7
+
+    // Ideal sample values for preambles with different phase
+    // Xn is the first data symbol with phase offset N
+    //
+    // sample#: 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0
+    // phase 3: 2/4\0/5\1 0 0 0 0/5\1/3 3\0 0 0 0 0 0 X4
+    // phase 4: 1/5\0/4\2 0 0 0 0/4\2 2/4\0 0 0 0 0 0 0 X0
+    // phase 5: 0/5\1/3 3\0 0 0 0/3 3\1/5\0 0 0 0 0 0 0 X1
+    // phase 6: 0/4\2 2/4\0 0 0 0 2/4\0/5\1 0 0 0 0 0 0 X2
+    // phase 7: 0/3 3\1/5\0 0 0 0 1/5\0/4\2 0 0 0 0 0 0 X3
+    //
+
+    // quick check: we must have a rising edge 0->1 and a falling edge 12->13
+    if (! (preamble[0] < preamble[1] && preamble[12] > preamble[13]) )
+        return false;
+
+    if (preamble[1] > preamble[2] &&                                       // 1
+        preamble[2] < preamble[3] && preamble[3] > preamble[4] &&          // 3
+        preamble[8] < preamble[9] && preamble[9] > preamble[10] &&         // 9
+        preamble[10] < preamble[11]) {                                     // 11-12
+        // peaks at 1,3,9,11-12: phase 3
+        high = (preamble[1] + preamble[3] + preamble[9] + preamble[11] + preamble[12]) / 4;
+        base_signal = preamble[1] + preamble[3] + preamble[9];
+        base_noise = preamble[5] + preamble[6] + preamble[7];
+    } else if (preamble[1] > preamble[2] &&                                // 1
+               preamble[2] < preamble[3] && preamble[3] > preamble[4] &&   // 3
+               preamble[8] < preamble[9] && preamble[9] > preamble[10] &&  // 9
+               preamble[11] < preamble[12]) {                              // 12
+        // peaks at 1,3,9,12: phase 4
+        high = (preamble[1] + preamble[3] + preamble[9] + preamble[12]) / 4;
+        base_signal = preamble[1] + preamble[3] + preamble[9] + preamble[12];
+        base_noise = preamble[5] + preamble[6] + preamble[7] + preamble[8];
+    } else if (preamble[1] > preamble[2] &&                                // 1
+               preamble[2] < preamble[3] && preamble[4] > preamble[5] &&   // 3-4
+               preamble[8] < preamble[9] && preamble[10] > preamble[11] && // 9-10
+               preamble[11] < preamble[12]) {                              // 12
+        // peaks at 1,3-4,9-10,12: phase 5
+        high = (preamble[1] + preamble[3] + preamble[4] + preamble[9] + preamble[10] + preamble[12]) / 4;
+        base_signal = preamble[1] + preamble[12];
+        base_noise = preamble[6] + preamble[7];
+    } else if (preamble[1] > preamble[2] &&                                 // 1
+               preamble[3] < preamble[4] && preamble[4] > preamble[5] &&    // 4
+               preamble[9] < preamble[10] && preamble[10] > preamble[11] && // 10
+               preamble[11] < preamble[12]) {                               // 12
+        // peaks at 1,4,10,12: phase 6
+        high = (preamble[1] + preamble[4] + preamble[10] + preamble[12]) / 4;
+        base_signal = preamble[1] + preamble[4] + preamble[10] + preamble[12];
+        base_noise = preamble[5] + preamble[6] + preamble[7] + preamble[8];
+    } else if (preamble[2] > preamble[3] &&                                 // 1-2
+               preamble[3] < preamble[4] && preamble[4] > preamble[5] &&    // 4
+               preamble[9] < preamble[10] && preamble[10] > preamble[11] && // 10
+               preamble[11] < preamble[12]) {                               // 12
+        // peaks at 1-2,4,10,12: phase 7
+        high = (preamble[1] + preamble[2] + preamble[4] + preamble[10] + preamble[12]) / 4;
+        base_signal = preamble[4] + preamble[10] + preamble[12];
+        base_noise = preamble[6] + preamble[7] + preamble[8];
+    } else {
+        // no suitable peaks
+        return false;
+    }
 
-    static unsigned last_message_end = 0;
+    // Check for enough signal
+    if (base_signal * 2 < 3 * base_noise) // about 3.5dB SNR
+        return false;
+
+    // Check that the "quiet" bits 6,7,15,16,17 are actually quiet
+    if (preamble[5] >= high ||
+        preamble[6] >= high ||
+        preamble[7] >= high ||
+        preamble[8] >= high ||
+        preamble[14] >= high ||
+        preamble[15] >= high ||
+        preamble[16] >= high ||
+        preamble[17] >= high ||
+        preamble[18] >= high) {
+        return false;
+    }
 
-    // initialize bitsets on first call
-    if (!valid_df_short_bitset)
-        init_bitsets();
+    // try all phases
+    counters->preambles++;
+    *bestmsg = NULL; *bestscore = SR_NOT_SET; *bestphase = -1;
 
-    if (mag->flags & MAGBUF_DISCONTINUOUS) {
-        // gap, start from the very beginning
-        last_message_end = 0;
+    // Decode all the next 112 bits at each phase, regardless of the actual
+    // message size; this may stop early for phases with an unknown DF.
+    starch_slice_phases_u16(&m[j+19], valid_df_short_bitset, valid_df_long_bitset, sliced);
+
+    unsigned candidates = 0;
+    for (try_phase = 4; try_phase <= 8; ++try_phase) {
+        unsigned char *msg = &sliced[(try_phase - 4) * MODES_LONG_MSG_BYTES];
+
+        // inspect DF field early, only continue processing
+        // messages where the DF appears valid
+        unsigned df = msg[0] >> 3;
+        if (!((valid_df_long_bitset | valid_df_short_bitset) & (1 << df))) {
+            // rejected early by the DF filter
+            counters->rejected_bad++;
+            continue;
+        }
+
+        candidates |= 1 << (try_phase - 4);
     }
 
-    unsigned char *bestmsg;
-    int bestscore, bestphase;
+    // Score the surviving mode S messages together and keep the best
+    score_rank score;
+    int best = scoreModesMessageBatch(sliced, 5, candidates, &score);
+    if (best >= 0) {
+        *bestmsg = &sliced[best * MODES_LONG_MSG_BYTES];
+        *bestscore = score;
+        *bestphase = best + 4;
+    }
 
-    // maximum lookahead we use
-    assert(mag->overlap >= 19 + 1 + 269);
+    return true;
+}
+
+// Bitmap of possible preamble offsets within part of a magnitude buffer
+struct preamble_bitmap {
+    uint64_t *bits;     // one bit per sample offset, from starch_preamble_scan_u16
+    unsigned alloc;     // allocated size of bits, in words
+    uint32_t start;     // sample offset corresponding to bit 0
+    uint32_t end;       // one past the last sample offset scanned
+};
+
+//
+// Pre-scan m[start..end) for offsets that have the overall shape of a
+// preamble, so that demodulate_preamble() only needs to visit those.
+// If we can't allocate the bitmap, every offset is treated as a candidate.
+//
+static void preamble_bitmap_scan(struct preamble_bitmap *b, uint16_t *m, uint32_t start, uint32_t end)
+{
+    unsigned words = (end - start + 63) / 64;
+
+    b->start = start;
+    b->end = end;
+
+    if (words > b->alloc) {
+        uint64_t *newbits = realloc(b->bits, words * sizeof(*newbits));
+        if (!newbits) {
+            free(b->bits);
+            b->bits = NULL;
+            b->alloc = 0;
+            return;
+        }
+        b->bits = newbits;
+        b->alloc = words;
+    }
+
+    if (b->bits && end > start)
+        starch_preamble_scan_u16(&m[start], end - start, b->bits);
+}
+
+// Return the first candidate offset >= j, or b->end if there are no more
+static inline uint32_t preamble_bitmap_next(const struct preamble_bitmap *b, uint32_t j)
+{
+    if (j < b->start)
+        j = b->start;
+    if (j >= b->end)
+        return b->end;
+    if (!b->bits)
+        return j;
+
+    uint32_t offset = j - b->start;
+    unsigned word = offset / 64;
+    unsigned words = (b->end - b->start + 63) / 64;
+    uint64_t bits = b->bits[word] & (~(uint64_t)0 << (offset % 64));
+
+    while (!bits) {
+        if (++word >= words)
+            return b->end;
+        bits = b->bits[word];
+    }
 
+    return b->start + word * 64 + __builtin_ctzll(bits);
+}
+
+//
+// Decode an accepted candidate message that starts at m[j], measure its
+// signal level, feed the adaptive gain logic, and pass it to the next layer.
+// Advances *last_message_end to the end of the message.
+//
+// Returns false if the message could not be decoded. Main thread only.
+//
+static bool demodulate_deliver(struct mag_buf *mag, uint32_t j,
+                               unsigned char *bestmsg, int bestscore, int bestphase,
+                               unsigned *last_message_end, uint64_t *sum_scaled_signal_power)
+{
+    static struct modesMessage zeroMessage;
+    struct modesMessage mm;
     uint16_t *m = mag->data;
-    uint32_t mlen = mag->validLength - mag->overlap;
+    int msglen;
 
-    uint64_t sum_scaled_signal_power = 0;
+    msglen = modesMessageLenByType(bestmsg[0] >> 3);
 
-    msg = msg1;
+    // Set initial mm structure details
+    mm = zeroMessage;
 
-    // sanity check
-    if (last_message_end > mlen)
-        last_message_end = mlen;
+    // For consistency with how the Beast / Radarcape does it,
+    // we report the timestamp at the end of bit 56 (even if
+    // the frame is a 112-bit frame)
+    mm.timestampMsg = mag->sampleTimestamp + j*5 + (8 + 56) * 12 + bestphase;
 
-    for (j = last_message_end; j < mlen; j++) {
-        uint16_t *preamble = &m[j];
-        int high;
-        uint32_t base_signal, base_noise;
-        int try_phase;
-        int msglen;
+    // compute message receive time as block-start-time + difference in the 12MHz clock
+    mm.sysTimestampMsg = mag->sysTimestamp + receiveclock_ms_elapsed(mag->sampleTimestamp, mm.timestampMsg);
 
-        // Look for a message starting at around sample 0 with phase offset 3..7
+    mm.score = bestscore;
 
-        // Ideal sample values for preambles with different phase
-        // Xn is the first data symbol with phase offset N
-        //
-        // sample#: 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0
-        // phase 3: 2/4\0/5\1 0 0 0 0/5\1/3 3\0 0 0 0 0 0 X4
-        // phase 4: 1/5\0/4\2 0 0 0 0/4\2 2/4\0 0 0 0 0 0 0 X0
-        // phase 5: 0/5\1/3 3\0 0 0 0/3 3\1/5\0 0 0 0 0 0 0 X1
-        // phase 6: 0/4\2 2/4\0 0 0 0 2/4\0/5\1 0 0 0 0 0 0 X2
-        // phase 7: 0/3 3\1/5\0 0 0 0 1/5\0/4\2 0 0 0 0 0 0 X3
-        //
+    // Decode the received message
+    if (decodeModesMessage(&mm, bestmsg) < 0) {
+        Modes.stats_current.demod_rejected_bad++;
+        return false;
+    } else {
+        Modes.stats_current.demod_accepted[mm.correctedbits]++;
+    }
 
-        // quick check: we must have a rising edge 0->1 and a falling edge 12->13
-        if (! (preamble[0] < preamble[1] && preamble[12] > preamble[13]) )
-           continue;
-
-        if (preamble[1] > preamble[2] &&                                       // 1
-            preamble[2] < preamble[3] && preamble[3] > preamble[4] &&          // 3
-            preamble[8] < preamble[9] && preamble[9] > preamble[10] &&         // 9
-            preamble[10] < preamble[11]) {                                     // 11-12
-            // peaks at 1,3,9,11-12: phase 3
-            high = (preamble[1] + preamble[3] + preamble[9] + preamble[11] + preamble[12]) / 4;
-            base_signal = preamble[1] + preamble[3] + preamble[9];
-            base_noise = preamble[5] + preamble[6] + preamble[7];
-        } else if (preamble[1] > preamble[2] &&                                // 1
-                   preamble[2] < preamble[3] && preamble[3] > preamble[4] &&   // 3
-                   preamble[8] < preamble[9] && preamble[9] > preamble[10] &&  // 9
-                   preamble[11] < preamble[12]) {                              // 12
-            // peaks at 1,3,9,12: phase 4
-            high = (preamble[1] + preamble[3] + preamble[9] + preamble[12]) / 4;
-            base_signal = preamble[1] + preamble[3] + preamble[9] + preamble[12];
-            base_noise = preamble[5] + preamble[6] + preamble[7] + preamble[8];
-        } else if (preamble[1] > preamble[2] &&                                // 1
-                   preamble[2] < preamble[3] && preamble[4] > preamble[5] &&   // 3-4
-                   preamble[8] < preamble[9] && preamble[10] > preamble[11] && // 9-10
-                   preamble[11] < preamble[12]) {                              // 12
-            // peaks at 1,3-4,9-10,12: phase 5
-            high = (preamble[1] + preamble[3] + preamble[4] + preamble[9] + preamble[10] + preamble[12]) / 4;
-            base_signal = preamble[1] + preamble[12];
-            base_noise = preamble[6] + preamble[7];
-        } else if (preamble[1] > preamble[2] &&                                 // 1
-                   preamble[3] < preamble[4] && preamble[4] > preamble[5] &&    // 4
-                   preamble[9] < preamble[10] && preamble[10] > preamble[11] && // 10
-                   preamble[11] < preamble[12]) {                               // 12
-            // peaks at 1,4,10,12: phase 6
-            high = (preamble[1] + preamble[4] + preamble[10] + preamble[12]) / 4;
-            base_signal = preamble[1] + preamble[4] + preamble[10] + preamble[12];
-            base_noise = preamble[5] + preamble[6] + preamble[7] + preamble[8];
-        } else if (preamble[2] > preamble[3] &&                                 // 1-2
-                   preamble[3] < preamble[4] && preamble[4] > preamble[5] &&    // 4
-                   preamble[9] < preamble[10] && preamble[10] > preamble[11] && // 10
-                   preamble[11] < preamble[12]) {                               // 12
-            // peaks at 1-2,4,10,12: phase 7
-            high = (preamble[1] + preamble[2] + preamble[4] + preamble[10] + preamble[12]) / 4;
-            base_signal = preamble[4] + preamble[10] + preamble[12];
-            base_noise = preamble[6] + preamble[7] + preamble[8];
-        } else {
-            // no suitable peaks
-            continue;
+    // measure signal power
+    {
+        double signal_power;
+        uint64_t scaled_signal_power = 0;
+        int signal_len = msglen*12/5;
+        int k;
+
+        for (k = 0; k < signal_len; ++k) {
+            uint32_t mag = m[j+19+k];
+            scaled_signal_power += mag * mag;
         }
 
-        // Check for enough signal
-        if (base_signal * 2 < 3 * base_noise) // about 3.5dB SNR
-            continue;
+        signal_power = scaled_signal_power / 65535.0 / 65535.0;
+        mm.signalLevel = signal_power / signal_len;
+        Modes.stats_current.signal_power_sum += signal_power;
+        Modes.stats_current.signal_power_count += signal_len;
+        *sum_scaled_signal_power += scaled_signal_power;
 
-        // Check that the "quiet" bits 6,7,15,16,17 are actually quiet
-        if (preamble[5] >= high ||
-            preamble[6] >= high ||
-            preamble[7] >= high ||
-            preamble[8] >= high ||
-            preamble[14] >= high ||
-            preamble[15] >= high ||
-            preamble[16] >= high ||
-            preamble[17] >= high ||
-            preamble[18] >= high) {
-            continue;
-        }
+        if (mm.signalLevel > Modes.stats_current.peak_signal_power)
+            Modes.stats_current.peak_signal_power = mm.signalLevel;
+        if (mm.signalLevel > 0.50119)
+            Modes.stats_current.strong_signal_count++; // signal power above -3dBFS
+    }
 
-        // try all phases
-        Modes.stats_current.demod_preambles++;
-        bestmsg = NULL; bestscore = SR_NOT_SET; bestphase = -1;
-        for (try_phase = 4; try_phase <= 8; ++try_phase) {
-            uint16_t *pPtr;
-            int phase, score;
-
-            // Decode all the next 112 bits, regardless of the actual message
-            // size. We'll check the actual message type later
-
-            pPtr = &m[j+19] + (try_phase/5);
-            phase = try_phase % 5;
-
-            unsigned bytelen = 1;
-            for (unsigned i = 0; i < bytelen; ++i) {
-                uint8_t theByte = 0;
-
-                switch (phase) {
-                case 0:
-                    theByte =
-                        (slice_phase0(pPtr) > 0 ? 0x80 : 0) |
-                        (slice_phase2(pPtr+2) > 0 ? 0x40 : 0) |
-                        (slice_phase4(pPtr+4) > 0 ? 0x20 : 0) |
-                        (slice_phase1(pPtr+7) > 0 ? 0x10 : 0) |
-                        (slice_phase3(pPtr+9) > 0 ? 0x08 : 0) |
-                        (slice_phase0(pPtr+12) > 0 ? 0x04 : 0) |
-                        (slice_phase2(pPtr+14) > 0 ? 0x02 : 0) |
-                        (slice_phase4(pPtr+16) > 0 ? 0x01 : 0);
-
-
-                    phase = 1;
-                    pPtr += 19;
-                    break;
-
-                case 1:
-                    theByte =
-                        (slice_phase1(pPtr) > 0 ? 0x80 : 0) |
-                        (slice_phase3(pPtr+2) > 0 ? 0x40 : 0) |
-                        (slice_phase0(pPtr+5) > 0 ? 0x20 : 0) |
-                        (slice_phase2(pPtr+7) > 0 ? 0x10 : 0) |
-                        (slice_phase4(pPtr+9) > 0 ? 0x08 : 0) |
-                        (slice_phase1(pPtr+12) > 0 ? 0x04 : 0) |
-                        (slice_phase3(pPtr+14) > 0 ? 0x02 : 0) |
-                        (slice_phase0(pPtr+17) > 0 ? 0x01 : 0);
-
-                    phase = 2;
-                    pPtr += 19;
-                    break;
-
-                case 2:
-                    theByte =
-                        (slice_phase2(pPtr) > 0 ? 0x80 : 0) |
-                        (slice_phase4(pPtr+2) > 0 ? 0x40 : 0) |
-                        (slice_phase1(pPtr+5) > 0 ? 0x20 : 0) |
-                        (slice_phase3(pPtr+7) > 0 ? 0x10 : 0) |
-                        (slice_phase0(pPtr+10) > 0 ? 0x08 : 0) |
-                        (slice_phase2(pPtr+12) > 0 ? 0x04 : 0) |
-                        (slice_phase4(pPtr+14) > 0 ? 0x02 : 0) |
-                        (slice_phase1(pPtr+17) > 0 ? 0x01 : 0);
-
-                    phase = 3;
-                    pPtr += 19;
-                    break;
-
-                case 3:
-                    theByte =
-                        (slice_phase3(pPtr) > 0 ? 0x80 : 0) |
-                        (slice_phase0(pPtr+3) > 0 ? 0x40 : 0) |
-                        (slice_phase2(pPtr+5) > 0 ? 0x20 : 0) |
-                        (slice_phase4(pPtr+7) > 0 ? 0x10 : 0) |
-                        (slice_phase1(pPtr+10) > 0 ? 0x08 : 0) |
-                        (slice_phase3(pPtr+12) > 0 ? 0x04 : 0) |
-                        (slice_phase0(pPtr+15) > 0 ? 0x02 : 0) |
-                        (slice_phase2(pPtr+17) > 0 ? 0x01 : 0);
-
-                    phase = 4;
-                    pPtr += 19;
-                    break;
-
-                case 4:
-                    theByte =
-                        (slice_phase4(pPtr) > 0 ? 0x80 : 0) |
-                        (slice_phase1(pPtr+3) > 0 ? 0x40 : 0) |
-                        (slice_phase3(pPtr+5) > 0 ? 0x20 : 0) |
-                        (slice_phase0(pPtr+8) > 0 ? 0x10 : 0) |
-                        (slice_phase2(pPtr+10) > 0 ? 0x08 : 0) |
-                        (slice_phase4(pPtr+12) > 0 ? 0x04 : 0) |
-                        (slice_phase1(pPtr+15) > 0 ? 0x02 : 0) |
-                        (slice_phase3(pPtr+17) > 0 ? 0x01 : 0);
-
-                    phase = 0;
-                    pPtr += 20;
-                    break;
-                }
+    // Feed "empty" sample to adaptive gain logic
+    if (j > *last_message_end)
+        adaptive_update(&m[*last_message_end], j - *last_message_end, NULL);
 
-                msg[i] = theByte;
+    // Feed message samples to adaptive gain logic, update end pointer
+    *last_message_end = j + (msglen + 8) * 12/5;
+    adaptive_update(&m[j], *last_message_end - j, &mm);
 
-                if (i == 0) {
-                    // inspect DF field early, only continue processing
-                    // messages where the DF appears valid
-                    unsigned df = theByte >> 3;
-                    if (valid_df_long_bitset & (1 << df))
-                        bytelen = MODES_LONG_MSG_BYTES;
-                    else if (valid_df_short_bitset & (1 << df))
-                        bytelen = MODES_SHORT_MSG_BYTES;
-                }
-            }
+    // Pass data to the next layer
+    useModesMessage(&mm);
+    return true;
+}
 
-            if (bytelen == 1) {
-                // rejected early by the DF filter
-                Modes.stats_current.demod_rejected_bad++;
-                continue;
-            }
+//
+// Demodulate the possible preambles in 'bitmap' that start in [from, to),
+// skipping over each message that is delivered. Returns true if any message
+// was delivered. Main thread only.
+//
+static bool demodulate_range(struct mag_buf *mag, const struct preamble_bitmap *bitmap,
+                             uint32_t from, uint32_t to, struct demod_counters *counters,
+                             unsigned *last_message_end, uint64_t *sum_scaled_signal_power)
+{
+    unsigned char sliced[5 * MODES_LONG_MSG_BYTES];
+    bool delivered = false;
 
-            // Score the mode S message and see if it's any good.
-            score = scoreModesMessage(msg);
-            if (score > bestscore) {
-                // new high score!
-                bestmsg = msg;
-                bestscore = score;
-                bestphase = try_phase;
-
-                // swap to using the other buffer so we don't clobber our demodulated data
-                // (if we find a better result then we'll swap back, but that's OK because
-                // we no longer need this copy if we found a better one)
-                msg = (msg == msg1) ? msg2 : msg1;
-            }
-        }
+    for (uint32_t j = preamble_bitmap_next(bitmap, from); j < to; j = preamble_bitmap_next(bitmap, j + 1)) {
+        unsigned char *bestmsg;
+        int bestscore, bestphase;
+
+        if (!demodulate_preamble(mag->data, j, sliced, &bestmsg, &bestscore, &bestphase, counters))
+            continue;
 
         // Do we have a candidate?
         if (bestscore < SR_ACCEPT_THRESHOLD) {
@@ -355,71 +383,344 @@ void demodulate2400(struct mag_buf *mag)
             continue; // nope.
         }
 
-        msglen = modesMessageLenByType(bestmsg[0] >> 3);
+        if (!demodulate_deliver(mag, j, bestmsg, bestscore, bestphase, last_message_end, sum_scaled_signal_power))
+            continue;
 
-        // Set initial mm structure details
-        mm = zeroMessage;
+        delivered = true;
 
-        // For consistency with how the Beast / Radarcape does it,
-        // we report the timestamp at the end of bit 56 (even if
-        // the frame is a 112-bit frame)
-        mm.timestampMsg = mag->sampleTimestamp + j*5 + (8 + 56) * 12 + bestphase;
+        // Skip over the message:
+        // (we actually skip to 8 bits before the end of the message,
+        //  because we can often decode two messages that *almost* collide,
+        //  where the preamble of the second message clobbered the last
+        //  few bits of the first message, but the message bits didn't
+        //  overlap)
+        j = *last_message_end - 8*12/5;
+    }
 
-        // compute message receive time as block-start-time + difference in the 12MHz clock
-        mm.sysTimestampMsg = mag->sysTimestamp + receiveclock_ms_elapsed(mag->sampleTimestamp, mm.timestampMsg);
+    return delivered;
+}
+
+//
+// Sharded (multithreaded) demodulation
+//
+// Each buffer is split into Modes.demod_threads contiguous shards of preamble
+// start offsets. A shard may look past its end into the following shard (and,
+// for the last shard, into the buffer overlap) when demodulating a message
+// that starts inside it, in the same way that the serial demodulator looks
+// into the overlap region; so a message is always owned by the shard that
+// contains its preamble.
+//
+// Workers only detect preambles, slice and score candidates; they record any
+// candidate that might be valid and leave everything that touches global
+// state (decoding, the ICAO filter, stats, adaptive gain, output) to the main
+// thread, which merges the shard results back in sample order.
+//
+
+// A candidate message found by a demodulator worker
+struct demod_candidate {
+    uint32_t j;                                 // sample offset of the preamble
+    int score;                                  // score from scoreModesMessage
+    int phase;                                  // phase offset of the best-scoring demodulation
+    uint32_t resume;                            // offset the worker resumed scanning from after this candidate
+    unsigned char msg[MODES_LONG_MSG_BYTES];    // demodulated message bytes
+};
+
+// Per-shard work and results
+struct demod_shard {
+    uint16_t *m;                                // magnitude data for the current buffer
+    uint32_t start;                             // first preamble offset owned by this shard
+    uint32_t end;                               // one past the last preamble offset owned by this shard
+    struct preamble_bitmap bitmap;              // possible preamble offsets in this shard
+    struct demod_candidate *candidates;         // candidates found, in sample order
+    unsigned candidate_count;                   // number of valid entries in candidates
+    unsigned candidate_alloc;                   // allocated size of candidates
+    struct demod_counters counters;             // local demodulator stats
+    struct icao_filter_counters icao_counters;  // ICAO filter lookups made by this shard
+    struct timespec cpu;                        // worker thread CPU used since last merge
+};
+
+static pthread_mutex_t demod_pool_mutex = PTHREAD_MUTEX_INITIALIZER;   // mutex protecting the pool state
+static pthread_cond_t demod_pool_work_cond = PTHREAD_COND_INITIALIZER; // condition used to signal new work to workers
+static pthread_cond_t demod_pool_done_cond = PTHREAD_COND_INITIALIZER; // condition used to signal all workers are done
+static unsigned demod_pool_generation;     // incremented each time a new buffer is handed to the workers
+static unsigned demod_pool_pending;        // number of workers still processing the current buffer
+static bool demod_pool_exiting;            // true if workers should exit
+
+static unsigned demod_shard_count;         // number of shards (0 = serial demodulation)
+static struct demod_shard *demod_shards;   // shard state; shard 0 is processed by the main thread
+static pthread_t *demod_workers;           // worker threads, one per shard excluding shard 0
+
+// Find and score candidates for one shard. May run on a worker thread.
+static void demodulate_shard(struct demod_shard *shard)
+{
+    unsigned char sliced[5 * MODES_LONG_MSG_BYTES];
+
+    shard->candidate_count = 0;
 
-        mm.score = bestscore;
+    preamble_bitmap_scan(&shard->bitmap, shard->m, shard->start, shard->end);
+    for (uint32_t j = preamble_bitmap_next(&shard->bitmap, shard->start);
+         j < shard->end;
+         j = preamble_bitmap_next(&shard->bitmap, j + 1)) {
+        unsigned char *bestmsg;
+        int bestscore, bestphase;
 
-        // Decode the received message
-        if (decodeModesMessage(&mm, bestmsg) < 0) {
-            Modes.stats_current.demod_rejected_bad++;
+        if (!demodulate_preamble(shard->m, j, sliced, &bestmsg, &bestscore, &bestphase, &shard->counters))
             continue;
-        } else {
-            Modes.stats_current.demod_accepted[mm.correctedbits]++;
+
+        if (bestscore < SR_UNKNOWN_THRESHOLD) {
+            shard->counters.rejected_bad++;
+            continue;
+        }
+
+        // Candidates below SR_ACCEPT_THRESHOLD are kept too; the main thread
+        // rescores them, as an earlier message in this buffer may have added
+        // their address to the ICAO filter in the meantime.
+        if (shard->candidate_count == shard->candidate_alloc) {
+            unsigned newsize = shard->candidate_alloc ? shard->candidate_alloc * 2 : 64;
+            struct demod_candidate *newcandidates = realloc(shard->candidates, newsize * sizeof(*newcandidates));
+            if (!newcandidates) {
+                shard->counters.rejected_bad++;
+                continue;
+            }
+            shard->candidates = newcandidates;
+            shard->candidate_alloc = newsize;
         }
 
-        // measure signal power
-        {
-            double signal_power;
-            uint64_t scaled_signal_power = 0;
-            int signal_len = msglen*12/5;
-            int k;
+        struct demod_candidate *c = &shard->candidates[shard->candidate_count++];
+        c->j = j;
+        c->score = bestscore;
+        c->phase = bestphase;
+        memcpy(c->msg, bestmsg, MODES_LONG_MSG_BYTES);
+
+        if (bestscore >= SR_ACCEPT_THRESHOLD) {
+            // Skip over the message, as the serial demodulator does. If the
+            // main thread ends up not delivering it, it rescans the skipped
+            // samples itself.
+            j += (modesMessageLenByType(bestmsg[0] >> 3) + 8) * 12/5 - 8*12/5;
+        }
+        c->resume = j + 1;
+    }
+
+    // the filter counts per thread; hand this thread's counts to the shard
+    icaoFilterCollectCounters(&shard->icao_counters);
+}
+
+static void *demodWorkerEntryPoint(void *arg)
+{
+    struct demod_shard *shard = arg;
+    unsigned seen_generation = 0;
+
+    set_thread_name("dump1090-demod");
+
+    pthread_mutex_lock(&demod_pool_mutex);
+    for (;;) {
+        while (!demod_pool_exiting && demod_pool_generation == seen_generation)
+            pthread_cond_wait(&demod_pool_work_cond, &demod_pool_mutex);
+        if (demod_pool_exiting)
+            break;
+        seen_generation = demod_pool_generation;
+        pthread_mutex_unlock(&demod_pool_mutex);
+
+        struct timespec start_time;
+        start_cpu_timing(&start_time);
+        demodulate_shard(shard);
+        end_cpu_timing(&start_time, &shard->cpu);
+
+        pthread_mutex_lock(&demod_pool_mutex);
+        if (--demod_pool_pending == 0)
+            pthread_cond_signal(&demod_pool_done_cond);
+    }
+    pthread_mutex_unlock(&demod_pool_mutex);
+
+    return NULL;
+}
+
+// Start the demodulator worker pool, if Modes.demod_threads asks for one
+bool demodulate2400Init(void)
+{
+    init_bitsets();
+
+    if (Modes.demod_threads <= 1)
+        return true;
+
+    demod_shard_count = Modes.demod_threads;
+    if (!(demod_shards = calloc(demod_shard_count, sizeof(*demod_shards))) ||
+        !(demod_workers = calloc(demod_shard_count - 1, sizeof(*demod_workers)))) {
+        fprintf(stderr, "Out of memory allocating demodulator shards\n");
+        goto fail;
+    }
+
+    for (unsigned i = 1; i < demod_shard_count; ++i) {
+        int err = pthread_create(&demod_workers[i - 1], NULL, demodWorkerEntryPoint, &demod_shards[i]);
+        if (err) {
+            fprintf(stderr, "Failed to create demodulator thread: %s\n", strerror(err));
+            demod_shard_count = i; // only join the threads we actually started
+            goto fail;
+        }
+    }
+
+    return true;
+
+ fail:
+    demodulate2400Cleanup();
+    return false;
+}
+
+// Stop the demodulator worker pool and release its resources
+void demodulate2400Cleanup(void)
+{
+    if (demod_workers) {
+        pthread_mutex_lock(&demod_pool_mutex);
+        demod_pool_exiting = true;
+        pthread_cond_broadcast(&demod_pool_work_cond);
+        pthread_mutex_unlock(&demod_pool_mutex);
+
+        for (unsigned i = 1; i < demod_shard_count; ++i)
+            pthread_join(demod_workers[i - 1], NULL);
+
+        free(demod_workers);
+        demod_workers = NULL;
+    }
+
+    if (demod_shards) {
+        for (unsigned i = 0; i < demod_shard_count; ++i) {
+            free(demod_shards[i].bitmap.bits);
+            free(demod_shards[i].candidates);
+        }
+        free(demod_shards);
+        demod_shards = NULL;
+    }
+
+    demod_shard_count = 0;
+    demod_pool_exiting = false;
+}
+
+// Demodulate preamble offsets [start, mlen) of a buffer using the worker pool
+static void demodulate_sharded(struct mag_buf *mag, uint32_t start, uint32_t mlen,
+                               unsigned *last_message_end, uint64_t *sum_scaled_signal_power)
+{
+    uint32_t span = (mlen - start + demod_shard_count - 1) / demod_shard_count;
+
+    for (unsigned i = 0; i < demod_shard_count; ++i) {
+        struct demod_shard *shard = &demod_shards[i];
+        shard->m = mag->data;
+        shard->start = start + i * span;
+        if (shard->start > mlen)
+            shard->start = mlen;
+        shard->end = shard->start + span;
+        if (shard->end > mlen)
+            shard->end = mlen;
+    }
+
+    // Hand shards 1..n-1 to the workers, and process shard 0 ourselves
+    pthread_mutex_lock(&demod_pool_mutex);
+    demod_pool_pending = demod_shard_count - 1;
+    ++demod_pool_generation;
+    pthread_cond_broadcast(&demod_pool_work_cond);
+    pthread_mutex_unlock(&demod_pool_mutex);
+
+    demodulate_shard(&demod_shards[0]);
+
+    pthread_mutex_lock(&demod_pool_mutex);
+    while (demod_pool_pending > 0)
+        pthread_cond_wait(&demod_pool_done_cond, &demod_pool_mutex);
+    pthread_mutex_unlock(&demod_pool_mutex);
+
+    // Merge the results in sample order
+    uint32_t next_j = start;
+    for (unsigned i = 0; i < demod_shard_count; ++i) {
+        struct demod_shard *shard = &demod_shards[i];
+
+        for (unsigned k = 0; k < shard->candidate_count; ++k) {
+            struct demod_candidate *c = &shard->candidates[k];
+
+            // Candidates that overlap a message we already delivered are
+            // dropped (only possible near the start of a shard)
+            bool delivered = false;
+            if (c->j >= next_j) {
+                int score = c->score;
+                if (score < SR_ACCEPT_THRESHOLD) {
+                    score = scoreModesMessage(c->msg);
+                    if (score < SR_ACCEPT_THRESHOLD) {
+                        if (score >= SR_UNKNOWN_THRESHOLD)
+                            Modes.stats_current.demod_rejected_unknown_icao++;
+                        else
+                            Modes.stats_current.demod_rejected_bad++;
+                    }
+                }
 
-            for (k = 0; k < signal_len; ++k) {
-                uint32_t mag = m[j+19+k];
-                scaled_signal_power += mag * mag;
+                delivered = (score >= SR_ACCEPT_THRESHOLD &&
+                             demodulate_deliver(mag, c->j, c->msg, score, c->phase, last_message_end, sum_scaled_signal_power));
             }
 
-            signal_power = scaled_signal_power / 65535.0 / 65535.0;
-            mm.signalLevel = signal_power / signal_len;
-            Modes.stats_current.signal_power_sum += signal_power;
-            Modes.stats_current.signal_power_count += signal_len;
-            sum_scaled_signal_power += scaled_signal_power;
+            if (!delivered) {
+                // The worker skipped the samples after a candidate it expected
+                // to be accepted; if that didn't happen, look at them now.
+                uint32_t from = (c->j + 1 > next_j ? c->j + 1 : next_j);
+                uint32_t to = (c->resume < shard->end ? c->resume : shard->end);
+                if (from >= to || !demodulate_range(mag, &shard->bitmap, from, to, &shard->counters, last_message_end, sum_scaled_signal_power))
+                    continue;
+            }
 
-            if (mm.signalLevel > Modes.stats_current.peak_signal_power)
-                Modes.stats_current.peak_signal_power = mm.signalLevel;
-            if (mm.signalLevel > 0.50119)
-                Modes.stats_current.strong_signal_count++; // signal power above -3dBFS
+            // Allow for almost-colliding messages, as in the serial case
+            next_j = *last_message_end - 8*12/5 + 1;
         }
 
-        // Feed "empty" sample to adaptive gain logic
-        if (j > last_message_end)
-            adaptive_update(&m[last_message_end], j - last_message_end, NULL);
+        Modes.stats_current.demod_preambles += shard->counters.preambles;
+        Modes.stats_current.demod_rejected_bad += shard->counters.rejected_bad;
+        shard->counters.preambles = shard->counters.rejected_bad = 0;
+        add_icao_filter_counters(&Modes.stats_current, &shard->icao_counters);
+        memset(&shard->icao_counters, 0, sizeof(shard->icao_counters));
+
+        // Worker CPU counts as demodulator CPU; the main thread's own share
+        // (shard 0 and the merge) is measured by the caller
+        Modes.stats_current.demod_cpu.tv_sec += shard->cpu.tv_sec;
+        Modes.stats_current.demod_cpu.tv_nsec += shard->cpu.tv_nsec;
+        normalize_timespec(&Modes.stats_current.demod_cpu);
+        shard->cpu.tv_sec = shard->cpu.tv_nsec = 0;
+    }
+}
 
-        // Feed message samples to adaptive gain logic, update end pointer
-        last_message_end = j + (msglen + 8) * 12/5;
-        adaptive_update(&m[j], last_message_end - j, &mm);
+//
+// Given 'mlen' magnitude samples in 'm', sampled at 2.4MHz,
+// try to demodulate some Mode S messages.
+//
+void demodulate2400(struct mag_buf *mag)
+{
+    static unsigned last_message_end = 0;
 
-        // Skip over the message:
-        // (we actually skip to 8 bits before the end of the message,
-        //  because we can often decode two messages that *almost* collide,
-        //  where the preamble of the second message clobbered the last
-        //  few bits of the first message, but the message bits didn't
-        //  overlap)
-        j = last_message_end - 8*12/5;
+    // initialize bitsets on first call
+    if (!valid_df_short_bitset)
+        init_bitsets();
 
-        // Pass data to the next layer
-        useModesMessage(&mm);
+    if (mag->flags & MAGBUF_DISCONTINUOUS) {
+        // gap, start from the very beginning
+        last_message_end = 0;
+    }
+
+    // maximum lookahead we use
+    assert(mag->overlap >= 19 + 1 + 269);
+
+    uint16_t *m = mag->data;
+    uint32_t mlen = mag->validLength - mag->overlap;
+
+    uint64_t sum_scaled_signal_power = 0;
+
+    // sanity check
+    if (last_message_end > mlen)
+        last_message_end = mlen;
+
+    if (demod_shard_count > 1) {
+        demodulate_sharded(mag, last_message_end, mlen, &last_message_end, &sum_scaled_signal_power);
+    } else {
+        static struct preamble_bitmap bitmap;
+        struct demod_counters counters = { 0, 0 };
+
+        preamble_bitmap_scan(&bitmap, m, last_message_end, mlen);
+        demodulate_range(mag, &bitmap, last_message_end, mlen, &counters, &last_message_end, &sum_scaled_signal_power);
+
+        Modes.stats_current.demod_preambles += counters.preambles;
+        Modes.stats_current.demod_rejected_bad += counters.rejected_bad;
     }
 
     /* update noise power */
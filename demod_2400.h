@@ -21,9 +21,12 @@
 #define DUMP1090_DEMOD_2400_H
 
 #include <stdint.h>
+#include <stdbool.h>
 
 struct mag_buf;
 
+bool demodulate2400Init(void);
+void demodulate2400Cleanup(void);
 void demodulate2400(struct mag_buf *mag);
 void demodulate2400AC(struct mag_buf *mag);
 
@@ -3,6 +3,10 @@
 
 #include <stdint.h>
 
+// Mode S message lengths, shared with the demodulator kernels
+#define MODES_LONG_MSG_BYTES     14
+#define MODES_SHORT_MSG_BYTES    7
+
 typedef struct {
     uint8_t I;
     uint8_t Q;
@@ -18,4 +22,11 @@ typedef struct {
     int16_t Q;
 } __attribute__((__packed__, __aligned__(2))) sc16_t;
 
+// A complex value with float components; used for DC offsets,
+// normalized so that full scale is 1.0
+typedef struct {
+    float I;
+    float Q;
+} fc32_t;
+
 #endif
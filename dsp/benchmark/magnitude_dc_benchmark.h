@@ -0,0 +1,134 @@
+#ifndef DSP_MAGNITUDE_DC_BENCHMARK_H
+#define DSP_MAGNITUDE_DC_BENCHMARK_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+/* Test data and verification shared by the magnitude_dc_* benchmarks */
+
+// Fill a buffer of SC16 samples with the given full scale (32768 for SC16,
+// 2048 for SC16Q11): a circle of 0.9 magnitude offset by the DC value,
+// then 0/45/90 degree ramps over the full input range, then random values
+static void magnitude_dc_benchmark_fill_sc16(sc16_t *in, unsigned len, const fc32_t *dc, int full_scale)
+{
+    unsigned i = 0;
+
+    double degrees = 0;
+    for (; i < len && degrees < 360; i += 1, degrees += 1) {
+        in[i].I = (int16_t) ((0.9 * cos(degrees * M_PI / 180.0) + dc->I) * full_scale);
+        in[i].Q = (int16_t) ((0.9 * sin(degrees * M_PI / 180.0) + dc->Q) * full_scale);
+    }
+
+    int sequence = 0;
+    for (; (i+3) <= len && sequence < 2 * full_scale; i += 3, sequence += 1) {
+        in[i + 0].I = (int16_t) (sequence - full_scale);
+        in[i + 0].Q = 0;
+
+        in[i + 1].I = (int16_t) (sequence - full_scale);
+        in[i + 1].Q = (int16_t) (sequence - full_scale);
+
+        in[i + 2].I = 0;
+        in[i + 2].Q = (int16_t) (sequence - full_scale);
+    }
+
+    srand(1);
+    for (; i < len; ++i) {
+        in[i].I = rand() % (2 * full_scale) - full_scale;
+        in[i].Q = rand() % (2 * full_scale) - full_scale;
+    }
+}
+
+// Check a kernel's outputs against a double-precision reference.
+// sample() returns the normalized (full scale = 1.0) value of input sample i.
+static bool magnitude_dc_benchmark_verify(const void *in, void (*sample)(const void *in, unsigned i, double *I, double *Q),
+                                          const uint16_t *out, unsigned len, const fc32_t *dc,
+                                          const fc32_t *out_mean, double out_level, double out_power)
+{
+    const double max_error = 0.015; // tolerate 1.5% error
+    const double epsilon = 1.0;
+    const double mean_epsilon = 1e-4;
+    bool okay = true;
+
+    double sum_I = 0, sum_Q = 0;
+    double sum_level = 0, sum_power = 0;
+
+    for (unsigned i = 0; i < len; ++i) {
+        double I, Q;
+        sample(in, i, &I, &Q);
+        sum_I += I;
+        sum_Q += Q;
+
+        I -= dc->I;
+        Q -= dc->Q;
+        double magsq = I * I + Q * Q;
+        double expected = round(sqrt(magsq) * 65536.0);
+        if (expected > 65535.0)
+            expected = 65535.0;
+        double actual = out[i];
+
+        double error = fabs(expected - actual);
+        double error_fraction = error / (expected > epsilon ? expected : epsilon);
+        if (error > epsilon && error_fraction > max_error) {
+            fprintf(stderr, "verification failed: in[%u] = %.5f/%.5f (after DC removal) out[%u]=%u, expected=%.0f, error=%.2f%%\n",
+                    i, I, Q,
+                    i, out[i],
+                    expected,
+                    error_fraction * 100.0);
+            okay = false;
+        }
+
+        sum_level += expected;
+        sum_power += expected * expected;
+    }
+
+    sum_I /= len;
+    sum_Q /= len;
+    if (fabs(sum_I - out_mean->I) > mean_epsilon || fabs(sum_Q - out_mean->Q) > mean_epsilon) {
+        fprintf(stderr, "verification failed: expected mean I/Q %.5f/%.5f, got mean I/Q %.5f/%.5f\n",
+                sum_I, sum_Q, out_mean->I, out_mean->Q);
+        okay = false;
+    }
+
+    sum_level = sum_level / len / 65536.0;
+    sum_power = sum_power / len / (65536.0 * 65536.0);
+
+    double level_error = sum_level - out_level;
+    if (fabs(level_error / sum_level) > max_error) {
+        fprintf(stderr, "verification failed: expected mean level %.5f, got mean level %.5f, error=%.2f%%\n",
+                sum_level, out_level, 100.0 * level_error / sum_level);
+        okay = false;
+    }
+
+    double power_error = sum_power - out_power;
+    if (fabs(power_error / sum_power) > max_error) {
+        fprintf(stderr, "verification failed: expected mean power %.5f, got mean power %.5f, error=%.2f%%\n",
+                sum_power, out_power, 100.0 * power_error / sum_power);
+        okay = false;
+    }
+
+    return okay;
+}
+
+static void magnitude_dc_benchmark_sample_uc8(const void *in, unsigned i, double *I, double *Q)
+{
+    const uc8_t *samples = in;
+    *I = (samples[i].I - 127.4) / 128;
+    *Q = (samples[i].Q - 127.4) / 128;
+}
+
+static void magnitude_dc_benchmark_sample_sc16(const void *in, unsigned i, double *I, double *Q)
+{
+    const sc16_t *samples = in;
+    *I = samples[i].I / 32768.0;
+    *Q = samples[i].Q / 32768.0;
+}
+
+static void magnitude_dc_benchmark_sample_sc16q11(const void *in, unsigned i, double *I, double *Q)
+{
+    const sc16_t *samples = in;
+    *I = samples[i].I / 2048.0;
+    *Q = samples[i].Q / 2048.0;
+}
+
+#endif
@@ -0,0 +1,28 @@
+#include "dsp/benchmark/magnitude_dc_benchmark.h"
+
+void STARCH_BENCHMARK(magnitude_dc_sc16q11) (void)
+{
+    sc16_t *in = NULL;
+    uint16_t *out_mag = NULL;
+    const unsigned len = 65536;
+    const fc32_t dc = { 0.02f, -0.01f };
+    fc32_t out_mean;
+    double out_level, out_power;
+
+    if (!(in = STARCH_BENCHMARK_ALLOC(len, sc16_t)) || !(out_mag = STARCH_BENCHMARK_ALLOC(len, uint16_t))) {
+        goto done;
+    }
+
+    magnitude_dc_benchmark_fill_sc16(in, len, &dc, 2048);
+
+    STARCH_BENCHMARK_RUN( magnitude_dc_sc16q11, in, out_mag, len, &dc, &out_mean, &out_level, &out_power );
+
+ done:
+    STARCH_BENCHMARK_FREE(in);
+    STARCH_BENCHMARK_FREE(out_mag);
+}
+
+bool STARCH_BENCHMARK_VERIFY(magnitude_dc_sc16q11) (const sc16_t *in, uint16_t *out, unsigned len, const fc32_t *dc, fc32_t *out_mean, double *out_level, double *out_power)
+{
+    return magnitude_dc_benchmark_verify(in, magnitude_dc_benchmark_sample_sc16q11, out, len, dc, out_mean, *out_level, *out_power);
+}
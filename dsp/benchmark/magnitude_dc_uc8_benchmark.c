@@ -0,0 +1,55 @@
+#include "dsp/benchmark/magnitude_dc_benchmark.h"
+
+void STARCH_BENCHMARK(magnitude_dc_uc8) (void)
+{
+    uc8_t *in = NULL;
+    uint16_t *out_mag = NULL;
+    const unsigned len = 65536;
+    const fc32_t dc = { 0.02f, -0.01f };
+    fc32_t out_mean;
+    double out_level, out_power;
+
+    if (!(in = STARCH_BENCHMARK_ALLOC(len, uc8_t)) || !(out_mag = STARCH_BENCHMARK_ALLOC(len, uint16_t))) {
+        goto done;
+    }
+
+    unsigned i = 0;
+
+    // 0.9 magnitude, varying phase, offset by the DC value
+    double degrees = 0;
+    for (; i < len && degrees < 360; i += 1, degrees += 1) {
+        in[i].I = (uint8_t) ((0.9 * cos(degrees * M_PI / 180.0) + dc.I) * 128 + 127.4);
+        in[i].Q = (uint8_t) ((0.9 * sin(degrees * M_PI / 180.0) + dc.Q) * 128 + 127.4);
+    }
+
+    // 0, 45, 90 degree phase, full input range
+    unsigned sequence = 0;
+    for (; (i+3) <= len && sequence < 256; i += 3, sequence += 1) {
+        in[i + 0].I = sequence;
+        in[i + 0].Q = 0;
+
+        in[i + 1].I = sequence;
+        in[i + 1].Q = sequence;
+
+        in[i + 2].I = 0;
+        in[i + 2].Q = sequence;
+    }
+
+    // Fill the rest with random values
+    srand(1);
+    for (; i < len; ++i) {
+        in[i].I = rand() % 256;
+        in[i].Q = rand() % 256;
+    }
+
+    STARCH_BENCHMARK_RUN( magnitude_dc_uc8, in, out_mag, len, &dc, &out_mean, &out_level, &out_power );
+
+ done:
+    STARCH_BENCHMARK_FREE(in);
+    STARCH_BENCHMARK_FREE(out_mag);
+}
+
+bool STARCH_BENCHMARK_VERIFY(magnitude_dc_uc8) (const uc8_t *in, uint16_t *out, unsigned len, const fc32_t *dc, fc32_t *out_mean, double *out_level, double *out_power)
+{
+    return magnitude_dc_benchmark_verify(in, magnitude_dc_benchmark_sample_uc8, out, len, dc, out_mean, *out_level, *out_power);
+}
@@ -0,0 +1,57 @@
+#include <stdlib.h>
+
+void STARCH_BENCHMARK(preamble_scan_u16) (void)
+{
+    uint16_t *in = NULL;
+    uint64_t *bitmap = NULL;
+    const unsigned len = 131072; /* one MODES_MAG_BUF_SAMPLES buffer */
+    const unsigned lookahead = 13;
+
+    if (!(in = STARCH_BENCHMARK_ALLOC(len + lookahead, uint16_t)) || !(bitmap = STARCH_BENCHMARK_ALLOC((len + 63) / 64, uint64_t))) {
+        goto done;
+    }
+
+    srand(1);
+    for (unsigned i = 0; i < len + lookahead; ++i) {
+        in[i] = rand() % 65536;
+    }
+
+    STARCH_BENCHMARK_RUN( preamble_scan_u16, in, len, bitmap );
+
+ done:
+    STARCH_BENCHMARK_FREE(in);
+    STARCH_BENCHMARK_FREE(bitmap);
+}
+
+bool STARCH_BENCHMARK_VERIFY(preamble_scan_u16) (const uint16_t *in, unsigned len, uint64_t *out_bitmap)
+{
+    for (unsigned i = 0; i < len; ++i) {
+        const uint16_t *p = &in[i];
+        bool expected = false;
+
+        if (p[0] < p[1] && p[12] > p[13]) {
+            expected =
+                (p[1] > p[2] && p[2] < p[3] && p[3] > p[4] && p[8] < p[9] && p[9] > p[10] && p[10] < p[11]) ||
+                (p[1] > p[2] && p[2] < p[3] && p[3] > p[4] && p[8] < p[9] && p[9] > p[10] && p[11] < p[12]) ||
+                (p[1] > p[2] && p[2] < p[3] && p[4] > p[5] && p[8] < p[9] && p[10] > p[11] && p[11] < p[12]) ||
+                (p[1] > p[2] && p[3] < p[4] && p[4] > p[5] && p[9] < p[10] && p[10] > p[11] && p[11] < p[12]) ||
+                (p[2] > p[3] && p[3] < p[4] && p[4] > p[5] && p[9] < p[10] && p[10] > p[11] && p[11] < p[12]);
+        }
+
+        bool actual = (out_bitmap[i / 64] >> (i % 64)) & 1;
+        if (expected != actual) {
+            fprintf(stderr, "verification failed: at offset %u, expected %s, got %s\n", i, expected ? "candidate" : "no candidate", actual ? "candidate" : "no candidate");
+            return false;
+        }
+    }
+
+    if (len % 64) {
+        uint64_t unused = out_bitmap[len / 64] >> (len % 64);
+        if (unused) {
+            fprintf(stderr, "verification failed: unused high bits of the last bitmap word are set\n");
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,70 @@
+#include <stdlib.h>
+
+/* Default DF filters used by demodulate2400() */
+#define BENCHMARK_VALID_DF_SHORT ((1 << 0) | (1 << 4) | (1 << 5) | (1 << 11))
+#define BENCHMARK_VALID_DF_LONG ((1 << 16) | (1 << 17) | (1 << 18) | (1 << 20) | (1 << 21))
+
+void STARCH_BENCHMARK(slice_phases_u16) (void)
+{
+    uint16_t *in = NULL;
+    uint8_t *out = NULL;
+    const unsigned len = 271;
+
+    if (!(in = STARCH_BENCHMARK_ALLOC(len, uint16_t)) || !(out = STARCH_BENCHMARK_ALLOC(5 * MODES_LONG_MSG_BYTES, uint8_t))) {
+        goto done;
+    }
+
+    srand(1);
+    for (unsigned i = 0; i < len; ++i) {
+        in[i] = rand() % 65536;
+    }
+
+    STARCH_BENCHMARK_RUN( slice_phases_u16, in, BENCHMARK_VALID_DF_SHORT, BENCHMARK_VALID_DF_LONG, out );
+
+ done:
+    STARCH_BENCHMARK_FREE(in);
+    STARCH_BENCHMARK_FREE(out);
+}
+
+bool STARCH_BENCHMARK_VERIFY(slice_phases_u16) (const uint16_t *in, uint32_t valid_df_short, uint32_t valid_df_long, uint8_t *out)
+{
+    static const int weights[5][4] = {
+        { 5, -3, -2, 0 },
+        { 4, -1, -3, 0 },
+        { 3, 1, -4, 0 },
+        { 2, 3, -5, 0 },
+        { 1, 5, -5, -1 }
+    };
+
+    for (unsigned h = 0; h < 5; ++h) {
+        uint8_t expected[MODES_LONG_MSG_BYTES];
+
+        for (unsigned k = 0; k < MODES_LONG_MSG_BYTES * 8; ++k) {
+            unsigned pos = h + 4 + 12 * k;
+            const uint16_t *m = &in[pos / 5];
+            const int *w = weights[pos % 5];
+            int correlation = w[0] * m[0] + w[1] * m[1] + w[2] * m[2] + w[3] * m[3];
+
+            if (k % 8 == 0)
+                expected[k / 8] = 0;
+            if (correlation > 0)
+                expected[k / 8] |= 0x80 >> (k % 8);
+        }
+
+        unsigned df = expected[0] >> 3;
+        unsigned bytelen = 1;
+        if (valid_df_long & (1 << df))
+            bytelen = MODES_LONG_MSG_BYTES;
+        else if (valid_df_short & (1 << df))
+            bytelen = MODES_SHORT_MSG_BYTES;
+
+        for (unsigned i = 0; i < bytelen; ++i) {
+            if (out[h * MODES_LONG_MSG_BYTES + i] != expected[i]) {
+                fprintf(stderr, "verification failed: hypothesis %u byte %u: expected %02x, got %02x\n", h, i, expected[i], out[h * MODES_LONG_MSG_BYTES + i]);
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
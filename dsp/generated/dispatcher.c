@@ -178,6 +178,492 @@ starch_count_above_u16_aligned_regentry starch_count_above_u16_aligned_registry[
     { 0, NULL, NULL, NULL, NULL }
 };
 
+/* dispatcher / registry for magnitude_dc_sc16 */
+
+starch_magnitude_dc_sc16_regentry * starch_magnitude_dc_sc16_select() {
+    for (starch_magnitude_dc_sc16_regentry *entry = starch_magnitude_dc_sc16_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_dc_sc16_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, const fc32_t * arg3, fc32_t * arg4, double * arg5, double * arg6 ) {
+    starch_magnitude_dc_sc16_regentry *entry = starch_magnitude_dc_sc16_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_dc_sc16 = entry->callable;
+    starch_magnitude_dc_sc16 ( arg0, arg1, arg2, arg3, arg4, arg5, arg6 );
+}
+
+starch_magnitude_dc_sc16_ptr starch_magnitude_dc_sc16 = starch_magnitude_dc_sc16_dispatch;
+
+void starch_magnitude_dc_sc16_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_dc_sc16_regentry *entry;
+    for (entry = starch_magnitude_dc_sc16_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_dc_sc16_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_dc_sc16_registry, entry - starch_magnitude_dc_sc16_registry, sizeof(starch_magnitude_dc_sc16_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_dc_sc16 = starch_magnitude_dc_sc16_dispatch;
+}
+
+starch_magnitude_dc_sc16_regentry starch_magnitude_dc_sc16_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_sc16_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "float_generic", "generic", starch_magnitude_dc_sc16_float_generic, NULL },
+    { 2, "float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_sc16_float_armv8_neon_simd, cpu_supports_armv8_simd },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "float_generic", "generic", starch_magnitude_dc_sc16_float_generic, NULL },
+    { 2, "float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "float_generic", "generic", starch_magnitude_dc_sc16_float_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "avx2_x86_avx2", "x86_avx2", starch_magnitude_dc_sc16_avx2_x86_avx2, cpu_supports_avx2 },
+    { 1, "float_x86_avx2", "x86_avx2", starch_magnitude_dc_sc16_float_x86_avx2, cpu_supports_avx2 },
+    { 2, "float_generic", "generic", starch_magnitude_dc_sc16_float_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_dc_sc16_aligned */
+
+starch_magnitude_dc_sc16_aligned_regentry * starch_magnitude_dc_sc16_aligned_select() {
+    for (starch_magnitude_dc_sc16_aligned_regentry *entry = starch_magnitude_dc_sc16_aligned_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_dc_sc16_aligned_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, const fc32_t * arg3, fc32_t * arg4, double * arg5, double * arg6 ) {
+    starch_magnitude_dc_sc16_aligned_regentry *entry = starch_magnitude_dc_sc16_aligned_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_dc_sc16_aligned = entry->callable;
+    starch_magnitude_dc_sc16_aligned ( arg0, arg1, arg2, arg3, arg4, arg5, arg6 );
+}
+
+starch_magnitude_dc_sc16_aligned_ptr starch_magnitude_dc_sc16_aligned = starch_magnitude_dc_sc16_aligned_dispatch;
+
+void starch_magnitude_dc_sc16_aligned_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_dc_sc16_aligned_regentry *entry;
+    for (entry = starch_magnitude_dc_sc16_aligned_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_dc_sc16_aligned_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_dc_sc16_aligned_registry, entry - starch_magnitude_dc_sc16_aligned_registry, sizeof(starch_magnitude_dc_sc16_aligned_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_dc_sc16_aligned = starch_magnitude_dc_sc16_aligned_dispatch;
+}
+
+starch_magnitude_dc_sc16_aligned_regentry starch_magnitude_dc_sc16_aligned_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_dc_sc16_aligned_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "float_generic", "generic", starch_magnitude_dc_sc16_float_generic, NULL },
+    { 2, "float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_dc_sc16_aligned_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_sc16_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_sc16_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16_aligned_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "float_generic", "generic", starch_magnitude_dc_sc16_float_generic, NULL },
+    { 2, "float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16_aligned_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "float_generic", "generic", starch_magnitude_dc_sc16_float_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "avx2_x86_avx2_aligned", "x86_avx2", starch_magnitude_dc_sc16_aligned_avx2_x86_avx2, cpu_supports_avx2 },
+    { 1, "float_x86_avx2_aligned", "x86_avx2", starch_magnitude_dc_sc16_aligned_float_x86_avx2, cpu_supports_avx2 },
+    { 2, "float_generic", "generic", starch_magnitude_dc_sc16_float_generic, NULL },
+    { 3, "float_x86_avx2", "x86_avx2", starch_magnitude_dc_sc16_float_x86_avx2, cpu_supports_avx2 },
+    { 4, "avx2_x86_avx2", "x86_avx2", starch_magnitude_dc_sc16_avx2_x86_avx2, cpu_supports_avx2 },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_dc_sc16q11 */
+
+starch_magnitude_dc_sc16q11_regentry * starch_magnitude_dc_sc16q11_select() {
+    for (starch_magnitude_dc_sc16q11_regentry *entry = starch_magnitude_dc_sc16q11_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_dc_sc16q11_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, const fc32_t * arg3, fc32_t * arg4, double * arg5, double * arg6 ) {
+    starch_magnitude_dc_sc16q11_regentry *entry = starch_magnitude_dc_sc16q11_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_dc_sc16q11 = entry->callable;
+    starch_magnitude_dc_sc16q11 ( arg0, arg1, arg2, arg3, arg4, arg5, arg6 );
+}
+
+starch_magnitude_dc_sc16q11_ptr starch_magnitude_dc_sc16q11 = starch_magnitude_dc_sc16q11_dispatch;
+
+void starch_magnitude_dc_sc16q11_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_dc_sc16q11_regentry *entry;
+    for (entry = starch_magnitude_dc_sc16q11_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_dc_sc16q11_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_dc_sc16q11_registry, entry - starch_magnitude_dc_sc16q11_registry, sizeof(starch_magnitude_dc_sc16q11_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_dc_sc16q11 = starch_magnitude_dc_sc16q11_dispatch;
+}
+
+starch_magnitude_dc_sc16q11_regentry starch_magnitude_dc_sc16q11_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_sc16q11_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "float_generic", "generic", starch_magnitude_dc_sc16q11_float_generic, NULL },
+    { 2, "float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_sc16q11_float_armv8_neon_simd, cpu_supports_armv8_simd },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16q11_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "float_generic", "generic", starch_magnitude_dc_sc16q11_float_generic, NULL },
+    { 2, "float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16q11_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "float_generic", "generic", starch_magnitude_dc_sc16q11_float_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "avx2_x86_avx2", "x86_avx2", starch_magnitude_dc_sc16q11_avx2_x86_avx2, cpu_supports_avx2 },
+    { 1, "float_x86_avx2", "x86_avx2", starch_magnitude_dc_sc16q11_float_x86_avx2, cpu_supports_avx2 },
+    { 2, "float_generic", "generic", starch_magnitude_dc_sc16q11_float_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_dc_sc16q11_aligned */
+
+starch_magnitude_dc_sc16q11_aligned_regentry * starch_magnitude_dc_sc16q11_aligned_select() {
+    for (starch_magnitude_dc_sc16q11_aligned_regentry *entry = starch_magnitude_dc_sc16q11_aligned_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_dc_sc16q11_aligned_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, const fc32_t * arg3, fc32_t * arg4, double * arg5, double * arg6 ) {
+    starch_magnitude_dc_sc16q11_aligned_regentry *entry = starch_magnitude_dc_sc16q11_aligned_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_dc_sc16q11_aligned = entry->callable;
+    starch_magnitude_dc_sc16q11_aligned ( arg0, arg1, arg2, arg3, arg4, arg5, arg6 );
+}
+
+starch_magnitude_dc_sc16q11_aligned_ptr starch_magnitude_dc_sc16q11_aligned = starch_magnitude_dc_sc16q11_aligned_dispatch;
+
+void starch_magnitude_dc_sc16q11_aligned_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_dc_sc16q11_aligned_regentry *entry;
+    for (entry = starch_magnitude_dc_sc16q11_aligned_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_dc_sc16q11_aligned_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_dc_sc16q11_aligned_registry, entry - starch_magnitude_dc_sc16q11_aligned_registry, sizeof(starch_magnitude_dc_sc16q11_aligned_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_dc_sc16q11_aligned = starch_magnitude_dc_sc16q11_aligned_dispatch;
+}
+
+starch_magnitude_dc_sc16q11_aligned_regentry starch_magnitude_dc_sc16q11_aligned_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_dc_sc16q11_aligned_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "float_generic", "generic", starch_magnitude_dc_sc16q11_float_generic, NULL },
+    { 2, "float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_dc_sc16q11_aligned_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_sc16q11_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_sc16q11_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16q11_aligned_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "float_generic", "generic", starch_magnitude_dc_sc16q11_float_generic, NULL },
+    { 2, "float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16q11_aligned_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16q11_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16q11_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "float_generic", "generic", starch_magnitude_dc_sc16q11_float_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "avx2_x86_avx2_aligned", "x86_avx2", starch_magnitude_dc_sc16q11_aligned_avx2_x86_avx2, cpu_supports_avx2 },
+    { 1, "float_x86_avx2_aligned", "x86_avx2", starch_magnitude_dc_sc16q11_aligned_float_x86_avx2, cpu_supports_avx2 },
+    { 2, "float_generic", "generic", starch_magnitude_dc_sc16q11_float_generic, NULL },
+    { 3, "float_x86_avx2", "x86_avx2", starch_magnitude_dc_sc16q11_float_x86_avx2, cpu_supports_avx2 },
+    { 4, "avx2_x86_avx2", "x86_avx2", starch_magnitude_dc_sc16q11_avx2_x86_avx2, cpu_supports_avx2 },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_dc_uc8 */
+
+starch_magnitude_dc_uc8_regentry * starch_magnitude_dc_uc8_select() {
+    for (starch_magnitude_dc_uc8_regentry *entry = starch_magnitude_dc_uc8_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_dc_uc8_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, const fc32_t * arg3, fc32_t * arg4, double * arg5, double * arg6 ) {
+    starch_magnitude_dc_uc8_regentry *entry = starch_magnitude_dc_uc8_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_dc_uc8 = entry->callable;
+    starch_magnitude_dc_uc8 ( arg0, arg1, arg2, arg3, arg4, arg5, arg6 );
+}
+
+starch_magnitude_dc_uc8_ptr starch_magnitude_dc_uc8 = starch_magnitude_dc_uc8_dispatch;
+
+void starch_magnitude_dc_uc8_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_dc_uc8_regentry *entry;
+    for (entry = starch_magnitude_dc_uc8_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_dc_uc8_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_dc_uc8_registry, entry - starch_magnitude_dc_uc8_registry, sizeof(starch_magnitude_dc_uc8_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_dc_uc8 = starch_magnitude_dc_uc8_dispatch;
+}
+
+starch_magnitude_dc_uc8_regentry starch_magnitude_dc_uc8_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_uc8_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "float_generic", "generic", starch_magnitude_dc_uc8_float_generic, NULL },
+    { 2, "float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_uc8_float_armv8_neon_simd, cpu_supports_armv8_simd },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_uc8_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "float_generic", "generic", starch_magnitude_dc_uc8_float_generic, NULL },
+    { 2, "float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_uc8_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "float_generic", "generic", starch_magnitude_dc_uc8_float_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "avx2_x86_avx2", "x86_avx2", starch_magnitude_dc_uc8_avx2_x86_avx2, cpu_supports_avx2 },
+    { 1, "float_x86_avx2", "x86_avx2", starch_magnitude_dc_uc8_float_x86_avx2, cpu_supports_avx2 },
+    { 2, "float_generic", "generic", starch_magnitude_dc_uc8_float_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_dc_uc8_aligned */
+
+starch_magnitude_dc_uc8_aligned_regentry * starch_magnitude_dc_uc8_aligned_select() {
+    for (starch_magnitude_dc_uc8_aligned_regentry *entry = starch_magnitude_dc_uc8_aligned_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_dc_uc8_aligned_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, const fc32_t * arg3, fc32_t * arg4, double * arg5, double * arg6 ) {
+    starch_magnitude_dc_uc8_aligned_regentry *entry = starch_magnitude_dc_uc8_aligned_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_dc_uc8_aligned = entry->callable;
+    starch_magnitude_dc_uc8_aligned ( arg0, arg1, arg2, arg3, arg4, arg5, arg6 );
+}
+
+starch_magnitude_dc_uc8_aligned_ptr starch_magnitude_dc_uc8_aligned = starch_magnitude_dc_uc8_aligned_dispatch;
+
+void starch_magnitude_dc_uc8_aligned_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_dc_uc8_aligned_regentry *entry;
+    for (entry = starch_magnitude_dc_uc8_aligned_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_dc_uc8_aligned_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_dc_uc8_aligned_registry, entry - starch_magnitude_dc_uc8_aligned_registry, sizeof(starch_magnitude_dc_uc8_aligned_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_dc_uc8_aligned = starch_magnitude_dc_uc8_aligned_dispatch;
+}
+
+starch_magnitude_dc_uc8_aligned_regentry starch_magnitude_dc_uc8_aligned_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_dc_uc8_aligned_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "float_generic", "generic", starch_magnitude_dc_uc8_float_generic, NULL },
+    { 2, "float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_dc_uc8_aligned_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_uc8_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_uc8_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_dc_uc8_aligned_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "float_generic", "generic", starch_magnitude_dc_uc8_float_generic, NULL },
+    { 2, "float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_dc_uc8_aligned_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_uc8_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_uc8_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "float_generic", "generic", starch_magnitude_dc_uc8_float_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "avx2_x86_avx2_aligned", "x86_avx2", starch_magnitude_dc_uc8_aligned_avx2_x86_avx2, cpu_supports_avx2 },
+    { 1, "float_x86_avx2_aligned", "x86_avx2", starch_magnitude_dc_uc8_aligned_float_x86_avx2, cpu_supports_avx2 },
+    { 2, "float_generic", "generic", starch_magnitude_dc_uc8_float_generic, NULL },
+    { 3, "float_x86_avx2", "x86_avx2", starch_magnitude_dc_uc8_float_x86_avx2, cpu_supports_avx2 },
+    { 4, "avx2_x86_avx2", "x86_avx2", starch_magnitude_dc_uc8_avx2_x86_avx2, cpu_supports_avx2 },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
 /* dispatcher / registry for magnitude_power_uc8 */
 
 starch_magnitude_power_uc8_regentry * starch_magnitude_power_uc8_select() {
@@ -1143,6 +1629,162 @@ starch_mean_power_u16_aligned_regentry starch_mean_power_u16_aligned_registry[]
     { 0, NULL, NULL, NULL, NULL }
 };
 
+/* dispatcher / registry for preamble_scan_u16 */
+
+starch_preamble_scan_u16_regentry * starch_preamble_scan_u16_select() {
+    for (starch_preamble_scan_u16_regentry *entry = starch_preamble_scan_u16_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_preamble_scan_u16_dispatch ( const uint16_t * arg0, unsigned arg1, uint64_t * arg2 ) {
+    starch_preamble_scan_u16_regentry *entry = starch_preamble_scan_u16_select();
+    if (!entry)
+        abort();
+
+    starch_preamble_scan_u16 = entry->callable;
+    starch_preamble_scan_u16 ( arg0, arg1, arg2 );
+}
+
+starch_preamble_scan_u16_ptr starch_preamble_scan_u16 = starch_preamble_scan_u16_dispatch;
+
+void starch_preamble_scan_u16_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_preamble_scan_u16_regentry *entry;
+    for (entry = starch_preamble_scan_u16_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_preamble_scan_u16_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_preamble_scan_u16_registry, entry - starch_preamble_scan_u16_registry, sizeof(starch_preamble_scan_u16_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_preamble_scan_u16 = starch_preamble_scan_u16_dispatch;
+}
+
+starch_preamble_scan_u16_regentry starch_preamble_scan_u16_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_armv8_neon_simd", "armv8_neon_simd", starch_preamble_scan_u16_neon_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "generic_generic", "generic", starch_preamble_scan_u16_generic_generic, NULL },
+    { 2, "generic_armv8_neon_simd", "armv8_neon_simd", starch_preamble_scan_u16_generic_armv8_neon_simd, cpu_supports_armv8_simd },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_scan_u16_neon_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "generic_generic", "generic", starch_preamble_scan_u16_generic_generic, NULL },
+    { 2, "generic_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_scan_u16_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "generic_generic", "generic", starch_preamble_scan_u16_generic_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "avx2_x86_avx2", "x86_avx2", starch_preamble_scan_u16_avx2_x86_avx2, cpu_supports_avx2 },
+    { 1, "generic_x86_avx2", "x86_avx2", starch_preamble_scan_u16_generic_x86_avx2, cpu_supports_avx2 },
+    { 2, "generic_generic", "generic", starch_preamble_scan_u16_generic_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for slice_phases_u16 */
+
+starch_slice_phases_u16_regentry * starch_slice_phases_u16_select() {
+    for (starch_slice_phases_u16_regentry *entry = starch_slice_phases_u16_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_slice_phases_u16_dispatch ( const uint16_t * arg0, uint32_t arg1, uint32_t arg2, uint8_t * arg3 ) {
+    starch_slice_phases_u16_regentry *entry = starch_slice_phases_u16_select();
+    if (!entry)
+        abort();
+
+    starch_slice_phases_u16 = entry->callable;
+    starch_slice_phases_u16 ( arg0, arg1, arg2, arg3 );
+}
+
+starch_slice_phases_u16_ptr starch_slice_phases_u16 = starch_slice_phases_u16_dispatch;
+
+void starch_slice_phases_u16_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_slice_phases_u16_regentry *entry;
+    for (entry = starch_slice_phases_u16_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_slice_phases_u16_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_slice_phases_u16_registry, entry - starch_slice_phases_u16_registry, sizeof(starch_slice_phases_u16_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_slice_phases_u16 = starch_slice_phases_u16_dispatch;
+}
+
+starch_slice_phases_u16_regentry starch_slice_phases_u16_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_armv8_neon_simd", "armv8_neon_simd", starch_slice_phases_u16_neon_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "generic_generic", "generic", starch_slice_phases_u16_generic_generic, NULL },
+    { 2, "generic_armv8_neon_simd", "armv8_neon_simd", starch_slice_phases_u16_generic_armv8_neon_simd, cpu_supports_armv8_simd },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_slice_phases_u16_neon_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "generic_generic", "generic", starch_slice_phases_u16_generic_generic, NULL },
+    { 2, "generic_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_slice_phases_u16_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "generic_generic", "generic", starch_slice_phases_u16_generic_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "avx2_x86_avx2", "x86_avx2", starch_slice_phases_u16_avx2_x86_avx2, cpu_supports_avx2 },
+    { 1, "generic_x86_avx2", "x86_avx2", starch_slice_phases_u16_generic_x86_avx2, cpu_supports_avx2 },
+    { 2, "generic_generic", "generic", starch_slice_phases_u16_generic_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
 
 int starch_read_wisdom (const char * path)
 {
@@ -1159,6 +1801,30 @@ int starch_read_wisdom (const char * path)
     for (starch_count_above_u16_aligned_regentry *entry = starch_count_above_u16_aligned_registry; entry->name; ++entry) {
         entry->rank = 0;
     }
+    int rank_magnitude_dc_sc16 = 0;
+    for (starch_magnitude_dc_sc16_regentry *entry = starch_magnitude_dc_sc16_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_dc_sc16_aligned = 0;
+    for (starch_magnitude_dc_sc16_aligned_regentry *entry = starch_magnitude_dc_sc16_aligned_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_dc_sc16q11 = 0;
+    for (starch_magnitude_dc_sc16q11_regentry *entry = starch_magnitude_dc_sc16q11_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_dc_sc16q11_aligned = 0;
+    for (starch_magnitude_dc_sc16q11_aligned_regentry *entry = starch_magnitude_dc_sc16q11_aligned_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_dc_uc8 = 0;
+    for (starch_magnitude_dc_uc8_regentry *entry = starch_magnitude_dc_uc8_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_dc_uc8_aligned = 0;
+    for (starch_magnitude_dc_uc8_aligned_regentry *entry = starch_magnitude_dc_uc8_aligned_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
     int rank_magnitude_power_uc8 = 0;
     for (starch_magnitude_power_uc8_regentry *entry = starch_magnitude_power_uc8_registry; entry->name; ++entry) {
         entry->rank = 0;
@@ -1199,6 +1865,14 @@ int starch_read_wisdom (const char * path)
     for (starch_mean_power_u16_aligned_regentry *entry = starch_mean_power_u16_aligned_registry; entry->name; ++entry) {
         entry->rank = 0;
     }
+    int rank_preamble_scan_u16 = 0;
+    for (starch_preamble_scan_u16_regentry *entry = starch_preamble_scan_u16_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_slice_phases_u16 = 0;
+    for (starch_slice_phases_u16_regentry *entry = starch_slice_phases_u16_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
 
     char linebuf[512];
     while (fgets(linebuf, sizeof(linebuf), fp)) {
@@ -1250,6 +1924,60 @@ int starch_read_wisdom (const char * path)
             }
             continue;
         }
+        if (!strcmp(name, "magnitude_dc_sc16")) {
+            for (starch_magnitude_dc_sc16_regentry *entry = starch_magnitude_dc_sc16_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_dc_sc16;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_dc_sc16_aligned")) {
+            for (starch_magnitude_dc_sc16_aligned_regentry *entry = starch_magnitude_dc_sc16_aligned_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_dc_sc16_aligned;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_dc_sc16q11")) {
+            for (starch_magnitude_dc_sc16q11_regentry *entry = starch_magnitude_dc_sc16q11_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_dc_sc16q11;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_dc_sc16q11_aligned")) {
+            for (starch_magnitude_dc_sc16q11_aligned_regentry *entry = starch_magnitude_dc_sc16q11_aligned_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_dc_sc16q11_aligned;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_dc_uc8")) {
+            for (starch_magnitude_dc_uc8_regentry *entry = starch_magnitude_dc_uc8_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_dc_uc8;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_dc_uc8_aligned")) {
+            for (starch_magnitude_dc_uc8_aligned_regentry *entry = starch_magnitude_dc_uc8_aligned_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_dc_uc8_aligned;
+                    break;
+                }
+            }
+            continue;
+        }
         if (!strcmp(name, "magnitude_power_uc8")) {
             for (starch_magnitude_power_uc8_regentry *entry = starch_magnitude_power_uc8_registry; entry->name; ++entry) {
                 if (!strcmp(impl, entry->name)) {
@@ -1340,6 +2068,24 @@ int starch_read_wisdom (const char * path)
             }
             continue;
         }
+        if (!strcmp(name, "preamble_scan_u16")) {
+            for (starch_preamble_scan_u16_regentry *entry = starch_preamble_scan_u16_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_preamble_scan_u16;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "slice_phases_u16")) {
+            for (starch_slice_phases_u16_regentry *entry = starch_slice_phases_u16_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_slice_phases_u16;
+                    break;
+                }
+            }
+            continue;
+        }
     }
 
     if (ferror(fp)) {
@@ -1372,6 +2118,72 @@ int starch_read_wisdom (const char * path)
         /* reset the implementation pointer so the next call will re-select */
         starch_count_above_u16_aligned = starch_count_above_u16_aligned_dispatch;
     }
+    {
+        starch_magnitude_dc_sc16_regentry *entry;
+        for (entry = starch_magnitude_dc_sc16_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_dc_sc16;
+        }
+        qsort(starch_magnitude_dc_sc16_registry, entry - starch_magnitude_dc_sc16_registry, sizeof(starch_magnitude_dc_sc16_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_dc_sc16 = starch_magnitude_dc_sc16_dispatch;
+    }
+    {
+        starch_magnitude_dc_sc16_aligned_regentry *entry;
+        for (entry = starch_magnitude_dc_sc16_aligned_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_dc_sc16_aligned;
+        }
+        qsort(starch_magnitude_dc_sc16_aligned_registry, entry - starch_magnitude_dc_sc16_aligned_registry, sizeof(starch_magnitude_dc_sc16_aligned_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_dc_sc16_aligned = starch_magnitude_dc_sc16_aligned_dispatch;
+    }
+    {
+        starch_magnitude_dc_sc16q11_regentry *entry;
+        for (entry = starch_magnitude_dc_sc16q11_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_dc_sc16q11;
+        }
+        qsort(starch_magnitude_dc_sc16q11_registry, entry - starch_magnitude_dc_sc16q11_registry, sizeof(starch_magnitude_dc_sc16q11_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_dc_sc16q11 = starch_magnitude_dc_sc16q11_dispatch;
+    }
+    {
+        starch_magnitude_dc_sc16q11_aligned_regentry *entry;
+        for (entry = starch_magnitude_dc_sc16q11_aligned_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_dc_sc16q11_aligned;
+        }
+        qsort(starch_magnitude_dc_sc16q11_aligned_registry, entry - starch_magnitude_dc_sc16q11_aligned_registry, sizeof(starch_magnitude_dc_sc16q11_aligned_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_dc_sc16q11_aligned = starch_magnitude_dc_sc16q11_aligned_dispatch;
+    }
+    {
+        starch_magnitude_dc_uc8_regentry *entry;
+        for (entry = starch_magnitude_dc_uc8_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_dc_uc8;
+        }
+        qsort(starch_magnitude_dc_uc8_registry, entry - starch_magnitude_dc_uc8_registry, sizeof(starch_magnitude_dc_uc8_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_dc_uc8 = starch_magnitude_dc_uc8_dispatch;
+    }
+    {
+        starch_magnitude_dc_uc8_aligned_regentry *entry;
+        for (entry = starch_magnitude_dc_uc8_aligned_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_dc_uc8_aligned;
+        }
+        qsort(starch_magnitude_dc_uc8_aligned_registry, entry - starch_magnitude_dc_uc8_aligned_registry, sizeof(starch_magnitude_dc_uc8_aligned_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_dc_uc8_aligned = starch_magnitude_dc_uc8_aligned_dispatch;
+    }
     {
         starch_magnitude_power_uc8_regentry *entry;
         for (entry = starch_magnitude_power_uc8_registry; entry->name; ++entry) {
@@ -1482,6 +2294,28 @@ int starch_read_wisdom (const char * path)
         /* reset the implementation pointer so the next call will re-select */
         starch_mean_power_u16_aligned = starch_mean_power_u16_aligned_dispatch;
     }
+    {
+        starch_preamble_scan_u16_regentry *entry;
+        for (entry = starch_preamble_scan_u16_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_preamble_scan_u16;
+        }
+        qsort(starch_preamble_scan_u16_registry, entry - starch_preamble_scan_u16_registry, sizeof(starch_preamble_scan_u16_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_preamble_scan_u16 = starch_preamble_scan_u16_dispatch;
+    }
+    {
+        starch_slice_phases_u16_regentry *entry;
+        for (entry = starch_slice_phases_u16_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_slice_phases_u16;
+        }
+        qsort(starch_slice_phases_u16_registry, entry - starch_slice_phases_u16_registry, sizeof(starch_slice_phases_u16_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_slice_phases_u16 = starch_slice_phases_u16_dispatch;
+    }
 
     return 0;
 }
@@ -0,0 +1,218 @@
+#ifndef DSP_MAGNITUDE_DC_H
+#define DSP_MAGNITUDE_DC_H
+
+#include <math.h>
+
+/* Shared parts of the magnitude_dc_* kernels (see dsp/impl/magnitude_dc_uc8.c).
+ *
+ * The SC16 and SC16Q11 kernels differ only in their full scale, so their
+ * bodies live here as inline functions that take the scale as an argument.
+ *
+ * The running sums of I, Q, level and power are kept in double, as the
+ * generic flavor does: the vector flavors add up at most MAGNITUDE_DC_RUN
+ * samples in float lanes before adding them into the double totals, so
+ * rounding doesn't creep into the DC estimate over a large buffer.
+ */
+
+#define MAGNITUDE_DC_RUN 128
+
+// Convert one normalized, DC-removed sample to an output magnitude and
+// add it to the running sums
+static inline uint16_t magnitude_dc_sample(float I, float Q, double *sum_I, double *sum_Q, double *sum_level, double *sum_power)
+{
+    const float almost_one = 65535.0f / 65536.0f;
+
+    float mag = sqrtf(I * I + Q * Q);
+    if (mag > almost_one)
+        mag = almost_one;
+
+    *sum_I += I;
+    *sum_Q += Q;
+    *sum_level += mag;
+    *sum_power += mag * mag;
+    return (uint16_t) (mag * 65536.0f + 0.5f);
+}
+
+// Turn the running sums into the kernel's outputs
+static inline void magnitude_dc_finish(unsigned len, const fc32_t *dc, double sum_I, double sum_Q, double sum_level, double sum_power, fc32_t *out_mean, double *out_level, double *out_power)
+{
+    out_mean->I = (len ? sum_I / len : 0) + dc->I;
+    out_mean->Q = (len ? sum_Q / len : 0) + dc->Q;
+    *out_level = len ? sum_level / len : 0;
+    *out_power = len ? sum_power / len : 0;
+}
+
+static inline void magnitude_dc_sc16_generic(const sc16_t * restrict in, uint16_t * restrict out, unsigned len, float scale, const fc32_t *dc, fc32_t *out_mean, double *out_level, double *out_power)
+{
+    double sum_I = 0, sum_Q = 0, sum_level = 0, sum_power = 0;
+
+    for (unsigned i = 0; i < len; ++i) {
+        float I = (int16_t) le16toh(in[i].I) * scale - dc->I;
+        float Q = (int16_t) le16toh(in[i].Q) * scale - dc->Q;
+        out[i] = magnitude_dc_sample(I, Q, &sum_I, &sum_Q, &sum_level, &sum_power);
+    }
+
+    magnitude_dc_finish(len, dc, sum_I, sum_Q, sum_level, sum_power, out_mean, out_level, out_power);
+}
+
+#ifdef STARCH_FEATURE_AVX2
+
+#include <immintrin.h>
+
+// Add the 8 float lanes of *acc into the 4 double lanes of *total (lanes k
+// and k+4 share a double, so interleaved I/Q sums keep I in the even lanes
+// and Q in the odd ones), and clear *acc
+static inline void magnitude_dc_flush_avx2(__m256 *acc, __m256d *total)
+{
+    *total = _mm256_add_pd(*total, _mm256_cvtps_pd(_mm256_castps256_ps128(*acc)));
+    *total = _mm256_add_pd(*total, _mm256_cvtps_pd(_mm256_extractf128_ps(*acc, 1)));
+    *acc = _mm256_setzero_ps();
+}
+
+// Horizontal sums of the double accumulators: I (even lanes), Q (odd lanes), and total
+static inline void magnitude_dc_reduce_pd(__m256d iq, __m256d level, __m256d power, double *sum_I, double *sum_Q, double *sum_level, double *sum_power)
+{
+    double lanes[4];
+
+    _mm256_storeu_pd(lanes, iq);
+    *sum_I = lanes[0] + lanes[2];
+    *sum_Q = lanes[1] + lanes[3];
+    _mm256_storeu_pd(lanes, level);
+    *sum_level = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    _mm256_storeu_pd(lanes, power);
+    *sum_power = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+
+static inline void magnitude_dc_sc16_avx2(const int16_t * restrict in, uint16_t * restrict out, unsigned len, float scale_f, const fc32_t *dc, fc32_t *out_mean, double *out_level, double *out_power)
+{
+    // samples stay interleaved (I, Q, I, Q, ...) until the squares are summed pairwise
+    const __m256 scale = _mm256_set1_ps(scale_f);
+    const __m256 offset = _mm256_setr_ps(dc->I, dc->Q, dc->I, dc->Q, dc->I, dc->Q, dc->I, dc->Q);
+    const __m256 almost_one = _mm256_set1_ps(65535.0f / 65536.0f);
+    const __m256 full_scale = _mm256_set1_ps(65536.0f);
+    // _mm256_hadd_ps leaves the results in the order 0 1 4 5 2 3 6 7
+    const __m256i unshuffle = _mm256_setr_epi32(0, 1, 4, 5, 2, 3, 6, 7);
+
+    __m256 sum_iq_x8 = _mm256_setzero_ps();
+    __m256 sum_level_x8 = _mm256_setzero_ps();
+    __m256 sum_power_x8 = _mm256_setzero_ps();
+    __m256d total_iq = _mm256_setzero_pd();
+    __m256d total_level = _mm256_setzero_pd();
+    __m256d total_power = _mm256_setzero_pd();
+
+    unsigned len16 = len >> 4;
+    for (unsigned n = 0; n < len16; ++n) {
+        __m256i mag32[2];
+
+        for (unsigned half = 0; half < 2; ++half) {
+            // 8 samples = 32 bytes
+            __m256i raw = _mm256_loadu_si256((const __m256i *) in);
+            __m256 iq_lo = _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_castsi256_si128(raw))), scale), offset);
+            __m256 iq_hi = _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_extracti128_si256(raw, 1))), scale), offset);
+            sum_iq_x8 = _mm256_add_ps(sum_iq_x8, _mm256_add_ps(iq_lo, iq_hi));
+
+            __m256 magsq = _mm256_hadd_ps(_mm256_mul_ps(iq_lo, iq_lo), _mm256_mul_ps(iq_hi, iq_hi));
+            magsq = _mm256_permutevar8x32_ps(magsq, unshuffle);
+
+            __m256 mag = _mm256_min_ps(_mm256_sqrt_ps(magsq), almost_one);
+            sum_level_x8 = _mm256_add_ps(sum_level_x8, mag);
+            sum_power_x8 = _mm256_add_ps(sum_power_x8, _mm256_mul_ps(mag, mag));
+
+            mag32[half] = _mm256_cvtps_epi32(_mm256_mul_ps(mag, full_scale));
+            in += 16;
+        }
+
+        // pack to 16 bits (packus works per 128-bit lane, so fix up the order afterwards)
+        __m256i mag16 = _mm256_permute4x64_epi64(_mm256_packus_epi32(mag32[0], mag32[1]), 0xD8);
+        _mm256_storeu_si256((__m256i *) out, mag16);
+        out += 16;
+
+        if ((n + 1) % (MAGNITUDE_DC_RUN / 16) == 0 || n + 1 == len16) {
+            magnitude_dc_flush_avx2(&sum_iq_x8, &total_iq);
+            magnitude_dc_flush_avx2(&sum_level_x8, &total_level);
+            magnitude_dc_flush_avx2(&sum_power_x8, &total_power);
+        }
+    }
+
+    double sum_I, sum_Q, sum_level, sum_power;
+    magnitude_dc_reduce_pd(total_iq, total_level, total_power, &sum_I, &sum_Q, &sum_level, &sum_power);
+
+    for (unsigned i = len16 * 16; i < len; ++i) {
+        *out++ = magnitude_dc_sample(in[0] * scale_f - dc->I, in[1] * scale_f - dc->Q, &sum_I, &sum_Q, &sum_level, &sum_power);
+        in += 2;
+    }
+
+    magnitude_dc_finish(len, dc, sum_I, sum_Q, sum_level, sum_power, out_mean, out_level, out_power);
+}
+
+#endif /* STARCH_FEATURE_AVX2 */
+
+#ifdef STARCH_FEATURE_NEON
+
+#include <arm_neon.h>
+
+// Add the lanes of *acc into *total, and clear *acc
+static inline void magnitude_dc_flush_neon(float32x4_t *acc, double *total)
+{
+    float lanes[4];
+
+    vst1q_f32(lanes, *acc);
+    *total += (double) lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    *acc = vdupq_n_f32(0);
+}
+
+static inline void magnitude_dc_sc16_neon(const int16_t * restrict in, uint16_t * restrict out, unsigned len, float scale_f, const fc32_t *dc, fc32_t *out_mean, double *out_level, double *out_power)
+{
+    const float32x4_t dc_I = vdupq_n_f32(dc->I);
+    const float32x4_t dc_Q = vdupq_n_f32(dc->Q);
+    const float32x4_t almost_one = vdupq_n_f32(65535.0f / 65536.0f);
+    const float32x4_t tiny = vdupq_n_f32(1e-12f); // avoid 0 * rsqrt(0) = NaN
+
+    float32x4_t sum_I_x4 = vdupq_n_f32(0);
+    float32x4_t sum_Q_x4 = vdupq_n_f32(0);
+    float32x4_t sum_level_x4 = vdupq_n_f32(0);
+    float32x4_t sum_power_x4 = vdupq_n_f32(0);
+    double sum_I = 0, sum_Q = 0, sum_level = 0, sum_power = 0;
+
+    unsigned len4 = len >> 2;
+    for (unsigned n = 0; n < len4; ++n) {
+        int16x4x2_t iq = vld2_s16(in);
+
+        float32x4_t I = vsubq_f32(vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(iq.val[0])), scale_f), dc_I);
+        float32x4_t Q = vsubq_f32(vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(iq.val[1])), scale_f), dc_Q);
+        sum_I_x4 = vaddq_f32(sum_I_x4, I);
+        sum_Q_x4 = vaddq_f32(sum_Q_x4, Q);
+
+        float32x4_t magsq = vmaxq_f32(vmlaq_f32(vmulq_f32(I, I), Q, Q), tiny);
+        // sqrt(x) = x * (1/sqrt(x)), with one Newton-Raphson step on the estimate
+        float32x4_t rsqrt = vrsqrteq_f32(magsq);
+        rsqrt = vmulq_f32(rsqrt, vrsqrtsq_f32(vmulq_f32(magsq, rsqrt), rsqrt));
+        float32x4_t mag = vminq_f32(vmulq_f32(magsq, rsqrt), almost_one);
+
+        sum_level_x4 = vaddq_f32(sum_level_x4, mag);
+        sum_power_x4 = vmlaq_f32(sum_power_x4, mag, mag);
+
+        vst1_u16(out, vqmovn_u32(vcvtq_n_u32_f32(mag, 16)));
+
+        in += 8;
+        out += 4;
+
+        if ((n + 1) % (MAGNITUDE_DC_RUN / 4) == 0 || n + 1 == len4) {
+            magnitude_dc_flush_neon(&sum_I_x4, &sum_I);
+            magnitude_dc_flush_neon(&sum_Q_x4, &sum_Q);
+            magnitude_dc_flush_neon(&sum_level_x4, &sum_level);
+            magnitude_dc_flush_neon(&sum_power_x4, &sum_power);
+        }
+    }
+
+    for (unsigned i = len4 * 4; i < len; ++i) {
+        *out++ = magnitude_dc_sample(in[0] * scale_f - dc->I, in[1] * scale_f - dc->Q, &sum_I, &sum_Q, &sum_level, &sum_power);
+        in += 2;
+    }
+
+    magnitude_dc_finish(len, dc, sum_I, sum_Q, sum_level, sum_power, out_mean, out_level, out_power);
+}
+
+#endif /* STARCH_FEATURE_NEON */
+
+#endif
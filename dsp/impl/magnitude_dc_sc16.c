@@ -0,0 +1,36 @@
+#include <math.h>
+
+#include "compat/compat.h"
+
+#include "dsp/helpers/magnitude_dc.h"
+
+/* Convert (little-endian) SC16 values to unsigned 16-bit magnitudes, removing a DC offset.
+ *
+ * *dc is the DC offset (normalized, full scale = 1.0) to subtract from every sample.
+ * On return, *out_mean is the mean of the normalized samples _before_ DC removal,
+ * and *out_level / *out_power are the mean level and power of the output magnitudes;
+ * see magnitude_dc_uc8. The work is done by the helpers in dsp/helpers/magnitude_dc.h.
+ */
+
+void STARCH_IMPL(magnitude_dc_sc16, float) (const sc16_t *in, uint16_t *out, unsigned len, const fc32_t *dc, fc32_t *out_mean, double *out_level, double *out_power)
+{
+    magnitude_dc_sc16_generic(STARCH_ALIGNED(in), STARCH_ALIGNED(out), len, 1.0f / 32768.0f, dc, out_mean, out_level, out_power);
+}
+
+#ifdef STARCH_FEATURE_AVX2
+
+void STARCH_IMPL_REQUIRES(magnitude_dc_sc16, avx2, STARCH_FEATURE_AVX2) (const sc16_t *in, uint16_t *out, unsigned len, const fc32_t *dc, fc32_t *out_mean, double *out_level, double *out_power)
+{
+    magnitude_dc_sc16_avx2((const int16_t *) STARCH_ALIGNED(in), STARCH_ALIGNED(out), len, 1.0f / 32768.0f, dc, out_mean, out_level, out_power);
+}
+
+#endif /* STARCH_FEATURE_AVX2 */
+
+#ifdef STARCH_FEATURE_NEON
+
+void STARCH_IMPL_REQUIRES(magnitude_dc_sc16, neon_vrsqrte, STARCH_FEATURE_NEON) (const sc16_t *in, uint16_t *out, unsigned len, const fc32_t *dc, fc32_t *out_mean, double *out_level, double *out_power)
+{
+    magnitude_dc_sc16_neon((const int16_t *) STARCH_ALIGNED(in), STARCH_ALIGNED(out), len, 1.0f / 32768.0f, dc, out_mean, out_level, out_power);
+}
+
+#endif /* STARCH_FEATURE_NEON */
@@ -0,0 +1,177 @@
+#include <math.h>
+
+#include "compat/compat.h"
+
+#include "dsp/helpers/magnitude_dc.h"
+
+/* Convert UC8 values to unsigned 16-bit magnitudes, removing a DC offset.
+ *
+ * *dc is the DC offset (normalized, full scale = 1.0) to subtract from every sample.
+ * On return, *out_mean is the mean of the normalized samples _before_ DC removal,
+ * for use in updating the DC estimate, and *out_level / *out_power are the mean
+ * (normalized) level and power of the output magnitudes. Parts shared with the
+ * SC16 kernels are in dsp/helpers/magnitude_dc.h.
+ */
+
+void STARCH_IMPL(magnitude_dc_uc8, float) (const uc8_t *in, uint16_t *out, unsigned len, const fc32_t *dc, fc32_t *out_mean, double *out_level, double *out_power)
+{
+    const uc8_t * restrict in_align = STARCH_ALIGNED(in);
+    uint16_t * restrict out_align = STARCH_ALIGNED(out);
+
+    const float offset_I = 127.4f / 128.0f + dc->I;
+    const float offset_Q = 127.4f / 128.0f + dc->Q;
+
+    double sum_I = 0, sum_Q = 0, sum_level = 0, sum_power = 0;
+
+    for (unsigned i = 0; i < len; ++i) {
+        float I = in_align[i].I / 128.0f - offset_I;
+        float Q = in_align[i].Q / 128.0f - offset_Q;
+        out_align[i] = magnitude_dc_sample(I, Q, &sum_I, &sum_Q, &sum_level, &sum_power);
+    }
+
+    magnitude_dc_finish(len, dc, sum_I, sum_Q, sum_level, sum_power, out_mean, out_level, out_power);
+}
+
+#ifdef STARCH_FEATURE_AVX2
+
+void STARCH_IMPL_REQUIRES(magnitude_dc_uc8, avx2, STARCH_FEATURE_AVX2) (const uc8_t *in, uint16_t *out, unsigned len, const fc32_t *dc, fc32_t *out_mean, double *out_level, double *out_power)
+{
+    const uint8_t * restrict in_align = (const uint8_t *) STARCH_ALIGNED(in);
+    uint16_t * restrict out_align = STARCH_ALIGNED(out);
+
+    const float offset_I = 127.4f / 128.0f + dc->I;
+    const float offset_Q = 127.4f / 128.0f + dc->Q;
+
+    // samples stay interleaved (I, Q, I, Q, ...) until the squares are summed pairwise
+    const __m256 scale = _mm256_set1_ps(1.0f / 128.0f);
+    const __m256 offset = _mm256_setr_ps(offset_I, offset_Q, offset_I, offset_Q, offset_I, offset_Q, offset_I, offset_Q);
+    const __m256 almost_one = _mm256_set1_ps(65535.0f / 65536.0f);
+    const __m256 full_scale = _mm256_set1_ps(65536.0f);
+    // _mm256_hadd_ps leaves the results in the order 0 1 4 5 2 3 6 7
+    const __m256i unshuffle = _mm256_setr_epi32(0, 1, 4, 5, 2, 3, 6, 7);
+
+    __m256 sum_iq_x8 = _mm256_setzero_ps();
+    __m256 sum_level_x8 = _mm256_setzero_ps();
+    __m256 sum_power_x8 = _mm256_setzero_ps();
+    __m256d total_iq = _mm256_setzero_pd();
+    __m256d total_level = _mm256_setzero_pd();
+    __m256d total_power = _mm256_setzero_pd();
+
+    unsigned len16 = len >> 4;
+    for (unsigned n = 0; n < len16; ++n) {
+        __m256i mag32[2];
+
+        for (unsigned half = 0; half < 2; ++half) {
+            // 8 samples = 16 bytes
+            __m128i raw = _mm_loadu_si128((const __m128i *) in_align);
+            __m256 iq_lo = _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(raw)), scale), offset);
+            __m256 iq_hi = _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(raw, 8))), scale), offset);
+            sum_iq_x8 = _mm256_add_ps(sum_iq_x8, _mm256_add_ps(iq_lo, iq_hi));
+
+            __m256 magsq = _mm256_hadd_ps(_mm256_mul_ps(iq_lo, iq_lo), _mm256_mul_ps(iq_hi, iq_hi));
+            magsq = _mm256_permutevar8x32_ps(magsq, unshuffle);
+
+            __m256 mag = _mm256_min_ps(_mm256_sqrt_ps(magsq), almost_one);
+            sum_level_x8 = _mm256_add_ps(sum_level_x8, mag);
+            sum_power_x8 = _mm256_add_ps(sum_power_x8, _mm256_mul_ps(mag, mag));
+
+            mag32[half] = _mm256_cvtps_epi32(_mm256_mul_ps(mag, full_scale));
+            in_align += 16;
+        }
+
+        // pack to 16 bits (packus works per 128-bit lane, so fix up the order afterwards)
+        __m256i mag16 = _mm256_permute4x64_epi64(_mm256_packus_epi32(mag32[0], mag32[1]), 0xD8);
+        _mm256_storeu_si256((__m256i *) out_align, mag16);
+        out_align += 16;
+
+        if ((n + 1) % (MAGNITUDE_DC_RUN / 16) == 0 || n + 1 == len16) {
+            magnitude_dc_flush_avx2(&sum_iq_x8, &total_iq);
+            magnitude_dc_flush_avx2(&sum_level_x8, &total_level);
+            magnitude_dc_flush_avx2(&sum_power_x8, &total_power);
+        }
+    }
+
+    double sum_I, sum_Q, sum_level, sum_power;
+    magnitude_dc_reduce_pd(total_iq, total_level, total_power, &sum_I, &sum_Q, &sum_level, &sum_power);
+
+    for (unsigned i = len16 * 16; i < len; ++i) {
+        *out_align++ = magnitude_dc_sample(in_align[0] / 128.0f - offset_I, in_align[1] / 128.0f - offset_Q, &sum_I, &sum_Q, &sum_level, &sum_power);
+        in_align += 2;
+    }
+
+    magnitude_dc_finish(len, dc, sum_I, sum_Q, sum_level, sum_power, out_mean, out_level, out_power);
+}
+
+#endif /* STARCH_FEATURE_AVX2 */
+
+#ifdef STARCH_FEATURE_NEON
+
+void STARCH_IMPL_REQUIRES(magnitude_dc_uc8, neon_vrsqrte, STARCH_FEATURE_NEON) (const uc8_t *in, uint16_t *out, unsigned len, const fc32_t *dc, fc32_t *out_mean, double *out_level, double *out_power)
+{
+    const uint8_t * restrict in_align = (const uint8_t *) STARCH_ALIGNED(in);
+    uint16_t * restrict out_align = STARCH_ALIGNED(out);
+
+    const float offset_I = 127.4f / 128.0f + dc->I;
+    const float offset_Q = 127.4f / 128.0f + dc->Q;
+
+    const float32x4_t offset_I_x4 = vdupq_n_f32(offset_I);
+    const float32x4_t offset_Q_x4 = vdupq_n_f32(offset_Q);
+    const float32x4_t almost_one = vdupq_n_f32(65535.0f / 65536.0f);
+    const float32x4_t tiny = vdupq_n_f32(1e-12f); // avoid 0 * rsqrt(0) = NaN
+
+    float32x4_t sum_I_x4 = vdupq_n_f32(0);
+    float32x4_t sum_Q_x4 = vdupq_n_f32(0);
+    float32x4_t sum_level_x4 = vdupq_n_f32(0);
+    float32x4_t sum_power_x4 = vdupq_n_f32(0);
+    double sum_I = 0, sum_Q = 0, sum_level = 0, sum_power = 0;
+
+    unsigned len8 = len >> 3;
+    for (unsigned n = 0; n < len8; ++n) {
+        uint8x8x2_t iq = vld2_u8(in_align);
+        uint16x8_t i_u16 = vmovl_u8(iq.val[0]);
+        uint16x8_t q_u16 = vmovl_u8(iq.val[1]);
+        uint16x4_t mag_u16[2];
+
+        for (unsigned half = 0; half < 2; ++half) {
+            uint32x4_t i_u32 = vmovl_u16(half ? vget_high_u16(i_u16) : vget_low_u16(i_u16));
+            uint32x4_t q_u32 = vmovl_u16(half ? vget_high_u16(q_u16) : vget_low_u16(q_u16));
+
+            // 7 fractional bits: x / 128
+            float32x4_t I = vsubq_f32(vcvtq_n_f32_u32(i_u32, 7), offset_I_x4);
+            float32x4_t Q = vsubq_f32(vcvtq_n_f32_u32(q_u32, 7), offset_Q_x4);
+            sum_I_x4 = vaddq_f32(sum_I_x4, I);
+            sum_Q_x4 = vaddq_f32(sum_Q_x4, Q);
+
+            float32x4_t magsq = vmaxq_f32(vmlaq_f32(vmulq_f32(I, I), Q, Q), tiny);
+            // sqrt(x) = x * (1/sqrt(x)), with one Newton-Raphson step on the estimate
+            float32x4_t rsqrt = vrsqrteq_f32(magsq);
+            rsqrt = vmulq_f32(rsqrt, vrsqrtsq_f32(vmulq_f32(magsq, rsqrt), rsqrt));
+            float32x4_t mag = vminq_f32(vmulq_f32(magsq, rsqrt), almost_one);
+
+            sum_level_x4 = vaddq_f32(sum_level_x4, mag);
+            sum_power_x4 = vmlaq_f32(sum_power_x4, mag, mag);
+
+            mag_u16[half] = vqmovn_u32(vcvtq_n_u32_f32(mag, 16));
+        }
+
+        vst1q_u16(out_align, vcombine_u16(mag_u16[0], mag_u16[1]));
+        in_align += 16;
+        out_align += 8;
+
+        if ((n + 1) % (MAGNITUDE_DC_RUN / 8) == 0 || n + 1 == len8) {
+            magnitude_dc_flush_neon(&sum_I_x4, &sum_I);
+            magnitude_dc_flush_neon(&sum_Q_x4, &sum_Q);
+            magnitude_dc_flush_neon(&sum_level_x4, &sum_level);
+            magnitude_dc_flush_neon(&sum_power_x4, &sum_power);
+        }
+    }
+
+    for (unsigned i = len8 * 8; i < len; ++i) {
+        *out_align++ = magnitude_dc_sample(in_align[0] / 128.0f - offset_I, in_align[1] / 128.0f - offset_Q, &sum_I, &sum_Q, &sum_level, &sum_power);
+        in_align += 2;
+    }
+
+    magnitude_dc_finish(len, dc, sum_I, sum_Q, sum_level, sum_power, out_mean, out_level, out_power);
+}
+
+#endif /* STARCH_FEATURE_NEON */
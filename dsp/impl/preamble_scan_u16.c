@@ -0,0 +1,158 @@
+/*
+ * Scan a magnitude buffer for possible 2.4MHz Mode S preambles.
+ *
+ * For each sample offset i in [0, len), bit (i % 64) of out_bitmap[i / 64]
+ * is set if in[i..i+13] has the rising/falling edge at 0-1 / 12-13 and the
+ * peak pattern of one of the phase 3..7 preambles that demodulate2400()
+ * looks for. This is only the shape test; the demodulator still applies
+ * the signal/noise and quiet-sample checks to each candidate.
+ *
+ * The caller must ensure that in[len..len+12] are also readable.
+ * out_bitmap must have room for (len + 63) / 64 words; unused high bits
+ * of the last word are cleared.
+ */
+
+static inline uint64_t STARCH_SYMBOL(preamble_test) (const uint16_t *p)
+{
+    // quick check first; most samples fail this
+    if (! (p[0] < p[1] && p[12] > p[13]) )
+        return 0;
+
+    // peaks for phase 3 / 4 / 5 / 6 / 7 respectively
+    return
+        (p[1] > p[2] && p[2] < p[3] && p[3] > p[4] && p[8] < p[9] && p[9] > p[10] && p[10] < p[11]) ||
+        (p[1] > p[2] && p[2] < p[3] && p[3] > p[4] && p[8] < p[9] && p[9] > p[10] && p[11] < p[12]) ||
+        (p[1] > p[2] && p[2] < p[3] && p[4] > p[5] && p[8] < p[9] && p[10] > p[11] && p[11] < p[12]) ||
+        (p[1] > p[2] && p[3] < p[4] && p[4] > p[5] && p[9] < p[10] && p[10] > p[11] && p[11] < p[12]) ||
+        (p[2] > p[3] && p[3] < p[4] && p[4] > p[5] && p[9] < p[10] && p[10] > p[11] && p[11] < p[12]);
+}
+
+void STARCH_IMPL(preamble_scan_u16, generic) (const uint16_t *in, unsigned len, uint64_t *out_bitmap)
+{
+    for (unsigned base = 0; base < len; base += 64) {
+        unsigned n = (len - base < 64 ? len - base : 64);
+        uint64_t bits = 0;
+
+        for (unsigned i = 0; i < n; ++i)
+            bits |= STARCH_SYMBOL(preamble_test)(&in[base + i]) << i;
+
+        *out_bitmap++ = bits;
+    }
+}
+
+#ifdef STARCH_FEATURE_AVX2
+
+#include <immintrin.h>
+
+void STARCH_IMPL_REQUIRES(preamble_scan_u16, avx2, STARCH_FEATURE_AVX2) (const uint16_t *in, unsigned len, uint64_t *out_bitmap)
+{
+    // AVX2 only has signed 16-bit compares; flip the sign bit so that
+    // a signed compare gives the unsigned result
+    const __m256i bias = _mm256_set1_epi16((short) 0x8000);
+
+    for (unsigned base = 0; base < len; base += 64) {
+        unsigned n = (len - base < 64 ? len - base : 64);
+        uint64_t bits = 0;
+        unsigned i = 0;
+
+        for (; i + 16 <= n; i += 16) {
+            const uint16_t *p = &in[base + i];
+            __m256i v[14];
+            for (unsigned k = 0; k < 14; ++k)
+                v[k] = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *) (p + k)), bias);
+
+#define GT(_a,_b) _mm256_cmpgt_epi16(v[_a], v[_b])
+            __m256i edges = _mm256_and_si256(GT(1, 0), GT(12, 13));
+
+            __m256i rise23_fall34 = _mm256_and_si256(GT(3, 2), GT(3, 4));
+            __m256i rise34_fall45 = _mm256_and_si256(GT(4, 3), GT(4, 5));
+            __m256i rise89 = GT(9, 8);
+            __m256i fall1011_rise1112 = _mm256_and_si256(GT(10, 11), GT(12, 11));
+
+            __m256i phase3 = _mm256_and_si256(_mm256_and_si256(GT(1, 2), rise23_fall34),
+                                              _mm256_and_si256(_mm256_and_si256(rise89, GT(9, 10)), GT(11, 10)));
+            __m256i phase4 = _mm256_and_si256(_mm256_and_si256(GT(1, 2), rise23_fall34),
+                                              _mm256_and_si256(_mm256_and_si256(rise89, GT(9, 10)), GT(12, 11)));
+            __m256i phase5 = _mm256_and_si256(_mm256_and_si256(_mm256_and_si256(GT(1, 2), GT(3, 2)), GT(4, 5)),
+                                              _mm256_and_si256(rise89, fall1011_rise1112));
+            __m256i phase6 = _mm256_and_si256(_mm256_and_si256(GT(1, 2), rise34_fall45),
+                                              _mm256_and_si256(GT(10, 9), fall1011_rise1112));
+            __m256i phase7 = _mm256_and_si256(_mm256_and_si256(GT(2, 3), rise34_fall45),
+                                              _mm256_and_si256(GT(10, 9), fall1011_rise1112));
+#undef GT
+
+            __m256i any = _mm256_or_si256(_mm256_or_si256(phase3, phase4),
+                                          _mm256_or_si256(_mm256_or_si256(phase5, phase6), phase7));
+            __m256i result = _mm256_and_si256(edges, any);
+
+            // narrow 16 x 16-bit masks to 16 x 8-bit, in order, and collect one bit per lane
+            __m128i packed = _mm_packs_epi16(_mm256_castsi256_si128(result), _mm256_extracti128_si256(result, 1));
+            bits |= (uint64_t) (uint16_t) _mm_movemask_epi8(packed) << i;
+        }
+
+        for (; i < n; ++i)
+            bits |= STARCH_SYMBOL(preamble_test)(&in[base + i]) << i;
+
+        *out_bitmap++ = bits;
+    }
+}
+
+#endif /* STARCH_FEATURE_AVX2 */
+
+#ifdef STARCH_FEATURE_NEON
+
+#include <arm_neon.h>
+
+void STARCH_IMPL_REQUIRES(preamble_scan_u16, neon, STARCH_FEATURE_NEON) (const uint16_t *in, unsigned len, uint64_t *out_bitmap)
+{
+    static const uint16_t lane_bits[8] = { 1, 2, 4, 8, 16, 32, 64, 128 };
+    const uint16x8_t lane_bits_x8 = vld1q_u16(lane_bits);
+
+    for (unsigned base = 0; base < len; base += 64) {
+        unsigned n = (len - base < 64 ? len - base : 64);
+        uint64_t bits = 0;
+        unsigned i = 0;
+
+        for (; i + 8 <= n; i += 8) {
+            const uint16_t *p = &in[base + i];
+            uint16x8_t v[14];
+            for (unsigned k = 0; k < 14; ++k)
+                v[k] = vld1q_u16(p + k);
+
+#define GT(_a,_b) vcgtq_u16(v[_a], v[_b])
+            uint16x8_t edges = vandq_u16(GT(1, 0), GT(12, 13));
+
+            uint16x8_t rise23_fall34 = vandq_u16(GT(3, 2), GT(3, 4));
+            uint16x8_t rise34_fall45 = vandq_u16(GT(4, 3), GT(4, 5));
+            uint16x8_t rise89 = GT(9, 8);
+            uint16x8_t fall1011_rise1112 = vandq_u16(GT(10, 11), GT(12, 11));
+
+            uint16x8_t phase3 = vandq_u16(vandq_u16(GT(1, 2), rise23_fall34),
+                                          vandq_u16(vandq_u16(rise89, GT(9, 10)), GT(11, 10)));
+            uint16x8_t phase4 = vandq_u16(vandq_u16(GT(1, 2), rise23_fall34),
+                                          vandq_u16(vandq_u16(rise89, GT(9, 10)), GT(12, 11)));
+            uint16x8_t phase5 = vandq_u16(vandq_u16(vandq_u16(GT(1, 2), GT(3, 2)), GT(4, 5)),
+                                          vandq_u16(rise89, fall1011_rise1112));
+            uint16x8_t phase6 = vandq_u16(vandq_u16(GT(1, 2), rise34_fall45),
+                                          vandq_u16(GT(10, 9), fall1011_rise1112));
+            uint16x8_t phase7 = vandq_u16(vandq_u16(GT(2, 3), rise34_fall45),
+                                          vandq_u16(GT(10, 9), fall1011_rise1112));
+#undef GT
+
+            uint16x8_t any = vorrq_u16(vorrq_u16(phase3, phase4), vorrq_u16(vorrq_u16(phase5, phase6), phase7));
+            uint16x8_t result = vandq_u16(vandq_u16(edges, any), lane_bits_x8);
+
+            // horizontal add of the per-lane bits gives the 8-bit mask
+            uint64x2_t sum2 = vpaddlq_u32(vpaddlq_u16(result));
+            uint64_t mask8 = vgetq_lane_u64(sum2, 0) + vgetq_lane_u64(sum2, 1);
+            bits |= mask8 << i;
+        }
+
+        for (; i < n; ++i)
+            bits |= STARCH_SYMBOL(preamble_test)(&in[base + i]) << i;
+
+        *out_bitmap++ = bits;
+    }
+}
+
+#endif /* STARCH_FEATURE_NEON */
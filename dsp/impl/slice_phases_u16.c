@@ -0,0 +1,301 @@
+/*
+ * Demodulate a 112-bit 2.4MHz Mode S message body at each of the five
+ * phase offsets that demodulate2400() tries.
+ *
+ * in points at the first data sample (preamble + 19). Hypothesis h
+ * (h = 0..4) corresponds to demodulate2400()'s try_phase = h + 4, i.e. the
+ * first data symbol starts (h + 4) / 5 of a sample into in[0]. Bit k of
+ * hypothesis h is decided by the correlation at (h + 4 + 12k) / 5 samples.
+ *
+ * The results are written to out[h * MODES_LONG_MSG_BYTES ..
+ * (h + 1) * MODES_LONG_MSG_BYTES - 1].
+ *
+ * Only byte 0 of each hypothesis is always valid. Implementations may stop
+ * early for a hypothesis whose DF (top 5 bits of byte 0) is not in either
+ * of valid_df_short / valid_df_long, and may stop after 7 bytes if it is
+ * only in valid_df_short.
+ *
+ * in[0..270] must be readable.
+ */
+
+// The correlation functions; see demod_2400.c
+#define SLICE_PHASE0(m) (5 * (m)[0] - 3 * (m)[1] - 2 * (m)[2])
+#define SLICE_PHASE1(m) (4 * (m)[0] - (m)[1] - 3 * (m)[2])
+#define SLICE_PHASE2(m) (3 * (m)[0] + (m)[1] - 4 * (m)[2])
+#define SLICE_PHASE3(m) (2 * (m)[0] + 3 * (m)[1] - 5 * (m)[2])
+#define SLICE_PHASE4(m) ((m)[0] + 5 * (m)[1] - 5 * (m)[2] - (m)[3])
+
+void STARCH_IMPL(slice_phases_u16, generic) (const uint16_t *in, uint32_t valid_df_short, uint32_t valid_df_long, uint8_t *out)
+{
+    for (unsigned try_phase = 4; try_phase <= 8; ++try_phase) {
+        const uint16_t *pPtr = in + (try_phase / 5);
+        unsigned phase = try_phase % 5;
+        uint8_t *msg = &out[(try_phase - 4) * MODES_LONG_MSG_BYTES];
+
+        unsigned bytelen = 1;
+        for (unsigned i = 0; i < bytelen; ++i) {
+            uint8_t theByte = 0;
+
+            switch (phase) {
+            case 0:
+                theByte =
+                    (SLICE_PHASE0(pPtr) > 0 ? 0x80 : 0) |
+                    (SLICE_PHASE2(pPtr+2) > 0 ? 0x40 : 0) |
+                    (SLICE_PHASE4(pPtr+4) > 0 ? 0x20 : 0) |
+                    (SLICE_PHASE1(pPtr+7) > 0 ? 0x10 : 0) |
+                    (SLICE_PHASE3(pPtr+9) > 0 ? 0x08 : 0) |
+                    (SLICE_PHASE0(pPtr+12) > 0 ? 0x04 : 0) |
+                    (SLICE_PHASE2(pPtr+14) > 0 ? 0x02 : 0) |
+                    (SLICE_PHASE4(pPtr+16) > 0 ? 0x01 : 0);
+
+                phase = 1;
+                pPtr += 19;
+                break;
+
+            case 1:
+                theByte =
+                    (SLICE_PHASE1(pPtr) > 0 ? 0x80 : 0) |
+                    (SLICE_PHASE3(pPtr+2) > 0 ? 0x40 : 0) |
+                    (SLICE_PHASE0(pPtr+5) > 0 ? 0x20 : 0) |
+                    (SLICE_PHASE2(pPtr+7) > 0 ? 0x10 : 0) |
+                    (SLICE_PHASE4(pPtr+9) > 0 ? 0x08 : 0) |
+                    (SLICE_PHASE1(pPtr+12) > 0 ? 0x04 : 0) |
+                    (SLICE_PHASE3(pPtr+14) > 0 ? 0x02 : 0) |
+                    (SLICE_PHASE0(pPtr+17) > 0 ? 0x01 : 0);
+
+                phase = 2;
+                pPtr += 19;
+                break;
+
+            case 2:
+                theByte =
+                    (SLICE_PHASE2(pPtr) > 0 ? 0x80 : 0) |
+                    (SLICE_PHASE4(pPtr+2) > 0 ? 0x40 : 0) |
+                    (SLICE_PHASE1(pPtr+5) > 0 ? 0x20 : 0) |
+                    (SLICE_PHASE3(pPtr+7) > 0 ? 0x10 : 0) |
+                    (SLICE_PHASE0(pPtr+10) > 0 ? 0x08 : 0) |
+                    (SLICE_PHASE2(pPtr+12) > 0 ? 0x04 : 0) |
+                    (SLICE_PHASE4(pPtr+14) > 0 ? 0x02 : 0) |
+                    (SLICE_PHASE1(pPtr+17) > 0 ? 0x01 : 0);
+
+                phase = 3;
+                pPtr += 19;
+                break;
+
+            case 3:
+                theByte =
+                    (SLICE_PHASE3(pPtr) > 0 ? 0x80 : 0) |
+                    (SLICE_PHASE0(pPtr+3) > 0 ? 0x40 : 0) |
+                    (SLICE_PHASE2(pPtr+5) > 0 ? 0x20 : 0) |
+                    (SLICE_PHASE4(pPtr+7) > 0 ? 0x10 : 0) |
+                    (SLICE_PHASE1(pPtr+10) > 0 ? 0x08 : 0) |
+                    (SLICE_PHASE3(pPtr+12) > 0 ? 0x04 : 0) |
+                    (SLICE_PHASE0(pPtr+15) > 0 ? 0x02 : 0) |
+                    (SLICE_PHASE2(pPtr+17) > 0 ? 0x01 : 0);
+
+                phase = 4;
+                pPtr += 19;
+                break;
+
+            case 4:
+                theByte =
+                    (SLICE_PHASE4(pPtr) > 0 ? 0x80 : 0) |
+                    (SLICE_PHASE1(pPtr+3) > 0 ? 0x40 : 0) |
+                    (SLICE_PHASE3(pPtr+5) > 0 ? 0x20 : 0) |
+                    (SLICE_PHASE0(pPtr+8) > 0 ? 0x10 : 0) |
+                    (SLICE_PHASE2(pPtr+10) > 0 ? 0x08 : 0) |
+                    (SLICE_PHASE4(pPtr+12) > 0 ? 0x04 : 0) |
+                    (SLICE_PHASE1(pPtr+15) > 0 ? 0x02 : 0) |
+                    (SLICE_PHASE3(pPtr+17) > 0 ? 0x01 : 0);
+
+                phase = 0;
+                pPtr += 20;
+                break;
+            }
+
+            msg[i] = theByte;
+
+            if (i == 0) {
+                // inspect DF field early, only continue processing
+                // messages where the DF appears valid
+                unsigned df = theByte >> 3;
+                if (valid_df_long & (1 << df))
+                    bytelen = MODES_LONG_MSG_BYTES;
+                else if (valid_df_short & (1 << df))
+                    bytelen = MODES_SHORT_MSG_BYTES;
+            }
+        }
+    }
+}
+
+#undef SLICE_PHASE0
+#undef SLICE_PHASE1
+#undef SLICE_PHASE2
+#undef SLICE_PHASE3
+#undef SLICE_PHASE4
+
+#if defined(STARCH_FEATURE_AVX2) || defined(STARCH_FEATURE_NEON)
+
+//
+// The vector implementations compute all five hypotheses for one bit at a
+// time, one hypothesis per lane (so 3 of AVX2's 8 lanes are idle), and stop
+// after the first byte / after a short message if no hypothesis needs
+// more. The sample/phase pattern for bit k repeats every 5 bits
+// (12 samples), so bit 5n+r uses a 4-sample window starting at sample
+// 12n + window_start[r], with per-lane weights weights[r].
+//
+// The weights are the negated correlation functions, so a set bit is a
+// negative dot product (i.e. the sign bit). As each correlation function
+// sums to zero, the dot product is unchanged if the samples are offset by
+// -32768 to fit them into int16_t.
+//
+
+static const unsigned STARCH_SYMBOL(slice_window_start)[5] = { 0, 3, 5, 8, 10 };
+
+static const int16_t STARCH_SYMBOL(slice_weights)[5][4][8] = {
+    // bits 5n+0
+    { { -1,  0,  0,  0,  0,  0,  0,  0 },
+      { -5, -5, -4, -3, -2,  0,  0,  0 },
+      {  5,  3,  1, -1, -3,  0,  0,  0 },
+      {  1,  2,  3,  4,  5,  0,  0,  0 } },
+    // bits 5n+1
+    { { -4, -3, -2, -1,  0,  0,  0,  0 },
+      {  1, -1, -3, -5, -5,  0,  0,  0 },
+      {  3,  4,  5,  5,  3,  0,  0,  0 },
+      {  0,  0,  0,  1,  2,  0,  0,  0 } },
+    // bits 5n+2
+    { { -2, -1,  0,  0,  0,  0,  0,  0 },
+      { -3, -5, -5, -4, -3,  0,  0,  0 },
+      {  5,  5,  3,  1, -1,  0,  0,  0 },
+      {  0,  1,  2,  3,  4,  0,  0,  0 } },
+    // bits 5n+3
+    { { -5, -4, -3, -2, -1,  0,  0,  0 },
+      {  3,  1, -1, -3, -5,  0,  0,  0 },
+      {  2,  3,  4,  5,  5,  0,  0,  0 },
+      {  0,  0,  0,  0,  1,  0,  0,  0 } },
+    // bits 5n+4
+    { { -3, -2, -1,  0,  0,  0,  0,  0 },
+      { -1, -3, -5, -5, -4,  0,  0,  0 },
+      {  4,  5,  5,  3,  1,  0,  0,  0 },
+      {  0,  0,  1,  2,  3,  0,  0,  0 } }
+};
+
+// Given the first byte of each hypothesis, return the number of bytes
+// needed to satisfy the most demanding one
+static inline unsigned STARCH_SYMBOL(slice_bytelen) (const uint8_t *out, uint32_t valid_df_short, uint32_t valid_df_long)
+{
+    unsigned bytelen = 1;
+    for (unsigned h = 0; h < 5; ++h) {
+        unsigned df = out[h * MODES_LONG_MSG_BYTES] >> 3;
+        if (valid_df_long & (1 << df))
+            return MODES_LONG_MSG_BYTES;
+        if (valid_df_short & (1 << df))
+            bytelen = MODES_SHORT_MSG_BYTES;
+    }
+    return bytelen;
+}
+
+#endif
+
+#ifdef STARCH_FEATURE_AVX2
+
+#include <immintrin.h>
+#include <string.h>
+
+void STARCH_IMPL_REQUIRES(slice_phases_u16, avx2, STARCH_FEATURE_AVX2) (const uint16_t *in, uint32_t valid_df_short, uint32_t valid_df_long, uint8_t *out)
+{
+    // Interleave the weights into (tap 0, tap 1) and (tap 2, tap 3) int16
+    // pairs per int32 lane, for use with _mm256_madd_epi16
+    __m256i w01[5], w23[5];
+    for (unsigned r = 0; r < 5; ++r) {
+        __m128i t0 = _mm_loadu_si128((const __m128i *) STARCH_SYMBOL(slice_weights)[r][0]);
+        __m128i t1 = _mm_loadu_si128((const __m128i *) STARCH_SYMBOL(slice_weights)[r][1]);
+        __m128i t2 = _mm_loadu_si128((const __m128i *) STARCH_SYMBOL(slice_weights)[r][2]);
+        __m128i t3 = _mm_loadu_si128((const __m128i *) STARCH_SYMBOL(slice_weights)[r][3]);
+        w01[r] = _mm256_set_m128i(_mm_unpackhi_epi16(t0, t1), _mm_unpacklo_epi16(t0, t1));
+        w23[r] = _mm256_set_m128i(_mm_unpackhi_epi16(t2, t3), _mm_unpacklo_epi16(t2, t3));
+    }
+
+    const __m256i bias = _mm256_set1_epi32((int) 0x80008000);
+
+    unsigned r = 0, base = 0;
+    unsigned bytelen = 1;
+    for (unsigned byte = 0; byte < bytelen; ++byte) {
+        __m256i acc = _mm256_setzero_si256();
+
+        for (unsigned bit = 0; bit < 8; ++bit) {
+            const uint16_t *window = in + base + STARCH_SYMBOL(slice_window_start)[r];
+            uint32_t pair01, pair23;
+            memcpy(&pair01, window, sizeof(pair01));
+            memcpy(&pair23, window + 2, sizeof(pair23));
+
+            __m256i x01 = _mm256_xor_si256(_mm256_set1_epi32((int) pair01), bias);
+            __m256i x23 = _mm256_xor_si256(_mm256_set1_epi32((int) pair23), bias);
+            __m256i dot = _mm256_add_epi32(_mm256_madd_epi16(x01, w01[r]), _mm256_madd_epi16(x23, w23[r]));
+
+            acc = _mm256_or_si256(_mm256_slli_epi32(acc, 1), _mm256_srli_epi32(dot, 31));
+
+            if (++r == 5) {
+                r = 0;
+                base += 12;
+            }
+        }
+
+        uint32_t lanes[8];
+        _mm256_storeu_si256((__m256i *) lanes, acc);
+        for (unsigned h = 0; h < 5; ++h)
+            out[h * MODES_LONG_MSG_BYTES + byte] = lanes[h];
+
+        if (byte == 0)
+            bytelen = STARCH_SYMBOL(slice_bytelen)(out, valid_df_short, valid_df_long);
+    }
+}
+
+#endif /* STARCH_FEATURE_AVX2 */
+
+#ifdef STARCH_FEATURE_NEON
+
+#include <arm_neon.h>
+
+void STARCH_IMPL_REQUIRES(slice_phases_u16, neon, STARCH_FEATURE_NEON) (const uint16_t *in, uint32_t valid_df_short, uint32_t valid_df_long, uint8_t *out)
+{
+    unsigned r = 0, base = 0;
+    unsigned bytelen = 1;
+    for (unsigned byte = 0; byte < bytelen; ++byte) {
+        uint32x4_t acc_lo = vdupq_n_u32(0);
+        uint32x4_t acc_hi = vdupq_n_u32(0);
+
+        for (unsigned bit = 0; bit < 8; ++bit) {
+            const uint16_t *window = in + base + STARCH_SYMBOL(slice_window_start)[r];
+            const int16_t (*w)[8] = STARCH_SYMBOL(slice_weights)[r];
+
+            int32x4_t dot_lo = vdupq_n_s32(0);
+            int32x4_t dot_hi = vdupq_n_s32(0);
+            for (unsigned tap = 0; tap < 4; ++tap) {
+                int16_t x = (int16_t) (window[tap] ^ 0x8000);
+                int16x8_t weights = vld1q_s16(w[tap]);
+                dot_lo = vmlal_n_s16(dot_lo, vget_low_s16(weights), x);
+                dot_hi = vmlal_n_s16(dot_hi, vget_high_s16(weights), x);
+            }
+
+            acc_lo = vorrq_u32(vshlq_n_u32(acc_lo, 1), vshrq_n_u32(vreinterpretq_u32_s32(dot_lo), 31));
+            acc_hi = vorrq_u32(vshlq_n_u32(acc_hi, 1), vshrq_n_u32(vreinterpretq_u32_s32(dot_hi), 31));
+
+            if (++r == 5) {
+                r = 0;
+                base += 12;
+            }
+        }
+
+        out[0 * MODES_LONG_MSG_BYTES + byte] = vgetq_lane_u32(acc_lo, 0);
+        out[1 * MODES_LONG_MSG_BYTES + byte] = vgetq_lane_u32(acc_lo, 1);
+        out[2 * MODES_LONG_MSG_BYTES + byte] = vgetq_lane_u32(acc_lo, 2);
+        out[3 * MODES_LONG_MSG_BYTES + byte] = vgetq_lane_u32(acc_lo, 3);
+        out[4 * MODES_LONG_MSG_BYTES + byte] = vgetq_lane_u32(acc_hi, 0);
+
+        if (byte == 0)
+            bytelen = STARCH_SYMBOL(slice_bytelen)(out, valid_df_short, valid_df_long);
+    }
+}
+
+#endif /* STARCH_FEATURE_NEON */
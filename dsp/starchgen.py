@@ -19,10 +19,16 @@ gen.add_function(name = 'magnitude_uc8', argtypes = ['const uc8_t *', 'uint16_t
 gen.add_function(name = 'magnitude_power_uc8', argtypes = ['const uc8_t *', 'uint16_t *', 'unsigned', 'double *', 'double *'], aligned = True)
 gen.add_function(name = 'magnitude_sc16', argtypes = ['const sc16_t *', 'uint16_t *', 'unsigned'], aligned = True)
 gen.add_function(name = 'magnitude_sc16q11', argtypes = ['const sc16_t *', 'uint16_t *', 'unsigned'], aligned = True)
+gen.add_function(name = 'magnitude_dc_uc8', argtypes = ['const uc8_t *', 'uint16_t *', 'unsigned', 'const fc32_t *', 'fc32_t *', 'double *', 'double *'], aligned = True)
+gen.add_function(name = 'magnitude_dc_sc16', argtypes = ['const sc16_t *', 'uint16_t *', 'unsigned', 'const fc32_t *', 'fc32_t *', 'double *', 'double *'], aligned = True)
+gen.add_function(name = 'magnitude_dc_sc16q11', argtypes = ['const sc16_t *', 'uint16_t *', 'unsigned', 'const fc32_t *', 'fc32_t *', 'double *', 'double *'], aligned = True)
 gen.add_function(name = 'mean_power_u16', argtypes = ['const uint16_t *', 'unsigned', 'double *', 'double *'], aligned = True)
 gen.add_function(name = 'count_above_u16', argtypes = ['const uint16_t *', 'unsigned', 'uint16_t', 'unsigned *'], aligned = True)
+gen.add_function(name = 'preamble_scan_u16', argtypes = ['const uint16_t *', 'unsigned', 'uint64_t *'])
+gen.add_function(name = 'slice_phases_u16', argtypes = ['const uint16_t *', 'uint32_t', 'uint32_t', 'uint8_t *'])
 
 gen.add_feature(name='neon', description='ARM NEON')
+gen.add_feature(name='avx2', description='x86 AVX2')
 
 gen.add_flavor(name = 'generic',
                description = 'Generic build, default compiler options',
@@ -42,6 +48,7 @@ gen.add_flavor(name = 'armv8_neon_simd',
 gen.add_flavor(name = 'x86_avx2',
                description = 'x86 with AVX2',
                compile_flags = ['-mavx2', '-ffast-math'],
+               features = ['avx2'],
                test_function = 'cpu_supports_avx2',
                alignment = 32)
 
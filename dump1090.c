@@ -98,7 +98,7 @@ static void sigtermHandler(int dummy) {
 void receiverPositionChanged(float lat, float lon, float alt)
 {
     log_with_timestamp("Autodetected receiver location: %.5f, %.5f at %.0fm AMSL", lat, lon, alt);
-    writeJsonToFile("receiver.json", generateReceiverJson); // location changed
+    publishJson("receiver.json", generateReceiverJson); // location changed
 }
 
 
@@ -117,12 +117,14 @@ static void modesInitConfig(void) {
     Modes.json_interval           = 1000;
     Modes.json_stats_interval     = 60000;
     Modes.json_location_accuracy  = 1;
+    Modes.json_gzip_budget        = 5.0;
     Modes.maxRange                = 1852 * 300; // 300NM default max range
     Modes.mode_ac_auto            = 1;
 
     Modes.net_heartbeat_interval = MODES_NET_HEARTBEAT_INTERVAL;
-    Modes.net_output_flush_size = 1300;
+    Modes.net_output_flush_size = MODES_OUT_FLUSH_SIZE;
     Modes.net_output_flush_interval = 500;
+    Modes.net_queue_limit = MODES_NET_QUEUE_LIMIT;
 
     // adaptive
     Modes.adaptive_min_gain_db = 0;
@@ -164,7 +166,7 @@ static void modesInit(void) {
         exit(1);
     }
 
-    if (!fifo_create(MODES_MAG_BUFFERS, MODES_MAG_BUF_SAMPLES + Modes.trailing_samples, Modes.trailing_samples)) {
+    if (!fifo_create(MODES_MAG_BUFFERS, MODES_MAG_BUF_SAMPLES + Modes.trailing_samples, Modes.trailing_samples, Modes.mirrored_fifo, Modes.sample_rate)) {
         fprintf(stderr, "Out of memory allocating FIFO\n");
         exit(1);
     }
@@ -188,9 +190,11 @@ static void modesInit(void) {
         Modes.bUserFlags |= MODES_USER_LATLON_VALID;
     }
 
-    // Limit the maximum requested raw output size to less than one Ethernet Block
-    if (Modes.net_output_flush_size > (MODES_OUT_FLUSH_SIZE))
-      {Modes.net_output_flush_size = MODES_OUT_FLUSH_SIZE;}
+    // Limit the requested output flush size; output is gathered from
+    // several flushes into one writev() anyway, so this is about latency
+    // and memory rather than packet size
+    if (Modes.net_output_flush_size > (MODES_OUT_MAX_FLUSH_SIZE))
+      {Modes.net_output_flush_size = MODES_OUT_MAX_FLUSH_SIZE;}
     if (Modes.net_output_flush_interval > (MODES_OUT_FLUSH_INTERVAL))
       {Modes.net_output_flush_interval = MODES_OUT_FLUSH_INTERVAL;}
     if (Modes.net_sndbuf_size > (MODES_NET_SNDBUF_MAX))
@@ -203,10 +207,20 @@ static void modesInit(void) {
     }
 
     // Prepare error correction tables
+    struct timespec crc_start, crc_end;
+    clock_gettime(CLOCK_MONOTONIC, &crc_start);
     modesChecksumInit(Modes.nfix_crc);
+    clock_gettime(CLOCK_MONOTONIC, &crc_end);
+    log_with_timestamp("Error correction tables ready in %.2f ms (CRC engine: %s)",
+                       (crc_end.tv_sec - crc_start.tv_sec) * 1e3 + (crc_end.tv_nsec - crc_start.tv_nsec) / 1e6,
+                       modesChecksumEngine());
     icaoFilterInit();
     modeACInit();
 
+    if (!demodulate2400Init()) {
+        exit(1);
+    }
+
     if (Modes.show_only)
         icaoFilterAdd(Modes.show_only);
 }
@@ -304,15 +318,24 @@ static void showDSP()
         printf("    %-40s %s\n", #x , starch_ ## x ## _select()->name);  \
         printf("    %-40s %s\n", #x "_aligned", starch_ ## x ## _aligned_select()->name); \
     } while(0)
+#define SHOW_UNALIGNED(x) do {                                          \
+        printf("    %-40s %s\n", #x , starch_ ## x ## _select()->name);  \
+    } while(0)
 
     SHOW(magnitude_uc8);
     SHOW(magnitude_power_uc8);
     SHOW(magnitude_sc16);
     SHOW(magnitude_sc16q11);
+    SHOW(magnitude_dc_uc8);
+    SHOW(magnitude_dc_sc16);
+    SHOW(magnitude_dc_sc16q11);
     SHOW(mean_power_u16);
     SHOW(count_above_u16);
+    SHOW_UNALIGNED(preamble_scan_u16);
+    SHOW_UNALIGNED(slice_phases_u16);
 
 #undef SHOW
+#undef SHOW_UNALIGNED
 
     printf("\n");
 }
@@ -342,6 +365,7 @@ static void showHelp(void)
 // ------ 80 char limit ----------------------------------------------------------|
 "--gain <db>              Set gain in dB (default: varies by SDR type)\n"
 "--freq <hz>              Set frequency (default: 1090 Mhz)\n"
+"--dcfilter               Remove any DC offset from the input samples\n"
 "--fix                    Enable single-bit error correction using CRC\n"
 "--fix-2bit               Enable two-bit error correction using CRC\n"
 "                          (use with caution!)\n"
@@ -349,6 +373,10 @@ static void showHelp(void)
 "--no-fix-df              Disable error correction of the DF message field\n"
 "                          (reduces CPU requirements)\n"
 "--enable-df24            Enable decoding of DF24 Comm-D ELM messages\n"
+"--demod-threads <n>      Split Mode S demodulation across n threads\n"
+"                          (1-64, default: 1, demodulate on the main thread)\n"
+"--mirrored-fifo          Keep samples in one mirrored ring buffer to avoid\n"
+"                          copying buffer overlaps (Linux only)\n"
 "--lat <latitude>         Reference/receiver latitude for surface positions\n"
 "--lon <longitude>        Reference/receiver longitude for surface positions\n"
 "--max-range <distance>   Absolute maximum range for position decoding (in NM)\n"
@@ -394,11 +422,16 @@ static void showHelp(void)
 "--net-bi-port <ports>    TCP Beast input listen ports  (default: 30004,30104)\n"
 "--net-bo-port <ports>    TCP Beast output listen ports (default: 30005)\n"
 "--net-stratux-port <ports>  TCP Stratux output listen ports (default: disabled)\n"
-"--net-ro-size <size>     TCP output minimum size (default: 0)\n"
+"--net-http-port <ports>  HTTP server listen ports (default: disabled)\n"
+"--html-dir <dir>         Serve the web interface from <dir> over HTTP\n"
+"--net-ro-size <size>     TCP output flush size in bytes (default: 1300, max 262144)\n"
 "--net-ro-interval <rate> TCP output memory flush rate in seconds (default: 0)\n"
 "--net-heartbeat <rate>   TCP heartbeat rate in seconds\n"
 "                          (default: 60 sec; 0 to disable)\n"
 "--net-buffer <n>         TCP buffer size 64Kb * (2^n) (default: n=0, 64Kb)\n"
+"--net-queue-limit <bytes> Output queued for a slow client before disconnecting it\n"
+"                          (default: 1048576)\n"
+"--net-io-uring           Use io_uring for network I/O, if the kernel supports it\n"
 "--net-verbatim           Make output connections default to verbatim mode\n"
 "                           (forward all messages without correction)\n"
 "--forward-mlat           Allow forwarding of received mlat results\n"
@@ -415,6 +448,10 @@ static void showHelp(void)
 "--json-stats-every <t>   Write json stats output every t seconds (default 60)\n"
 "--json-location-accuracy <n>  Accuracy of receiver location in json metadata\n"
 "                          (0=no location, 1=approximate, 2=exact)\n"
+"--json-gzip-level <n>    Also produce gzip-compressed json at level n (1-9)\n"
+"                          (default 0, disabled)\n"
+"--json-gzip-budget <p>   Lower the compression level to keep its CPU use\n"
+"                          under p percent of one core (default 5)\n"
 "\n"
 "      Interactive mode\n"
 "\n"
@@ -443,6 +480,16 @@ void flush_stats(uint64_t now)
         Modes.stats_current.sdr_gain = sdrGetGain();
     }
 
+    trackPoolStats(&Modes.stats_current.aircraft_pool_used, &Modes.stats_current.aircraft_pool_slots);
+
+    // ICAO filter lookups made on the main thread (workers report theirs via demodulate2400)
+    struct icao_filter_counters icao_counters = { 0 };
+    icaoFilterCollectCounters(&icao_counters);
+    add_icao_filter_counters(&Modes.stats_current, &icao_counters);
+
+    // network backlog, and the network thread's CPU time
+    modesNetCollectStats(&Modes.stats_current);
+
     add_stats(&Modes.stats_current, &Modes.stats_periodic, &Modes.stats_periodic);
     add_stats(&Modes.stats_current, &Modes.stats_alltime, &Modes.stats_alltime);
     add_stats(&Modes.stats_current, &Modes.stats_latest, &Modes.stats_latest);
@@ -463,6 +510,7 @@ static void backgroundTasks(void) {
     static uint64_t next_stats_update;
     static uint64_t next_json_stats_update;
     static uint64_t next_json, next_history;
+    static int history_changed;
 
     uint64_t now = mstime();
 
@@ -484,6 +532,7 @@ static void backgroundTasks(void) {
 
     // copy out reader CPU time and reset it
     sdrUpdateCPUTime(&Modes.stats_current.reader_cpu);
+    sdrUpdateCallbackStats(&Modes.stats_current);
 
     // always update end time so it is current when requests arrive
     Modes.stats_current.end = mstime();
@@ -535,41 +584,44 @@ static void backgroundTasks(void) {
     }
 
     // json stats update
-    if (Modes.json_dir && now >= next_json_stats_update) {
+    if (now >= next_json_stats_update) {
         if (next_json_stats_update == 0) {
             next_json_stats_update = now + Modes.json_stats_interval;
         } else {
-            flush_stats(now); // Ensure everything we'll write is up to date
-            writeJsonToFile("stats.json", generateStatsJson);
+            if (modesJsonWanted("stats.json")) {
+                flush_stats(now); // Ensure everything we'll write is up to date
+                publishJson("stats.json", generateStatsJson);
+            }
             next_json_stats_update += Modes.json_stats_interval;
         }
     }
 
-    if (Modes.json_dir && now >= next_json) {
-        writeJsonToFile("aircraft.json", generateAircraftJson);
+    // aircraft.json is only regenerated while something will use it;
+    // the delta goes first so that aircraft.json carries its sequence number
+    if (now >= next_json && (modesJsonWanted("aircraft.json") || modesJsonWanted("aircraft_delta.json"))) {
+        publishJson("aircraft_delta.json", generateAircraftDeltaJson);
+        publishJson("aircraft.json", generateAircraftJson);
         next_json = now + Modes.json_interval;
     }
 
     if (now >= next_history) {
-        int rewrite_receiver_json = (Modes.json_dir && Modes.json_aircraft_history[HISTORY_SIZE-1].content == NULL);
+        int rewrite_receiver_json = (trackHistoryCount() < HISTORY_SIZE);
 
-        free(Modes.json_aircraft_history[Modes.json_aircraft_history_next].content); // might be NULL, that's OK.
-        Modes.json_aircraft_history[Modes.json_aircraft_history_next].content =
-            generateAircraftJson("/data/aircraft.json", &Modes.json_aircraft_history[Modes.json_aircraft_history_next].clen);
-
-        if (Modes.json_dir) {
-            char filebuf[PATH_MAX];
-            snprintf(filebuf, PATH_MAX, "history_%d.json", Modes.json_aircraft_history_next);
-            writeJsonToFile(filebuf, generateHistoryJson);
-        }
-
-        Modes.json_aircraft_history_next = (Modes.json_aircraft_history_next+1) % HISTORY_SIZE;
+        trackCaptureHistory(now);
+        modesJsonInvalidate("history.json");
+        history_changed = 1;
 
         if (rewrite_receiver_json)
-            writeJsonToFile("receiver.json", generateReceiverJson); // number of history entries changed
+            publishJson("receiver.json", generateReceiverJson); // number of history entries changed
 
         next_history = now + HISTORY_INTERVAL;
     }
+
+    // history.json is large, so it is only rendered when something asks for it
+    if (history_changed && modesJsonRequested("history.json")) {
+        publishJson("history.json", generateHistoryJson);
+        history_changed = 0;
+    }
 }
 
 //
@@ -614,11 +666,7 @@ int main(int argc, char **argv) {
         } else if (!strcmp(argv[j],"--gain") && more) {
             Modes.gain = atof(argv[++j]);
         } else if (!strcmp(argv[j],"--dcfilter")) {
-#if 0
             Modes.dc_filter = 1;
-#else
-            fprintf(stderr, "--dcfilter option ignored (please raise an issue on github if you have a usecase that needs this)\n");
-#endif
         } else if (!strcmp(argv[j],"--measure-noise")) {
             // Ignored
         } else if (!strcmp(argv[j],"--fix")) {
@@ -628,6 +676,16 @@ int main(int argc, char **argv) {
             Modes.nfix_crc = 2;
         } else if (!strcmp(argv[j],"--enable-df24")) {
             Modes.enable_df24 = 1;
+        } else if (!strcmp(argv[j],"--demod-threads") && more) {
+            char *end;
+            long threads = strtol(argv[++j], &end, 10);
+            if (end == argv[j] || *end || threads < 1 || threads > MODES_MAX_DEMOD_THREADS) {
+                fprintf(stderr, "--demod-threads must be a number between 1 and %d\n", MODES_MAX_DEMOD_THREADS);
+                exit(1);
+            }
+            Modes.demod_threads = (int) threads;
+        } else if (!strcmp(argv[j],"--mirrored-fifo")) {
+            Modes.mirrored_fifo = 1;
         } else if (!strcmp(argv[j],"--no-fix")) {
             Modes.nfix_crc = 0;
         } else if (!strcmp(argv[j],"--no-fix-df")) {
@@ -680,9 +738,12 @@ int main(int argc, char **argv) {
             free(Modes.net_bind_address);
             Modes.net_bind_address = strdup(argv[++j]);
         } else if (!strcmp(argv[j],"--net-http-port") && more) {
-            if (strcmp(argv[++j], "0")) {
-                fprintf(stderr, "warning: --net-http-port not supported in this build, option ignored.\n");
-            }
+            Modes.net = 1;
+            free(Modes.net_http_ports);
+            Modes.net_http_ports = strdup(argv[++j]);
+        } else if (!strcmp(argv[j],"--html-dir") && more) {
+            free(Modes.html_dir);
+            Modes.html_dir = strdup(argv[++j]);
         } else if (!strcmp(argv[j],"--net-sbs-port") && more) {
             Modes.net = 1;
             free(Modes.net_output_sbs_ports);
@@ -693,6 +754,10 @@ int main(int argc, char **argv) {
             Modes.net_output_stratux_ports = strdup(argv[++j]);
         } else if (!strcmp(argv[j],"--net-buffer") && more) {
             Modes.net_sndbuf_size = atoi(argv[++j]);
+        } else if (!strcmp(argv[j],"--net-queue-limit") && more) {
+            Modes.net_queue_limit = atoi(argv[++j]);
+        } else if (!strcmp(argv[j],"--net-io-uring")) {
+            Modes.net_io_uring = 1;
         } else if (!strcmp(argv[j],"--net-verbatim")) {
             Modes.net_verbatim = 1;
         } else if (!strcmp(argv[j],"--forward-mlat")) {
@@ -766,6 +831,20 @@ int main(int argc, char **argv) {
                 Modes.json_interval = 100;
         } else if (!strcmp(argv[j], "--json-location-accuracy") && more) {
             Modes.json_location_accuracy = atoi(argv[++j]);
+        } else if (!strcmp(argv[j], "--json-gzip-level") && more) {
+#ifdef ENABLE_ZLIB
+            Modes.json_gzip_level = atoi(argv[++j]);
+            if (Modes.json_gzip_level < 0)
+                Modes.json_gzip_level = 0;
+            if (Modes.json_gzip_level > 9)
+                Modes.json_gzip_level = 9;
+#else
+            if (strcmp(argv[++j], "0")) {
+                fprintf(stderr, "warning: --json-gzip-level not supported in this build, option ignored.\n");
+            }
+#endif
+        } else if (!strcmp(argv[j], "--json-gzip-budget") && more) {
+            Modes.json_gzip_budget = atof(argv[++j]);
         } else if (!strcmp(argv[j], "--wisdom") && more) {
             if (starch_read_wisdom (argv[++j]) < 0) {
                 fprintf(stderr,
@@ -831,6 +910,8 @@ int main(int argc, char **argv) {
 
     // Initialization
     log_with_timestamp("%s %s starting up.", MODES_DUMP1090_VARIANT, MODES_DUMP1090_VERSION);
+    struct timespec startup_start;
+    clock_gettime(CLOCK_MONOTONIC, &startup_start);
     modesInit();
 
     if (!sdrOpen()) {
@@ -864,24 +945,37 @@ int main(int argc, char **argv) {
     adaptive_init();
 
     // write initial json files so they're not missing
-    writeJsonToFile("receiver.json", generateReceiverJson);
-    writeJsonToFile("stats.json", generateStatsJson);
-    writeJsonToFile("aircraft.json", generateAircraftJson);
+    publishJson("receiver.json", generateReceiverJson);
+    publishJson("stats.json", generateStatsJson);
+    publishJson("aircraft.json", generateAircraftJson);
 
     interactiveInit();
 
+    {
+        struct timespec startup_end;
+        clock_gettime(CLOCK_MONOTONIC, &startup_end);
+        log_with_timestamp("Startup complete in %.1f ms",
+                           (startup_end.tv_sec - startup_start.tv_sec) * 1e3 + (startup_end.tv_nsec - startup_start.tv_nsec) / 1e6);
+    }
+
+    // Socket work runs on its own thread from here on
+    if (Modes.net && !modesNetStartThread()) {
+        log_with_timestamp("Network I/O will run on the main thread");
+    }
+
     // If the user specifies --net-only, just run in order to serve network
     // clients without reading data from the RTL device
     if (Modes.sdr_type == SDR_NONE) {
         while (!Modes.exit) {
             struct timespec start_time;
-            struct timespec slp = { 0, 100 * 1000 * 1000};
 
             start_cpu_timing(&start_time);
             backgroundTasks();
             end_cpu_timing(&start_time, &Modes.stats_current.background_cpu);
 
-            nanosleep(&slp, NULL);
+            // wake early if network input arrives, so a busy network
+            // thread isn't held up waiting for us to drain its queue
+            modesNetWaitForInput(100);
         }
     } else {
         int watchdogCounter = 300; // about 30 seconds
@@ -891,7 +985,8 @@ int main(int argc, char **argv) {
 
         while (!Modes.exit) {
             // get the next sample buffer off the FIFO; wait only up to 100ms
-            // this is fairly aggressive as all our network I/O runs out of the background work!
+            // this is fairly aggressive as network input is processed, and
+            // network output flushed, from the background work
             struct mag_buf *buf = fifo_dequeue(100 /* milliseconds */);
             struct timespec start_time;
 
@@ -939,14 +1034,19 @@ int main(int argc, char **argv) {
 
     interactiveCleanup();
 
+    if (Modes.net) {
+        modesNetStopThread();
+    }
+
     // Write final stats
     flush_stats(0);
-    writeJsonToFile("stats.json", generateStatsJson);
+    publishJson("stats.json", generateStatsJson);
     if (Modes.stats) {
         display_stats(&Modes.stats_alltime);
     }
 
     sdrClose();
+    demodulate2400Cleanup();
     fifo_destroy();
 
     if (Modes.exit == 1) {
@@ -93,6 +93,7 @@
 #define MODES_RTL_BUF_SIZE         (16*16384)                 // 256k
 #define MODES_MAG_BUF_SAMPLES      (MODES_RTL_BUF_SIZE / 2)   // Each sample is 2 bytes
 #define MODES_MAG_BUFFERS          12                         // Number of magnitude buffers (should be smaller than RTL_BUFFERS for flowcontrol to work)
+#define MODES_MAX_DEMOD_THREADS    64                         // Upper limit for --demod-threads
 #define MODES_LEGACY_AUTO_GAIN     -10                        // old gain value for "use automatic gain"
 #define MODES_DEFAULT_GAIN         999999                     // Use default SDR gain
 #define MODES_MSG_SQUELCH_DB       4.0                        // Minimum SNR, in dB
@@ -105,8 +106,7 @@
 #define MODES_PREAMBLE_US        8              // microseconds = bits
 #define MODES_PREAMBLE_SAMPLES  (MODES_PREAMBLE_US       * 2)
 #define MODES_PREAMBLE_SIZE     (MODES_PREAMBLE_SAMPLES  * sizeof(uint16_t))
-#define MODES_LONG_MSG_BYTES     14
-#define MODES_SHORT_MSG_BYTES    7
+// MODES_LONG_MSG_BYTES / MODES_SHORT_MSG_BYTES are in dsp-types.h
 #define MODES_LONG_MSG_BITS     (MODES_LONG_MSG_BYTES    * 8)
 #define MODES_SHORT_MSG_BITS    (MODES_SHORT_MSG_BYTES   * 8)
 #define MODES_LONG_MSG_SAMPLES  (MODES_LONG_MSG_BITS     * 2)
@@ -121,8 +121,9 @@
 #define MODES_OS_LONG_MSG_SIZE     (MODES_LONG_MSG_SAMPLES  * sizeof(uint16_t))
 #define MODES_OS_SHORT_MSG_SIZE    (MODES_SHORT_MSG_SAMPLES * sizeof(uint16_t))
 
-#define MODES_OUT_BUF_SIZE         (1500)
-#define MODES_OUT_FLUSH_SIZE       (MODES_OUT_BUF_SIZE - 256)
+#define MODES_OUT_MAX_MESSAGE      (1024)              // largest single message any output format writes
+#define MODES_OUT_FLUSH_SIZE       (1300)              // default output flush size
+#define MODES_OUT_MAX_FLUSH_SIZE   (256*1024)          // largest output flush size
 #define MODES_OUT_FLUSH_INTERVAL   (60000)
 
 #define MODES_USER_LATLON_VALID (1<<0)
@@ -266,9 +267,10 @@ typedef enum {
 
 #define MODES_NET_HEARTBEAT_INTERVAL 60000      // milliseconds
 
-#define MODES_CLIENT_BUF_SIZE  1024
+#define MODES_CLIENT_BUF_SIZE  4096 // room for a typical HTTP request header
 #define MODES_NET_SNDBUF_SIZE (1024*64)
 #define MODES_NET_SNDBUF_MAX  (7)
+#define MODES_NET_QUEUE_LIMIT (1024*1024)       // default per-client output backlog before disconnecting
 
 #define HISTORY_SIZE 120
 #define HISTORY_INTERVAL 30000
@@ -286,6 +288,7 @@ typedef enum {
 #include "util.h"
 #include "anet.h"
 #include "net_io.h"
+#include "json_writer.h"
 #include "crc.h"
 #include "demod_2400.h"
 #include "stats.h"
@@ -309,6 +312,9 @@ struct _Modes {                             // Internal state
     pthread_mutex_t reader_cpu_mutex;                     // mutex protecting reader_cpu_accumulator
     struct timespec reader_cpu_accumulator;               // accumulated CPU time used by the reader thread
     struct timespec reader_cpu_start;                     // start time for the last reader thread CPU measurement
+    uint32_t        reader_callback_count;                // SDR sample callbacks since the last stats update (protected by reader_cpu_mutex)
+    uint64_t        reader_callback_us;                   // total time spent in those callbacks, microseconds
+    uint32_t        reader_callback_max_us;               // longest of those callbacks, microseconds
 
     unsigned        trailing_samples;                     // extra trailing samples in magnitude buffers
     double          sample_rate;                          // actual sample rate in use (in hz)
@@ -351,6 +357,8 @@ struct _Modes {                             // Internal state
     int   check_crc;                 // Only display messages with good CRC
     int   fix_df;                    // Try to correct damage to the DF field, as well as the main message body
     int   enable_df24;               // Enable decoding of DF24..DF31 (Comm-D ELM)
+    int   demod_threads;             // Number of threads to split Mode S demodulation across (<= 1 = demodulate on the main thread)
+    int   mirrored_fifo;             // Keep sample data in a mirrored ring buffer rather than copying the overlap
     int   raw;                       // Raw output format
     int   mode_ac;                   // Enable decoding of SSR Modes A & C
     int   mode_ac_auto;              // allow toggling of A/C by Beast commands
@@ -367,6 +375,10 @@ struct _Modes {                             // Internal state
     char *net_output_beast_ports;    // List of Beast output TCP ports
     char *net_bind_address;          // Bind address
     int   net_sndbuf_size;           // TCP output buffer size (64Kb * 2^n)
+    int   net_queue_limit;           // Max output bytes queued for a slow client before disconnecting it (0 = default)
+    int   net_io_uring;              // Use io_uring for network I/O where available
+    char *net_http_ports;            // List of HTTP server TCP ports
+    char *html_dir;                  // Static files served by the HTTP server, or NULL for JSON only
     int   net_verbatim;              // if true, Beast output connections default to verbatim mode
     int   forward_mlat;              // allow forwarding of mlat messages to output ports
     int   quiet;                     // Suppress stdout
@@ -387,14 +399,19 @@ struct _Modes {                             // Internal state
     uint64_t json_interval;          // Interval between rewriting the json aircraft file, in milliseconds; also the advertised map refresh interval
     uint64_t json_stats_interval;    // Interval between rewriting the json stats file, in milliseconds
     int   json_location_accuracy;    // Accuracy of location metadata: 0=none, 1=approx, 2=exact
+    int   json_gzip_level;           // zlib level for gzip copies of json output, or 0 for none
+    double json_gzip_budget;         // Maximum CPU time to spend compressing json, in percent of one core
     double faup_rate_multiplier;     // Multiplier to adjust rate of faup1090 messages emitted
     bool faup_upload_unknown_commb;  // faup1090: should we upload Comm-B messages that weren't in a recognized format?
 
-    int   json_aircraft_history_next;
+    uint64_t json_aircraft_seq;      // Sequence number of the last aircraft delta generated (see generateAircraftDeltaJson)
+
+    // Aircraft history captures (see trackCaptureHistory); capture N is in slot N % HISTORY_SIZE
+    uint32_t history_captures;       // Number of captures taken so far
     struct {
-        char *content;
-        int clen;
-    } json_aircraft_history[HISTORY_SIZE];
+        uint64_t time;               // When the capture was taken
+        uint32_t messages;           // Total messages received at that time
+    } history[HISTORY_SIZE];
 
     // User details
     double fUserLat;                // Users receiver/antenna lat/lon needed for initial surface location
@@ -24,28 +24,285 @@
 #include <stdio.h>
 #include <errno.h>
 #include <string.h>
+#include <limits.h>
 #include <pthread.h>
 #include <assert.h>
+#include <stdatomic.h>
 
-static pthread_mutex_t fifo_mutex = PTHREAD_MUTEX_INITIALIZER;        // mutex protecting the queues
-static pthread_cond_t fifo_notempty_cond = PTHREAD_COND_INITIALIZER;  // condition used to signal FIFO-not-empty
-static pthread_cond_t fifo_empty_cond = PTHREAD_COND_INITIALIZER;     // condition used to signal FIFO-empty
-static pthread_cond_t fifo_free_cond = PTHREAD_COND_INITIALIZER;      // condition used to signal freelist-not-empty
-static struct mag_buf *fifo_head;          // head of queued buffers awaiting demodulation
-static struct mag_buf *fifo_tail;          // tail of queued buffers awaiting demodulation
-static struct mag_buf *fifo_freelist;      // freelist of preallocated buffers
-static bool fifo_halted;                   // true if queue has been halted
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#endif
+
+// The FIFO is a pair of lock-free single-producer / single-consumer rings:
+//
+//   fifo_queue:    SDR thread (fifo_enqueue) -> demodulator (fifo_dequeue)
+//   fifo_freelist: demodulator (fifo_release) -> SDR thread (fifo_acquire)
+//
+// Every buffer is always in exactly one ring or owned by exactly one thread,
+// so a ring can never overflow if it has room for all buffers.
+//
+// Threads only sleep when the ring they want to read from is empty; they wait
+// on a fifo_event (a futex on Linux, a mutex/condvar elsewhere) that the other
+// side only touches if it sees a sleeping waiter.
+//
+// In mirrored mode, buffer data is not separately allocated. All samples live
+// in one ring of mirror_length samples that is mapped twice, back to back, so
+// that any window of up to mirror_length samples is contiguous in memory.
+// Each acquired buffer's data starts "overlap" samples before the next free
+// sample, so the leading overlap is already in place and nothing is copied.
+// Buffers cycle through both rings in order, so the span of the ring that is in
+// use by queued buffers is always contiguous; sizing the ring for every buffer
+// plus one overlap means that a free buffer always has free ring space behind it.
+
+struct fifo_ring {
+    _Alignas(64) atomic_uint head;     // next slot to write; written only by the producer
+    _Alignas(64) atomic_uint tail;     // next slot to read; written only by the consumer
+    _Alignas(64) struct mag_buf **slots;
+    unsigned mask;                     // number of slots - 1 (number of slots is a power of two)
+};
+
+struct fifo_event {
+    atomic_uint seq;                   // bumped on every signal
+    atomic_uint waiters;               // number of threads sleeping (or about to sleep) on seq
+#ifndef __linux__
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+#endif
+};
+
+#ifdef __linux__
+#define FIFO_EVENT_INIT { 0, 0 }
+#else
+#define FIFO_EVENT_INIT { 0, 0, PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER }
+#endif
+
+static struct fifo_ring fifo_queue;       // buffers awaiting demodulation
+static struct fifo_ring fifo_freelist;    // preallocated buffers available to the SDR thread
+static struct fifo_event fifo_notempty_event = FIFO_EVENT_INIT;   // signalled when a buffer is enqueued
+static struct fifo_event fifo_empty_event = FIFO_EVENT_INIT;      // signalled when the queue becomes empty
+static struct fifo_event fifo_free_event = FIFO_EVENT_INIT;       // signalled when a buffer is released
+static atomic_bool fifo_halted;           // true if queue has been halted
+
+static struct mag_buf **fifo_buffers;     // every allocated buffer, for fifo_destroy
+static unsigned fifo_buffer_count;
 
 static unsigned overlap_length;     // desired overlap size in samples (size of overlap_buffer)
 static uint16_t *overlap_buffer;    // buffer used to save overlapping data
 
+static unsigned buffer_length;      // size of each buffer's data in samples, including overlap
+static uint16_t *mirror_base;       // mirrored mode: start of the doubly-mapped ring; NULL if not mirrored
+static size_t mirror_length;        // mirrored mode: size of the ring in samples
+static size_t mirror_cursor;        // mirrored mode: ring offset of the next new sample (producer only)
+static double fifo_sample_rate;     // magnitude sample rate in Hz
+
+//
+// Ring operations
+//
+
+static bool ring_init(struct fifo_ring *ring, unsigned capacity)
+{
+    unsigned size = 1;
+    while (size < capacity)
+        size <<= 1;
+
+    if (!(ring->slots = calloc(size, sizeof(ring->slots[0]))))
+        return false;
+
+    ring->mask = size - 1;
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    return true;
+}
+
+static void ring_free(struct fifo_ring *ring)
+{
+    free(ring->slots);
+    ring->slots = NULL;
+}
+
+// Producer side only
+static void ring_push(struct fifo_ring *ring, struct mag_buf *buf)
+{
+    unsigned head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    assert(head - atomic_load_explicit(&ring->tail, memory_order_acquire) <= ring->mask);
+    ring->slots[head & ring->mask] = buf;
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+}
+
+// Consumer side only; returns NULL if the ring is empty
+static struct mag_buf *ring_pop(struct fifo_ring *ring)
+{
+    unsigned tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    if (tail == atomic_load_explicit(&ring->head, memory_order_acquire))
+        return NULL;
+
+    struct mag_buf *buf = ring->slots[tail & ring->mask];
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+    return buf;
+}
+
+// Either side
+static bool ring_empty(struct fifo_ring *ring)
+{
+    return atomic_load_explicit(&ring->tail, memory_order_acquire) == atomic_load_explicit(&ring->head, memory_order_acquire);
+}
+
+//
+// Wait/wake support. A waiter calls event_prepare() before checking its
+// condition, then event_wait() with the returned value if the condition
+// was not satisfied; a signaller changes the condition, then calls event_signal().
+//
+
+static unsigned event_prepare(struct fifo_event *ev)
+{
+    return atomic_load(&ev->seq);
+}
+
+#ifdef __linux__
+
+static void event_signal(struct fifo_event *ev)
+{
+    atomic_fetch_add(&ev->seq, 1);
+    if (atomic_load(&ev->waiters))
+        syscall(SYS_futex, &ev->seq, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+}
+
+// Wait for a signal after 'seen', or until the (CLOCK_REALTIME) deadline passes.
+// Returns false on timeout; returns true if the caller should recheck its condition.
+static bool event_wait(struct fifo_event *ev, unsigned seen, const struct timespec *deadline)
+{
+    atomic_fetch_add(&ev->waiters, 1);
+    long rc = syscall(SYS_futex, &ev->seq, FUTEX_WAIT_BITSET_PRIVATE | FUTEX_CLOCK_REALTIME, seen, deadline, NULL, FUTEX_BITSET_MATCH_ANY);
+    int err = errno;
+    atomic_fetch_sub(&ev->waiters, 1);
+
+    if (rc < 0 && err != EAGAIN && err != EINTR) {
+        if (err != ETIMEDOUT) {
+            fprintf(stderr, "fifo: futex wait unexpectedly returned %s\n", strerror(err));
+        }
+        return false;
+    }
+
+    return true;
+}
+
+#else
+
+static void event_signal(struct fifo_event *ev)
+{
+    atomic_fetch_add(&ev->seq, 1);
+    if (atomic_load(&ev->waiters)) {
+        pthread_mutex_lock(&ev->mutex);
+        pthread_cond_broadcast(&ev->cond);
+        pthread_mutex_unlock(&ev->mutex);
+    }
+}
+
+static bool event_wait(struct fifo_event *ev, unsigned seen, const struct timespec *deadline)
+{
+    bool result = true;
+
+    pthread_mutex_lock(&ev->mutex);
+    atomic_fetch_add(&ev->waiters, 1);
+    if (atomic_load(&ev->seq) == seen) {
+        int err = pthread_cond_timedwait(&ev->cond, &ev->mutex, deadline);
+        if (err) {
+            if (err != ETIMEDOUT) {
+                fprintf(stderr, "fifo: pthread_cond_timedwait unexpectedly returned %s\n", strerror(err));
+            }
+            result = false;
+        }
+    }
+    atomic_fetch_sub(&ev->waiters, 1);
+    pthread_mutex_unlock(&ev->mutex);
+
+    return result;
+}
+
+#endif
+
+// Map a ring of at least 'samples' samples twice, back to back. Returns false
+// (leaving mirror_base as NULL) if this is not possible.
+static bool mirror_create(size_t samples)
+{
+#if defined(__linux__) && defined(SYS_memfd_create)
+    long pagesize = sysconf(_SC_PAGESIZE);
+    size_t bytes = samples * sizeof(uint16_t);
+    bytes = (bytes + pagesize - 1) / pagesize * pagesize;
+
+    int fd = syscall(SYS_memfd_create, "dump1090-fifo", 0);
+    if (fd < 0) {
+        fprintf(stderr, "fifo: memfd_create failed: %s\n", strerror(errno));
+        return false;
+    }
+
+    if (ftruncate(fd, bytes) < 0) {
+        fprintf(stderr, "fifo: ftruncate failed: %s\n", strerror(errno));
+        close(fd);
+        return false;
+    }
+
+    // reserve address space for both copies, then map the ring over each half
+    uint8_t *base = mmap(NULL, 2 * bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) {
+        fprintf(stderr, "fifo: mmap failed: %s\n", strerror(errno));
+        close(fd);
+        return false;
+    }
+
+    if (mmap(base, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED ||
+        mmap(base + bytes, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED) {
+        fprintf(stderr, "fifo: mmap failed: %s\n", strerror(errno));
+        munmap(base, 2 * bytes);
+        close(fd);
+        return false;
+    }
+
+    close(fd); // the mappings keep the memory alive
+
+    mirror_base = (uint16_t *) base;
+    mirror_length = bytes / sizeof(uint16_t);
+    mirror_cursor = 0;
+    return true;
+#else
+    (void) samples;
+    fprintf(stderr, "fifo: mirrored buffers are not supported on this platform\n");
+    return false;
+#endif
+}
+
+static void mirror_destroy()
+{
+#ifdef __linux__
+    if (mirror_base)
+        munmap(mirror_base, 2 * mirror_length * sizeof(uint16_t));
+#endif
+    mirror_base = NULL;
+    mirror_length = 0;
+}
+
 // Create the queue structures. Not threadsafe.
-bool fifo_create(unsigned buffer_count, unsigned buffer_size, unsigned overlap)
+bool fifo_create(unsigned buffer_count, unsigned buffer_size, unsigned overlap, bool mirrored, double sample_rate)
 {
     if (!(overlap_buffer = calloc(overlap, sizeof(overlap_buffer[0]))))
         goto nomem;
 
     overlap_length = overlap;
+    buffer_length = buffer_size;
+    fifo_sample_rate = sample_rate;
+
+    if (mirrored && !mirror_create((size_t) buffer_count * (buffer_size - overlap) + overlap)) {
+        fprintf(stderr, "fifo: falling back to separate buffers\n");
+    }
+
+    if (!(fifo_buffers = calloc(buffer_count, sizeof(fifo_buffers[0]))))
+        goto nomem;
+
+    if (!ring_init(&fifo_queue, buffer_count) || !ring_init(&fifo_freelist, buffer_count))
+        goto nomem;
 
     for (unsigned i = 0; i < buffer_count; ++i) {
         struct mag_buf *newbuf;
@@ -53,16 +310,17 @@ bool fifo_create(unsigned buffer_count, unsigned buffer_size, unsigned overlap)
             goto nomem;
         }
 
-        if (!(newbuf->data = calloc(buffer_size, sizeof(newbuf->data[0])))) {
+        if (!mirror_base && !(newbuf->data = calloc(buffer_size, sizeof(newbuf->data[0])))) {
             free(newbuf);
             goto nomem;
         }
 
         newbuf->totalLength = buffer_size;
-        newbuf->next = fifo_freelist;
-        fifo_freelist = newbuf;
+        fifo_buffers[fifo_buffer_count++] = newbuf;
+        ring_push(&fifo_freelist, newbuf);
     }
 
+    atomic_store(&fifo_halted, false);
     return true;
 
  nomem:
@@ -70,23 +328,22 @@ bool fifo_create(unsigned buffer_count, unsigned buffer_size, unsigned overlap)
     return false;
 }
 
-static void free_buffer_list(struct mag_buf *head)
-{
-    while (head) {
-        struct mag_buf *next = head->next;
-        free(head->data);
-        free(head);
-        head = next;
-    }
-}
-
 void fifo_destroy()
 {
-    free_buffer_list(fifo_head);
-    fifo_head = fifo_tail = NULL;
+    if (fifo_buffers) {
+        for (unsigned i = 0; i < fifo_buffer_count; ++i) {
+            if (!mirror_base)
+                free(fifo_buffers[i]->data);
+            free(fifo_buffers[i]);
+        }
+        free(fifo_buffers);
+        fifo_buffers = NULL;
+    }
+    fifo_buffer_count = 0;
 
-    free_buffer_list(fifo_freelist);
-    fifo_freelist = NULL;
+    ring_free(&fifo_queue);
+    ring_free(&fifo_freelist);
+    mirror_destroy();
 
     free(overlap_buffer);
     overlap_buffer = NULL;
@@ -94,34 +351,27 @@ void fifo_destroy()
 
 void fifo_drain()
 {
-    pthread_mutex_lock(&fifo_mutex);
-    while (fifo_head && !fifo_halted) {
-        pthread_cond_wait(&fifo_empty_cond, &fifo_mutex);
+    struct timespec deadline;
+
+    while (true) {
+        unsigned seen = event_prepare(&fifo_empty_event);
+        if (atomic_load(&fifo_halted) || ring_empty(&fifo_queue))
+            return;
+
+        // no deadline here; just wake up now and then to recheck
+        get_deadline(1000, &deadline);
+        event_wait(&fifo_empty_event, seen, &deadline);
     }
-    pthread_mutex_unlock(&fifo_mutex);
 }
 
 void fifo_halt()
 {
-    pthread_mutex_lock(&fifo_mutex);
-
-    // Drain all enqueued buffers to the freelist
-    while (fifo_head) {
-        struct mag_buf *freebuf = fifo_head;
-        fifo_head = freebuf->next;
-
-        freebuf->next = fifo_freelist;
-        fifo_freelist = freebuf;
-    }
-
-    fifo_tail = NULL;
-    fifo_halted = true;
+    atomic_store(&fifo_halted, true);
 
     // wake all waiters
-    pthread_cond_broadcast(&fifo_notempty_cond);
-    pthread_cond_broadcast(&fifo_empty_cond);
-    pthread_cond_broadcast(&fifo_free_cond);
-    pthread_mutex_unlock(&fifo_mutex);
+    event_signal(&fifo_notempty_event);
+    event_signal(&fifo_empty_event);
+    event_signal(&fifo_free_event);
 }
 
 struct mag_buf *fifo_acquire(uint32_t timeout_ms)
@@ -130,43 +380,39 @@ struct mag_buf *fifo_acquire(uint32_t timeout_ms)
     if (timeout_ms)
         get_deadline(timeout_ms, &deadline);
 
-    pthread_mutex_lock(&fifo_mutex);
+    struct mag_buf *result;
+    while (true) {
+        unsigned seen = event_prepare(&fifo_free_event);
+        if (atomic_load(&fifo_halted))
+            return NULL;
+
+        if ((result = ring_pop(&fifo_freelist)))
+            break;
 
-    struct mag_buf *result = NULL;
-    while (!fifo_halted && !fifo_freelist) {
         if (!timeout_ms) {
             // Non-blocking
-            goto done;
+            return NULL;
         }
 
         // No free buffers, wait for one
-        int err = pthread_cond_timedwait(&fifo_free_cond, &fifo_mutex, &deadline);
-        if (err) {
-            if (err != ETIMEDOUT) {
-                fprintf(stderr, "fifo_acquire: pthread_cond_timedwait unexpectedly returned %s\n", strerror(err));
-            }
-
-            goto done; // done waiting
-        }
+        if (!event_wait(&fifo_free_event, seen, &deadline))
+            return NULL; // done waiting
     }
 
-    if (!fifo_halted) {
-        result = fifo_freelist;
-        fifo_freelist = result->next;
-
-        result->overlap = overlap_length;
-        result->validLength = result->overlap;
-        result->sampleTimestamp = 0;
-        result->sysTimestamp = 0;
-        result->flags = 0;
-        result->mean_level = 0;
-        result->mean_power = 0;
-        result->dropped = 0;
-        result->next = NULL;
+    if (mirror_base) {
+        // start at the previous buffer's trailing overlap
+        result->data = mirror_base + (mirror_cursor + mirror_length - overlap_length) % mirror_length;
+        result->totalLength = buffer_length;
     }
 
- done:
-    pthread_mutex_unlock(&fifo_mutex);
+    result->overlap = overlap_length;
+    result->validLength = result->overlap;
+    result->sampleTimestamp = 0;
+    result->sysTimestamp = 0;
+    result->flags = 0;
+    result->mean_level = 0;
+    result->mean_power = 0;
+    result->dropped = 0;
     return result;
 }
 
@@ -175,13 +421,30 @@ void fifo_enqueue(struct mag_buf *buf)
     assert(buf->validLength <= buf->totalLength);
     assert(buf->validLength >= overlap_length);
 
-    pthread_mutex_lock(&fifo_mutex);
+    if (atomic_load(&fifo_halted)) {
+        // Shutting down, just drop the buffer (fifo_destroy will free it)
+        return;
+    }
+
+    if (mirror_base) {
+        // The overlap region is already in place, as the samples just before this buffer's new data
+        mirror_cursor = (mirror_cursor + buf->validLength - overlap_length) % mirror_length;
+
+        if (buf->flags & MAGBUF_DISCONTINUOUS) {
+            // The overlap region is not valid, but the previous buffer may still be
+            // using it, so it can't be zeroed; skip over it instead.
+            unsigned skip = buf->validLength - overlap_length;
+            if (skip > overlap_length)
+                skip = overlap_length;
+            buf->data += skip;
+            buf->validLength -= skip;
+
+            // ... and move the timestamps along to match, as they refer to buf->data[0]
+            buf->sampleTimestamp += skip * 12e6 / fifo_sample_rate;
+            buf->sysTimestamp += skip * 1000 / fifo_sample_rate;
+        }
 
-    if (fifo_halted) {
-        // Shutting down, just return the buffer to the freelist.
-        buf->next = fifo_freelist;
-        fifo_freelist = buf;
-        goto done;
+        goto enqueue;
     }
 
     // Populate the overlap region
@@ -196,17 +459,9 @@ void fifo_enqueue(struct mag_buf *buf)
     memcpy(overlap_buffer, &buf->data[buf->validLength - overlap_length], overlap_length * sizeof(overlap_buffer[0]));
 
     // enqueue and tell the main thread
-    buf->next = NULL;
-    if (!fifo_head) {
-        fifo_head = fifo_tail = buf;
-        pthread_cond_signal(&fifo_notempty_cond);
-    } else {
-        fifo_tail->next = buf;
-        fifo_tail = buf;
-    }
-
- done:
-    pthread_mutex_unlock(&fifo_mutex);
+ enqueue:
+    ring_push(&fifo_queue, buf);
+    event_signal(&fifo_notempty_event);
 }
 
 struct mag_buf *fifo_dequeue(uint32_t timeout_ms)
@@ -215,47 +470,33 @@ struct mag_buf *fifo_dequeue(uint32_t timeout_ms)
     if (timeout_ms)
         get_deadline(timeout_ms, &deadline);
 
-    pthread_mutex_lock(&fifo_mutex);
+    struct mag_buf *result;
+    while (true) {
+        unsigned seen = event_prepare(&fifo_notempty_event);
+        if (atomic_load(&fifo_halted))
+            return NULL;
+
+        if ((result = ring_pop(&fifo_queue)))
+            break;
 
-    struct mag_buf *result = NULL;
-    while (!fifo_head && !fifo_halted) {
         if (!timeout_ms) {
             // Non-blocking
-            goto done;
+            return NULL;
         }
 
         // No data pending, wait for some
-        int err = pthread_cond_timedwait(&fifo_notempty_cond, &fifo_mutex, &deadline);
-        if (err) {
-            if (err != ETIMEDOUT) {
-                fprintf(stderr, "fifo_dequeue: pthread_cond_timedwait unexpectedly returned %s\n", strerror(err));
-            }
-
-            goto done; // done waiting
-        }
+        if (!event_wait(&fifo_notempty_event, seen, &deadline))
+            return NULL; // done waiting
     }
 
-    if (!fifo_halted) {
-        result = fifo_head;
-        fifo_head = result->next;
-        result->next = NULL;
-        if (!fifo_head) {
-            fifo_tail = NULL;
-            pthread_cond_broadcast(&fifo_empty_cond);
-        }
-    }
+    if (ring_empty(&fifo_queue))
+        event_signal(&fifo_empty_event);
 
- done:
-    pthread_mutex_unlock(&fifo_mutex);
     return result;
 }
 
 void fifo_release(struct mag_buf *buf)
 {
-    pthread_mutex_lock(&fifo_mutex);
-    if (!fifo_freelist)
-        pthread_cond_signal(&fifo_free_cond);
-    buf->next = fifo_freelist;
-    fifo_freelist = buf;
-    pthread_mutex_unlock(&fifo_mutex);
+    ring_push(&fifo_freelist, buf);
+    event_signal(&fifo_free_event);
 }
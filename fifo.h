@@ -65,16 +65,25 @@ struct mag_buf {
     double          mean_level;      // Mean of normalized (0..1) signal level
     double          mean_power;      // Mean of normalized (0..1) power level
     unsigned        dropped;         // (approx) number of dropped samples, if flag MAGBUF_DISCONTINUOUS is set; zero if not discontinuous
-
-    struct mag_buf *next;            // linked list forward link
 };
 
+// The FIFO is lock-free and supports exactly one producer thread (the SDR reader,
+// which calls fifo_acquire / fifo_enqueue / fifo_drain) and one consumer thread
+// (the demodulator, which calls fifo_dequeue / fifo_release). fifo_halt may be
+// called from any thread.
+
 // Create the queue structures. Not threadsafe. Returns true on success.
 //
 //   buffer_count - the number of buffers to preallocate
 //   buffer_size  - the size of each magnitude buffer, in samples, including overlap
 //   overlap      - the number of samples to overlap between adjacent buffers
-bool fifo_create(unsigned buffer_count, unsigned buffer_size, unsigned overlap);
+//   mirrored     - if true, keep all sample data in one mirrored ring so that the overlap
+//                  never needs copying; falls back to separate buffers if this is not possible.
+//                  In this mode buffers must be released in the order they were dequeued,
+//                  and buf->data is only valid between fifo_acquire and fifo_release.
+//   sample_rate  - the magnitude sample rate in Hz, used to keep buffer timestamps
+//                  consistent when the mirrored ring skips stale overlap data
+bool fifo_create(unsigned buffer_count, unsigned buffer_size, unsigned overlap, bool mirrored, double sample_rate);
 
 // Destroy the fifo structures allocated in magbuf_fifo_create. Not threadsafe; ensure all FIFO users
 // are done before calling.
@@ -83,10 +92,10 @@ void fifo_destroy();
 // Block until the FIFO is empty.
 void fifo_drain();
 
-// Mark the FIFO as halted. Move any buffers in FIFO to the freelist immediately.
-// Future calls to magbuf_acquire() will immediately return NULL.
-// Future calls to magbuf_produce() will immediately put the produced buffer on the freelist.
-// Future alls to magbuf_consume() will immediately return NULL; if there are
+// Mark the FIFO as halted. Any buffers still in the FIFO are discarded.
+// Future calls to fifo_acquire() will immediately return NULL.
+// Future calls to fifo_enqueue() will immediately discard the produced buffer.
+// Future calls to fifo_dequeue() will immediately return NULL; if there are
 //   existing calls waiting on data, they will be immediately awoken and return NULL.
 void fifo_halt();
 
@@ -19,21 +19,45 @@
 
 #include "dump1090.h"
 
-// hash table size, must be a power of two:
-#define ICAO_FILTER_SIZE 4096
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 
-// Millis between filter expiry flips:
-#define MODES_ICAO_FILTER_TTL 60000
+// Number of buckets, must be a power of two:
+#define ICAO_FILTER_BUCKETS 1024
 
-// Open-addressed hash table with linear probing.
-// We store each address twice to handle Data/Parity
-// which need to match on a partial address (top 16 bits only).
+// Addresses per bucket; a bucket fills exactly one 64-byte cache line
+#define ICAO_FILTER_SLOTS 8
 
-// Maintain two tables and switch between them to age out entries.
+// Seconds an address stays in the filter after it was last added:
+#define MODES_ICAO_FILTER_TTL 60
 
-static uint32_t icao_filter_a[ICAO_FILTER_SIZE];
-static uint32_t icao_filter_b[ICAO_FILTER_SIZE];
-static uint32_t *icao_filter_active;
+// Seconds between sweeps that drop expired entries:
+#define ICAO_FILTER_SWEEP_INTERVAL 60
+
+// Open-addressed hash table of buckets, probed linearly bucket by bucket.
+// A probe sequence ends at the first bucket that has a never-used (EMPTY)
+// slot. Each entry carries the (coarse) time it was last added, and is
+// treated as absent once that is more than MODES_ICAO_FILTER_TTL ago;
+// expired slots are reused by later adds, and a periodic sweep rehashes
+// the live entries into a clean table so probe sequences stay short.
+
+struct icao_filter_bucket {
+    uint32_t addr[ICAO_FILTER_SLOTS];
+    uint32_t seen[ICAO_FILTER_SLOTS];   // icao_filter_now when last added
+} __attribute__((aligned(64)));
+
+static struct icao_filter_bucket icao_filter_a[ICAO_FILTER_BUCKETS];
+static struct icao_filter_bucket icao_filter_b[ICAO_FILTER_BUCKETS];
+static struct icao_filter_bucket *icao_filter_active;
+
+// Coarse clock (seconds), updated by icaoFilterExpire
+static uint32_t icao_filter_now;
+
+// Per-thread lookup counters; see icaoFilterCollectCounters
+static _Thread_local struct icao_filter_counters icao_filter_counters;
 
 #define EMPTY 0xFFFFFFFF
 
@@ -58,70 +82,170 @@ static uint32_t icaoHash(uint32_t a)
     hash ^= (hash >> 11);
     hash += (hash << 15);
 
-    return hash & (ICAO_FILTER_SIZE-1);
+    return hash & (ICAO_FILTER_BUCKETS-1);
 }
 
-void icaoFilterInit()
+// Return a bitmask of the slots in bucket b that hold `value`
+static inline unsigned bucketMatch(const struct icao_filter_bucket *b, uint32_t value)
 {
-    memset(icao_filter_a, 0xFF, sizeof(icao_filter_a));
-    memset(icao_filter_b, 0xFF, sizeof(icao_filter_b));
-    icao_filter_active = icao_filter_a;
+#if defined(__SSE2__)
+    __m128i v = _mm_set1_epi32((int) value);
+    __m128i lo = _mm_cmpeq_epi32(_mm_load_si128((const __m128i *) &b->addr[0]), v);
+    __m128i hi = _mm_cmpeq_epi32(_mm_load_si128((const __m128i *) &b->addr[4]), v);
+    return (unsigned) _mm_movemask_ps(_mm_castsi128_ps(lo)) | ((unsigned) _mm_movemask_ps(_mm_castsi128_ps(hi)) << 4);
+#elif defined(__ARM_NEON)
+    static const uint32_t bits_lo[4] = { 1, 2, 4, 8 };
+    static const uint32_t bits_hi[4] = { 16, 32, 64, 128 };
+    uint32x4_t v = vdupq_n_u32(value);
+    uint32x4_t lo = vandq_u32(vceqq_u32(vld1q_u32(&b->addr[0]), v), vld1q_u32(bits_lo));
+    uint32x4_t hi = vandq_u32(vceqq_u32(vld1q_u32(&b->addr[4]), v), vld1q_u32(bits_hi));
+    uint32x4_t both = vorrq_u32(lo, hi);
+    uint32x2_t pair = vorr_u32(vget_low_u32(both), vget_high_u32(both));
+    return vget_lane_u32(pair, 0) | vget_lane_u32(pair, 1);
+#else
+    unsigned mask = 0;
+    for (unsigned i = 0; i < ICAO_FILTER_SLOTS; ++i)
+        if (b->addr[i] == value)
+            mask |= 1U << i;
+    return mask;
+#endif
 }
 
-void icaoFilterAdd(uint32_t addr)
+static inline bool entryLive(const struct icao_filter_bucket *b, unsigned slot)
+{
+    return (icao_filter_now - b->seen[slot]) < MODES_ICAO_FILTER_TTL;
+}
+
+static void clearTable(struct icao_filter_bucket *table)
+{
+    memset(table, 0xFF, sizeof(struct icao_filter_bucket) * ICAO_FILTER_BUCKETS);
+}
+
+// Insert or refresh addr in table, with the given last-seen time
+static void tableAdd(struct icao_filter_bucket *table, uint32_t addr, uint32_t seen)
 {
     uint32_t h, h0;
+    struct icao_filter_bucket *reuse = NULL;
+    unsigned reuse_slot = 0;
+
     h0 = h = icaoHash(addr);
-    while (icao_filter_active[h] != EMPTY && icao_filter_active[h] != addr) {
-        h = (h+1) & (ICAO_FILTER_SIZE-1);
-        if (h == h0) {
-            fprintf(stderr, "ICAO hash table full, increase ICAO_FILTER_SIZE\n");
+    for (;;) {
+        struct icao_filter_bucket *b = &table[h];
+
+        unsigned match = bucketMatch(b, addr);
+        if (match) {
+            b->seen[__builtin_ctz(match)] = seen;
             return;
         }
+
+        // remember the first slot we could reuse, in case addr isn't present
+        if (!reuse) {
+            for (unsigned i = 0; i < ICAO_FILTER_SLOTS; ++i) {
+                if (b->addr[i] == EMPTY || !entryLive(b, i)) {
+                    reuse = b;
+                    reuse_slot = i;
+                    break;
+                }
+            }
+        }
+
+        if (bucketMatch(b, EMPTY))
+            break; // end of the probe sequence
+
+        h = (h+1) & (ICAO_FILTER_BUCKETS-1);
+        if (h == h0)
+            break;
+    }
+
+    if (!reuse) {
+        fprintf(stderr, "ICAO hash table full, increase ICAO_FILTER_BUCKETS\n");
+        return;
     }
-    if (icao_filter_active[h] == EMPTY)
-        icao_filter_active[h] = addr;
+
+    reuse->addr[reuse_slot] = addr;
+    reuse->seen[reuse_slot] = seen;
+}
+
+void icaoFilterInit()
+{
+    clearTable(icao_filter_a);
+    clearTable(icao_filter_b);
+    icao_filter_active = icao_filter_a;
+    icao_filter_now = (uint32_t) (mstime() / 1000);
+}
+
+void icaoFilterAdd(uint32_t addr)
+{
+    tableAdd(icao_filter_active, addr, icao_filter_now);
 }
 
 int icaoFilterTest(uint32_t addr)
 {
     uint32_t h, h0;
+    unsigned probes = 0;
+    int result = 0;
 
     h0 = h = icaoHash(addr);
-    while (icao_filter_a[h] != EMPTY && icao_filter_a[h] != addr) {
-        h = (h+1) & (ICAO_FILTER_SIZE-1);
-        if (h == h0)
+    for (;;) {
+        const struct icao_filter_bucket *b = &icao_filter_active[h];
+        ++probes;
+
+        unsigned match = bucketMatch(b, addr);
+        if (match) {
+            result = entryLive(b, __builtin_ctz(match));
+            break;
+        }
+
+        if (bucketMatch(b, EMPTY))
             break;
-    }
-    if (icao_filter_a[h] == addr)
-        return 1;
 
-    h = h0;
-    while (icao_filter_b[h] != EMPTY && icao_filter_b[h] != addr) {
-        h = (h+1) & (ICAO_FILTER_SIZE-1);
+        h = (h+1) & (ICAO_FILTER_BUCKETS-1);
         if (h == h0)
             break;
     }
-    if (icao_filter_b[h] == addr)
-        return 1;
 
-    return 0;
+    if (result)
+        ++icao_filter_counters.hits;
+    else
+        ++icao_filter_counters.misses;
+    icao_filter_counters.probes += probes;
+    if (probes > icao_filter_counters.max_probes)
+        icao_filter_counters.max_probes = probes;
+
+    return result;
 }
 
 // call this periodically:
 void icaoFilterExpire()
 {
-    static uint64_t next_flip = 0;
-    uint64_t now = mstime();
-
-    if (now >= next_flip) {
-        if (icao_filter_active == icao_filter_a) {
-            memset(icao_filter_b, 0xFF, sizeof(icao_filter_b));
-            icao_filter_active = icao_filter_b;
-        } else {
-            memset(icao_filter_a, 0xFF, sizeof(icao_filter_a));
-            icao_filter_active = icao_filter_a;
+    static uint32_t next_sweep = 0;
+
+    icao_filter_now = (uint32_t) (mstime() / 1000);
+
+    if (icao_filter_now >= next_sweep) {
+        // rehash the live entries into the other table
+        struct icao_filter_bucket *from = icao_filter_active;
+        struct icao_filter_bucket *to = (from == icao_filter_a ? icao_filter_b : icao_filter_a);
+
+        clearTable(to);
+        for (unsigned h = 0; h < ICAO_FILTER_BUCKETS; ++h) {
+            for (unsigned i = 0; i < ICAO_FILTER_SLOTS; ++i) {
+                if (from[h].addr[i] != EMPTY && entryLive(&from[h], i))
+                    tableAdd(to, from[h].addr[i], from[h].seen[i]);
+            }
         }
-        next_flip = now + MODES_ICAO_FILTER_TTL;
+
+        icao_filter_active = to;
+        next_sweep = icao_filter_now + ICAO_FILTER_SWEEP_INTERVAL;
     }
 }
+
+void icaoFilterCollectCounters(struct icao_filter_counters *out)
+{
+    out->hits += icao_filter_counters.hits;
+    out->misses += icao_filter_counters.misses;
+    out->probes += icao_filter_counters.probes;
+    if (icao_filter_counters.max_probes > out->max_probes)
+        out->max_probes = icao_filter_counters.max_probes;
+    memset(&icao_filter_counters, 0, sizeof(icao_filter_counters));
+}
@@ -23,6 +23,14 @@
 // Special address bit used to mark ADS-B (NT) emitters
 #define ICAO_FILTER_ADSB_NT (1 << 25)
 
+// Lookup counters, accumulated per thread by icaoFilterTest
+struct icao_filter_counters {
+    uint64_t hits;          // lookups that found a live entry
+    uint64_t misses;        // lookups that did not
+    uint64_t probes;        // total buckets examined
+    unsigned max_probes;    // longest probe sequence
+};
+
 // Call once:
 void icaoFilterInit();
 
@@ -41,4 +49,7 @@ uint32_t icaoFilterTestFuzzy(uint32_t partial);
 // old entries.
 void icaoFilterExpire();
 
+// Add the calling thread's lookup counters to *out, and reset them
+void icaoFilterCollectCounters(struct icao_filter_counters *out);
+
 #endif
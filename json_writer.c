@@ -0,0 +1,228 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// json_writer.c: printf-free JSON output buffer
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// The JSON files are regenerated every second or so and are mostly numbers,
+// so formatting them through snprintf (particularly %f, which is slow on
+// ARM) used to be a large part of the background thread's CPU time. Numbers
+// here are converted directly, two digits at a time.
+
+#include "dump1090.h"
+
+#define JSON_MIN_SIZE 1024
+
+static const char digit_pairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+void jsonInit(struct json_writer *w, size_t *size_hint)
+{
+    w->len = 0;
+    w->size = (*size_hint > JSON_MIN_SIZE ? *size_hint : JSON_MIN_SIZE);
+    w->size_hint = size_hint;
+    w->failed = !(w->buf = malloc(w->size));
+    if (w->failed)
+        w->size = 0;
+}
+
+char *jsonFinish(struct json_writer *w, int *len)
+{
+    if (w->failed) {
+        free(w->buf);
+        *len = 0;
+        return NULL;
+    }
+
+    // leave some room for the document to grow next time
+    *w->size_hint = w->len + w->len / 8;
+    *len = (int) w->len;
+    return w->buf;
+}
+
+bool jsonGrow(struct json_writer *w, size_t n)
+{
+    if (w->failed)
+        return false;
+
+    size_t size = w->size ? w->size : JSON_MIN_SIZE;
+    while (size - w->len < n)
+        size *= 2;
+
+    char *buf = realloc(w->buf, size);
+    if (!buf) {
+        w->failed = true;
+        return false;
+    }
+
+    w->buf = buf;
+    w->size = size;
+    return true;
+}
+
+// Write 'value' in decimal ending just before 'end'; return where it starts
+static char *formatUint(char *end, uint64_t value)
+{
+    char *p = end;
+
+    while (value >= 100) {
+        unsigned pair = (unsigned) (value % 100) * 2;
+        value /= 100;
+        p -= 2;
+        memcpy(p, digit_pairs + pair, 2);
+    }
+
+    if (value >= 10) {
+        p -= 2;
+        memcpy(p, digit_pairs + value * 2, 2);
+    } else {
+        *--p = (char) ('0' + value);
+    }
+
+    return p;
+}
+
+void jsonUint(struct json_writer *w, uint64_t value)
+{
+    char buf[20];
+    char *start = formatUint(buf + sizeof(buf), value);
+    jsonAppend(w, start, buf + sizeof(buf) - start);
+}
+
+void jsonInt(struct json_writer *w, int64_t value)
+{
+    char buf[21];
+    uint64_t magnitude = (value < 0 ? -(uint64_t) value : (uint64_t) value);
+    char *start = formatUint(buf + sizeof(buf), magnitude);
+    if (value < 0)
+        *--start = '-';
+    jsonAppend(w, start, buf + sizeof(buf) - start);
+}
+
+void jsonFixed(struct json_writer *w, double value, unsigned decimals)
+{
+    static const double scales[] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+    static const uint64_t divisors[] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+
+    if (decimals > 6)
+        decimals = 6;
+
+    if (!isfinite(value)) {
+        jsonLiteral(w, "null");
+        return;
+    }
+
+    double scaled = fabs(value) * scales[decimals];
+    if (scaled >= 4e15) {
+        // too big to count exactly in units of the last digit; nothing we
+        // output gets anywhere near this, so don't try to be fast about it
+        char buf[512];
+        int n = snprintf(buf, sizeof(buf), "%.*f", (int) decimals, value);
+        if (n > 0 && (size_t) n < sizeof(buf))
+            jsonAppend(w, buf, n);
+        else
+            jsonLiteral(w, "null");
+        return;
+    }
+
+    // Round to nearest the way printf does. Below 2^52 the fractional part
+    // of 'scaled' is exact, and 'scaled' is the closest double to the true
+    // product, so only an apparent tie needs a closer look: fma gives the
+    // exact rounding error of the multiplication, and a real tie goes to even.
+    double whole = floor(scaled);
+    double fraction = scaled - whole;
+    uint64_t units = (uint64_t) whole;
+    if (fraction > 0.5) {
+        ++units;
+    } else if (fraction == 0.5) {
+        double error = fma(fabs(value), scales[decimals], -scaled);
+        if (error > 0 || (error == 0 && (units & 1)))
+            ++units;
+    }
+
+    uint64_t integer_part = units / divisors[decimals];
+    uint64_t fraction_part = units % divisors[decimals];
+
+    char buf[32];
+    char *end = buf + sizeof(buf);
+    char *start = end;
+
+    if (decimals) {
+        for (unsigned i = 0; i < decimals; ++i) {
+            *--start = (char) ('0' + fraction_part % 10);
+            fraction_part /= 10;
+        }
+        *--start = '.';
+    }
+
+    start = formatUint(start, integer_part);
+    if (signbit(value))
+        *--start = '-';
+
+    jsonAppend(w, start, end - start);
+}
+
+void jsonHex(struct json_writer *w, unsigned value, unsigned digits, bool uppercase)
+{
+    const char *hex = uppercase ? "0123456789ABCDEF" : "0123456789abcdef";
+
+    if (digits > 8)
+        digits = 8;
+    if (!jsonReserve(w, digits))
+        return;
+
+    char *p = w->buf + w->len;
+    for (unsigned i = digits; i > 0; --i) {
+        p[i - 1] = hex[value & 15];
+        value >>= 4;
+    }
+    w->len += digits;
+}
+
+void jsonString(struct json_writer *w, const char *str)
+{
+    jsonChar(w, '"');
+
+    const char *run = str;
+    for (const char *in = str; *in; ++in) {
+        unsigned char ch = (unsigned char) *in;
+        if (ch >= 32 && ch <= 127 && ch != '"' && ch != '\\')
+            continue;
+
+        jsonAppend(w, run, in - run);
+        run = in + 1;
+
+        if (ch == '"' || ch == '\\') {
+            char escaped[2] = { '\\', (char) ch };
+            jsonAppend(w, escaped, 2);
+        } else {
+            char escaped[6] = { '\\', 'u', '0', '0', 0, 0 };
+            escaped[4] = "0123456789abcdef"[ch >> 4];
+            escaped[5] = "0123456789abcdef"[ch & 15];
+            jsonAppend(w, escaped, 6);
+        }
+    }
+    jsonAppend(w, run, strlen(run));
+
+    jsonChar(w, '"');
+}
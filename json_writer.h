@@ -0,0 +1,94 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// json_writer.h: printf-free JSON output buffer
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DUMP1090_JSON_WRITER_H
+#define DUMP1090_JSON_WRITER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// A document under construction. The buffer grows as needed, starting from
+// the size the same document needed last time (*size_hint), so a document
+// that is regenerated periodically is normally built without reallocating.
+// If the buffer can't be grown, further output is discarded and jsonFinish
+// returns NULL.
+struct json_writer {
+    char *buf;
+    size_t len;
+    size_t size;
+    size_t *size_hint;
+    bool failed;
+};
+
+// Start a new document; *size_hint is the initial buffer size, and is
+// updated by jsonFinish
+void jsonInit(struct json_writer *w, size_t *size_hint);
+
+// Return the finished document (to be freed by the caller) and its length,
+// or NULL if memory ran out while building it
+char *jsonFinish(struct json_writer *w, int *len);
+
+// Grow the buffer to have room for 'n' more bytes. Use jsonReserve instead.
+bool jsonGrow(struct json_writer *w, size_t n);
+
+static inline bool jsonReserve(struct json_writer *w, size_t n)
+{
+    return (w->size - w->len >= n) || jsonGrow(w, n);
+}
+
+static inline void jsonAppend(struct json_writer *w, const char *data, size_t n)
+{
+    if (jsonReserve(w, n)) {
+        memcpy(w->buf + w->len, data, n);
+        w->len += n;
+    }
+}
+
+// Append a string literal (usually a key with its punctuation, e.g. ",\"gs\":"),
+// with the length known at compile time
+#define jsonLiteral(w, lit) jsonAppend((w), "" lit, sizeof(lit) - 1)
+
+static inline void jsonChar(struct json_writer *w, char ch)
+{
+    if (jsonReserve(w, 1))
+        w->buf[w->len++] = ch;
+}
+
+// Append an integer in decimal
+void jsonUint(struct json_writer *w, uint64_t value);
+void jsonInt(struct json_writer *w, int64_t value);
+
+// Append 'value' with exactly 'decimals' (at most 6) digits after the point,
+// with the same result as printf's "%.*f". Values that are not finite are
+// written as null.
+void jsonFixed(struct json_writer *w, double value, unsigned decimals);
+
+// Append 'value' as exactly 'digits' hex digits
+void jsonHex(struct json_writer *w, unsigned value, unsigned digits, bool uppercase);
+
+// Append a quoted string, escaping anything that needs it
+void jsonString(struct json_writer *w, const char *str);
+
+// Append a key literal (with its punctuation) followed by a value
+#define jsonKeyUint(w, key, value) do { jsonLiteral((w), key); jsonUint((w), (value)); } while (0)
+#define jsonKeyInt(w, key, value) do { jsonLiteral((w), key); jsonInt((w), (value)); } while (0)
+#define jsonKeyFixed(w, key, value, decimals) do { jsonLiteral((w), key); jsonFixed((w), (value), (decimals)); } while (0)
+#define jsonKeyString(w, key, str) do { jsonLiteral((w), key); jsonString((w), (str)); } while (0)
+
+#endif
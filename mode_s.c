@@ -53,6 +53,7 @@
 #include "ais_charset.h"
 
 /* for PRIX64 */
+#include <assert.h>
 #include <inttypes.h>
 
 //
@@ -249,24 +250,24 @@ static bool isShortPIMessage(const unsigned char *msg)
 
 #define UNCHECKED_SYNDROME 0xFFFFFFFFU
 
+// Possible DF values of the first byte of a message that could be a valid DF11/17/18
+// message after correction. See tools/df-correction-arrays.py for generator code.
+// This is used to shortcut message correction so that we don't bother computing a CRC over
+// messages that couldn't possibly become one of those message types.
+
+// These are bitsets, where the bit with value 1<<N represents a match for DF N
+static const uint32_t df_correctable_short[MODES_MAX_BITERRORS + 1] = {
+    0x00000800, 0x08008e08, 0x08008e08
+};
+static const uint32_t df_correctable_long[MODES_MAX_BITERRORS + 1] = {
+    0x00060000, 0x066f0006, 0x6fff066f
+};
+
+// On entry, *short_syndrome / *long_syndrome are either UNCHECKED_SYNDROME
+// or the already-known syndrome of the uncorrected message; on return they
+// hold any syndromes that were needed along the way.
 static int correctMessage(const unsigned char *in, unsigned char *out, uint32_t *short_syndrome, uint32_t *long_syndrome)
 {
-    // Possible DF values of the first byte of a message that could be a valid DF11/17/18
-    // message after correction. See tools/df-correction-arrays.py for generator code.
-    // This is used to shortcut message correction so that we don't bother computing a CRC over
-    // messages that couldn't possibly become one of those message types.
-
-    // These are bitsets, where the bit with value 1<<N represents a match for DF N
-    static const uint32_t df_correctable_short[MODES_MAX_BITERRORS + 1] = {
-        0x00000800, 0x08008e08, 0x08008e08
-    };
-    static const uint32_t df_correctable_long[MODES_MAX_BITERRORS + 1] = {
-        0x00060000, 0x066f0006, 0x6fff066f
-    };
-
-    *short_syndrome = UNCHECKED_SYNDROME;
-    *long_syndrome = UNCHECKED_SYNDROME;
-
     // Try to correct, including corrections to the initial 5 bit DF field
     // that determines message format
 
@@ -278,9 +279,10 @@ static int correctMessage(const unsigned char *in, unsigned char *out, uint32_t
     // (DF17 could be corrected to DF18 or vice versa), but it does disable the CPU hungry part of it.
     const unsigned fix_df_bits = (Modes.fix_df ? Modes.nfix_crc : 0);
 
-    struct errorinfo *long_ei = NULL;
+    const struct errorinfo *long_ei = NULL;
     if (df_correctable_long[fix_df_bits] & df_bit) {
-        *long_syndrome = modesChecksum(in, MODES_LONG_MSG_BITS);
+        if (*long_syndrome == UNCHECKED_SYNDROME)
+            *long_syndrome = modesChecksum(in, MODES_LONG_MSG_BITS);
         if (isLongPIMessage(in) && *long_syndrome == 0) {
             // DF17/18 message with correct checksum
             memcpy(out, in, MODES_LONG_MSG_BYTES);
@@ -290,9 +292,10 @@ static int correctMessage(const unsigned char *in, unsigned char *out, uint32_t
         long_ei = modesChecksumDiagnose(*long_syndrome, MODES_LONG_MSG_BITS);
     }
 
-    struct errorinfo *short_ei = NULL;
+    const struct errorinfo *short_ei = NULL;
     if (df_correctable_short[fix_df_bits] & df_bit) {
-        *short_syndrome = modesChecksum(in, MODES_SHORT_MSG_BITS);
+        if (*short_syndrome == UNCHECKED_SYNDROME)
+            *short_syndrome = modesChecksum(in, MODES_SHORT_MSG_BITS);
         if (isShortPIMessage(in) && (*short_syndrome & 0xFFFF80) == 0) {
             // DF11 message with correct checksum
             // (low 7 bits may be IID)
@@ -345,9 +348,9 @@ static int correctMessage(const unsigned char *in, unsigned char *out, uint32_t
     return -1;
 }
 
-// Score how plausible this ModeS message looks.
-// The more positive, the more reliable the message is.
-score_rank scoreModesMessage(const unsigned char *uncorrected)
+// Score a message given (optionally) its precomputed syndromes;
+// see scoreModesMessage
+static score_rank scoreMessageWithSyndromes(const unsigned char *uncorrected, uint32_t short_syndrome, uint32_t long_syndrome)
 {
     // This is a "valid" DF0 message, but it's not useful; we discard these messages
     static const unsigned char all_zeros[MODES_SHORT_MSG_BYTES] = { 0, 0, 0, 0, 0, 0, 0 };
@@ -356,7 +359,6 @@ score_rank scoreModesMessage(const unsigned char *uncorrected)
 
     // try to produce a corrected DF11/17/18, including correcting the DF bits
     unsigned char corrected[14];
-    uint32_t short_syndrome, long_syndrome;
     int corrections = correctMessage(uncorrected, corrected, &short_syndrome, &long_syndrome);
 
     unsigned df = getbits(corrected, 1, 5); // Downlink Format
@@ -465,6 +467,70 @@ score_rank scoreModesMessage(const unsigned char *uncorrected)
     }
 }
 
+// Score how plausible this ModeS message looks.
+// The more positive, the more reliable the message is.
+score_rank scoreModesMessage(const unsigned char *uncorrected)
+{
+    return scoreMessageWithSyndromes(uncorrected, UNCHECKED_SYNDROME, UNCHECKED_SYNDROME);
+}
+
+// Score up to MODES_MAX_CANDIDATES candidate messages stored
+// MODES_LONG_MSG_BYTES apart (e.g. one per demodulator phase), considering
+// only those whose bit is set in `mask`. The CRC syndromes that scoring
+// will need, given each candidate's DF, are computed together up front.
+//
+// Returns the index of the best-scoring candidate (the earliest one, on a
+// tie) and stores its score in *bestscore, or returns -1 if no candidate
+// was considered.
+int scoreModesMessageBatch(const unsigned char *msgs, unsigned count, unsigned mask, score_rank *bestscore)
+{
+    uint32_t short_syndromes[MODES_MAX_CANDIDATES];
+    uint32_t long_syndromes[MODES_MAX_CANDIDATES];
+    int best = -1;
+
+    assert(count <= MODES_MAX_CANDIDATES);
+
+    *bestscore = SR_NOT_SET;
+    if (!mask)
+        return -1;
+
+    // DFs whose scoring uses each syndrome of the uncorrected message:
+    // those that correctMessage might correct, plus those that are scored
+    // on their address/parity alone
+    const unsigned fix_df_bits = (Modes.fix_df ? Modes.nfix_crc : 0);
+    const uint32_t short_dfs = df_correctable_short[fix_df_bits] | (1 << 0) | (1 << 4) | (1 << 5);
+    const uint32_t long_dfs = df_correctable_long[fix_df_bits] | (1 << 16) | (1 << 20) | (1 << 21) |
+        (Modes.enable_df24 ? 0xFF000000 : 0);
+
+    unsigned short_mask = 0, long_mask = 0;
+    for (unsigned i = 0; i < count; ++i) {
+        short_syndromes[i] = long_syndromes[i] = UNCHECKED_SYNDROME;
+        if (!(mask & (1U << i)))
+            continue;
+
+        const uint32_t df_bit = 1U << getbits(msgs + i * MODES_LONG_MSG_BYTES, 1, 5);
+        if (short_dfs & df_bit)
+            short_mask |= 1U << i;
+        if (long_dfs & df_bit)
+            long_mask |= 1U << i;
+    }
+
+    modesChecksumBatch(msgs, count, short_mask, long_mask, short_syndromes, long_syndromes);
+
+    for (unsigned i = 0; i < count; ++i) {
+        if (!(mask & (1U << i)))
+            continue;
+
+        score_rank score = scoreMessageWithSyndromes(msgs + i * MODES_LONG_MSG_BYTES, short_syndromes[i], long_syndromes[i]);
+        if (best < 0 || score > *bestscore) {
+            best = i;
+            *bestscore = score;
+        }
+    }
+
+    return best;
+}
+
 static const char *score_to_string(score_rank score)
 {
     switch (score) {
@@ -532,7 +598,7 @@ int decodeModesMessage(struct modesMessage *mm, const unsigned char *in)
     memcpy(mm->verbatim, in, MODES_LONG_MSG_BYTES);
 
     // Apply corrections to our local copy
-    uint32_t short_syndrome, long_syndrome;
+    uint32_t short_syndrome = UNCHECKED_SYNDROME, long_syndrome = UNCHECKED_SYNDROME;
     int corrections = correctMessage(in, mm->msg, &short_syndrome, &long_syndrome);
     const unsigned char *msg = mm->msg;
 
@@ -79,8 +79,12 @@ typedef enum {
     SR_DF17_KNOWN,                // DF17,               no errors,  known aircraft
 } score_rank;
 
+// Maximum number of candidates accepted by scoreModesMessageBatch
+#define MODES_MAX_CANDIDATES 8
+
 int modesMessageLenByType(int type);
 score_rank scoreModesMessage(const unsigned char *msg);
+int scoreModesMessageBatch(const unsigned char *msgs, unsigned count, unsigned mask, score_rank *bestscore);
 int decodeModesMessage (struct modesMessage *mm, const unsigned char *msg);
 void displayModesMessage(struct modesMessage *mm);
 void useModesMessage    (struct modesMessage *mm);
@@ -55,25 +55,70 @@
 #include <assert.h>
 #include <stdarg.h>
 
+#ifndef _WIN32
+#include <sys/uio.h>
+#endif
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#define NET_HAVE_EPOLL
+#endif
+
+#include "net_uring.h"
+#if defined(NET_HAVE_URING) && !defined(NET_HAVE_EPOLL)
+#undef NET_HAVE_URING // the io_uring backend leans on epoll for wakeups
+#endif
+#ifdef NET_HAVE_URING
+#include <poll.h>
+#include <sys/socket.h>
+#endif
+
+#ifdef ENABLE_ZLIB
+#include <zlib.h>
+#endif
+
 //
 // ============================= Networking =============================
 //
 // Note: here we disregard any kind of good coding practice in favor of
 // extreme simplicity, that is:
 //
-// 1) We only rely on the kernel buffers for our I/O without any kind of
-//    user space buffering.
-// 2) We don't register any kind of event handler, from time to time a
-//    function gets called and we accept new connections. All the rest is
-//    handled via non-blocking I/O and manually polling clients to see if
-//    they have something new to share with us when reading is needed.
+// 1) Output is written straight to the socket while the kernel buffer has
+//    room. Whatever doesn't fit is queued per client, as references to a
+//    reference-counted copy of the output buffer shared by every client
+//    that needed it, and is sent as the socket drains. A client whose
+//    queue grows past --net-queue-limit is disconnected as too slow.
+// 2) From time to time a function gets called that accepts new connections
+//    and reads from clients. Where epoll is available, listeners and
+//    clients are registered with it and only ready sockets are serviced;
+//    otherwise (or for FDs epoll can't watch) we fall back to polling
+//    every listener and client with non-blocking I/O.
+// 3) In dump1090 all of the socket work happens on a dedicated network
+//    thread, so that a slow client or a burst of input can't hold up
+//    demodulation; see "Network thread" below.
+// 4) With --net-io-uring, the network thread accepts, reads and writes
+//    through io_uring instead; see "io_uring backend" below.
 
 static int handleBeastCommand(struct client *c, char *p);
 static int decodeBinMessage(struct client *c, char *p);
 static int decodeHexMessage(struct client *c, char *hex);
 static int handleFaupCommand(struct client *c, char *hex);
+static int handleHTTPRequest(struct client *c, char *p);
+struct net_output;
+static void httpInit(struct net_service *service);
+static void httpInstallSnapshot(const struct net_output *out);
+static void httpResumeWaiting(void);
+static void releaseChunk(struct net_chunk *chunk);
 
 static void moveNetClient(struct client *c, struct net_service *new_service);
+static void netWatchClient(struct client *c);
+static void netUpdateClientEvents(struct client *c);
+static bool modesServiceEvents(int timeout_ms);
+#ifdef NET_HAVE_URING
+static bool netUringWatchClient(struct client *c);
+static void netUringArmSend(struct client *c);
+#endif
 
 static void send_raw_heartbeat(struct net_service *service);
 static void send_beast_heartbeat(struct net_service *service);
@@ -86,12 +131,480 @@ static void writeFATSVEvent(struct modesMessage *mm, struct aircraft *a);
 static void writeFATSVPositionUpdate(float lat, float lon, float alt);
 
 static void autoset_modeac();
+static void handle_radarcape_position(float lat, float lon, float alt);
+struct net_input;
+static void useRemoteMessage(struct net_input *in);
 
 __attribute__ ((format (printf,3,0))) static char *safe_vsnprintf(char *p, char *end, const char *format, va_list ap);
 __attribute__ ((format (printf,3,4))) static char *safe_snprintf(char *p, char *end, const char *format, ...);
 
 static const char *jsonEscapeString(const char *str);
 
+//
+//=========================================================================
+//
+// Event loop: readiness notification for listeners and clients
+//
+
+#ifdef NET_HAVE_EPOLL
+// Max events handled per epoll_wait call
+#define NET_EPOLL_BATCH 64
+// Max epoll_wait calls per pass, so a flood of busy clients can't starve the demodulator
+#define NET_EPOLL_MAX_BATCHES 16
+
+static int net_epoll_fd = -1;
+static bool net_epoll_failed = false;
+
+// Create the epoll instance on first use; returns false if we should poll instead
+static bool netEventInit(void)
+{
+    if (net_epoll_fd >= 0)
+        return true;
+    if (net_epoll_failed)
+        return false;
+
+    if ((net_epoll_fd = epoll_create1(EPOLL_CLOEXEC)) < 0) {
+        fprintf(stderr, "epoll_create1 failed (%s), falling back to polling network clients\n", strerror(errno));
+        net_epoll_failed = true;
+        return false;
+    }
+
+    return true;
+}
+#endif
+
+//
+//=========================================================================
+//
+// Network thread
+//
+// When the network thread is running (see modesNetStartThread) it owns every
+// socket and the client list. The main thread keeps the aircraft state and
+// the output writers. The two talk through a pair of lock-free
+// single-producer / single-consumer rings:
+//
+//   net_input:   network thread -> main thread: messages framed from remote
+//                input, plus a few control events that touch global state
+//   net_output:  main thread -> network thread: flushed writer buffers, to
+//                be sent to every client of the writer's service, and new
+//                JSON snapshots for the HTTP server
+//
+// If the main thread falls behind and net_input fills, the network thread
+// waits for space and the input sockets back up. If the network thread
+// falls behind and net_output fills, the main thread holds further output
+// in a short overflow list (merging it per service) until there is room,
+// rather than stalling the demodulator.
+//
+// Without the thread (view1090, faup1090, or if it could not be started)
+// modesNetPeriodicWork does everything directly on the caller's thread.
+//
+
+#define NET_INPUT_QUEUE_SIZE 8192   // entries; must be a power of two
+#define NET_OUTPUT_QUEUE_SIZE 1024  // entries; must be a power of two
+#define NET_THREAD_WAIT_MS 50       // longest the network thread waits for socket events
+#define NET_THREAD_POLL_MS 5        // network thread pass interval if we can't wait for events
+#define NET_IOV_BATCH 64            // most output chunks sent to a client in one writev()
+#define NET_OVERFLOW_LIMIT (64 * 1024 * 1024) // bytes of overflow output held before discarding more
+
+typedef enum {
+    NET_INPUT_MESSAGE,     // a Mode S or Mode A/C message
+    NET_INPUT_POSITION,    // a Radarcape receiver position
+    NET_INPUT_MODEAC       // the Mode A/C setting requested by clients changed
+} net_input_type_t;
+
+struct net_input {
+    net_input_type_t type;
+    int msgLen;                              // MESSAGE: bytes of msg used
+    uint64_t timestampMsg;                   // MESSAGE: receiver timestamp, if any
+    uint64_t sysTimestampMsg;                // MESSAGE: system time when we read it
+    double signalLevel;                      // MESSAGE: signal level, if any
+    unsigned char msg[MODES_LONG_MSG_BYTES]; // MESSAGE: message data
+    float lat, lon, alt;                     // POSITION
+    int mode_ac;                             // MODEAC
+};
+
+struct net_output {
+    struct net_service *service; // service to send to, or NULL for an HTTP snapshot
+    struct net_chunk *chunk;     // holds one reference
+    int snapshot;                // HTTP snapshot to replace, if service is NULL
+    uint64_t seq;                // aircraft delta sequence number the snapshot was generated at
+    struct net_chunk *gzip;      // gzip-compressed copy of the snapshot, or NULL; holds one reference
+    unsigned generation;         // snapshot generation (see modesJsonInvalidate) it was generated at
+};
+
+struct net_ring {
+    _Alignas(64) atomic_uint head;     // next slot to write; written only by the producer
+    _Alignas(64) atomic_uint tail;     // next slot to read; written only by the consumer
+};
+
+static bool net_threaded;              // true while the network thread is running
+static pthread_t net_thread;
+static atomic_bool net_thread_exit;
+
+static struct net_ring net_input_ring;
+static struct net_input net_input_slots[NET_INPUT_QUEUE_SIZE];
+static struct net_ring net_output_ring;
+static struct net_output net_output_slots[NET_OUTPUT_QUEUE_SIZE];
+
+// Main thread only: output waiting for room in net_output, oldest first.
+// Later output for a service is appended to that service's last entry, and
+// a newer HTTP snapshot replaces an older one, so this stays short.
+struct net_overflow {
+    struct net_overflow *next;
+    struct net_output out;
+    size_t alloc;                      // bytes allocated for out.chunk's data
+};
+
+static struct net_overflow *net_overflow_head;
+static struct net_overflow **net_overflow_tail = &net_overflow_head;
+static size_t net_overflow_bytes;
+
+// the network thread waits on this when net_input is full
+static pthread_mutex_t net_input_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t net_input_space_cond = PTHREAD_COND_INITIALIZER;
+static atomic_bool net_input_waiting;
+
+// the main thread may wait on this for input to arrive (modesNetWaitForInput)
+static pthread_cond_t net_input_ready_cond = PTHREAD_COND_INITIALIZER;
+static atomic_bool net_input_sleeping;
+static bool net_input_pushed;          // network thread only: input was pushed during this pass
+
+#ifdef NET_HAVE_EPOLL
+// eventfd that wakes the network thread when output is queued
+static int net_wakeup_fd = -1;
+static struct net_event_source net_wakeup_source;
+#endif
+
+// Producer side only; returns the slot to fill, or -1 if the ring is full
+static int ringReserve(struct net_ring *ring, unsigned size)
+{
+    unsigned head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    if (head - atomic_load_explicit(&ring->tail, memory_order_acquire) >= size)
+        return -1;
+    return head & (size - 1);
+}
+
+// Producer side only; publishes the slot returned by ringReserve
+static void ringCommit(struct net_ring *ring)
+{
+    unsigned head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+}
+
+// Consumer side only; returns the next slot to read, or -1 if the ring is empty
+static int ringPeek(struct net_ring *ring, unsigned size)
+{
+    unsigned tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    if (tail == atomic_load_explicit(&ring->head, memory_order_acquire))
+        return -1;
+    return tail & (size - 1);
+}
+
+// Consumer side only; releases the slot returned by ringPeek
+static void ringConsume(struct net_ring *ring)
+{
+    unsigned tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+}
+
+// Wake the network thread, if it is waiting for socket events
+static void netWakeThread(void)
+{
+#ifdef NET_HAVE_EPOLL
+    uint64_t one = 1;
+    if (net_wakeup_fd >= 0 && write(net_wakeup_fd, &one, sizeof(one)) < 0) {
+        // EAGAIN means the counter is saturated, i.e. a wakeup is already pending
+    }
+#endif
+}
+
+// Network thread: wake the main thread if it is waiting for input
+static void netSignalInput(void)
+{
+    net_input_pushed = false;
+
+    // pairs with the fence in modesNetWaitForInput, so that either we see
+    // that it's sleeping or it sees what we pushed
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load(&net_input_sleeping)) {
+        pthread_mutex_lock(&net_input_mutex);
+        pthread_cond_signal(&net_input_ready_cond);
+        pthread_mutex_unlock(&net_input_mutex);
+    }
+}
+
+// Network thread: hand some input to the main thread
+static void netInputPush(const struct net_input *in)
+{
+    int slot;
+
+    while ((slot = ringReserve(&net_input_ring, NET_INPUT_QUEUE_SIZE)) < 0) {
+        if (atomic_load(&net_thread_exit))
+            return;
+
+        netSignalInput();
+
+        pthread_mutex_lock(&net_input_mutex);
+        atomic_store(&net_input_waiting, true);
+        if (ringReserve(&net_input_ring, NET_INPUT_QUEUE_SIZE) < 0) {
+            // the main thread signals us when it has made space; the timeout
+            // covers the window where it drained just before we set the flag
+            struct timespec deadline;
+            get_deadline(10, &deadline);
+            pthread_cond_timedwait(&net_input_space_cond, &net_input_mutex, &deadline);
+        }
+        atomic_store(&net_input_waiting, false);
+        pthread_mutex_unlock(&net_input_mutex);
+    }
+
+    net_input_slots[slot] = *in;
+    ringCommit(&net_input_ring);
+    net_input_pushed = true;
+}
+
+// Main thread: process remote input in the order the network thread read it
+static void processRemoteInput(struct net_input *in)
+{
+    switch (in->type) {
+    case NET_INPUT_MESSAGE:
+        useRemoteMessage(in);
+        break;
+    case NET_INPUT_POSITION:
+        handle_radarcape_position(in->lat, in->lon, in->alt);
+        break;
+    case NET_INPUT_MODEAC:
+        Modes.mode_ac = in->mode_ac;
+        break;
+    }
+}
+
+// Network side: pass on some input, via the main thread if we are running threaded
+static void submitRemoteInput(struct net_input *in)
+{
+    if (net_threaded)
+        netInputPush(in);
+    else
+        processRemoteInput(in);
+}
+
+// Main thread: process everything the network thread has queued so far
+static void drainRemoteInput(void)
+{
+    int slot;
+    unsigned count = 0;
+
+    // bounded, so a flood of input can't keep us here indefinitely
+    while (count++ < NET_INPUT_QUEUE_SIZE && (slot = ringPeek(&net_input_ring, NET_INPUT_QUEUE_SIZE)) >= 0) {
+        processRemoteInput(&net_input_slots[slot]);
+        ringConsume(&net_input_ring);
+    }
+
+    if (atomic_load(&net_input_waiting)) {
+        pthread_mutex_lock(&net_input_mutex);
+        pthread_cond_signal(&net_input_space_cond);
+        pthread_mutex_unlock(&net_input_mutex);
+    }
+}
+
+// Main thread: wait up to timeout_ms for the network thread to queue some
+// input. Without the network thread, this just sleeps.
+void modesNetWaitForInput(int timeout_ms)
+{
+    if (!net_threaded) {
+        struct timespec slp = { timeout_ms / 1000, (timeout_ms % 1000) * 1000 * 1000 };
+        nanosleep(&slp, NULL);
+        return;
+    }
+
+    struct timespec deadline;
+    get_deadline(timeout_ms, &deadline);
+
+    pthread_mutex_lock(&net_input_mutex);
+    atomic_store(&net_input_sleeping, true);
+    atomic_thread_fence(memory_order_seq_cst);
+    if (ringPeek(&net_input_ring, NET_INPUT_QUEUE_SIZE) < 0)
+        pthread_cond_timedwait(&net_input_ready_cond, &net_input_mutex, &deadline);
+    atomic_store(&net_input_sleeping, false);
+    pthread_mutex_unlock(&net_input_mutex);
+}
+
+// Main thread: move as much overflow output as will fit into net_output
+static void netOutputRetry(void)
+{
+    struct net_overflow *o;
+    bool pushed = false;
+    int slot;
+
+    while ((o = net_overflow_head) && (slot = ringReserve(&net_output_ring, NET_OUTPUT_QUEUE_SIZE)) >= 0) {
+        net_overflow_bytes -= o->out.chunk->len; // the network thread owns it once committed
+        net_output_slots[slot] = o->out;
+        ringCommit(&net_output_ring);
+        pushed = true;
+
+        if (!(net_overflow_head = o->next))
+            net_overflow_tail = &net_overflow_head;
+        free(o);
+    }
+
+    if (pushed)
+        netWakeThread();
+}
+
+// Main thread: hold some output in the overflow list. Returns false if it
+// had to be discarded.
+static bool netOutputDefer(const struct net_output *out)
+{
+    struct net_overflow *o, *same = NULL;
+
+    if (net_overflow_bytes + out->chunk->len > NET_OVERFLOW_LIMIT)
+        return false;
+
+    for (o = net_overflow_head; o; o = o->next) {
+        if (o->out.service == out->service && (out->service || o->out.snapshot == out->snapshot))
+            same = o;
+    }
+
+    if (same && !out->service) {
+        // a newer snapshot makes the waiting one redundant
+        net_overflow_bytes -= same->out.chunk->len;
+        releaseChunk(same->out.chunk);
+        if (same->out.gzip)
+            releaseChunk(same->out.gzip);
+        same->out = *out;
+        net_overflow_bytes += out->chunk->len;
+        return true;
+    }
+
+    if (same) {
+        // append to the service's waiting output, which nothing else references yet
+        size_t len = same->out.chunk->len + out->chunk->len;
+        if (len > same->alloc) {
+            size_t alloc = same->alloc * 2 > len ? same->alloc * 2 : len;
+            struct net_chunk *chunk = realloc(same->out.chunk, sizeof(*chunk) + alloc);
+            if (!chunk)
+                return false;
+            same->out.chunk = chunk;
+            same->alloc = alloc;
+        }
+        memcpy(same->out.chunk->data + same->out.chunk->len, out->chunk->data, out->chunk->len);
+        same->out.chunk->len = len;
+        net_overflow_bytes += out->chunk->len;
+        releaseChunk(out->chunk);
+        return true;
+    }
+
+    if (!(o = malloc(sizeof(*o))))
+        return false;
+    o->next = NULL;
+    o->out = *out;
+    o->alloc = out->chunk->len;
+    *net_overflow_tail = o;
+    net_overflow_tail = &o->next;
+    net_overflow_bytes += out->chunk->len;
+    return true;
+}
+
+// Main thread: discard the overflow list
+static void netOutputDiscardOverflow(void)
+{
+    struct net_overflow *o, *next;
+
+    for (o = net_overflow_head; o; o = next) {
+        next = o->next;
+        releaseChunk(o->out.chunk);
+        if (o->out.gzip)
+            releaseChunk(o->out.gzip);
+        free(o);
+    }
+
+    net_overflow_head = NULL;
+    net_overflow_tail = &net_overflow_head;
+    net_overflow_bytes = 0;
+}
+
+// Main thread: hand some output to the network thread, which takes over
+// our reference to its chunk. If net_output is full it is held until there
+// is room; returns false only if it had to be discarded.
+static bool netOutputPush(const struct net_output *out)
+{
+    netOutputRetry();
+
+    int slot;
+    if (!net_overflow_head && (slot = ringReserve(&net_output_ring, NET_OUTPUT_QUEUE_SIZE)) >= 0) {
+        net_output_slots[slot] = *out;
+        ringCommit(&net_output_ring);
+        netWakeThread();
+        return true;
+    }
+
+    return netOutputDefer(out);
+}
+
+// Register an FD with the event loop, reporting input readiness if
+// want_read is set (errors and hangups are always reported).
+// Returns false if the FD must be polled instead.
+static bool netWatch(struct net_event_source *source, bool want_read)
+{
+#ifdef NET_HAVE_EPOLL
+    if (!netEventInit())
+        return false;
+
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = want_read ? EPOLLIN : 0;
+    ev.data.ptr = source;
+    // regular files and some character devices can't be watched (EPERM)
+    return epoll_ctl(net_epoll_fd, EPOLL_CTL_ADD, source->fd, &ev) == 0;
+#else
+    MODES_NOTUSED(source);
+    MODES_NOTUSED(want_read);
+    return false;
+#endif
+}
+
+static void netWatchClient(struct client *c)
+{
+    c->source.type = NET_SOURCE_CLIENT;
+    c->source.fd = c->fd;
+    c->source.service = NULL;
+    c->source.client = c;
+#ifdef NET_HAVE_URING
+    if (netUringWatchClient(c))
+        return;
+#endif
+    c->watched = netWatch(&c->source, c->service && c->service->read_handler);
+}
+
+// Update the events we want for a client after it has changed service,
+// or its output queue has become empty / non-empty
+static void netUpdateClientEvents(struct client *c)
+{
+#ifdef NET_HAVE_URING
+    // io_uring clients always have a receive armed; a send is armed as
+    // soon as there is output, and netUringSendComplete keeps it going
+    if (c->uring) {
+        if (c->service && c->sendq && !c->uring_sending)
+            netUringArmSend(c);
+        return;
+    }
+#endif
+#ifdef NET_HAVE_EPOLL
+    if (!c->watched || c->fd < 0)
+        return;
+
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = (c->service && c->service->read_handler) ? EPOLLIN : 0;
+    if (c->sendq)
+        ev.events |= EPOLLOUT;
+    ev.data.ptr = &c->source;
+    if (epoll_ctl(net_epoll_fd, EPOLL_CTL_MOD, c->fd, &ev) < 0)
+        c->watched = 0;
+#else
+    MODES_NOTUSED(c);
+#endif
+}
+
 //
 //=========================================================================
 //
@@ -121,12 +634,15 @@ struct net_service *serviceInit(const char *descr, struct net_writer *writer, he
     service->read_handler = handler;
 
     if (service->writer) {
-        if (! (service->writer->data = malloc(MODES_OUT_BUF_SIZE)) ) {
+        // room for a full flush plus the largest single message
+        int size = (Modes.net_output_flush_size > 0 ? Modes.net_output_flush_size : 0) + MODES_OUT_MAX_MESSAGE;
+        if (! (service->writer->data = malloc(size)) ) {
             fprintf(stderr, "Out of memory allocating output buffer for service %s\n", descr);
             exit(1);
         }
 
         service->writer->service = service;
+        service->writer->size = size;
         service->writer->dataUsed = 0;
         service->writer->lastWrite = mstime();
         service->writer->send_heartbeat = hb;
@@ -161,9 +677,19 @@ struct client *createGenericClient(struct net_service *service, int fd)
     c->modeac_requested = 0;
     c->verbatim_requested = (service == Modes.beast_verbatim_service || service == Modes.beast_verbatim_local_service);
     c->local_requested = (service == Modes.beast_verbatim_local_service);
+    c->watched    = 0;
+    c->sendq      = NULL;
+    c->sendq_tail = &c->sendq;
+    c->sendq_bytes = 0;
+    c->uring      = 0;
+    c->uring_pending = 0;
+    c->uring_sending = 0;
+    c->uring_iov  = NULL;
+    c->close_when_sent = 0;
     Modes.clients = c;
 
     moveNetClient(c, service);
+    netWatchClient(c);
 
     return c;
 }
@@ -241,6 +767,21 @@ void serviceListen(struct net_service *service, char *bind_addr, char *bind_port
 
     service->listener_count = n;
     service->listener_fds = fds;
+
+    if (!(service->listener_sources = calloc(n, sizeof(*service->listener_sources)))) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+
+    for (int i = 0; i < n; ++i) {
+        struct net_event_source *source = &service->listener_sources[i];
+        source->type = NET_SOURCE_LISTENER;
+        source->fd = fds[i];
+        source->service = service;
+        source->client = NULL;
+        if (!netWatch(source, true))
+            service->listeners_polled = 1;
+    }
 }
 
 struct net_service *makeBeastInputService(void)
@@ -291,6 +832,11 @@ void modesInitNet(void) {
 
     s = makeBeastInputService();
     serviceListen(s, Modes.net_bind_address, Modes.net_input_beast_ports);
+
+    s = serviceInit("HTTP server", NULL, NULL, READ_MODE_ASCII, "\r\n\r\n", handleHTTPRequest);
+    serviceListen(s, Modes.net_bind_address, Modes.net_http_ports);
+    if (s->listener_count > 0)
+        httpInit(s);
 }
 //
 //=========================================================================
@@ -304,6 +850,8 @@ static struct client * modesAcceptClients(void) {
 
     for (s = Modes.services; s; s = s->next) {
         int i;
+        if (!s->listeners_polled)
+            continue; // handled by the event loop
         for (i = 0; i < s->listener_count; ++i) {
             while ((fd = anetTcpAccept(Modes.aneterr, s->listener_fds[i])) >= 0) {
                 createSocketClient(s, fd);
@@ -313,6 +861,76 @@ static struct client * modesAcceptClients(void) {
 
     return Modes.clients;
 }
+
+//
+//=========================================================================
+//
+// Per-client output queues
+//
+// Output for a service is collected in the shared writer buffer and then
+// written directly to each client. If a client's socket won't take all
+// of it, the remainder is queued for that client as a reference to a
+// shared, refcounted copy of the buffer, and sent later when the socket
+// becomes writable. A client whose backlog exceeds Modes.net_queue_limit
+// is disconnected.
+//
+
+// Statistics gathered by the network side, handed to the main thread by
+// netPublishStats / modesNetCollectStats
+static struct {
+    pthread_mutex_t mutex;
+    unsigned backlog_clients;        // gauge
+    uint64_t backlog_bytes;          // gauge
+    uint64_t backlog_peak;           // max since last collected
+    unsigned backlog_disconnects;    // count since last collected
+    unsigned backlog_alloc_failures; // count since last collected
+    struct timespec cpu;             // network thread CPU time since last collected
+} net_shared_stats = { .mutex = PTHREAD_MUTEX_INITIALIZER };
+
+// network side only, published at the end of each pass
+static uint64_t net_backlog_peak;
+static unsigned net_backlog_disconnects;
+static unsigned net_backlog_alloc_failures;
+
+static void releaseChunk(struct net_chunk *chunk)
+{
+    if (--chunk->refcount == 0)
+        free(chunk);
+}
+
+static void clearClientQueue(struct client *c)
+{
+    struct net_queued_write *q, *next;
+
+    for (q = c->sendq; q; q = next) {
+        next = q->next;
+        releaseChunk(q->chunk);
+        free(q);
+    }
+
+    c->sendq = NULL;
+    c->sendq_tail = &c->sendq;
+    c->sendq_bytes = 0;
+}
+
+// Write a batch of buffers to a client socket with one system call; returns
+// bytes written, 0 if the socket would block, or -1 on error
+static ssize_t clientWritev(struct client *c, const struct iovec *iov, int iovcnt)
+{
+#ifndef _WIN32
+    ssize_t nwritten = writev(c->fd, iov, iovcnt);
+    if (nwritten < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        return 0;
+#else
+    // no writev; send the first buffer, and the caller will queue the rest
+    MODES_NOTUSED(iovcnt);
+    ssize_t nwritten = send(c->fd, iov[0].iov_base, iov[0].iov_len, 0 );
+    if (nwritten < 0 && WSAGetLastError() == WSAEWOULDBLOCK)
+        return 0;
+#endif
+    return nwritten;
+}
+
 //
 //=========================================================================
 //
@@ -329,8 +947,18 @@ static void modesCloseClient(struct client *c) {
     // client (unpredictably: reading from client A may cause client B to
     // be freed)
 
+    // io_uring may have operations in flight for this socket that hold
+    // their own reference to it; shutting it down makes them complete
+    // now, and the client is freed once they all have (netPruneClients)
+#ifdef NET_HAVE_URING
+    if (c->uring)
+        shutdown(c->fd, SHUT_RDWR);
+#endif
     close(c->fd);
     c->service->connections--;
+    // a send in flight still points into the queue; it is cleared when the send completes
+    if (!c->uring_sending)
+        clearClientQueue(c);
 
     // mark it as inactive and ready to be freed
     c->fd = -1;
@@ -339,67 +967,312 @@ static void modesCloseClient(struct client *c) {
 
     autoset_modeac();
 }
-//
-//=========================================================================
-//
-// Send the write buffer for the specified writer to all connected clients
-//
-static void flushWrites(struct net_writer *writer) {
-    struct client *c;
 
-    for (c = Modes.clients; c; c = c->next) {
-        if (!c->service)
-            continue;
-        if (c->service == writer->service) {
-#ifndef _WIN32
-            int nwritten = write(c->fd, writer->data, writer->dataUsed);
-#else
-            int nwritten = send(c->fd, writer->data, writer->dataUsed, 0 );
-#endif
-            if (nwritten != writer->dataUsed) {
-                modesCloseClient(c);
-            }
-        }
+static size_t clientQueueLimit(void)
+{
+    return Modes.net_queue_limit > 0 ? (size_t) Modes.net_queue_limit : MODES_NET_QUEUE_LIMIT;
+}
+
+// Queue (part of) a chunk for a client. Returns false (after closing the
+// client) if the client is already over its backlog limit, or if the
+// queue entry can't be allocated.
+static bool queueClientWrite(struct client *c, struct net_chunk *chunk, int offset)
+{
+    struct net_queued_write *q;
+    size_t limit = clientQueueLimit();
+
+    // the limit is checked before adding the write, so that one HTTP
+    // response bigger than the limit can still be queued in full
+    if (c->sendq_bytes > limit) {
+        net_backlog_disconnects++;
+        modesCloseClient(c);
+        return false;
     }
 
-    writer->dataUsed = 0;
-    writer->lastWrite = mstime();
-}
+    if (!(q = malloc(sizeof(*q)))) {
+        net_backlog_alloc_failures++;
+        modesCloseClient(c);
+        return false;
+    }
 
-// Prepare to write up to 'len' bytes to the given net_writer.
-// Returns a pointer to write to, or NULL to skip this write.
-static void *prepareWrite(struct net_writer *writer, int len) {
-    if (!writer ||
-        !writer->service ||
-        !writer->service->connections ||
-        !writer->data)
-        return NULL;
+    q->next = NULL;
+    q->chunk = chunk;
+    q->offset = offset;
+    ++chunk->refcount;
 
-    if (len > MODES_OUT_BUF_SIZE)
-        return NULL;
+    bool was_empty = (c->sendq == NULL);
+    *c->sendq_tail = q;
+    c->sendq_tail = &q->next;
+    c->sendq_bytes += chunk->len - offset;
 
-    if (writer->dataUsed + len >= MODES_OUT_BUF_SIZE) {
-        // Flush now to free some space
-        flushWrites(writer);
+    if (c->sendq_bytes > net_backlog_peak)
+        net_backlog_peak = c->sendq_bytes;
+    if (was_empty)
+        netUpdateClientEvents(c);
+
+    return true;
+}
+
+// Drop 'nwritten' bytes that have been sent from the head of a client's output queue
+static void retireClientQueue(struct client *c, size_t nwritten)
+{
+    struct net_queued_write *q;
+
+    c->sendq_bytes -= nwritten;
+    while ((q = c->sendq) && nwritten >= (size_t) (q->chunk->len - q->offset)) {
+        nwritten -= q->chunk->len - q->offset;
+        c->sendq = q->next;
+        releaseChunk(q->chunk);
+        free(q);
     }
 
-    return writer->data + writer->dataUsed;
+    if (q)
+        q->offset += nwritten;
+    else
+        c->sendq_tail = &c->sendq;
 }
 
-// Complete a write previously begun by prepareWrite.
-// endptr should point one byte past the last byte written
-// to the buffer returned from prepareWrite.
-static void completeWrite(struct net_writer *writer, void *endptr) {
-    writer->dataUsed = endptr - writer->data;
+// Send as much of a client's queued output as the socket will take.
+// Returns false if the client was closed.
+static bool drainClientQueue(struct client *c)
+{
+    while (c->sendq) {
+        struct iovec iov[NET_IOV_BATCH];
+        struct net_queued_write *q;
+        int n = 0;
+        size_t total = 0;
+
+        for (q = c->sendq; q && n < NET_IOV_BATCH; q = q->next, ++n) {
+            iov[n].iov_base = q->chunk->data + q->offset;
+            iov[n].iov_len = q->chunk->len - q->offset;
+            total += iov[n].iov_len;
+        }
 
-    if (writer->dataUsed >= Modes.net_output_flush_size) {
-        flushWrites(writer);
+        ssize_t nwritten = clientWritev(c, iov, n);
+        if (nwritten < 0) {
+            modesCloseClient(c);
+            return false;
+        }
+
+        retireClientQueue(c, nwritten);
+        if ((size_t) nwritten < total)
+            return true; // socket is full, wait for it to drain
     }
+
+    if (c->close_when_sent) {
+        modesCloseClient(c);
+        return false;
+    }
+
+    netUpdateClientEvents(c);
+    return true;
 }
 
-//
-//=========================================================================
-//
+// Copy some output into a new chunk, holding one reference
+static struct net_chunk *makeChunk(const void *data, int len)
+{
+    struct net_chunk *chunk = malloc(sizeof(*chunk) + len);
+    if (!chunk)
+        return NULL;
+
+    chunk->refcount = 1;
+    chunk->len = len;
+    memcpy(chunk->data, data, len);
+    return chunk;
+}
+
+//
+// Send a batch of output chunks to the clients of their services, with one
+// writev() per client covering every chunk that client should get. Whatever
+// a socket won't take is queued for the client as references to the chunks.
+//
+static void sendToClients(const struct net_output *outs, unsigned count)
+{
+    struct client *c;
+    struct iovec iov[NET_IOV_BATCH];
+    struct net_chunk *chunks[NET_IOV_BATCH];
+
+    assert(count <= NET_IOV_BATCH);
+
+    for (c = Modes.clients; c; c = c->next) {
+        unsigned i, n = 0;
+
+        if (!c->service)
+            continue;
+
+        for (i = 0; i < count; ++i) {
+            if (outs[i].service == c->service && outs[i].chunk->len) {
+                chunks[n] = outs[i].chunk;
+                iov[n].iov_base = chunks[n]->data;
+                iov[n].iov_len = chunks[n]->len;
+                ++n;
+            }
+        }
+
+        if (!n)
+            continue;
+
+        size_t sent = 0;
+        if (!c->sendq && !c->uring) {
+            // nothing backlogged, try to send it straight away
+            ssize_t nwritten = clientWritev(c, iov, n);
+            if (nwritten < 0) {
+                modesCloseClient(c);
+                continue;
+            }
+            sent = nwritten;
+        }
+
+        // queue whatever the socket didn't take
+        for (i = 0; i < n; ++i) {
+            if (sent >= (size_t) chunks[i]->len) {
+                sent -= chunks[i]->len;
+                continue;
+            }
+
+            if (!queueClientWrite(c, chunks[i], sent))
+                break; // client was closed
+            sent = 0;
+        }
+    }
+}
+
+// Network thread: send everything the main thread has queued so far,
+// a batch of chunks at a time
+static void sendQueuedOutput(void)
+{
+    struct net_output outs[NET_IOV_BATCH];
+    unsigned count;
+    int slot;
+
+    do {
+        for (count = 0; count < NET_IOV_BATCH && (slot = ringPeek(&net_output_ring, NET_OUTPUT_QUEUE_SIZE)) >= 0; ) {
+            struct net_output *out = &net_output_slots[slot];
+            if (out->service)
+                outs[count++] = *out;
+            else
+                httpInstallSnapshot(out);
+            ringConsume(&net_output_ring);
+        }
+
+        if (count) {
+            sendToClients(outs, count);
+            for (unsigned i = 0; i < count; ++i)
+                releaseChunk(outs[i].chunk);
+        }
+    } while (count == NET_IOV_BATCH);
+}
+
+//
+//=========================================================================
+//
+// Send the write buffer for the specified writer to all connected clients
+//
+static void flushWrites(struct net_writer *writer) {
+    if (writer->dataUsed) {
+        struct net_output out = { writer->service, makeChunk(writer->data, writer->dataUsed), 0, 0, NULL, 0 };
+
+        if (!out.chunk) {
+            Modes.stats_current.net_output_dropped++;
+        } else if (net_threaded) {
+            if (!netOutputPush(&out)) {
+                releaseChunk(out.chunk);
+                Modes.stats_current.net_output_dropped++;
+            }
+        } else {
+            sendToClients(&out, 1);
+            releaseChunk(out.chunk);
+        }
+    }
+
+    writer->dataUsed = 0;
+    writer->lastWrite = mstime();
+}
+
+// Network side: make the current backlog and counters available to modesNetCollectStats
+static void netPublishStats(const struct timespec *cpu)
+{
+    unsigned clients = 0;
+    uint64_t bytes = 0;
+
+    for (struct client *c = Modes.clients; c; c = c->next) {
+        if (!c->service || !c->sendq_bytes)
+            continue;
+        ++clients;
+        bytes += c->sendq_bytes;
+    }
+
+    pthread_mutex_lock(&net_shared_stats.mutex);
+    net_shared_stats.backlog_clients = clients;
+    net_shared_stats.backlog_bytes = bytes;
+    if (net_backlog_peak > net_shared_stats.backlog_peak)
+        net_shared_stats.backlog_peak = net_backlog_peak;
+    net_shared_stats.backlog_disconnects += net_backlog_disconnects;
+    net_shared_stats.backlog_alloc_failures += net_backlog_alloc_failures;
+    if (cpu)
+        add_timespecs(&net_shared_stats.cpu, cpu, &net_shared_stats.cpu);
+    pthread_mutex_unlock(&net_shared_stats.mutex);
+
+    net_backlog_peak = 0;
+    net_backlog_disconnects = 0;
+    net_backlog_alloc_failures = 0;
+}
+
+// Main thread: add the network side's statistics to 'st'. The network
+// thread's CPU time is counted as background CPU.
+void modesNetCollectStats(struct stats *st)
+{
+    pthread_mutex_lock(&net_shared_stats.mutex);
+    st->net_backlog_clients = net_shared_stats.backlog_clients;
+    st->net_backlog_bytes = net_shared_stats.backlog_bytes;
+    if (net_shared_stats.backlog_peak > st->net_backlog_peak)
+        st->net_backlog_peak = net_shared_stats.backlog_peak;
+    st->net_backlog_disconnects += net_shared_stats.backlog_disconnects;
+    st->net_backlog_alloc_failures += net_shared_stats.backlog_alloc_failures;
+    add_timespecs(&st->background_cpu, &net_shared_stats.cpu, &st->background_cpu);
+
+    net_shared_stats.backlog_peak = 0;
+    net_shared_stats.backlog_disconnects = 0;
+    net_shared_stats.backlog_alloc_failures = 0;
+    net_shared_stats.cpu.tv_sec = 0;
+    net_shared_stats.cpu.tv_nsec = 0;
+    pthread_mutex_unlock(&net_shared_stats.mutex);
+}
+
+// Prepare to write up to 'len' bytes to the given net_writer.
+// Returns a pointer to write to, or NULL to skip this write.
+static void *prepareWrite(struct net_writer *writer, int len) {
+    if (!writer ||
+        !writer->service ||
+        !writer->service->connections ||
+        !writer->data)
+        return NULL;
+
+    if (len > writer->size)
+        return NULL;
+
+    if (writer->dataUsed + len > writer->size) {
+        // Flush now to free some space
+        flushWrites(writer);
+    }
+
+    return writer->data + writer->dataUsed;
+}
+
+// Complete a write previously begun by prepareWrite.
+// endptr should point one byte past the last byte written
+// to the buffer returned from prepareWrite.
+static void completeWrite(struct net_writer *writer, void *endptr) {
+    writer->dataUsed = endptr - writer->data;
+
+    if (writer->dataUsed >= Modes.net_output_flush_size) {
+        flushWrites(writer);
+    }
+}
+
+//
+//=========================================================================
+//
 // Write raw output in Beast Binary format with Timestamp to TCP clients
 //
 static void modesSendBeastVerbatimOutput(struct modesMessage *mm) {
@@ -1076,17 +1949,19 @@ static void handle_radarcape_position(float lat, float lon, float alt)
 // recompute global Mode A/C setting
 static void autoset_modeac() {
     struct client *c;
+    struct net_input in = { .type = NET_INPUT_MODEAC, .mode_ac = 0 };
 
     if (!Modes.mode_ac_auto)
         return;
 
-    Modes.mode_ac = 0;
     for (c = Modes.clients; c; c = c->next) {
         if (c->modeac_requested) {
-            Modes.mode_ac = 1;
+            in.mode_ac = 1;
             break;
         }
     }
+
+    submitRemoteInput(&in);
 }
 
 // Send some Beast settings commands to a client
@@ -1118,21 +1993,23 @@ static void moveNetClient(struct client *c, struct net_service *new_service)
     if (c->service == new_service)
         return;
 
+    // Flush to ensure correct message framing. (The network thread can't
+    // touch the writers, but doesn't need to: everything the main thread
+    // hands over is whole messages.)
     if (c->service) {
-        // Flush to ensure correct message framing
-        if (c->service->writer)
+        if (c->service->writer && !net_threaded)
             flushWrites(c->service->writer);
         --c->service->connections;
     }
 
     if (new_service) {
-        // Flush to ensure correct message framing
-        if (new_service->writer)
+        if (new_service->writer && !net_threaded)
             flushWrites(new_service->writer);
         ++new_service->connections;
     }
 
     c->service = new_service;
+    netUpdateClientEvents(c);
 }
 
 static int handleFaupCommand(struct client *c, char *p) {
@@ -1243,14 +2120,12 @@ static int decodeBinMessage(struct client *c, char *p) {
     int  j;
     char ch;
     unsigned char msg[MODES_LONG_MSG_BYTES + 7];
-    static struct modesMessage zeroMessage;
-    struct modesMessage mm;
+    struct net_input in;
     MODES_NOTUSED(c);
-    memset(&mm, 0, sizeof(mm));
 
     ch = *p++; /// Get the message type
 
-    if (ch == '1' && Modes.mode_ac) {
+    if (ch == '1') {
         msgLen = MODEAC_MSG_BYTES;
     } else if (ch == '2') {
         msgLen = MODES_SHORT_MSG_BYTES;
@@ -1269,62 +2144,91 @@ static int decodeBinMessage(struct client *c, char *p) {
         lon = ieee754_binary32_le_to_float(msg + 8);
         alt = ieee754_binary32_le_to_float(msg + 12);
 
-        handle_radarcape_position(lat, lon, alt);
+        memset(&in, 0, sizeof(in));
+        in.type = NET_INPUT_POSITION;
+        in.lat = lat;
+        in.lon = lon;
+        in.alt = alt;
+        submitRemoteInput(&in);
     } else {
         // Ignore this.
         return 0;
     }
 
     if (msgLen) {
-        mm = zeroMessage;
-
-        // Mark messages received over the internet as remote so that we don't try to
-        // pass them off as being received by this instance when forwarding them
-        mm.remote      =    1;
+        memset(&in, 0, sizeof(in));
+        in.type = NET_INPUT_MESSAGE;
+        in.msgLen = msgLen;
 
         // Grab the timestamp (big endian format)
-        mm.timestampMsg = 0;
         for (j = 0; j < 6; j++) {
             ch = *p++;
-            mm.timestampMsg = mm.timestampMsg << 8 | (ch & 255);
+            in.timestampMsg = in.timestampMsg << 8 | (ch & 255);
             if (0x1A == ch) {p++;}
         }
 
         // record reception time as the time we read it.
-        mm.sysTimestampMsg = mstime();
+        in.sysTimestampMsg = mstime();
 
         ch = *p++;  // Grab the signal level
-        mm.signalLevel = ((unsigned char)ch / 255.0);
-        mm.signalLevel = mm.signalLevel * mm.signalLevel;
+        in.signalLevel = ((unsigned char)ch / 255.0);
+        in.signalLevel = in.signalLevel * in.signalLevel;
         if (0x1A == ch) {p++;}
 
         for (j = 0; j < msgLen; j++) { // and the data
-            msg[j] = ch = *p++;
+            in.msg[j] = ch = *p++;
             if (0x1A == ch) {p++;}
         }
 
-        if (msgLen == MODEAC_MSG_BYTES) { // ModeA or ModeC
-            Modes.stats_current.remote_received_modeac++;
-            decodeModeAMessage(&mm, ((msg[0] << 8) | msg[1]));
+        submitRemoteInput(&in);
+    }
+    return (0);
+}
+
+//
+//=========================================================================
+//
+// Decode a message received over the network (framed by decodeBinMessage
+// or decodeHexMessage) and pass it to the higher level layers.
+// Runs on the main thread.
+//
+static void useRemoteMessage(struct net_input *in)
+{
+    static struct modesMessage zeroMessage;
+    struct modesMessage mm;
+
+    if (in->msgLen == MODEAC_MSG_BYTES && !Modes.mode_ac)
+        return; // Mode A/C not enabled
+
+    mm = zeroMessage;
+
+    // Mark messages received over the internet as remote so that we don't try to
+    // pass them off as being received by this instance when forwarding them
+    mm.remote = 1;
+    mm.timestampMsg = in->timestampMsg;
+    mm.sysTimestampMsg = in->sysTimestampMsg;
+    mm.signalLevel = in->signalLevel;
+
+    if (in->msgLen == MODEAC_MSG_BYTES) { // ModeA or ModeC
+        Modes.stats_current.remote_received_modeac++;
+        decodeModeAMessage(&mm, ((in->msg[0] << 8) | in->msg[1]));
+    } else {
+        int result;
+
+        Modes.stats_current.remote_received_modes++;
+        result = decodeModesMessage(&mm, in->msg);
+        if (result < 0) {
+            if (result == -1)
+                Modes.stats_current.remote_rejected_unknown_icao++;
+            else
+                Modes.stats_current.remote_rejected_bad++;
+            return;
         } else {
-            int result;
-
-            Modes.stats_current.remote_received_modes++;
-            result = decodeModesMessage(&mm, msg);
-            if (result < 0) {
-                if (result == -1)
-                    Modes.stats_current.remote_rejected_unknown_icao++;
-                else
-                    Modes.stats_current.remote_rejected_bad++;
-                return 0;
-            } else {
-                Modes.stats_current.remote_accepted[mm.correctedbits]++;
-            }
+            Modes.stats_current.remote_accepted[mm.correctedbits]++;
         }
-
-        useModesMessage(&mm);
     }
-    return (0);
+
+    useModesMessage(&mm);
 }
 //
 //=========================================================================
@@ -1384,17 +2288,11 @@ static bool signalFromHex(const char *hex, double *signal)
 //
 static int decodeHexMessage(struct client *c, char *hex) {
     int l = strlen(hex), j;
-    unsigned char msg[MODES_LONG_MSG_BYTES];
-    struct modesMessage mm;
-    static struct modesMessage zeroMessage;
+    struct net_input in;
 
     MODES_NOTUSED(c);
-    mm = zeroMessage;
-
-    // Mark messages received over the internet as remote so that we don't try to
-    // pass them off as being received by this instance when forwarding them
-    mm.remote      =    1;
-    mm.signalLevel =    0;
+    memset(&in, 0, sizeof(in));
+    in.type = NET_INPUT_MESSAGE;
 
     // Remove spaces on the left and on the right
     while(l && isspace(hex[l-1])) {
@@ -1418,9 +2316,9 @@ static int decodeHexMessage(struct client *c, char *hex) {
             // [l-1]     ';'
             if (l < 18)
                 return 0; // truncated
-            if (!timestampFromHex(hex + 1, &mm.timestampMsg))
+            if (!timestampFromHex(hex + 1, &in.timestampMsg))
                 return 0; // malformed timestamp
-            if (!signalFromHex(hex + 13, &mm.signalLevel))
+            if (!signalFromHex(hex + 13, &in.signalLevel))
                 return 0; // malformed signal level
             hex += 15;
             l -= 16;
@@ -1434,7 +2332,7 @@ static int decodeHexMessage(struct client *c, char *hex) {
             // [l-1]     ';'
             if (l < 16)
                 return 0; // truncated
-            if (!timestampFromHex(hex + 1, &mm.timestampMsg))
+            if (!timestampFromHex(hex + 1, &in.timestampMsg))
                 return 0; // malformed timestamp
             hex += 13;
             l -= 14;
@@ -1460,41 +2358,20 @@ static int decodeHexMessage(struct client *c, char *hex) {
       && (l != (MODES_LONG_MSG_BYTES  * 2)) )
         {return (0);} // Too short or long message... broken
 
-    if ( (0 == Modes.mode_ac)
-      && (l == (MODEAC_MSG_BYTES * 2)) )
-        {return (0);} // Right length for ModeA/C, but not enabled
-
     for (j = 0; j < l; j += 2) {
         int high = hexDigitVal(hex[j]);
         int low  = hexDigitVal(hex[j+1]);
 
         if (high == -1 || low == -1) return 0;
-        msg[j/2] = (high << 4) | low;
+        in.msg[j/2] = (high << 4) | low;
     }
+    in.msgLen = l / 2;
 
     // record reception time as the time we read it.
-    mm.sysTimestampMsg = mstime();
+    in.sysTimestampMsg = mstime();
 
-    if (l == (MODEAC_MSG_BYTES * 2)) {  // ModeA or ModeC
-        Modes.stats_current.remote_received_modeac++;
-        decodeModeAMessage(&mm, ((msg[0] << 8) | msg[1]));
-    } else {       // Assume ModeS
-        int result;
-
-        Modes.stats_current.remote_received_modes++;
-        result = decodeModesMessage(&mm, msg);
-        if (result < 0) {
-            if (result == -1)
-                Modes.stats_current.remote_rejected_unknown_icao++;
-            else
-                Modes.stats_current.remote_rejected_bad++;
-            return 0;
-        } else {
-            Modes.stats_current.remote_accepted[mm.correctedbits]++;
-        }
-    }
-
-    useModesMessage(&mm);
+    // Mode A/C is dropped later if it's not enabled
+    submitRemoteInput(&in);
     return (0);
 }
 
@@ -1541,71 +2418,70 @@ static const char *jsonEscapeString(const char *str) {
     return buf;
 }
 
-static char *append_flags(char *p, char *end, struct aircraft *a, datasource_t source)
+static void jsonFlags(struct json_writer *w, struct aircraft *a, datasource_t source)
 {
-    p = safe_snprintf(p, end, "[");
+    jsonChar(w, '[');
 
-    char *start = p;
+    size_t start = w->len;
     if (a->callsign_valid.source == source)
-        p = safe_snprintf(p, end, "\"callsign\",");
+        jsonLiteral(w, "\"callsign\",");
     if (a->altitude_baro_valid.source == source)
-        p = safe_snprintf(p, end, "\"altitude\",");
+        jsonLiteral(w, "\"altitude\",");
     if (a->altitude_geom_valid.source == source)
-        p = safe_snprintf(p, end, "\"alt_geom\",");
+        jsonLiteral(w, "\"alt_geom\",");
     if (a->gs_valid.source == source)
-        p = safe_snprintf(p, end, "\"gs\",");
+        jsonLiteral(w, "\"gs\",");
     if (a->ias_valid.source == source)
-        p = safe_snprintf(p, end, "\"ias\",");
+        jsonLiteral(w, "\"ias\",");
     if (a->tas_valid.source == source)
-        p = safe_snprintf(p, end, "\"tas\",");
+        jsonLiteral(w, "\"tas\",");
     if (a->mach_valid.source == source)
-        p = safe_snprintf(p, end, "\"mach\",");
+        jsonLiteral(w, "\"mach\",");
     if (a->track_valid.source == source)
-        p = safe_snprintf(p, end, "\"track\",");
+        jsonLiteral(w, "\"track\",");
     if (a->track_rate_valid.source == source)
-        p = safe_snprintf(p, end, "\"track_rate\",");
+        jsonLiteral(w, "\"track_rate\",");
     if (a->roll_valid.source == source)
-        p = safe_snprintf(p, end, "\"roll\",");
+        jsonLiteral(w, "\"roll\",");
     if (a->mag_heading_valid.source == source)
-        p = safe_snprintf(p, end, "\"mag_heading\",");
+        jsonLiteral(w, "\"mag_heading\",");
     if (a->true_heading_valid.source == source)
-        p = safe_snprintf(p, end, "\"true_heading\",");
+        jsonLiteral(w, "\"true_heading\",");
     if (a->baro_rate_valid.source == source)
-        p = safe_snprintf(p, end, "\"baro_rate\",");
+        jsonLiteral(w, "\"baro_rate\",");
     if (a->geom_rate_valid.source == source)
-        p = safe_snprintf(p, end, "\"geom_rate\",");
+        jsonLiteral(w, "\"geom_rate\",");
     if (a->squawk_valid.source == source)
-        p = safe_snprintf(p, end, "\"squawk\",");
+        jsonLiteral(w, "\"squawk\",");
     if (a->emergency_valid.source == source)
-        p = safe_snprintf(p, end, "\"emergency\",");
+        jsonLiteral(w, "\"emergency\",");
     if (a->nav_qnh_valid.source == source)
-        p = safe_snprintf(p, end, "\"nav_qnh\",");
+        jsonLiteral(w, "\"nav_qnh\",");
     if (a->nav_altitude_mcp_valid.source == source)
-        p = safe_snprintf(p, end, "\"nav_altitude_mcp\",");
+        jsonLiteral(w, "\"nav_altitude_mcp\",");
     if (a->nav_altitude_fms_valid.source == source)
-        p = safe_snprintf(p, end, "\"nav_altitude_fms\",");
+        jsonLiteral(w, "\"nav_altitude_fms\",");
     if (a->nav_heading_valid.source == source)
-        p = safe_snprintf(p, end, "\"nav_heading\",");
+        jsonLiteral(w, "\"nav_heading\",");
     if (a->nav_modes_valid.source == source)
-        p = safe_snprintf(p, end, "\"nav_modes\",");
+        jsonLiteral(w, "\"nav_modes\",");
     if (a->position_valid.source == source)
-        p = safe_snprintf(p, end, "\"lat\",\"lon\",\"nic\",\"rc\",");
+        jsonLiteral(w, "\"lat\",\"lon\",\"nic\",\"rc\",");
     if (a->nic_baro_valid.source == source)
-        p = safe_snprintf(p, end, "\"nic_baro\",");
+        jsonLiteral(w, "\"nic_baro\",");
     if (a->nac_p_valid.source == source)
-        p = safe_snprintf(p, end, "\"nac_p\",");
+        jsonLiteral(w, "\"nac_p\",");
     if (a->nac_v_valid.source == source)
-        p = safe_snprintf(p, end, "\"nac_v\",");
+        jsonLiteral(w, "\"nac_v\",");
     if (a->sil_valid.source == source)
-        p = safe_snprintf(p, end, "\"sil\",\"sil_type\",");
+        jsonLiteral(w, "\"sil\",\"sil_type\",");
     if (a->gva_valid.source == source)
-        p = safe_snprintf(p, end, "\"gva\",");
+        jsonLiteral(w, "\"gva\",");
     if (a->sda_valid.source == source)
-        p = safe_snprintf(p, end, "\"sda\",");
-    if (p != start)
-        --p;
-    p = safe_snprintf(p, end, "]");
-    return p;
+        jsonLiteral(w, "\"sda\",");
+    if (w->len != start && !w->failed)
+        --w->len; // drop the trailing comma
+    jsonChar(w, ']');
 }
 
 static struct {
@@ -1729,24 +2605,152 @@ static const char *hazard_enum_string(hazard_t hazard)
     }
 }
 
+// Append one aircraft's entry in aircraft.json
+static void appendAircraftJson(struct json_writer *w, struct aircraft *a, uint64_t now)
+{
+    jsonLiteral(w, "\n    {\"hex\":\"");
+    if (a->addr & MODES_NON_ICAO_ADDRESS)
+        jsonChar(w, '~');
+    jsonHex(w, a->addr & 0xFFFFFF, 6, false);
+    jsonChar(w, '"');
+    if (a->addrtype != ADDR_ADSB_ICAO)
+        jsonKeyString(w, ",\"type\":", addrtype_enum_string(a->addrtype));
+    if (trackDataValid(&a->callsign_valid))
+        jsonKeyString(w, ",\"flight\":", a->callsign);
+    if (trackDataValid(&a->airground_valid) && a->airground_valid.source >= SOURCE_MODE_S_CHECKED && a->airground == AG_GROUND)
+        jsonLiteral(w, ",\"alt_baro\":\"ground\"");
+    else {
+        if (trackDataValid(&a->altitude_baro_valid))
+            jsonKeyInt(w, ",\"alt_baro\":", a->altitude_baro);
+        if (trackDataValid(&a->altitude_geom_valid))
+            jsonKeyInt(w, ",\"alt_geom\":", a->altitude_geom);
+    }
+    if (trackDataValid(&a->gs_valid))
+        jsonKeyFixed(w, ",\"gs\":", a->gs, 1);
+    if (trackDataValid(&a->ias_valid))
+        jsonKeyUint(w, ",\"ias\":", a->ias);
+    if (trackDataValid(&a->tas_valid))
+        jsonKeyUint(w, ",\"tas\":", a->tas);
+    if (trackDataValid(&a->mach_valid))
+        jsonKeyFixed(w, ",\"mach\":", a->mach, 3);
+    if (trackDataValid(&a->track_valid))
+        jsonKeyFixed(w, ",\"track\":", a->track, 1);
+    if (trackDataValid(&a->track_rate_valid))
+        jsonKeyFixed(w, ",\"track_rate\":", a->track_rate, 2);
+    if (trackDataValid(&a->roll_valid))
+        jsonKeyFixed(w, ",\"roll\":", a->roll, 1);
+    if (trackDataValid(&a->mag_heading_valid))
+        jsonKeyFixed(w, ",\"mag_heading\":", a->mag_heading, 1);
+    if (trackDataValid(&a->true_heading_valid))
+        jsonKeyFixed(w, ",\"true_heading\":", a->true_heading, 1);
+    if (trackDataValid(&a->baro_rate_valid))
+        jsonKeyInt(w, ",\"baro_rate\":", a->baro_rate);
+    if (trackDataValid(&a->geom_rate_valid))
+        jsonKeyInt(w, ",\"geom_rate\":", a->geom_rate);
+    if (trackDataValid(&a->squawk_valid)) {
+        jsonLiteral(w, ",\"squawk\":\"");
+        jsonHex(w, a->squawk, 4, false);
+        jsonChar(w, '"');
+    }
+    if (trackDataValid(&a->emergency_valid))
+        jsonKeyString(w, ",\"emergency\":", emergency_enum_string(a->emergency));
+    if (a->category != 0) {
+        jsonLiteral(w, ",\"category\":\"");
+        jsonHex(w, a->category, 2, true);
+        jsonChar(w, '"');
+    }
+    if (trackDataValid(&a->nav_qnh_valid))
+        jsonKeyFixed(w, ",\"nav_qnh\":", a->nav_qnh, 1);
+    if (trackDataValid(&a->nav_altitude_mcp_valid))
+        jsonKeyInt(w, ",\"nav_altitude_mcp\":", a->nav_altitude_mcp);
+    if (trackDataValid(&a->nav_altitude_fms_valid))
+        jsonKeyInt(w, ",\"nav_altitude_fms\":", a->nav_altitude_fms);
+    if (trackDataValid(&a->nav_heading_valid))
+        jsonKeyFixed(w, ",\"nav_heading\":", a->nav_heading, 1);
+    if (trackDataValid(&a->nav_modes_valid)) {
+        bool first = true;
+        jsonLiteral(w, ",\"nav_modes\":[");
+        for (int i = 0; nav_modes_names[i].name; ++i) {
+            if (a->nav_modes & nav_modes_names[i].flag) {
+                if (!first)
+                    jsonChar(w, ',');
+                jsonString(w, nav_modes_names[i].name);
+                first = false;
+            }
+        }
+        jsonChar(w, ']');
+    }
+    if (trackDataValid(&a->position_valid)) {
+        jsonKeyFixed(w, ",\"lat\":", a->lat, 6);
+        jsonKeyFixed(w, ",\"lon\":", a->lon, 6);
+        jsonKeyUint(w, ",\"nic\":", a->pos_nic);
+        jsonKeyUint(w, ",\"rc\":", a->pos_rc);
+        jsonKeyFixed(w, ",\"seen_pos\":", (now - a->position_valid.updated) / 1000.0, 1);
+    }
+    if (a->adsb_version >= 0)
+        jsonKeyInt(w, ",\"version\":", a->adsb_version);
+    if (trackDataValid(&a->nic_baro_valid))
+        jsonKeyUint(w, ",\"nic_baro\":", a->nic_baro);
+    if (trackDataValid(&a->nac_p_valid))
+        jsonKeyUint(w, ",\"nac_p\":", a->nac_p);
+    if (trackDataValid(&a->nac_v_valid))
+        jsonKeyUint(w, ",\"nac_v\":", a->nac_v);
+    if (trackDataValid(&a->sil_valid))
+        jsonKeyUint(w, ",\"sil\":", a->sil);
+    if (a->sil_type != SIL_INVALID)
+        jsonKeyString(w, ",\"sil_type\":", sil_type_enum_string(a->sil_type));
+    if (trackDataValid(&a->gva_valid))
+        jsonKeyUint(w, ",\"gva\":", a->gva);
+    if (trackDataValid(&a->sda_valid))
+        jsonKeyUint(w, ",\"sda\":", a->sda);
+    if (trackDataValid(&a->mrar_source_valid))
+        jsonKeyString(w, ",\"mrar_source\":", mrar_source_enum_string(a->mrar_source));
+    if (trackDataValid(&a->wind_valid)) {
+        jsonKeyFixed(w, ",\"wind_speed\":", a->wind_speed, 0);
+        jsonKeyFixed(w, ",\"wind_dir\":", a->wind_dir, 1);
+    }
+    if (trackDataValid(&a->temperature_valid))
+        jsonKeyFixed(w, ",\"temperature\":", a->temperature, 2);
+    if (trackDataValid(&a->pressure_valid))
+        jsonKeyFixed(w, ",\"pressure\":", a->pressure, 0);
+    if (trackDataValid(&a->turbulence_valid))
+        jsonKeyString(w, ",\"turbulence\":", hazard_enum_string(a->turbulence));
+    if (trackDataValid(&a->humidity_valid))
+        jsonKeyFixed(w, ",\"humidity\":", a->humidity, 1);
+    if (a->modeA_hit)
+        jsonLiteral(w, ",\"modea\":true");
+    if (a->modeC_hit)
+        jsonLiteral(w, ",\"modec\":true");
+
+    jsonLiteral(w, ",\"mlat\":");
+    jsonFlags(w, a, SOURCE_MLAT);
+    jsonLiteral(w, ",\"tisb\":");
+    jsonFlags(w, a, SOURCE_TISB);
+
+    double signal = (a->signalLevel[0] + a->signalLevel[1] + a->signalLevel[2] + a->signalLevel[3] +
+                     a->signalLevel[4] + a->signalLevel[5] + a->signalLevel[6] + a->signalLevel[7] + 1e-5) / 8;
+    jsonKeyInt(w, ",\"messages\":", a->messages);
+    jsonKeyFixed(w, ",\"seen\":", (now - a->seen) / 1000.0, 1);
+    jsonKeyFixed(w, ",\"rssi\":", 10 * log10(signal), 1);
+    jsonChar(w, '}');
+}
+
 char *generateAircraftJson(const char *url_path, int *len) {
+    static size_t size_hint = 32768;
     uint64_t now = mstime();
     struct aircraft *a;
-    int buflen = 32768; // The initial buffer is resized as needed
-    char *buf = (char *) malloc(buflen), *p = buf, *end = buf+buflen;
-    char *line_start;
+    struct json_writer w;
     int first = 1;
 
     MODES_NOTUSED(url_path);
 
     _messageNow = now;
 
-    p = safe_snprintf(p, end,
-                       "{ \"now\" : %.1f,\n"
-                       "  \"messages\" : %u,\n"
-                       "  \"aircraft\" : [",
-                       now / 1000.0,
-                       Modes.stats_current.messages_total + Modes.stats_alltime.messages_total);
+    jsonInit(&w, &size_hint);
+    jsonKeyFixed(&w, "{ \"now\" : ", now / 1000.0, 1);
+    jsonKeyUint(&w, ",\n  \"seq\" : ", Modes.json_aircraft_seq);
+    jsonKeyUint(&w, ",\n  \"messages\" : ", Modes.stats_current.messages_total + Modes.stats_alltime.messages_total);
+    jsonLiteral(&w, ",\n  \"aircraft\" : [");
 
     for (a = Modes.aircrafts; a; a = a->next) {
         if (!a->reliable) {
@@ -1756,321 +2760,367 @@ char *generateAircraftJson(const char *url_path, int *len) {
         if (first)
             first = 0;
         else
-            *p++ = ',';
+            jsonChar(&w, ',');
 
-    retry:
-        line_start = p;
-        p = safe_snprintf(p, end, "\n    {\"hex\":\"%s%06x\"", (a->addr & MODES_NON_ICAO_ADDRESS) ? "~" : "", a->addr & 0xFFFFFF);
-        if (a->addrtype != ADDR_ADSB_ICAO)
-            p = safe_snprintf(p, end, ",\"type\":\"%s\"", addrtype_enum_string(a->addrtype));
-        if (trackDataValid(&a->callsign_valid))
-            p = safe_snprintf(p, end, ",\"flight\":\"%s\"", jsonEscapeString(a->callsign));
-        if (trackDataValid(&a->airground_valid) && a->airground_valid.source >= SOURCE_MODE_S_CHECKED && a->airground == AG_GROUND)
-            p = safe_snprintf(p, end, ",\"alt_baro\":\"ground\"");
-        else {
-            if (trackDataValid(&a->altitude_baro_valid))
-                p = safe_snprintf(p, end, ",\"alt_baro\":%d", a->altitude_baro);
-            if (trackDataValid(&a->altitude_geom_valid))
-                p = safe_snprintf(p, end, ",\"alt_geom\":%d", a->altitude_geom);
-        }
-        if (trackDataValid(&a->gs_valid))
-            p = safe_snprintf(p, end, ",\"gs\":%.1f", a->gs);
-        if (trackDataValid(&a->ias_valid))
-            p = safe_snprintf(p, end, ",\"ias\":%u", a->ias);
-        if (trackDataValid(&a->tas_valid))
-            p = safe_snprintf(p, end, ",\"tas\":%u", a->tas);
-        if (trackDataValid(&a->mach_valid))
-            p = safe_snprintf(p, end, ",\"mach\":%.3f", a->mach);
-        if (trackDataValid(&a->track_valid))
-            p = safe_snprintf(p, end, ",\"track\":%.1f", a->track);
-        if (trackDataValid(&a->track_rate_valid))
-            p = safe_snprintf(p, end, ",\"track_rate\":%.2f", a->track_rate);
-        if (trackDataValid(&a->roll_valid))
-            p = safe_snprintf(p, end, ",\"roll\":%.1f", a->roll);
-        if (trackDataValid(&a->mag_heading_valid))
-            p = safe_snprintf(p, end, ",\"mag_heading\":%.1f", a->mag_heading);
-        if (trackDataValid(&a->true_heading_valid))
-            p = safe_snprintf(p, end, ",\"true_heading\":%.1f", a->true_heading);
-        if (trackDataValid(&a->baro_rate_valid))
-            p = safe_snprintf(p, end, ",\"baro_rate\":%d", a->baro_rate);
-        if (trackDataValid(&a->geom_rate_valid))
-            p = safe_snprintf(p, end, ",\"geom_rate\":%d", a->geom_rate);
-        if (trackDataValid(&a->squawk_valid))
-            p = safe_snprintf(p, end, ",\"squawk\":\"%04x\"", a->squawk);
-        if (trackDataValid(&a->emergency_valid))
-            p = safe_snprintf(p, end, ",\"emergency\":\"%s\"", emergency_enum_string(a->emergency));
-        if (a->category != 0)
-            p = safe_snprintf(p, end, ",\"category\":\"%02X\"", a->category);
-        if (trackDataValid(&a->nav_qnh_valid))
-            p = safe_snprintf(p, end, ",\"nav_qnh\":%.1f", a->nav_qnh);
-         if (trackDataValid(&a->nav_altitude_mcp_valid))
-            p = safe_snprintf(p, end, ",\"nav_altitude_mcp\":%d", a->nav_altitude_mcp);
-         if (trackDataValid(&a->nav_altitude_fms_valid))
-            p = safe_snprintf(p, end, ",\"nav_altitude_fms\":%d", a->nav_altitude_fms);
-        if (trackDataValid(&a->nav_heading_valid))
-            p = safe_snprintf(p, end, ",\"nav_heading\":%.1f", a->nav_heading);
-        if (trackDataValid(&a->nav_modes_valid)) {
-            p = safe_snprintf(p, end, ",\"nav_modes\":[");
-            p = append_nav_modes(p, end, a->nav_modes, "\"", ",");
-            p = safe_snprintf(p, end, "]");
-        }
-        if (trackDataValid(&a->position_valid))
-            p = safe_snprintf(p, end, ",\"lat\":%f,\"lon\":%f,\"nic\":%u,\"rc\":%u,\"seen_pos\":%.1f", a->lat, a->lon, a->pos_nic, a->pos_rc, (now - a->position_valid.updated)/1000.0);
-        if (a->adsb_version >= 0)
-            p = safe_snprintf(p, end, ",\"version\":%d", a->adsb_version);
-        if (trackDataValid(&a->nic_baro_valid))
-            p = safe_snprintf(p, end, ",\"nic_baro\":%u", (unsigned) a->nic_baro);
-        if (trackDataValid(&a->nac_p_valid))
-            p = safe_snprintf(p, end, ",\"nac_p\":%u", a->nac_p);
-        if (trackDataValid(&a->nac_v_valid))
-            p = safe_snprintf(p, end, ",\"nac_v\":%u", a->nac_v);
-        if (trackDataValid(&a->sil_valid))
-            p = safe_snprintf(p, end, ",\"sil\":%u", a->sil);
-        if (a->sil_type != SIL_INVALID)
-            p = safe_snprintf(p, end, ",\"sil_type\":\"%s\"", sil_type_enum_string(a->sil_type));
-        if (trackDataValid(&a->gva_valid))
-            p = safe_snprintf(p, end, ",\"gva\":%u", a->gva);
-        if (trackDataValid(&a->sda_valid))
-            p = safe_snprintf(p, end, ",\"sda\":%u", a->sda);
-        if (trackDataValid(&a->mrar_source_valid))
-            p = safe_snprintf(p, end, ",\"mrar_source\":\"%s\"", mrar_source_enum_string(a->mrar_source));
-        if (trackDataValid(&a->wind_valid))
-            p = safe_snprintf(p, end, ",\"wind_speed\":%.0f,\"wind_dir\":%.1f", a->wind_speed, a->wind_dir);
-        if (trackDataValid(&a->temperature_valid))
-            p = safe_snprintf(p, end, ",\"temperature\":%.2f", a->temperature);
-        if (trackDataValid(&a->pressure_valid))
-            p = safe_snprintf(p, end, ",\"pressure\":%.0f", a->pressure);
-        if (trackDataValid(&a->turbulence_valid))
-            p = safe_snprintf(p, end, ",\"turbulence\":\"%s\"", hazard_enum_string(a->turbulence));
-        if (trackDataValid(&a->humidity_valid))
-            p = safe_snprintf(p, end, ",\"humidity\":%.1f", a->humidity);
-        if (a->modeA_hit)
-            p = safe_snprintf(p, end, ",\"modea\":true");
-        if (a->modeC_hit)
-            p = safe_snprintf(p, end, ",\"modec\":true");
-
-        p = safe_snprintf(p, end, ",\"mlat\":");
-        p = append_flags(p, end, a, SOURCE_MLAT);
-        p = safe_snprintf(p, end, ",\"tisb\":");
-        p = append_flags(p, end, a, SOURCE_TISB);
-
-        p = safe_snprintf(p, end, ",\"messages\":%ld,\"seen\":%.1f,\"rssi\":%.1f}",
-                      a->messages, (now - a->seen)/1000.0,
-                      10 * log10((a->signalLevel[0] + a->signalLevel[1] + a->signalLevel[2] + a->signalLevel[3] +
-                                  a->signalLevel[4] + a->signalLevel[5] + a->signalLevel[6] + a->signalLevel[7] + 1e-5) / 8));
-
-        if ((p + 10) >= end) { // +10 to leave some space for the final line
-            // overran the buffer
-            int used = line_start - buf;
-            buflen *= 2;
-            buf = (char *) realloc(buf, buflen);
-            p = buf+used;
-            end = buf + buflen;
-            goto retry;
-        }
-    }
-
-    p = safe_snprintf(p, end, "\n  ]\n}\n");
-    *len = p-buf;
-    return buf;
+        appendAircraftJson(&w, a, now);
+    }
+
+    jsonLiteral(&w, "\n  ]\n}\n");
+    return jsonFinish(&w, len);
+}
+
+//
+// Every member that appendAircraftJson can write. An aircraft delta reports
+// a member only if its output differs from what the last delta reported for
+// that aircraft, which is remembered as a hash per member in
+// aircraft->json_emitted (indexed as this table).
+//
+// The first AIRCRAFT_JSON_ALWAYS members are reported whenever the aircraft
+// is: "hex" identifies the aircraft, and "seen" / "seen_pos" are ages
+// relative to "now", so an unchanged age is still news.
+//
+#define AIRCRAFT_JSON_ALWAYS 3
+static const char *const aircraft_json_members[TRACK_JSON_MEMBERS] = {
+    "hex", "seen", "seen_pos",
+    "type", "flight", "alt_baro", "alt_geom", "gs", "ias", "tas", "mach",
+    "track", "track_rate", "roll", "mag_heading", "true_heading", "baro_rate",
+    "geom_rate", "squawk", "emergency", "category", "nav_qnh", "nav_altitude_mcp",
+    "nav_altitude_fms", "nav_heading", "nav_modes", "lat", "lon", "nic", "rc",
+    "version", "nic_baro", "nac_p", "nac_v", "sil", "sil_type", "gva",
+    "sda", "mrar_source", "wind_speed", "wind_dir", "temperature", "pressure",
+    "turbulence", "humidity", "modea", "modec", "mlat", "tisb", "messages",
+    "rssi"
+};
+
+static int aircraftJsonMemberIndex(const char *key, size_t len)
+{
+    for (int i = 0; i < TRACK_JSON_MEMBERS && aircraft_json_members[i]; ++i) {
+        if (!strncmp(aircraft_json_members[i], key, len) && !aircraft_json_members[i][len])
+            return i;
+    }
+    return -1;
+}
+
+// Return the end of the JSON member or value starting at p: the ',' or
+// closing bracket that follows it at the same nesting level, or 'end'
+static const char *jsonMemberEnd(const char *p, const char *end)
+{
+    unsigned depth = 0;
+    bool in_string = false;
+
+    for (; p < end; ++p) {
+        if (in_string) {
+            if (*p == '\\')
+                ++p;
+            else if (*p == '"')
+                in_string = false;
+        } else if (*p == '"') {
+            in_string = true;
+        } else if (*p == '[' || *p == '{') {
+            ++depth;
+        } else if (*p == ']' || *p == '}') {
+            if (!depth)
+                return p;
+            --depth;
+        } else if (*p == ',' && !depth) {
+            return p;
+        }
+    }
+
+    return end;
+}
+
+// 64-bit FNV-1a
+static uint64_t aircraftJsonHash(const char *p, size_t len)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < len; ++i) {
+        hash ^= (unsigned char) p[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash ? hash : 1; // 0 means "not reported"
+}
+
+// Append the members of aircraft 'a' that changed since the last delta to
+// 'w', as one object: the members whose output differs, and null for those
+// that are no longer present. 'scratch' is used to build the full entry.
+static void appendAircraftDeltaJson(struct json_writer *w, struct json_writer *scratch, struct aircraft *a, uint64_t now)
+{
+    scratch->len = 0;
+    appendAircraftJson(scratch, a, now);
+    if (scratch->failed) {
+        w->failed = true;
+        return;
+    }
+
+    const char *p = memchr(scratch->buf, '{', scratch->len);
+    const char *end = scratch->buf + scratch->len;
+    uint64_t present = 0;
+    bool first = true;
+
+    jsonLiteral(w, "\n    {");
+    for (++p; p < end && *p != '}'; ) {
+        const char *member = p;
+        p = jsonMemberEnd(p, end);
+
+        const char *key = member + 1;
+        const char *key_end = memchr(key, '"', p - key);
+        int index = key_end ? aircraftJsonMemberIndex(key, key_end - key) : -1;
+        uint64_t hash = aircraftJsonHash(member, p - member);
+
+        // members not in the table are always reported
+        if (index < AIRCRAFT_JSON_ALWAYS || a->json_emitted[index] != hash) {
+            if (!first)
+                jsonChar(w, ',');
+            jsonAppend(w, member, p - member);
+            first = false;
+        }
+        if (index >= 0) {
+            a->json_emitted[index] = hash;
+            present |= UINT64_C(1) << index;
+        }
+
+        if (p < end && *p == ',')
+            ++p;
+    }
+
+    for (int i = 0; i < TRACK_JSON_MEMBERS; ++i) {
+        if (a->json_emitted[i] && !(present & (UINT64_C(1) << i))) {
+            jsonLiteral(w, ",\"");
+            jsonAppend(w, aircraft_json_members[i], strlen(aircraft_json_members[i]));
+            jsonLiteral(w, "\":null");
+            a->json_emitted[i] = 0;
+        }
+    }
+    jsonChar(w, '}');
+}
+
+//
+// Generate the next aircraft delta: the members that changed since the
+// previous delta of each aircraft whose state changed (see trackNoteChanged
+// and appendAircraftDeltaJson), and the addresses of aircraft that were
+// removed. Each call advances the sequence number, so only call
+// this when the result will be published.
+//
+char *generateAircraftDeltaJson(const char *url_path, int *len) {
+    static size_t size_hint = 8192;
+    uint64_t now = mstime();
+    uint64_t seq = ++Modes.json_aircraft_seq;
+    struct aircraft *a;
+    struct json_writer w;
+    int first = 1;
+    static size_t scratch_size_hint = 1024;
+    struct json_writer scratch;
+    const uint32_t *removed;
+    unsigned removed_count;
+    bool removed_overflow;
+
+    MODES_NOTUSED(url_path);
+
+    _messageNow = now;
+
+    removed = trackRemovedAircraft(&removed_count, &removed_overflow);
+
+    jsonInit(&w, &size_hint);
+    jsonInit(&scratch, &scratch_size_hint);
+    jsonKeyFixed(&w, "{ \"now\" : ", now / 1000.0, 1);
+    jsonKeyUint(&w, ",\n  \"seq\" : ", seq);
+    jsonKeyUint(&w, ",\n  \"messages\" : ", Modes.stats_current.messages_total + Modes.stats_alltime.messages_total);
+    jsonLiteral(&w, ",\n");
+    if (removed_overflow)
+        jsonLiteral(&w, "  \"reset\" : true,\n");
+    jsonLiteral(&w, "  \"aircraft\" : [");
+
+    for (a = Modes.aircrafts; a; a = a->next) {
+        if (!a->reliable || a->changed_seq < seq) {
+            continue;
+        }
+
+        if (first)
+            first = 0;
+        else
+            jsonChar(&w, ',');
+
+        appendAircraftDeltaJson(&w, &scratch, a, now);
+    }
+
+    int scratch_len;
+    free(jsonFinish(&scratch, &scratch_len));
+
+    jsonLiteral(&w, "\n  ],\n  \"removed\" : [");
+    for (unsigned i = 0; i < removed_count; ++i) {
+        if (i)
+            jsonChar(&w, ',');
+        jsonChar(&w, '"');
+        if (removed[i] & MODES_NON_ICAO_ADDRESS)
+            jsonChar(&w, '~');
+        jsonHex(&w, removed[i] & 0xFFFFFF, 6, false);
+        jsonChar(&w, '"');
+    }
+    jsonLiteral(&w, "]\n}\n");
+    trackClearRemoved();
+
+    return jsonFinish(&w, len);
 }
 
-static char * appendStatsJson(char *p,
-                              char *end,
-                              struct stats *st,
-                              const char *key)
+static void appendStatsJson(struct json_writer *w,
+                            struct stats *st,
+                            const char *key)
 {
     int i;
 
-    p = safe_snprintf(p, end,
-                       "\"%s\":{\"start\":%.1f,\"end\":%.1f",
-                       key,
-                       st->start / 1000.0,
-                       st->end / 1000.0);
+    jsonChar(w, '"');
+    jsonAppend(w, key, strlen(key));
+    jsonKeyFixed(w, "\":{\"start\":", st->start / 1000.0, 1);
+    jsonKeyFixed(w, ",\"end\":", st->end / 1000.0, 1);
 
     if (!Modes.net_only) {
-        p = safe_snprintf(p, end,
-                           ",\"local\":{\"samples_processed\":%llu"
-                           ",\"samples_dropped\":%llu"
-                           ",\"modeac\":%u"
-                           ",\"modes\":%u"
-                           ",\"bad\":%u"
-                           ",\"unknown_icao\":%u",
-                           (unsigned long long)st->samples_processed,
-                           (unsigned long long)st->samples_dropped,
-                           st->demod_modeac,
-                           st->demod_preambles,
-                           st->demod_rejected_bad,
-                           st->demod_rejected_unknown_icao);
-
+        jsonKeyUint(w, ",\"local\":{\"samples_processed\":", st->samples_processed);
+        jsonKeyUint(w, ",\"samples_dropped\":", st->samples_dropped);
+        jsonKeyUint(w, ",\"modeac\":", st->demod_modeac);
+        jsonKeyUint(w, ",\"modes\":", st->demod_preambles);
+        jsonKeyUint(w, ",\"bad\":", st->demod_rejected_bad);
+        jsonKeyUint(w, ",\"unknown_icao\":", st->demod_rejected_unknown_icao);
+
+        jsonLiteral(w, ",\"accepted\":[");
         for (i=0; i <= Modes.nfix_crc; ++i) {
-            if (i == 0) p = safe_snprintf(p, end, ",\"accepted\":[%u", st->demod_accepted[i]);
-            else p = safe_snprintf(p, end, ",%u", st->demod_accepted[i]);
+            if (i)
+                jsonChar(w, ',');
+            jsonUint(w, st->demod_accepted[i]);
         }
-
-        p = safe_snprintf(p, end, "]");
+        jsonChar(w, ']');
 
         if (st->signal_power_sum > 0 && st->signal_power_count > 0)
-            p = safe_snprintf(p, end, ",\"signal\":%.1f", 10 * log10(st->signal_power_sum / st->signal_power_count));
+            jsonKeyFixed(w, ",\"signal\":", 10 * log10(st->signal_power_sum / st->signal_power_count), 1);
         if (st->noise_power_sum > 0 && st->noise_power_count > 0)
-            p = safe_snprintf(p, end, ",\"noise\":%.1f", 10 * log10(st->noise_power_sum / st->noise_power_count));
+            jsonKeyFixed(w, ",\"noise\":", 10 * log10(st->noise_power_sum / st->noise_power_count), 1);
         if (st->peak_signal_power > 0)
-            p = safe_snprintf(p, end, ",\"peak_signal\":%.1f", 10 * log10(st->peak_signal_power));
+            jsonKeyFixed(w, ",\"peak_signal\":", 10 * log10(st->peak_signal_power), 1);
 
-        p = safe_snprintf(p, end, ",\"strong_signals\":%u", st->strong_signal_count);
+        jsonKeyUint(w, ",\"strong_signals\":", st->strong_signal_count);
         if (st->sdr_gain >= 0)
-            p = safe_snprintf(p, end, ",\"gain_db\":%.1f", sdrGetGainDb(st->sdr_gain));
-        p = safe_snprintf(p, end, "}");
+            jsonKeyFixed(w, ",\"gain_db\":", sdrGetGainDb(st->sdr_gain), 1);
+        if (st->sdr_callbacks) {
+            jsonKeyUint(w, ",\"callbacks\":", st->sdr_callbacks);
+            jsonKeyFixed(w, ",\"callback_mean_us\":", (double) st->sdr_callback_us / st->sdr_callbacks, 0);
+            jsonKeyUint(w, ",\"callback_max_us\":", st->sdr_callback_max_us);
+        }
+        jsonChar(w, '}');
     }
 
     if (Modes.net) {
-        p = safe_snprintf(p, end,
-                           ",\"remote\":{\"modeac\":%u"
-                           ",\"modes\":%u"
-                           ",\"bad\":%u"
-                           ",\"unknown_icao\":%u",
-                           st->remote_received_modeac,
-                           st->remote_received_modes,
-                           st->remote_rejected_bad,
-                           st->remote_rejected_unknown_icao);
+        jsonKeyUint(w, ",\"remote\":{\"modeac\":", st->remote_received_modeac);
+        jsonKeyUint(w, ",\"modes\":", st->remote_received_modes);
+        jsonKeyUint(w, ",\"bad\":", st->remote_rejected_bad);
+        jsonKeyUint(w, ",\"unknown_icao\":", st->remote_rejected_unknown_icao);
 
+        jsonLiteral(w, ",\"accepted\":[");
         for (i=0; i <= Modes.nfix_crc; ++i) {
-            if (i == 0) p = safe_snprintf(p, end, ",\"accepted\":[%u", st->remote_accepted[i]);
-            else p = safe_snprintf(p, end, ",%u", st->remote_accepted[i]);
+            if (i)
+                jsonChar(w, ',');
+            jsonUint(w, st->remote_accepted[i]);
         }
-
-        p = safe_snprintf(p, end, "]}");
+        jsonLiteral(w, "]}");
     }
 
     uint64_t demod_cpu_millis = (uint64_t)st->demod_cpu.tv_sec*1000UL + st->demod_cpu.tv_nsec/1000000UL;
     uint64_t reader_cpu_millis = (uint64_t)st->reader_cpu.tv_sec*1000UL + st->reader_cpu.tv_nsec/1000000UL;
     uint64_t background_cpu_millis = (uint64_t)st->background_cpu.tv_sec*1000UL + st->background_cpu.tv_nsec/1000000UL;
 
-    p = safe_snprintf(p, end,
-                      ",\"cpr\":{\"surface\":%u"
-                      ",\"airborne\":%u"
-                      ",\"global_ok\":%u"
-                      ",\"global_bad\":%u"
-                      ",\"global_range\":%u"
-                      ",\"global_speed\":%u"
-                      ",\"global_skipped\":%u"
-                      ",\"local_ok\":%u"
-                      ",\"local_aircraft_relative\":%u"
-                      ",\"local_receiver_relative\":%u"
-                      ",\"local_skipped\":%u"
-                      ",\"local_range\":%u"
-                      ",\"local_speed\":%u"
-                      ",\"filtered\":%u}"
-                      ",\"altitude_suppressed\":%u"
-                      ",\"cpu\":{\"demod\":%llu,\"reader\":%llu,\"background\":%llu}"
-                      ",\"tracks\":{\"all\":%u"
-                      ",\"single_message\":%u"
-                      ",\"unreliable\":%u}"
-                      ",\"messages\":%u",
-                      st->cpr_surface,
-                      st->cpr_airborne,
-                      st->cpr_global_ok,
-                      st->cpr_global_bad,
-                      st->cpr_global_range_checks,
-                      st->cpr_global_speed_checks,
-                      st->cpr_global_skipped,
-                      st->cpr_local_ok,
-                      st->cpr_local_aircraft_relative,
-                      st->cpr_local_receiver_relative,
-                      st->cpr_local_skipped,
-                      st->cpr_local_range_checks,
-                      st->cpr_local_speed_checks,
-                      st->cpr_filtered,
-                      st->suppressed_altitude_messages,
-                      (unsigned long long)demod_cpu_millis,
-                      (unsigned long long)reader_cpu_millis,
-                      (unsigned long long)background_cpu_millis,
-                      st->unique_aircraft,
-                      st->single_message_aircraft,
-                      st->unreliable_aircraft,
-                      st->messages_total);
-
+    jsonKeyUint(w, ",\"cpr\":{\"surface\":", st->cpr_surface);
+    jsonKeyUint(w, ",\"airborne\":", st->cpr_airborne);
+    jsonKeyUint(w, ",\"global_ok\":", st->cpr_global_ok);
+    jsonKeyUint(w, ",\"global_bad\":", st->cpr_global_bad);
+    jsonKeyUint(w, ",\"global_range\":", st->cpr_global_range_checks);
+    jsonKeyUint(w, ",\"global_speed\":", st->cpr_global_speed_checks);
+    jsonKeyUint(w, ",\"global_skipped\":", st->cpr_global_skipped);
+    jsonKeyUint(w, ",\"local_ok\":", st->cpr_local_ok);
+    jsonKeyUint(w, ",\"local_aircraft_relative\":", st->cpr_local_aircraft_relative);
+    jsonKeyUint(w, ",\"local_receiver_relative\":", st->cpr_local_receiver_relative);
+    jsonKeyUint(w, ",\"local_skipped\":", st->cpr_local_skipped);
+    jsonKeyUint(w, ",\"local_range\":", st->cpr_local_range_checks);
+    jsonKeyUint(w, ",\"local_speed\":", st->cpr_local_speed_checks);
+    jsonKeyUint(w, ",\"filtered\":", st->cpr_filtered);
+    jsonKeyUint(w, "},\"altitude_suppressed\":", st->suppressed_altitude_messages);
+    jsonKeyUint(w, ",\"cpu\":{\"demod\":", demod_cpu_millis);
+    jsonKeyUint(w, ",\"reader\":", reader_cpu_millis);
+    jsonKeyUint(w, ",\"background\":", background_cpu_millis);
+    jsonKeyUint(w, "},\"tracks\":{\"all\":", st->unique_aircraft);
+    jsonKeyUint(w, ",\"single_message\":", st->single_message_aircraft);
+    jsonKeyUint(w, ",\"unreliable\":", st->unreliable_aircraft);
+    jsonKeyUint(w, ",\"lookups\":", st->aircraft_lookups);
+    jsonKeyUint(w, ",\"lookup_probes\":", st->aircraft_lookup_probes);
+    jsonKeyUint(w, ",\"lookup_max_probes\":", st->aircraft_lookup_max_probes);
+    jsonKeyUint(w, ",\"pool_used\":", st->aircraft_pool_used);
+    jsonKeyUint(w, ",\"pool_slots\":", st->aircraft_pool_slots);
+    jsonKeyUint(w, "},\"icao_filter\":{\"hits\":", st->icao_filter_hits);
+    jsonKeyUint(w, ",\"misses\":", st->icao_filter_misses);
+    jsonKeyUint(w, ",\"probes\":", st->icao_filter_probes);
+    jsonKeyUint(w, ",\"max_probes\":", st->icao_filter_max_probes);
+    jsonKeyUint(w, "},\"net_backlog\":{\"clients\":", st->net_backlog_clients);
+    jsonKeyUint(w, ",\"bytes\":", st->net_backlog_bytes);
+    jsonKeyUint(w, ",\"peak_bytes\":", st->net_backlog_peak);
+    jsonKeyUint(w, ",\"disconnects\":", st->net_backlog_disconnects);
+    jsonKeyUint(w, ",\"alloc_failures\":", st->net_backlog_alloc_failures);
+    jsonKeyUint(w, ",\"dropped\":", st->net_output_dropped);
+    jsonKeyUint(w, "},\"messages\":", st->messages_total);
+
+    jsonLiteral(w, ",\"messages_by_df\":[");
     for (i = 0; i < 32; ++i) {
-        if (i == 0)
-            p = safe_snprintf(p, end, ",\"messages_by_df\":[%u", st->messages_by_df[i]);
-        else
-            p = safe_snprintf(p, end, ",%u", st->messages_by_df[i]);
+        if (i)
+            jsonChar(w, ',');
+        jsonUint(w, st->messages_by_df[i]);
     }
-    p = safe_snprintf(p, end, "]");
+    jsonChar(w, ']');
 
     if (st->adaptive_valid) {
-        p = safe_snprintf(p, end,
-                          ",\"adaptive\":"
-                          "{\"gain_db\":%.1f"
-                          ",\"dynamic_range_limit_db\":%.1f"
-                          ",\"gain_changes\":%u"
-                          ",\"loud_undecoded\":%u"
-                          ",\"loud_decoded\":%u"
-                          ",\"noise_dbfs\":%.1f"
-                          ",\"gain_seconds\":[",
-                          sdrGetGainDb(st->sdr_gain),
-                          sdrGetGainDb(st->adaptive_range_gain_limit),
-                          st->adaptive_gain_changes,
-                          st->adaptive_loud_undecoded,
-                          st->adaptive_loud_decoded,
-                          st->adaptive_noise_dbfs);
+        jsonKeyFixed(w, ",\"adaptive\":{\"gain_db\":", sdrGetGainDb(st->sdr_gain), 1);
+        jsonKeyFixed(w, ",\"dynamic_range_limit_db\":", sdrGetGainDb(st->adaptive_range_gain_limit), 1);
+        jsonKeyUint(w, ",\"gain_changes\":", st->adaptive_gain_changes);
+        jsonKeyUint(w, ",\"loud_undecoded\":", st->adaptive_loud_undecoded);
+        jsonKeyUint(w, ",\"loud_decoded\":", st->adaptive_loud_decoded);
+        jsonKeyFixed(w, ",\"noise_dbfs\":", st->adaptive_noise_dbfs, 1);
+        jsonLiteral(w, ",\"gain_seconds\":[");
         bool first = true;
         for (unsigned i = 0; i < STATS_GAIN_COUNT; ++i) {
             if (st->adaptive_gain_seconds[i] > 0) {
-                p = safe_snprintf(p, end, "%s[%.1f,%u]",
-                                  first ? "" : ",",
-                                  sdrGetGainDb(i), st->adaptive_gain_seconds[i]);
+                if (!first)
+                    jsonChar(w, ',');
+                jsonKeyFixed(w, "[", sdrGetGainDb(i), 1);
+                jsonKeyUint(w, ",", st->adaptive_gain_seconds[i]);
+                jsonChar(w, ']');
                 first = false;
             }
         }
-        p = safe_snprintf(p, end, "]}");
+        jsonLiteral(w, "]}");
     }
-    p = safe_snprintf(p, end, "}");
-    return p;
+    jsonChar(w, '}');
 }
 
 char *generateStatsJson(const char *url_path, int *len) {
-    MODES_NOTUSED(url_path);
+    static size_t size_hint = 8192;
+    struct json_writer w;
 
-    int buflen = 8192;
-    char *buf, *p, *end;
-
- retry:
-    if (!(buf = malloc(buflen))) {
-        // allocation failed, give up
-        *len = 0;
-        return NULL;
-    }
-
-    p = buf;
-    end = buf + buflen;
-
-    p = safe_snprintf(p, end, "{\n");
-    p = appendStatsJson(p, end, &Modes.stats_latest, "latest");
-    p = safe_snprintf(p, end, ",\n");
+    MODES_NOTUSED(url_path);
 
-    p = appendStatsJson(p, end, &Modes.stats_1min[Modes.stats_newest_1min], "last1min");
-    p = safe_snprintf(p, end, ",\n");
+    jsonInit(&w, &size_hint);
+    jsonLiteral(&w, "{\n");
+    appendStatsJson(&w, &Modes.stats_latest, "latest");
+    jsonLiteral(&w, ",\n");
 
-    p = appendStatsJson(p, end, &Modes.stats_5min, "last5min");
-    p = safe_snprintf(p, end, ",\n");
+    appendStatsJson(&w, &Modes.stats_1min[Modes.stats_newest_1min], "last1min");
+    jsonLiteral(&w, ",\n");
 
-    p = appendStatsJson(p, end, &Modes.stats_15min, "last15min");
-    p = safe_snprintf(p, end, ",\n");
+    appendStatsJson(&w, &Modes.stats_5min, "last5min");
+    jsonLiteral(&w, ",\n");
 
-    p = appendStatsJson(p, end, &Modes.stats_alltime, "total");
-    p = safe_snprintf(p, end, "\n}\n");
+    appendStatsJson(&w, &Modes.stats_15min, "last15min");
+    jsonLiteral(&w, ",\n");
 
-    int used = p - buf;
-    if (p >= end) {
-        // overran the buffer
-        buflen = used + 50;
-        free(buf);
-        goto retry;
-    }
+    appendStatsJson(&w, &Modes.stats_alltime, "total");
+    jsonLiteral(&w, "\n}\n");
 
-    *len = used;
-    return buf;
+    return jsonFinish(&w, len);
 }
 
 //
@@ -2079,21 +3129,14 @@ char *generateStatsJson(const char *url_path, int *len) {
 char *generateReceiverJson(const char *url_path, int *len)
 {
     char *buf = (char *) malloc(1024), *p = buf;
-    int history_size;
 
     MODES_NOTUSED(url_path);
 
-    // work out number of valid history entries
-    if (Modes.json_aircraft_history[HISTORY_SIZE-1].content == NULL)
-        history_size = Modes.json_aircraft_history_next;
-    else
-        history_size = HISTORY_SIZE;
-
     p += sprintf(p, "{ " \
                  "\"version\" : \"%s\", "
                  "\"refresh\" : %.0f, "
-                 "\"history\" : %d",
-                 MODES_DUMP1090_VERSION, 1.0*Modes.json_interval, history_size);
+                 "\"history\" : %u",
+                 MODES_DUMP1090_VERSION, 1.0*Modes.json_interval, trackHistoryCount());
 
     if (Modes.json_location_accuracy && (Modes.fUserLat != 0.0 || Modes.fUserLon != 0.0)) {
         if (Modes.json_location_accuracy == 1) {
@@ -2115,21 +3158,82 @@ char *generateReceiverJson(const char *url_path, int *len)
     return buf;
 }
 
+// Append one aircraft's entry in a history capture
+static void appendHistoryJson(struct json_writer *w, uint32_t addr, const struct history_entry *h)
+{
+    jsonLiteral(w, "\n      {\"hex\":\"");
+    if (addr & MODES_NON_ICAO_ADDRESS)
+        jsonChar(w, '~');
+    jsonHex(w, addr & 0xFFFFFF, 6, false);
+    jsonChar(w, '"');
+    if (h->addrtype != ADDR_ADSB_ICAO)
+        jsonKeyString(w, ",\"type\":", addrtype_enum_string(h->addrtype));
+    if (h->flags & HISTORY_GROUND)
+        jsonLiteral(w, ",\"alt_baro\":\"ground\"");
+    else if (h->flags & HISTORY_ALT_BARO)
+        jsonKeyInt(w, ",\"alt_baro\":", h->altitude);
+    else if (h->flags & HISTORY_ALT_GEOM)
+        jsonKeyInt(w, ",\"alt_geom\":", h->altitude);
+    if (h->flags & HISTORY_GS)
+        jsonKeyFixed(w, ",\"gs\":", h->gs / 10.0, 1);
+    if (h->flags & HISTORY_TRACK)
+        jsonKeyFixed(w, ",\"track\":", h->track / 10.0, 1);
+    if (h->flags & HISTORY_POSITION) {
+        jsonKeyFixed(w, ",\"lat\":", h->lat / 1e6, 6);
+        jsonKeyFixed(w, ",\"lon\":", h->lon / 1e6, 6);
+        jsonKeyFixed(w, ",\"seen_pos\":", h->seen_pos / 10.0, 1);
+    }
+    if (h->flags & HISTORY_POSITION_MLAT)
+        jsonLiteral(w, ",\"mlat\":[\"lat\",\"lon\"]");
+    jsonKeyFixed(w, ",\"seen\":", h->seen / 10.0, 1);
+    jsonChar(w, '}');
+}
+
+//
+// Render every history capture still held (see trackCaptureHistory) as one
+// document, oldest first. Each capture has the same layout as aircraft.json,
+// with only the fields that history keeps.
+//
 char *generateHistoryJson(const char *url_path, int *len)
 {
-    int history_index = -1;
+    static size_t size_hint = 65536;
+    uint32_t last = Modes.history_captures;
+    uint32_t first = last - trackHistoryCount() + 1;
+    struct json_writer w;
 
-    if (sscanf(url_path, "/data/history_%d.json", &history_index) != 1)
-        return NULL;
+    MODES_NOTUSED(url_path);
 
-    if (history_index < 0 || history_index >= HISTORY_SIZE)
-        return NULL;
+    jsonInit(&w, &size_hint);
+    jsonKeyFixed(&w, "{ \"now\" : ", (last ? Modes.history[last % HISTORY_SIZE].time : mstime()) / 1000.0, 1);
+    jsonLiteral(&w, ",\n  \"history\" : [");
 
-    if (!Modes.json_aircraft_history[history_index].content)
-        return NULL;
+    for (uint32_t capture = first; capture <= last; ++capture) {
+        unsigned slot = capture % HISTORY_SIZE;
+        int first_aircraft = 1;
+
+        if (capture != first)
+            jsonChar(&w, ',');
+        jsonKeyFixed(&w, "\n    { \"now\" : ", Modes.history[slot].time / 1000.0, 1);
+        jsonKeyUint(&w, ", \"messages\" : ", Modes.history[slot].messages);
+        jsonLiteral(&w, ", \"aircraft\" : [");
+
+        for (struct aircraft *a = Modes.aircrafts; a; a = a->next) {
+            if (!a->history || a->history[slot].capture != capture)
+                continue;
+
+            if (first_aircraft)
+                first_aircraft = 0;
+            else
+                jsonChar(&w, ',');
 
-    *len = Modes.json_aircraft_history[history_index].clen;
-    return strdup(Modes.json_aircraft_history[history_index].content);
+            appendHistoryJson(&w, a->addr, &a->history[slot]);
+        }
+
+        jsonLiteral(&w, " ] }");
+    }
+
+    jsonLiteral(&w, "\n  ]\n}\n");
+    return jsonFinish(&w, len);
 }
 
 static void ratelimitWriteError(const char *format, ...)
@@ -2156,19 +3260,14 @@ static void ratelimitWriteError(const char *format, ...)
     va_end(ap);
 }
 
-// Write JSON to file
-void writeJsonToFile(const char *file, char * (*generator) (const char *,int*))
+// Write JSON to a file in the json directory
+static void writeJsonFile(const char *file, const char *content, int len)
 {
 #ifndef _WIN32
     char pathbuf[PATH_MAX];
     char tmppath[PATH_MAX];
     int fd;
-    int len = 0;
     mode_t mask;
-    char *content;
-
-    if (!Modes.json_dir)
-        return;
 
     snprintf(tmppath, PATH_MAX, "%s/%s.XXXXXX", Modes.json_dir, file);
     tmppath[PATH_MAX-1] = 0;
@@ -2182,10 +3281,6 @@ void writeJsonToFile(const char *file, char * (*generator) (const char *,int*))
     umask(mask);
     fchmod(fd, 0644 & ~mask);
 
-    snprintf(pathbuf, PATH_MAX, "/data/%s", file);
-    pathbuf[PATH_MAX-1] = 0;
-    content = generator(pathbuf, &len);
-
     if (write(fd, content, len) != len) {
         ratelimitWriteError("failed to write to %s (while updating %s/%s): %s", tmppath, Modes.json_dir, file, strerror(errno));
         goto error_1;
@@ -2203,687 +3298,2281 @@ void writeJsonToFile(const char *file, char * (*generator) (const char *,int*))
         goto error_2;
     }
 
-    free(content);
     return;
 
  error_1:
     close(fd);
  error_2:
     unlink(tmppath);
-    free(content);
     return;
+#else
+    MODES_NOTUSED(file);
+    MODES_NOTUSED(content);
+    MODES_NOTUSED(len);
 #endif
 }
 
-
 //
-//=========================================================================
+// =============================== HTTP server ===============================
 //
-// This function polls the clients using read() in order to receive new
-// messages from the net.
+// A small HTTP/1.1 server for the web map, so that it can run without a
+// separate web server. It serves two kinds of content:
 //
-// The message is supposed to be separated from the next message by the
-// separator 'sep', which is a null-terminated C string.
+//   /data/<file>  the same JSON that --write-json writes, from in-memory
+//                 snapshots that the main thread publishes with publishJson()
+//   anything else static files from --html-dir, read from disk per request
 //
-// Every full message received is decoded and passed to the higher layers
-// calling the function's 'handler'.
+// Requests are handled entirely on the network thread. Each JSON snapshot
+// is a single net_chunk that every client fetching it shares a reference
+// to, so a response costs one small header plus a writev. Snapshots carry
+// an ETag derived from their content; a client that sends it back in
+// If-None-Match gets a 304 until the content actually changes.
 //
-// The handler returns 0 on success, or 1 to signal this function we should
-// close the connection with the client in case of non-recoverable errors.
+// When nothing else needs the JSON (no --write-json), the main thread only
+// regenerates the frequently-updated snapshots while someone is fetching
+// them (see modesJsonWanted).
 //
-static void modesReadFromClient(struct client *c) {
-    int left;
-    int nread;
-    int bContinue = 1;
 
-    while (bContinue) {
-        left = MODES_CLIENT_BUF_SIZE - c->buflen - 1; // leave 1 extra byte for NUL termination in the ASCII case
+#define HTTP_MAX_SNAPSHOTS 8
+#define HTTP_SNAPSHOT_NAME_LEN 32
+#define HTTP_DEMAND_WINDOW 10000     // ms: keep regenerating a snapshot this long after it was last requested
+#define HTTP_IDLE_REFRESH 10000      // ms: otherwise, refresh it at most this often
+#define HTTP_MAX_FILE_SIZE (16 * 1024 * 1024)
+
+// network side only
+struct http_snapshot {
+    struct net_chunk *body;      // holds one reference, or NULL if not published yet
+    struct net_chunk *gzip_body; // gzip-compressed copy of body, or NULL; holds one reference
+    uint64_t hash;               // content hash, used as the ETag
+    uint64_t seq;                // aircraft delta sequence number when generated
+    unsigned generation;         // http_generation[] when generated
+};
 
-        // If our buffer is full discard it, this is some badly formatted shit
-        if (left <= 0) {
-            c->buflen = 0;
-            left = MODES_CLIENT_BUF_SIZE;
-            // If there is garbage, read more to discard it ASAP
-        }
-#ifndef _WIN32
-        nread = read(c->fd, c->buf+c->buflen, left);
-#else
-        nread = recv(c->fd, c->buf+c->buflen, left, 0);
-        if (nread < 0) {errno = WSAGetLastError();}
-#endif
+static struct net_service *http_service;
+static struct http_snapshot http_snapshots[HTTP_MAX_SNAPSHOTS];
 
-        // If we didn't get all the data we asked for, then return once we've processed what we did get.
-        if (nread != left) {
-            bContinue = 0;
-        }
+// Recent aircraft deltas, by sequence number, for /data/aircraft_delta.json?since=N
+#define HTTP_DELTA_HISTORY 64
+static struct net_chunk *http_deltas[HTTP_DELTA_HISTORY]; // indexed by seq % HTTP_DELTA_HISTORY, one reference each
+static uint64_t http_delta_first;  // oldest delta held; all from here to http_delta_last are present
+static uint64_t http_delta_last;   // newest delta held, or 0 if none
+static int http_aircraft_index = -1;
+static int http_delta_index = -1;
 
-        if (nread == 0) { // End of file
-            modesCloseClient(c);
-            return;
-        }
+// fixed after modesInitNet
+static char http_snapshot_names[HTTP_MAX_SNAPSHOTS][HTTP_SNAPSHOT_NAME_LEN];
+static int http_snapshot_count;
 
-#ifndef _WIN32
-        if (nread < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) // No data available (not really an error)
-#else
-        if (nread < 0 && errno == EWOULDBLOCK) // No data available (not really an error)
-#endif
-        {
-            return;
-        }
+static _Atomic uint64_t http_requested_at[HTTP_MAX_SNAPSHOTS]; // written by the network side
+static uint64_t http_published_at[HTTP_MAX_SNAPSHOTS];         // main thread only
+static atomic_uint http_generation[HTTP_MAX_SNAPSHOTS];        // written by the main thread (modesJsonInvalidate)
+static atomic_bool http_awaited[HTTP_MAX_SNAPSHOTS];           // set by the network side while a request waits for a new generation
 
-        if (nread < 0) { // Other errors
-            modesCloseClient(c);
-            return;
+static void httpAddSnapshot(const char *name)
+{
+    if (http_snapshot_count >= HTTP_MAX_SNAPSHOTS)
+        return;
+
+    snprintf(http_snapshot_names[http_snapshot_count], HTTP_SNAPSHOT_NAME_LEN, "%s", name);
+    ++http_snapshot_count;
+}
+
+static int httpSnapshotIndex(const char *name)
+{
+    for (int i = 0; i < http_snapshot_count; ++i) {
+        if (!strcmp(http_snapshot_names[i], name))
+            return i;
+    }
+    return -1;
+}
+
+// Set up the snapshots that the HTTP server can serve from /data/
+static void httpInit(struct net_service *service)
+{
+    http_service = service;
+    httpAddSnapshot("aircraft.json");
+    httpAddSnapshot("aircraft_delta.json");
+    httpAddSnapshot("stats.json");
+    httpAddSnapshot("receiver.json");
+    httpAddSnapshot("history.json");
+
+    http_aircraft_index = httpSnapshotIndex("aircraft.json");
+    http_delta_index = httpSnapshotIndex("aircraft_delta.json");
+}
+
+// FNV-1a
+static uint64_t httpHash(const char *data, int len)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (int i = 0; i < len; ++i) {
+        hash ^= (unsigned char) data[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+// Network side: remember a new aircraft delta
+static void httpAddDelta(struct net_chunk *chunk, uint64_t seq)
+{
+    if (seq != http_delta_last + 1) {
+        // a delta went missing (or we are just starting); older ones
+        // can't be chained across the gap
+        for (int i = 0; i < HTTP_DELTA_HISTORY; ++i) {
+            if (http_deltas[i]) {
+                releaseChunk(http_deltas[i]);
+                http_deltas[i] = NULL;
+            }
         }
+        http_delta_first = seq;
+    }
 
-        c->buflen += nread;
+    struct net_chunk **slot = &http_deltas[seq % HTTP_DELTA_HISTORY];
+    if (*slot) {
+        releaseChunk(*slot);
+        http_delta_first = seq - HTTP_DELTA_HISTORY + 1;
+    }
 
-        char *som = c->buf;           // first byte of next message
-        char *eod = som + c->buflen;  // one byte past end of data
-        char *p;
+    *slot = chunk;
+    ++chunk->refcount;
+    http_delta_last = seq;
+}
 
-        switch (c->service->read_mode) {
-        case READ_MODE_IGNORE:
-            // drop the bytes on the floor
-            som = eod;
-            break;
+// Network side: replace a snapshot, taking over the reference to its chunk.
+// If the content hasn't changed, the old chunk (and its ETag) is kept.
+static void httpInstallSnapshot(const struct net_output *out)
+{
+    struct net_chunk *chunk = out->chunk;
+    int index = out->snapshot;
 
-        case READ_MODE_BEAST:
-            // This is the Beast Binary scanning case.
-            // If there is a complete message still in the buffer, there must be the separator 'sep'
-            // in the buffer, note that we full-scan the buffer at every read for simplicity.
+    if (index < 0 || index >= http_snapshot_count) {
+        releaseChunk(chunk);
+        if (out->gzip)
+            releaseChunk(out->gzip);
+        return;
+    }
 
-            while (som < eod && ((p = memchr(som, (char) 0x1a, eod - som)) != NULL)) { // The first byte of buffer 'should' be 0x1a
-                som = p; // consume garbage up to the 0x1a
-                ++p; // skip 0x1a
+    if (index == http_delta_index)
+        httpAddDelta(chunk, out->seq);
 
-                if (p >= eod) {
-                    // Incomplete message in buffer, retry later
-                    break;
-                }
+    struct http_snapshot *snap = &http_snapshots[index];
+    uint64_t hash = httpHash(chunk->data, chunk->len);
 
-                char *eom; // one byte past end of message
-                if        (*p == '1') {
-                    eom = p + MODEAC_MSG_BYTES      + 8;         // point past remainder of message
-                } else if (*p == '2') {
-                    eom = p + MODES_SHORT_MSG_BYTES + 8;
-                } else if (*p == '3') {
-                    eom = p + MODES_LONG_MSG_BYTES  + 8;
-                } else if (*p == '4') {
-                    eom = p + MODES_LONG_MSG_BYTES  + 8;
-                } else if (*p == '5') {
-                    eom = p + MODES_LONG_MSG_BYTES  + 8;
-                } else {
-                    // Not a valid beast message, skip 0x1a and try again
-                    ++som;
-                    continue;
-                }
+    snap->generation = out->generation;
+    if (snap->body && snap->hash == hash && snap->body->len == chunk->len) {
+        releaseChunk(chunk);
+        if (out->gzip && !snap->gzip_body)
+            snap->gzip_body = out->gzip;
+        else if (out->gzip)
+            releaseChunk(out->gzip);
+    } else {
+        if (snap->body)
+            releaseChunk(snap->body);
+        if (snap->gzip_body)
+            releaseChunk(snap->gzip_body);
+        snap->body = chunk;
+        snap->gzip_body = out->gzip;
+        snap->hash = hash;
+        snap->seq = out->seq;
+    }
 
-                // we need to be careful of double escape characters in the message body
-                for (p = som + 1; p < eod && p < eom; p++) {
-                    if (0x1A == *p) {
-                        p++;
-                        eom++;
-                    }
-                }
+    httpResumeWaiting();
+}
 
-                if (eom > eod) { // Incomplete message in buffer, retry later
-                    break;
-                }
+//
+// Compressed JSON. When --json-gzip-level is set, every JSON file that is
+// published also gets a gzip-compressed copy, made once here rather than by
+// a web server for every request. Compressing takes CPU time from the main
+// thread, so it is kept within a budget: once per JSON_GZIP_WINDOW, if the
+// time spent compressing went over budget, the level is lowered (and at
+// level 1, compression stops until the next window); if it used less than
+// half the budget, the level is raised back towards the configured one.
+//
 
-                // Have a 0x1a followed by 1/2/3/4/5 - pass message to handler.
-                if (c->service->read_handler(c, som + 1)) {
-                    modesCloseClient(c);
-                    return;
-                }
+#ifdef ENABLE_ZLIB
 
-                // advance to next message
-                som = eom;
-            }
-            break;
+#define JSON_GZIP_WINDOW 10000 // ms
 
-        case READ_MODE_BEAST_COMMAND:
-            while (som < eod && ((p = memchr(som, (char) 0x1a, eod - som)) != NULL)) { // The first byte of buffer 'should' be 0x1a
-                char *eom; // one byte past end of message
+static struct {
+    bool initialized;
+    z_stream stream;
+    int level;                 // current level, no more than Modes.json_gzip_level
+    bool suspended;            // over budget even at level 1
+    uint64_t window_start;     // ms
+    struct timespec used;      // CPU time spent compressing in this window
+} json_gzip;
+
+static void jsonGzipCheckBudget(uint64_t now)
+{
+    if (!json_gzip.window_start) {
+        json_gzip.window_start = now;
+        return;
+    }
 
-                som = p; // consume garbage up to the 0x1a
-                ++p; // skip 0x1a
+    if (now < json_gzip.window_start + JSON_GZIP_WINDOW)
+        return;
 
-                if (p >= eod) {
-                    // Incomplete message in buffer, retry later
-                    break;
-                }
+    double used_ms = json_gzip.used.tv_sec * 1000.0 + json_gzip.used.tv_nsec / 1e6;
+    double budget_ms = (now - json_gzip.window_start) * Modes.json_gzip_budget / 100.0;
 
-                if (*p == '1') {
-                    eom = p + 2;
-                } else {
-                    // Not a valid beast command, skip 0x1a and try again
-                    ++som;
-                    continue;
-                }
+    if (used_ms > budget_ms) {
+        if (json_gzip.level > 1)
+            --json_gzip.level;
+        else
+            json_gzip.suspended = true;
+    } else {
+        json_gzip.suspended = false;
+        if (used_ms < budget_ms / 2 && json_gzip.level < Modes.json_gzip_level)
+            ++json_gzip.level;
+    }
 
-                // we need to be careful of double escape characters in the message body
-                for (p = som + 1; p < eod && p < eom; p++) {
-                    if (0x1A == *p) {
-                        p++;
-                        eom++;
-                    }
-                }
+    json_gzip.window_start = now;
+    json_gzip.used.tv_sec = json_gzip.used.tv_nsec = 0;
+}
 
-                if (eom > eod) { // Incomplete message in buffer, retry later
-                    break;
-                }
+// Compress some JSON, returning a chunk holding one reference, or NULL if
+// compression is disabled (or over budget) or failed
+static struct net_chunk *jsonGzip(const char *content, int len)
+{
+    struct timespec start;
+    struct net_chunk *chunk;
+    int ret;
 
-                // Have a 0x1a followed by 1 - pass message to handler.
-                if (c->service->read_handler(c, som + 1)) {
-                    modesCloseClient(c);
-                    return;
-                }
+    if (Modes.json_gzip_level <= 0)
+        return NULL;
 
-                // advance to next message
-                som = eom;
-            }
-            break;
+    jsonGzipCheckBudget(mstime());
+    if (json_gzip.suspended)
+        return NULL;
 
-        case READ_MODE_ASCII:
-            //
-            // This is the ASCII scanning case, AVR RAW or HTTP at present
-            // If there is a complete message still in the buffer, there must be the separator 'sep'
-            // in the buffer, note that we full-scan the buffer at every read for simplicity.
-
-            // Always NUL-terminate so we are free to use strstr()
-            // nb: we never fill the last byte of the buffer with read data (see above) so this is safe
-            *eod = '\0';
-
-            while (som < eod && (p = strstr(som, c->service->read_sep)) != NULL) { // end of first message if found
-                *p = '\0';                         // The handler expects null terminated strings
-                if (c->service->read_handler(c, som)) {         // Pass message to handler.
-                    modesCloseClient(c);           // Handler returns 1 on error to signal we .
-                    return;                        // should close the client connection
-                }
-                som = p + strlen(c->service->read_sep);               // Move to start of next message
-            }
+    start_cpu_timing(&start);
 
-            break;
+    if (!json_gzip.initialized) {
+        json_gzip.level = Modes.json_gzip_level;
+        // windowBits 15 + 16: gzip framing rather than zlib
+        if (deflateInit2(&json_gzip.stream, json_gzip.level, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            fprintf(stderr, "warning: failed to set up json compression, disabling it\n");
+            Modes.json_gzip_level = 0;
+            return NULL;
         }
+        json_gzip.initialized = true;
+    } else {
+        deflateReset(&json_gzip.stream);
+        deflateParams(&json_gzip.stream, json_gzip.level, Z_DEFAULT_STRATEGY);
+    }
 
-        if (som > c->buf) {                        // We processed something - so
-            c->buflen = eod - som;                 //     Update the unprocessed buffer length
-            memmove(c->buf, som, c->buflen);       //     Move what's remaining to the start of the buffer
-        } else {                                   // If no message was decoded process the next client
-            return;
-        }
+    uLong bound = deflateBound(&json_gzip.stream, len);
+    if (!(chunk = malloc(sizeof(*chunk) + bound))) {
+        end_cpu_timing(&start, &json_gzip.used);
+        return NULL;
     }
-}
 
-__attribute__ ((format (printf,4,5))) static char *appendFATSV(char *p, char *end, const char *field, const char *format, ...)
-{
-    va_list ap;
-    va_start(ap, format);
+    json_gzip.stream.next_in = (Bytef *) content;
+    json_gzip.stream.avail_in = len;
+    json_gzip.stream.next_out = (Bytef *) chunk->data;
+    json_gzip.stream.avail_out = bound;
+    ret = deflate(&json_gzip.stream, Z_FINISH);
 
-    p = safe_snprintf(p, end, "%s\t", field);
-    p = safe_vsnprintf(p, end, format, ap);
-    p = safe_snprintf(p, end, "\t");
+    end_cpu_timing(&start, &json_gzip.used);
 
-    va_end(ap);
-    return p;
+    if (ret != Z_STREAM_END) {
+        free(chunk);
+        return NULL;
+    }
+
+    chunk->refcount = 1;
+    chunk->len = bound - json_gzip.stream.avail_out;
+    return chunk;
 }
 
-#define TSV_MAX_PACKET_SIZE 800
-#define TSV_VERSION "9E"
+#else
 
-static void writeFATSVPositionUpdate(float lat, float lon, float alt)
+static struct net_chunk *jsonGzip(const char *content, int len)
 {
-    static float last_lat, last_lon, last_alt;
+    MODES_NOTUSED(content);
+    MODES_NOTUSED(len);
+    return NULL;
+}
 
-    if (lat == last_lat && lon == last_lon && alt == last_alt)
-        return;
+#endif
 
-    last_lat = lat;
-    last_lon = lon;
-    last_alt = alt;
+// Main thread: generate some JSON and hand it to everything that wants it
+void publishJson(const char *file, char * (*generator) (const char *,int*))
+{
+    char pathbuf[PATH_MAX];
+    char *content;
+    int len = 0;
+    int index = -1;
+    struct net_chunk *gzip;
 
-    char *p = prepareWrite(&Modes.fatsv_out, TSV_MAX_PACKET_SIZE);
-    if (!p)
+    if (http_service)
+        index = httpSnapshotIndex(file);
+
+    if (!Modes.json_dir && index < 0)
         return;
 
-    char *end = p + TSV_MAX_PACKET_SIZE;
+    snprintf(pathbuf, PATH_MAX, "/data/%s", file);
+    pathbuf[PATH_MAX-1] = 0;
+    if (!(content = generator(pathbuf, &len)))
+        return;
 
-    p = appendFATSV(p, end, "_v",     "%s", TSV_VERSION);
-    p = appendFATSV(p, end, "clock",  "%" PRIu64, messageNow() / 1000);
-    p = appendFATSV(p, end, "type",   "%s",       "location_update");
-    p = appendFATSV(p, end, "lat",    "%.5f",     lat);
-    p = appendFATSV(p, end, "lon",    "%.5f",     lon);
-    p = appendFATSV(p, end, "alt",    "%.0f",     alt);
-    p = appendFATSV(p, end, "altref", "%s",       "egm96_meters");
-    --p; // remove last tab
-    p = safe_snprintf(p, end, "\n");
+    gzip = jsonGzip(content, len);
 
-    if (p < end)
-        completeWrite(&Modes.fatsv_out, p);
-    else
-        fprintf(stderr, "fatsv: output too large (max %d, overran by %d)\n", TSV_MAX_PACKET_SIZE, (int) (p - end));
+    if (Modes.json_dir) {
+        char gzfile[128];
+
+        writeJsonFile(file, content, len);
+
+        snprintf(gzfile, sizeof(gzfile), "%s.gz", file);
+        if (gzip) {
+            writeJsonFile(gzfile, gzip->data, gzip->len);
+        } else if (Modes.json_gzip_level > 0) {
+            // don't leave a stale copy behind while compression is suspended
+            snprintf(pathbuf, PATH_MAX, "%s/%s", Modes.json_dir, gzfile);
+            pathbuf[PATH_MAX-1] = 0;
+            unlink(pathbuf);
+        }
+    }
+
+    if (index >= 0) {
+        struct net_output out = { NULL, makeChunk(content, len), index, Modes.json_aircraft_seq, gzip,
+                                  atomic_load(&http_generation[index]) };
+
+        http_published_at[index] = mstime();
+        if (!out.chunk) {
+            Modes.stats_current.net_output_dropped++;
+        } else if (net_threaded) {
+            if (!netOutputPush(&out)) {
+                releaseChunk(out.chunk);
+                Modes.stats_current.net_output_dropped++;
+            } else {
+                gzip = NULL; // the network thread has it now
+            }
+        } else {
+            httpInstallSnapshot(&out);
+            gzip = NULL;
+        }
+    }
+
+    if (gzip)
+        releaseChunk(gzip);
+    free(content);
 }
 
-static void writeFATSVEventMessage(struct modesMessage *mm, const char *datafield, unsigned char *data, size_t len)
+// Main thread: is it worth generating this JSON file now?
+bool modesJsonWanted(const char *file)
 {
-    char *p = prepareWrite(&Modes.fatsv_out, TSV_MAX_PACKET_SIZE);
-    if (!p)
-        return;
+    if (Modes.json_dir)
+        return true;
 
-    char *end = p + TSV_MAX_PACKET_SIZE;
+    int index = http_service ? httpSnapshotIndex(file) : -1;
+    if (index < 0)
+        return false;
 
-    p = appendFATSV(p, end, "_v",    "%s", TSV_VERSION);
-    p = appendFATSV(p, end, "clock", "%" PRIu64, messageNow() / 1000);
-    p = appendFATSV(p, end, (mm->addr & MODES_NON_ICAO_ADDRESS) ? "otherid" : "hexid", "%06X", mm->addr & 0xFFFFFF);
-    if (mm->addrtype != ADDR_ADSB_ICAO) {
-        p = appendFATSV(p, end, "addrtype", "%s", addrtype_enum_string(mm->addrtype));
+    // keep up while someone is polling it, otherwise just stop it from
+    // going too stale for the first request that comes along
+    uint64_t now = mstime();
+    uint64_t requested = atomic_load_explicit(&http_requested_at[index], memory_order_relaxed);
+    return (now < requested + HTTP_DEMAND_WINDOW || now >= http_published_at[index] + HTTP_IDLE_REFRESH);
+}
+
+// Main thread: the data behind this file has changed, but it will only be
+// regenerated on request (see modesJsonRequested). HTTP requests for it wait
+// until the new version has been published.
+void modesJsonInvalidate(const char *file)
+{
+    int index = http_service ? httpSnapshotIndex(file) : -1;
+    if (index >= 0)
+        atomic_fetch_add(&http_generation[index], 1);
+}
+
+// Main thread: does anything need a file that was invalidated to be
+// regenerated now? That is, we are writing files, or an HTTP request is
+// waiting for it.
+bool modesJsonRequested(const char *file)
+{
+    if (Modes.json_dir)
+        return true;
+
+    int index = http_service ? httpSnapshotIndex(file) : -1;
+    if (index < 0)
+        return false;
+
+    return atomic_exchange(&http_awaited[index], false);
+}
+
+static const char *httpStatusText(int status)
+{
+    switch (status) {
+    case 200: return "OK";
+    case 304: return "Not Modified";
+    case 400: return "Bad Request";
+    case 403: return "Forbidden";
+    case 404: return "Not Found";
+    case 405: return "Method Not Allowed";
+    case 500: return "Internal Server Error";
+    default:  return "Unknown";
     }
+}
 
-    p = safe_snprintf(p, end, "%s\t", datafield);
-    for (size_t i = 0; i < len; ++i) {
-        p = safe_snprintf(p, end, "%02X", data[i]);
+static const char *httpContentType(const char *path)
+{
+    static const struct {
+        const char *ext;
+        const char *type;
+    } types[] = {
+        { ".html", "text/html; charset=utf-8" },
+        { ".htm",  "text/html; charset=utf-8" },
+        { ".js",   "application/javascript" },
+        { ".css",  "text/css" },
+        { ".json", "application/json" },
+        { ".png",  "image/png" },
+        { ".gif",  "image/gif" },
+        { ".jpg",  "image/jpeg" },
+        { ".jpeg", "image/jpeg" },
+        { ".svg",  "image/svg+xml" },
+        { ".ico",  "image/x-icon" },
+        { ".txt",  "text/plain" },
+        { ".xml",  "text/xml" },
+        { NULL,    NULL }
+    };
+
+    const char *ext = strrchr(path, '.');
+    if (ext && !strchr(ext, '/')) {
+        for (int i = 0; types[i].ext; ++i) {
+            if (!strcasecmp(ext, types[i].ext))
+                return types[i].type;
+        }
     }
-    p = safe_snprintf(p, end, "\n");
 
-    if (p < end)
-        completeWrite(&Modes.fatsv_out, p);
-    else
-        fprintf(stderr, "fatsv: output too large (max %d, overran by %d)\n", TSV_MAX_PACKET_SIZE, (int) (p - end));
-#       undef bufsize
+    return "application/octet-stream";
 }
 
-static void writeFATSVEvent(struct modesMessage *mm, struct aircraft *a)
-{
-    // Write event records for a couple of message types.
+struct http_request {
+    bool head;          // HEAD rather than GET
+    bool keepalive;
+    const char *if_none_match;
+    bool gzip;          // client accepts gzip Content-Encoding
+    char *query;        // after the '?', or NULL
+};
 
-    if (!Modes.fatsv_out.service || !Modes.fatsv_out.service->connections) {
-        return; // not enabled or no active connections
+// Queue a response. 'body' may be NULL for an empty one; the caller keeps
+// its reference. Returns 1 if the client should be closed now.
+static int httpRespond(struct client *c, const struct http_request *req, int status, const char *content_type,
+                       const char *etag, const char *extra_headers, struct net_chunk *body)
+{
+    char header[1024];
+    char *p = header, *end = header + sizeof(header);
+    int body_len = body ? body->len : 0;
+
+    p = safe_snprintf(p, end, "HTTP/1.1 %d %s\r\n", status, httpStatusText(status));
+    p = safe_snprintf(p, end, "Server: " MODES_DUMP1090_VARIANT "/" MODES_DUMP1090_VERSION "\r\n");
+    if (status != 304)
+        p = safe_snprintf(p, end, "Content-Length: %d\r\n", body_len);
+    if (content_type)
+        p = safe_snprintf(p, end, "Content-Type: %s\r\n", content_type);
+    if (etag)
+        p = safe_snprintf(p, end, "ETag: %s\r\n", etag);
+    if (extra_headers)
+        p = safe_snprintf(p, end, "%s", extra_headers);
+    p = safe_snprintf(p, end, "Connection: %s\r\n\r\n", req->keepalive ? "keep-alive" : "close");
+
+    if (p >= end)
+        return 1;
+
+    struct net_chunk *chunk = makeChunk(header, p - header);
+    if (!chunk)
+        return 1;
+
+    bool queued = queueClientWrite(c, chunk, 0);
+    releaseChunk(chunk);
+    if (!queued)
+        return 0; // already closed
+
+    if (body && body_len && !req->head && status != 304) {
+        if (!queueClientWrite(c, body, 0))
+            return 0;
     }
 
-    if (!a || mm->source == SOURCE_MLAT || (!a->reliable && !mm->reliable))
-        return;
+    if (!req->keepalive)
+        c->close_when_sent = 1;
 
-    switch (mm->msgtype) {
-    case 20:
-    case 21:
-        // DF 20/21: Comm-B: emit if they've changed since we last sent them
-        switch (mm->commb_format) {
-        case COMMB_DATALINK_CAPS:
-            // BDS 1,0: data link capability report
-            if (memcmp(mm->MB, a->fatsv_emitted_bds_10, 7) != 0) {
-                memcpy(a->fatsv_emitted_bds_10, mm->MB, 7);
-                writeFATSVEventMessage(mm, "datalink_caps", mm->MB, 7);
-            }
-            break;
+    // io_uring clients are sent to at the end of the pass
+    if (!c->uring)
+        drainClientQueue(c);
+    return 0;
+}
 
-        case COMMB_ACAS_RA:
-            // BDS 3,0: ACAS RA report
-            if (memcmp(mm->MB, a->fatsv_emitted_bds_30, 7) != 0) {
-                memcpy(a->fatsv_emitted_bds_30, mm->MB, 7);
-                writeFATSVEventMessage(mm, "commb_acas_ra", mm->MB, 7);
-            }
-            break;
+static int httpRespondError(struct client *c, struct http_request *req, int status)
+{
+    char text[64];
+    snprintf(text, sizeof(text), "%d %s\n", status, httpStatusText(status));
 
-        case COMMB_GICB_CAPS:
-            // BDS 1,7: common usage GICB capability report
-            if (memcmp(mm->MB, a->fatsv_emitted_bds_17, 7) != 0) {
-                memcpy(a->fatsv_emitted_bds_17, mm->MB, 7);
-                writeFATSVEventMessage(mm, "gicb_caps", mm->MB, 7);
-            }
-            break;
+    struct net_chunk *body = makeChunk(text, strlen(text));
+    if (!body)
+        return 1;
 
-        case COMMB_UNKNOWN:
-            // If enabled, upload raw unrecognized Comm-B messages
-            // for server-side analysis
-            if (Modes.faup_upload_unknown_commb && memcmp(mm->MB, a->fatsv_emitted_unknown_commb, 7) != 0) {
-                memcpy(a->fatsv_emitted_unknown_commb, mm->MB, 7);
-                writeFATSVEventMessage(mm, "unknown_commb", mm->MB, 7);
-            }
-            break;
+    int ret = httpRespond(c, req, status, "text/plain", NULL, NULL, body);
+    releaseChunk(body);
+    return ret;
+}
 
-        default:
-            // nothing
-            break;
-        }
-        break;
+static bool httpETagMatches(const struct http_request *req, const char *etag)
+{
+    return req->if_none_match && (strstr(req->if_none_match, etag) || !strcmp(req->if_none_match, "*"));
+}
 
-    case 17:
-    case 18:
-        // DF 17/18: extended squitter
-        if (mm->metype == 28 && mm->mesub == 2 && memcmp(mm->ME, &a->fatsv_emitted_es_acas_ra, 7) != 0) {
-            // type 28 subtype 2: ACAS RA report
-            // first byte has the type/subtype, remaining bytes match the BDS 3,0 format
-            memcpy(a->fatsv_emitted_es_acas_ra, mm->ME, 7);
-            writeFATSVEventMessage(mm, "es_acas_ra", mm->ME, 7);
-        } else if (mm->metype == 31 && (mm->mesub == 0 || mm->mesub == 1) && memcmp(mm->ME, a->fatsv_emitted_es_status, 7) != 0) {
-            // aircraft operational status
-            memcpy(a->fatsv_emitted_es_status, mm->ME, 7);
-            writeFATSVEventMessage(mm, "es_op_status", mm->ME, 7);
-        }
-        break;
+#define HTTP_JSON_HEADERS "Cache-Control: no-cache\r\nAccess-Control-Allow-Origin: *\r\nVary: Accept-Encoding\r\n"
+
+static int httpServeSnapshot(struct client *c, struct http_request *req, int index)
+{
+    struct http_snapshot *snap = &http_snapshots[index];
+
+    atomic_store_explicit(&http_requested_at[index], mstime(), memory_order_relaxed);
+
+    if (snap->generation != atomic_load(&http_generation[index])) {
+        // regenerated on demand; wait for the main thread to publish it
+        atomic_store(&http_awaited[index], true);
+        c->http_waiting = 1;
+        return NET_READ_DEFER;
     }
+
+    if (!snap->body)
+        return httpRespondError(c, req, 404);
+
+    // the compressed copy is a different representation, so it gets its own ETag
+    bool gzip = req->gzip && snap->gzip_body;
+    char etag[32];
+    snprintf(etag, sizeof(etag), "\"%016" PRIx64 "%s\"", snap->hash, gzip ? "-gz" : "");
+
+    const char *headers = gzip ? HTTP_JSON_HEADERS "Content-Encoding: gzip\r\n" : HTTP_JSON_HEADERS;
+    if (httpETagMatches(req, etag))
+        return httpRespond(c, req, 304, NULL, etag, headers, NULL);
+    return httpRespond(c, req, 200, "application/json", etag, headers, gzip ? snap->gzip_body : snap->body);
 }
 
-static inline unsigned unsigned_difference(unsigned v1, unsigned v2)
+// Find a parameter in a query string, returning its (NUL-terminated) value or NULL
+static const char *httpQueryParam(char *query, const char *name)
 {
-    return (v1 > v2) ? (v1 - v2) : (v2 - v1);
+    size_t namelen = strlen(name);
+    char *p, *next;
+
+    for (p = query; p; p = next) {
+        if ((next = strchr(p, '&')))
+            *next++ = 0;
+        if (!strncmp(p, name, namelen) && p[namelen] == '=')
+            return p + namelen + 1;
+    }
+
+    return NULL;
 }
 
-static inline float heading_difference(float h1, float h2)
+//
+// Serve every aircraft delta after sequence number 'since' as
+//
+//   { "seq" : <latest>, "deltas" : [ <delta>, <delta>, ... ] }
+//
+// If we no longer hold all of those deltas, serve the whole aircraft.json
+// instead; the client can tell the two apart by the "deltas" key, and
+// carries on from the "seq" in either.
+//
+static int httpServeDeltasSince(struct client *c, struct http_request *req, const char *since_param)
 {
-    float d = fabs(h1 - h2);
-    return (d < 180) ? d : (360 - d);
+    char *end;
+    uint64_t since = strtoull(since_param, &end, 10);
+    uint64_t now = mstime();
+
+    atomic_store_explicit(&http_requested_at[http_delta_index], now, memory_order_relaxed);
+
+    if (*end || !http_delta_last || since > http_delta_last || since + 1 < http_delta_first)
+        return httpServeSnapshot(c, req, http_aircraft_index);
+
+    char prefix[64];
+    int prefix_len = snprintf(prefix, sizeof(prefix), "{ \"seq\" : %" PRIu64 ", \"deltas\" : [", http_delta_last);
+    size_t total = prefix_len + 3;
+    for (uint64_t seq = since + 1; seq <= http_delta_last; ++seq)
+        total += http_deltas[seq % HTTP_DELTA_HISTORY]->len + 1;
+
+    struct net_chunk *body = malloc(sizeof(*body) + total);
+    if (!body)
+        return httpRespondError(c, req, 500);
+
+    char *p = body->data;
+    memcpy(p, prefix, prefix_len);
+    p += prefix_len;
+    for (uint64_t seq = since + 1; seq <= http_delta_last; ++seq) {
+        struct net_chunk *delta = http_deltas[seq % HTTP_DELTA_HISTORY];
+        if (seq > since + 1)
+            *p++ = ',';
+        memcpy(p, delta->data, delta->len);
+        p += delta->len;
+    }
+    memcpy(p, "]}\n", 3);
+    p += 3;
+
+    body->refcount = 1;
+    body->len = p - body->data;
+
+    int ret = httpRespond(c, req, 200, "application/json", NULL, HTTP_JSON_HEADERS, body);
+    releaseChunk(body);
+    return ret;
 }
 
- __attribute__ ((format (printf,6,7))) static char *appendFATSVMeta(char *p, char *end, const char *field, struct aircraft *a, const data_validity *source, const char *format, ...)
+//
+// Static files from --html-dir are cached in memory, so that serving them
+// doesn't block the network thread on the disk each time. A cached file is
+// checked against the filesystem (stat, no read) at most once every
+// HTTP_FILE_RECHECK ms, and is reloaded if its size, mtime or inode changed.
+// A compressed copy is made the first time a client that accepts gzip asks
+// for a compressible file. The least recently used files are evicted to keep
+// the cache within HTTP_FILE_CACHE_BYTES.
+//
+
+#define HTTP_FILE_CACHE_ENTRIES 256
+#define HTTP_FILE_CACHE_BYTES (32 * 1024 * 1024)
+#define HTTP_FILE_RECHECK 1000       // ms
+
+// network side only
+struct http_cached_file {
+    char *filename;              // malloc'd; NULL if the entry is unused
+    off_t size;
+    time_t mtime;
+    ino_t ino;
+    struct net_chunk *body;      // holds one reference
+    struct net_chunk *gzip_body; // gzip-compressed copy of body, or NULL; holds one reference
+    bool gzip_tried;             // compression was attempted (gzip_body may still be NULL)
+    uint64_t checked;            // when the file was last checked against the filesystem
+    uint64_t used;               // when the file was last served, for eviction
+};
+
+static struct http_cached_file http_file_cache[HTTP_FILE_CACHE_ENTRIES];
+static size_t http_file_cache_bytes;
+
+// Release a cached file's contents, keeping its name
+static void httpFileCacheDrop(struct http_cached_file *f)
 {
-    const char *sourcetype;
-    switch (source->source) {
-    case SOURCE_MODE_S:
-        sourcetype = "U";
-        break;
-    case SOURCE_MODE_S_CHECKED:
-        sourcetype = "S";
-        break;
-    case SOURCE_TISB:
-        sourcetype = "T";
-        break;
-    case SOURCE_ADSR:
-        sourcetype = "R";
-        break;
-    case SOURCE_ADSB:
-        sourcetype = "A";
-        break;
-    default:
-        // don't want to forward data sourced from these
-        return p;
+    if (f->body) {
+        http_file_cache_bytes -= f->body->len;
+        releaseChunk(f->body);
+    }
+    if (f->gzip_body) {
+        http_file_cache_bytes -= f->gzip_body->len;
+        releaseChunk(f->gzip_body);
     }
 
-    if (!trackDataValid(source)) {
-        // expired data
-        return p;
+    char *filename = f->filename;
+    memset(f, 0, sizeof(*f));
+    f->filename = filename;
+}
+
+static void httpFileCacheEvict(struct http_cached_file *f)
+{
+    httpFileCacheDrop(f);
+    free(f->filename);
+    f->filename = NULL;
+}
+
+// Evict least recently used files (other than 'keep') until 'needed' more
+// bytes fit in the cache
+static void httpFileCacheMakeRoom(size_t needed, struct http_cached_file *keep)
+{
+    while (http_file_cache_bytes + needed > HTTP_FILE_CACHE_BYTES) {
+        struct http_cached_file *oldest = NULL;
+        for (int i = 0; i < HTTP_FILE_CACHE_ENTRIES; ++i) {
+            struct http_cached_file *f = &http_file_cache[i];
+            if (f->filename && f != keep && (!oldest || f->used < oldest->used))
+                oldest = f;
+        }
+        if (!oldest)
+            return;
+        httpFileCacheEvict(oldest);
     }
+}
 
-    if (source->updated > messageNow()) {
-        // data in the future
-        return p;
+// Read a whole file into a new chunk, or return NULL
+static struct net_chunk *httpReadFile(const char *filename, off_t size)
+{
+    int fd;
+    if ((fd = open(filename, O_RDONLY)) < 0)
+        return NULL;
+
+    struct net_chunk *body = malloc(sizeof(*body) + size);
+    if (!body) {
+        close(fd);
+        return NULL;
     }
 
-    if (source->updated < a->fatsv_last_emitted) {
-        // not updated since last time
-        return p;
+    body->refcount = 1;
+    body->len = 0;
+    while (body->len < size) {
+        ssize_t n = read(fd, body->data + body->len, size - body->len);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            break;
+        body->len += n;
     }
+    close(fd);
 
-    uint64_t age = (messageNow() - source->updated) / 1000;
-    if (age > 255) {
-        // too old
-        return p;
+    if (body->len != size) {
+        free(body);
+        return NULL;
     }
+    return body;
+}
 
-    p = safe_snprintf(p, end, "%s\t", field);
+static bool httpCompressible(const char *content_type)
+{
+    return !strncmp(content_type, "text/", 5) || strstr(content_type, "javascript") ||
+        strstr(content_type, "json") || strstr(content_type, "xml");
+}
 
-    va_list ap;
-    va_start(ap, format);
-    p = safe_vsnprintf(p, end, format, ap);
-    va_end(ap);
+#ifdef ENABLE_ZLIB
 
-    p = safe_snprintf(p, end, " %" PRIu64 " %s\t", age, sourcetype);
-    return p;
+// Compress a static file for gzip Content-Encoding. This runs on the
+// network thread, once per file version, so it favours speed.
+static struct net_chunk *httpGzipFile(const struct net_chunk *body)
+{
+    z_stream stream = { .zalloc = Z_NULL };
+    struct net_chunk *chunk;
+
+    // windowBits 15 + 16: gzip framing rather than zlib
+    if (deflateInit2(&stream, Z_BEST_SPEED, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        return NULL;
+
+    uLong bound = deflateBound(&stream, body->len);
+    if (!(chunk = malloc(sizeof(*chunk) + bound))) {
+        deflateEnd(&stream);
+        return NULL;
+    }
+
+    stream.next_in = (Bytef *) body->data;
+    stream.avail_in = body->len;
+    stream.next_out = (Bytef *) chunk->data;
+    stream.avail_out = bound;
+    int ret = deflate(&stream, Z_FINISH);
+    chunk->refcount = 1;
+    chunk->len = bound - stream.avail_out;
+    deflateEnd(&stream);
+
+    // not worth a separate representation unless it saves something
+    if (ret != Z_STREAM_END || chunk->len >= body->len - body->len / 8) {
+        free(chunk);
+        return NULL;
+    }
+    return chunk;
 }
 
-static const char *airground_enum_string(airground_t ag)
+#else
+
+static struct net_chunk *httpGzipFile(const struct net_chunk *body)
 {
-    switch (ag) {
-    case AG_AIRBORNE:
-        return "A+";
-    case AG_GROUND:
-        return "G+";
-    default:
-        return "?";
-    }
+    MODES_NOTUSED(body);
+    return NULL;
 }
 
-static void writeFATSV()
+#endif
+
+// Find (or load) the cache entry for a file; on failure, return NULL and
+// set *status to the HTTP status to respond with
+static struct http_cached_file *httpFileCacheGet(const char *filename, int *status)
 {
-    struct aircraft *a;
-    static uint64_t next_update;
+    uint64_t now = mstime();
+    struct http_cached_file *f = NULL, *unused = NULL;
+    struct stat st;
+
+    for (int i = 0; i < HTTP_FILE_CACHE_ENTRIES; ++i) {
+        struct http_cached_file *e = &http_file_cache[i];
+        if (!e->filename) {
+            if (!unused)
+                unused = e;
+        } else if (!strcmp(e->filename, filename)) {
+            f = e;
+            break;
+        }
+    }
 
-    if (!Modes.fatsv_out.service || !Modes.fatsv_out.service->connections) {
-        return; // not enabled or no active connections
+    if (f && now < f->checked + HTTP_FILE_RECHECK) {
+        f->used = now;
+        return f;
     }
 
-    uint64_t now = mstime();
-    if (now < next_update) {
-        return;
+    if (stat(filename, &st) < 0) {
+        *status = (errno == EACCES ? 403 : 404);
+        if (f)
+            httpFileCacheEvict(f);
+        return NULL;
     }
 
-    // scan once a second at most
-    next_update = now + 1000;
+    if (!S_ISREG(st.st_mode) || st.st_size > HTTP_MAX_FILE_SIZE) {
+        *status = 404;
+        if (f)
+            httpFileCacheEvict(f);
+        return NULL;
+    }
 
-    for (a = Modes.aircrafts; a; a = a->next) {
-        if (!a->reliable)
-            continue;
+    if (f && f->size == st.st_size && f->mtime == st.st_mtime && f->ino == st.st_ino) {
+        f->checked = f->used = now;
+        return f;
+    }
 
-        // don't emit if it hasn't updated since last time
-        if (a->seen < a->fatsv_last_emitted) {
-            continue;
+    // (re)load it
+    struct net_chunk *body = httpReadFile(filename, st.st_size);
+    if (!body) {
+        *status = (errno == EACCES ? 403 : 500);
+        if (f)
+            httpFileCacheEvict(f);
+        return NULL;
+    }
+
+    if (f) {
+        httpFileCacheDrop(f);
+    } else {
+        char *name = strdup(filename);
+        if (!name) {
+            releaseChunk(body);
+            *status = 500;
+            return NULL;
         }
 
-        // Pretend we are "processing a message" so the validity checks work as expected
-        _messageNow = a->seen;
+        if (!unused) {
+            // replace the least recently used entry
+            unused = &http_file_cache[0];
+            for (int i = 1; i < HTTP_FILE_CACHE_ENTRIES; ++i) {
+                if (http_file_cache[i].used < unused->used)
+                    unused = &http_file_cache[i];
+            }
+            httpFileCacheEvict(unused);
+        }
+        f = unused;
+        f->filename = name;
+    }
 
-        // some special cases:
-        int altValid = trackDataValid(&a->altitude_baro_valid);
-        int airgroundValid = trackDataValid(&a->airground_valid) && a->airground_valid.source >= SOURCE_MODE_S_CHECKED; // for non-ADS-B transponders, only trust DF11 CA field
-        int gsValid = trackDataValid(&a->gs_valid);
-        int squawkValid = trackDataValid(&a->squawk_valid);
-        int callsignValid = trackDataValid(&a->callsign_valid) && strcmp(a->callsign, "        ") != 0;
-        int positionValid = trackDataValid(&a->position_valid);
+    httpFileCacheMakeRoom(body->len, f);
+    f->size = st.st_size;
+    f->mtime = st.st_mtime;
+    f->ino = st.st_ino;
+    f->body = body;
+    f->checked = f->used = now;
+    http_file_cache_bytes += body->len;
+    return f;
+}
 
-        // If we are definitely on the ground, suppress any unreliable altitude info.
-        // When on the ground, ADS-B transponders don't emit an ADS-B message that includes
-        // altitude, so a corrupted Mode S altitude response from some other in-the-air AC
-        // might be taken as the "best available altitude" and produce e.g. "airGround G+ alt 31000".
-        if (airgroundValid && a->airground == AG_GROUND && a->altitude_baro_valid.source < SOURCE_MODE_S_CHECKED)
-            altValid = 0;
+static int httpServeFile(struct client *c, struct http_request *req, const char *path)
+{
+    char filename[PATH_MAX];
+    int status;
+
+    if (!Modes.html_dir || strstr(path, ".."))
+        return httpRespondError(c, req, 404);
+
+    snprintf(filename, sizeof(filename), "%s%s%s", Modes.html_dir, path, path[strlen(path) - 1] == '/' ? "index.html" : "");
+    filename[PATH_MAX - 1] = 0;
+
+    struct http_cached_file *f = httpFileCacheGet(filename, &status);
+    if (!f)
+        return httpRespondError(c, req, status);
+
+    const char *content_type = httpContentType(filename);
+    bool compressible = httpCompressible(content_type);
+    if (req->gzip && !f->gzip_tried && compressible) {
+        f->gzip_tried = true;
+        if ((f->gzip_body = httpGzipFile(f->body))) {
+            httpFileCacheMakeRoom(f->gzip_body->len, f);
+            http_file_cache_bytes += f->gzip_body->len;
+        }
+    }
 
-        // if it hasn't changed altitude, heading, or speed much,
-        // don't update so often
-        int changed =
-            (altValid && abs(a->altitude_baro - a->fatsv_emitted_altitude_baro) >= 50) ||
-            (trackDataValid(&a->altitude_geom_valid) && abs(a->altitude_geom - a->fatsv_emitted_altitude_geom) >= 50) ||
-            (trackDataValid(&a->baro_rate_valid) && abs(a->baro_rate - a->fatsv_emitted_baro_rate) > 500) ||
-            (trackDataValid(&a->geom_rate_valid) && abs(a->geom_rate - a->fatsv_emitted_geom_rate) > 500) ||
-            (trackDataValid(&a->track_valid) && heading_difference(a->track, a->fatsv_emitted_track) >= 2) ||
-            (trackDataValid(&a->track_rate_valid) && fabs(a->track_rate - a->fatsv_emitted_track_rate) >= 0.5) ||
-            (trackDataValid(&a->roll_valid) && fabs(a->roll - a->fatsv_emitted_roll) >= 5.0) ||
-            (trackDataValid(&a->mag_heading_valid) && heading_difference(a->mag_heading, a->fatsv_emitted_mag_heading) >= 2) ||
-            (trackDataValid(&a->true_heading_valid) && heading_difference(a->true_heading, a->fatsv_emitted_true_heading) >= 2) ||
-            (gsValid && fabs(a->gs - a->fatsv_emitted_gs) >= 25) ||
-            (trackDataValid(&a->ias_valid) && unsigned_difference(a->ias, a->fatsv_emitted_ias) >= 25) ||
-            (trackDataValid(&a->tas_valid) && unsigned_difference(a->tas, a->fatsv_emitted_tas) >= 25) ||
-            (trackDataValid(&a->mach_valid) && fabs(a->mach - a->fatsv_emitted_mach) >= 0.02);
+    // the compressed copy is a different representation, so it gets its own ETag
+    bool gzip = req->gzip && f->gzip_body;
+    char etag[48];
+    snprintf(etag, sizeof(etag), "\"%jx-%jx%s\"", (uintmax_t) f->size, (uintmax_t) f->mtime, gzip ? "-gz" : "");
 
-        int immediate =
-            (trackDataValid(&a->nav_altitude_mcp_valid) && abs(a->nav_altitude_mcp - a->fatsv_emitted_nav_altitude_mcp) > 50) ||
-            (trackDataValid(&a->nav_altitude_fms_valid) && abs(a->nav_altitude_fms - a->fatsv_emitted_nav_altitude_fms) > 50) ||
-            (trackDataValid(&a->nav_altitude_src_valid) && a->nav_altitude_src != a->fatsv_emitted_nav_altitude_src) ||
-            (trackDataValid(&a->nav_heading_valid) && heading_difference(a->nav_heading, a->fatsv_emitted_nav_heading) > 2) ||
-            (trackDataValid(&a->nav_modes_valid) && a->nav_modes != a->fatsv_emitted_nav_modes) ||
-            (trackDataValid(&a->nav_qnh_valid) && fabs(a->nav_qnh - a->fatsv_emitted_nav_qnh) > 0.8) || // 0.8 is the ES message resolution
-            (callsignValid && strcmp(a->callsign, a->fatsv_emitted_callsign) != 0) ||
-            (airgroundValid && a->airground == AG_AIRBORNE && a->fatsv_emitted_airground == AG_GROUND) ||
-            (airgroundValid && a->airground == AG_GROUND && a->fatsv_emitted_airground == AG_AIRBORNE) ||
-            (squawkValid && a->squawk != a->fatsv_emitted_squawk) ||
-            (trackDataValid(&a->emergency_valid) && a->emergency != a->fatsv_emitted_emergency) ||
-            (trackDataValid(&a->mrar_source_valid) && a->mrar_source_valid.updated > a->fatsv_last_emitted) ||
-            (trackDataValid(&a->wind_valid) && a->wind_valid.updated > a->fatsv_last_emitted) ||
-            (trackDataValid(&a->pressure_valid) && a->pressure_valid.updated > a->fatsv_last_emitted) ||
-            (trackDataValid(&a->temperature_valid) && a->temperature_valid.updated > a->fatsv_last_emitted) ||
-            (trackDataValid(&a->turbulence_valid) && a->turbulence_valid.updated > a->fatsv_last_emitted) ||
-            (trackDataValid(&a->humidity_valid) && a->humidity_valid.updated > a->fatsv_last_emitted);
+    const char *headers;
+    if (gzip)
+        headers = "Cache-Control: no-cache\r\nVary: Accept-Encoding\r\nContent-Encoding: gzip\r\n";
+    else if (compressible)
+        headers = "Cache-Control: no-cache\r\nVary: Accept-Encoding\r\n";
+    else
+        headers = "Cache-Control: no-cache\r\n";
+
+    if (httpETagMatches(req, etag))
+        return httpRespond(c, req, 304, NULL, etag, headers, NULL);
+    return httpRespond(c, req, 200, content_type, etag, headers, gzip ? f->gzip_body : f->body);
+}
+
+//
+// Handle one HTTP request header block (everything up to the blank line).
+// Request bodies are not supported; anything that would have one is refused.
+//
+static int handleHTTPRequest(struct client *c, char *p)
+{
+    struct http_request req = { false, false, NULL, false, NULL };
+    char *line, *next;
+    char *method, *path, *version;
+
+    if (c->close_when_sent)
+        return 0; // pipelined after a "Connection: close"; ignore
+
+    // parsing below modifies the request in place; keep a copy to put back
+    // if it has to wait for a snapshot (NET_READ_DEFER)
+    char raw[MODES_CLIENT_BUF_SIZE + 1];
+    size_t raw_len = strlen(p);
+    memcpy(raw, p, raw_len + 1);
+
+    // request line
+    if ((next = strstr(p, "\r\n"))) {
+        *next = 0;
+        next += 2;
+    }
+
+    method = p;
+    if (!(path = strchr(method, ' ')))
+        goto bad_request;
+    *path++ = 0;
+    if (!(version = strchr(path, ' ')))
+        goto bad_request;
+    *version++ = 0;
+
+    if (strncmp(version, "HTTP/1.", 7))
+        goto bad_request;
+    req.keepalive = strcmp(version, "HTTP/1.0") != 0;
+
+    // headers
+    for (line = next; line && *line; line = next) {
+        if ((next = strstr(line, "\r\n"))) {
+            *next = 0;
+            next += 2;
+        }
+
+        char *value = strchr(line, ':');
+        if (!value)
+            continue;
+        *value++ = 0;
+        while (*value == ' ' || *value == '\t')
+            ++value;
+
+        if (!strcasecmp(line, "Connection")) {
+            if (!strcasecmp(value, "close"))
+                req.keepalive = false;
+            else if (!strcasecmp(value, "keep-alive"))
+                req.keepalive = true;
+        } else if (!strcasecmp(line, "If-None-Match")) {
+            req.if_none_match = value;
+        } else if (!strcasecmp(line, "Accept-Encoding")) {
+            req.gzip = (strstr(value, "gzip") != NULL);
+        } else if (!strcasecmp(line, "Content-Length") || !strcasecmp(line, "Transfer-Encoding")) {
+            // we would misread the body as the next request
+            req.keepalive = false;
+        }
+    }
+
+    if (!strcmp(method, "HEAD")) {
+        req.head = true;
+    } else if (strcmp(method, "GET")) {
+        req.keepalive = false;
+        return httpRespondError(c, &req, 405);
+    }
+
+    path[strcspn(path, "#")] = 0;
+    if ((req.query = strchr(path, '?')))
+        *req.query++ = 0;
+    if (path[0] != '/')
+        goto bad_request;
+
+    if (!strncmp(path, "/data/", 6)) {
+        const char *since;
+        int index, ret;
+        if (!strcmp(path + 6, "aircraft_delta.json") && (since = httpQueryParam(req.query, "since")))
+            ret = httpServeDeltasSince(c, &req, since);
+        else if ((index = httpSnapshotIndex(path + 6)) < 0)
+            ret = httpRespondError(c, &req, 404);
+        else
+            ret = httpServeSnapshot(c, &req, index);
+
+        if (ret == NET_READ_DEFER)
+            memcpy(p, raw, raw_len + 1);
+        return ret;
+    }
+    return httpServeFile(c, &req, path);
+
+ bad_request:
+    req.keepalive = false;
+    return httpRespondError(c, &req, 400);
+}
+
+
+// Result of consumeClientInput
+typedef enum {
+    CLIENT_INPUT_CLOSED,    // a handler failed and the client has been closed
+    CLIENT_INPUT_CONSUMED,  // at least one message was consumed from the buffer
+    CLIENT_INPUT_WAITING    // nothing complete in the buffer yet
+} client_input_t;
+
+//
+// Pass every complete message in a client's read buffer to its service's
+// handler, and keep any partial message for next time.
+//
+static client_input_t consumeClientInput(struct client *c) {
+    char *som = c->buf;           // first byte of next message
+    char *eod = som + c->buflen;  // one byte past end of data
+    char *p;
+
+    switch (c->service->read_mode) {
+    case READ_MODE_IGNORE:
+        // drop the bytes on the floor
+        som = eod;
+        break;
+
+    case READ_MODE_BEAST:
+        // This is the Beast Binary scanning case.
+        // If there is a complete message still in the buffer, there must be the separator 'sep'
+        // in the buffer, note that we full-scan the buffer at every read for simplicity.
+
+        while (som < eod && ((p = memchr(som, (char) 0x1a, eod - som)) != NULL)) { // The first byte of buffer 'should' be 0x1a
+            som = p; // consume garbage up to the 0x1a
+            ++p; // skip 0x1a
+
+            if (p >= eod) {
+                // Incomplete message in buffer, retry later
+                break;
+            }
+
+            char *eom; // one byte past end of message
+            if        (*p == '1') {
+                eom = p + MODEAC_MSG_BYTES      + 8;         // point past remainder of message
+            } else if (*p == '2') {
+                eom = p + MODES_SHORT_MSG_BYTES + 8;
+            } else if (*p == '3') {
+                eom = p + MODES_LONG_MSG_BYTES  + 8;
+            } else if (*p == '4') {
+                eom = p + MODES_LONG_MSG_BYTES  + 8;
+            } else if (*p == '5') {
+                eom = p + MODES_LONG_MSG_BYTES  + 8;
+            } else {
+                // Not a valid beast message, skip 0x1a and try again
+                ++som;
+                continue;
+            }
+
+            // we need to be careful of double escape characters in the message body
+            for (p = som + 1; p < eod && p < eom; p++) {
+                if (0x1A == *p) {
+                    p++;
+                    eom++;
+                }
+            }
+
+            if (eom > eod) { // Incomplete message in buffer, retry later
+                break;
+            }
+
+            // Have a 0x1a followed by 1/2/3/4/5 - pass message to handler.
+            if (c->service->read_handler(c, som + 1)) {
+                modesCloseClient(c);
+                return CLIENT_INPUT_CLOSED;
+            }
+
+            // advance to next message
+            som = eom;
+        }
+        break;
+
+    case READ_MODE_BEAST_COMMAND:
+        while (som < eod && ((p = memchr(som, (char) 0x1a, eod - som)) != NULL)) { // The first byte of buffer 'should' be 0x1a
+            char *eom; // one byte past end of message
+
+            som = p; // consume garbage up to the 0x1a
+            ++p; // skip 0x1a
+
+            if (p >= eod) {
+                // Incomplete message in buffer, retry later
+                break;
+            }
+
+            if (*p == '1') {
+                eom = p + 2;
+            } else {
+                // Not a valid beast command, skip 0x1a and try again
+                ++som;
+                continue;
+            }
+
+            // we need to be careful of double escape characters in the message body
+            for (p = som + 1; p < eod && p < eom; p++) {
+                if (0x1A == *p) {
+                    p++;
+                    eom++;
+                }
+            }
+
+            if (eom > eod) { // Incomplete message in buffer, retry later
+                break;
+            }
+
+            // Have a 0x1a followed by 1 - pass message to handler.
+            if (c->service->read_handler(c, som + 1)) {
+                modesCloseClient(c);
+                return CLIENT_INPUT_CLOSED;
+            }
+
+            // advance to next message
+            som = eom;
+        }
+        break;
+
+    case READ_MODE_ASCII:
+        //
+        // This is the ASCII scanning case, AVR RAW or HTTP at present
+        // If there is a complete message still in the buffer, there must be the separator 'sep'
+        // in the buffer, note that we full-scan the buffer at every read for simplicity.
+
+        // Always NUL-terminate so we are free to use strstr()
+        // nb: we never fill the last byte of the buffer with read data (see above) so this is safe
+        *eod = '\0';
+
+        while (som < eod && (p = strstr(som, c->service->read_sep)) != NULL) { // end of first message if found
+            *p = '\0';                         // The handler expects null terminated strings
+            int ret = c->service->read_handler(c, som);     // Pass message to handler.
+            if (ret == NET_READ_DEFER) {       // Handler can't deal with it yet;
+                *p = c->service->read_sep[0];  //     leave it in the buffer until the client is resumed
+                break;
+            }
+            if (ret) {
+                modesCloseClient(c);           // Handler returns 1 on error to signal we .
+                return CLIENT_INPUT_CLOSED;    // should close the client connection
+            }
+            if (!c->service)                   // The handler's output may have closed it
+                return CLIENT_INPUT_CLOSED;
+            som = p + strlen(c->service->read_sep);               // Move to start of next message
+        }
+
+        break;
+    }
+
+    if (som > c->buf) {                        // We processed something - so
+        c->buflen = eod - som;                 //     Update the unprocessed buffer length
+        memmove(c->buf, som, c->buflen);       //     Move what's remaining to the start of the buffer
+        return CLIENT_INPUT_CONSUMED;
+    } else {                                   // If no message was decoded process the next client
+        return CLIENT_INPUT_WAITING;
+    }
+}
+
+// Network side: retry the requests that were waiting for a snapshot
+static void httpResumeWaiting(void)
+{
+    for (struct client *c = Modes.clients; c; c = c->next) {
+        if (c->service && c->http_waiting) {
+            c->http_waiting = 0;
+            consumeClientInput(c);
+        }
+    }
+}
+
+//
+//=========================================================================
+//
+// This function polls the clients using read() in order to receive new
+// messages from the net.
+//
+// The message is supposed to be separated from the next message by the
+// separator 'sep', which is a null-terminated C string.
+//
+// Every full message received is decoded and passed to the higher layers
+// calling the function's 'handler'.
+//
+// The handler returns 0 on success, or 1 to signal this function we should
+// close the connection with the client in case of non-recoverable errors.
+//
+static void modesReadFromClient(struct client *c) {
+    int left;
+    int nread;
+    int bContinue = 1;
+
+    while (bContinue) {
+        left = MODES_CLIENT_BUF_SIZE - c->buflen - 1; // leave 1 extra byte for NUL termination in the ASCII case
+
+        // If our buffer is full discard it, this is some badly formatted shit
+        if (left <= 0) {
+            c->buflen = 0;
+            left = MODES_CLIENT_BUF_SIZE;
+            // If there is garbage, read more to discard it ASAP
+        }
+#ifndef _WIN32
+        nread = read(c->fd, c->buf+c->buflen, left);
+#else
+        nread = recv(c->fd, c->buf+c->buflen, left, 0);
+        if (nread < 0) {errno = WSAGetLastError();}
+#endif
+
+        // If we didn't get all the data we asked for, then return once we've processed what we did get.
+        if (nread != left) {
+            bContinue = 0;
+        }
+
+        if (nread == 0) { // End of file
+            modesCloseClient(c);
+            return;
+        }
+
+#ifndef _WIN32
+        if (nread < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) // No data available (not really an error)
+#else
+        if (nread < 0 && errno == EWOULDBLOCK) // No data available (not really an error)
+#endif
+        {
+            return;
+        }
+
+        if (nread < 0) { // Other errors
+            modesCloseClient(c);
+            return;
+        }
+
+        c->buflen += nread;
+
+        if (consumeClientInput(c) != CLIENT_INPUT_CONSUMED)
+            return;
+    }
+}
+
+
+__attribute__ ((format (printf,4,5))) static char *appendFATSV(char *p, char *end, const char *field, const char *format, ...)
+{
+    va_list ap;
+    va_start(ap, format);
+
+    p = safe_snprintf(p, end, "%s\t", field);
+    p = safe_vsnprintf(p, end, format, ap);
+    p = safe_snprintf(p, end, "\t");
+
+    va_end(ap);
+    return p;
+}
+
+#define TSV_MAX_PACKET_SIZE 800
+#define TSV_VERSION "9E"
+
+static void writeFATSVPositionUpdate(float lat, float lon, float alt)
+{
+    static float last_lat, last_lon, last_alt;
+
+    if (lat == last_lat && lon == last_lon && alt == last_alt)
+        return;
+
+    last_lat = lat;
+    last_lon = lon;
+    last_alt = alt;
+
+    char *p = prepareWrite(&Modes.fatsv_out, TSV_MAX_PACKET_SIZE);
+    if (!p)
+        return;
+
+    char *end = p + TSV_MAX_PACKET_SIZE;
+
+    p = appendFATSV(p, end, "_v",     "%s", TSV_VERSION);
+    p = appendFATSV(p, end, "clock",  "%" PRIu64, messageNow() / 1000);
+    p = appendFATSV(p, end, "type",   "%s",       "location_update");
+    p = appendFATSV(p, end, "lat",    "%.5f",     lat);
+    p = appendFATSV(p, end, "lon",    "%.5f",     lon);
+    p = appendFATSV(p, end, "alt",    "%.0f",     alt);
+    p = appendFATSV(p, end, "altref", "%s",       "egm96_meters");
+    --p; // remove last tab
+    p = safe_snprintf(p, end, "\n");
+
+    if (p < end)
+        completeWrite(&Modes.fatsv_out, p);
+    else
+        fprintf(stderr, "fatsv: output too large (max %d, overran by %d)\n", TSV_MAX_PACKET_SIZE, (int) (p - end));
+}
+
+static void writeFATSVEventMessage(struct modesMessage *mm, const char *datafield, unsigned char *data, size_t len)
+{
+    char *p = prepareWrite(&Modes.fatsv_out, TSV_MAX_PACKET_SIZE);
+    if (!p)
+        return;
+
+    char *end = p + TSV_MAX_PACKET_SIZE;
+
+    p = appendFATSV(p, end, "_v",    "%s", TSV_VERSION);
+    p = appendFATSV(p, end, "clock", "%" PRIu64, messageNow() / 1000);
+    p = appendFATSV(p, end, (mm->addr & MODES_NON_ICAO_ADDRESS) ? "otherid" : "hexid", "%06X", mm->addr & 0xFFFFFF);
+    if (mm->addrtype != ADDR_ADSB_ICAO) {
+        p = appendFATSV(p, end, "addrtype", "%s", addrtype_enum_string(mm->addrtype));
+    }
+
+    p = safe_snprintf(p, end, "%s\t", datafield);
+    for (size_t i = 0; i < len; ++i) {
+        p = safe_snprintf(p, end, "%02X", data[i]);
+    }
+    p = safe_snprintf(p, end, "\n");
+
+    if (p < end)
+        completeWrite(&Modes.fatsv_out, p);
+    else
+        fprintf(stderr, "fatsv: output too large (max %d, overran by %d)\n", TSV_MAX_PACKET_SIZE, (int) (p - end));
+#       undef bufsize
+}
+
+static void writeFATSVEvent(struct modesMessage *mm, struct aircraft *a)
+{
+    // Write event records for a couple of message types.
+
+    if (!Modes.fatsv_out.service || !Modes.fatsv_out.service->connections) {
+        return; // not enabled or no active connections
+    }
+
+    if (!a || mm->source == SOURCE_MLAT || (!a->reliable && !mm->reliable))
+        return;
+
+    switch (mm->msgtype) {
+    case 20:
+    case 21:
+        // DF 20/21: Comm-B: emit if they've changed since we last sent them
+        switch (mm->commb_format) {
+        case COMMB_DATALINK_CAPS:
+            // BDS 1,0: data link capability report
+            if (memcmp(mm->MB, a->fatsv_emitted_bds_10, 7) != 0) {
+                memcpy(a->fatsv_emitted_bds_10, mm->MB, 7);
+                writeFATSVEventMessage(mm, "datalink_caps", mm->MB, 7);
+            }
+            break;
+
+        case COMMB_ACAS_RA:
+            // BDS 3,0: ACAS RA report
+            if (memcmp(mm->MB, a->fatsv_emitted_bds_30, 7) != 0) {
+                memcpy(a->fatsv_emitted_bds_30, mm->MB, 7);
+                writeFATSVEventMessage(mm, "commb_acas_ra", mm->MB, 7);
+            }
+            break;
+
+        case COMMB_GICB_CAPS:
+            // BDS 1,7: common usage GICB capability report
+            if (memcmp(mm->MB, a->fatsv_emitted_bds_17, 7) != 0) {
+                memcpy(a->fatsv_emitted_bds_17, mm->MB, 7);
+                writeFATSVEventMessage(mm, "gicb_caps", mm->MB, 7);
+            }
+            break;
+
+        case COMMB_UNKNOWN:
+            // If enabled, upload raw unrecognized Comm-B messages
+            // for server-side analysis
+            if (Modes.faup_upload_unknown_commb && memcmp(mm->MB, a->fatsv_emitted_unknown_commb, 7) != 0) {
+                memcpy(a->fatsv_emitted_unknown_commb, mm->MB, 7);
+                writeFATSVEventMessage(mm, "unknown_commb", mm->MB, 7);
+            }
+            break;
+
+        default:
+            // nothing
+            break;
+        }
+        break;
+
+    case 17:
+    case 18:
+        // DF 17/18: extended squitter
+        if (mm->metype == 28 && mm->mesub == 2 && memcmp(mm->ME, &a->fatsv_emitted_es_acas_ra, 7) != 0) {
+            // type 28 subtype 2: ACAS RA report
+            // first byte has the type/subtype, remaining bytes match the BDS 3,0 format
+            memcpy(a->fatsv_emitted_es_acas_ra, mm->ME, 7);
+            writeFATSVEventMessage(mm, "es_acas_ra", mm->ME, 7);
+        } else if (mm->metype == 31 && (mm->mesub == 0 || mm->mesub == 1) && memcmp(mm->ME, a->fatsv_emitted_es_status, 7) != 0) {
+            // aircraft operational status
+            memcpy(a->fatsv_emitted_es_status, mm->ME, 7);
+            writeFATSVEventMessage(mm, "es_op_status", mm->ME, 7);
+        }
+        break;
+    }
+}
+
+static inline unsigned unsigned_difference(unsigned v1, unsigned v2)
+{
+    return (v1 > v2) ? (v1 - v2) : (v2 - v1);
+}
+
+static inline float heading_difference(float h1, float h2)
+{
+    float d = fabs(h1 - h2);
+    return (d < 180) ? d : (360 - d);
+}
+
+ __attribute__ ((format (printf,6,7))) static char *appendFATSVMeta(char *p, char *end, const char *field, struct aircraft *a, const data_validity *source, const char *format, ...)
+{
+    const char *sourcetype;
+    switch (source->source) {
+    case SOURCE_MODE_S:
+        sourcetype = "U";
+        break;
+    case SOURCE_MODE_S_CHECKED:
+        sourcetype = "S";
+        break;
+    case SOURCE_TISB:
+        sourcetype = "T";
+        break;
+    case SOURCE_ADSR:
+        sourcetype = "R";
+        break;
+    case SOURCE_ADSB:
+        sourcetype = "A";
+        break;
+    default:
+        // don't want to forward data sourced from these
+        return p;
+    }
+
+    if (!trackDataValid(source)) {
+        // expired data
+        return p;
+    }
+
+    if (source->updated > messageNow()) {
+        // data in the future
+        return p;
+    }
+
+    if (source->updated < a->fatsv_last_emitted) {
+        // not updated since last time
+        return p;
+    }
+
+    uint64_t age = (messageNow() - source->updated) / 1000;
+    if (age > 255) {
+        // too old
+        return p;
+    }
+
+    p = safe_snprintf(p, end, "%s\t", field);
+
+    va_list ap;
+    va_start(ap, format);
+    p = safe_vsnprintf(p, end, format, ap);
+    va_end(ap);
+
+    p = safe_snprintf(p, end, " %" PRIu64 " %s\t", age, sourcetype);
+    return p;
+}
+
+static const char *airground_enum_string(airground_t ag)
+{
+    switch (ag) {
+    case AG_AIRBORNE:
+        return "A+";
+    case AG_GROUND:
+        return "G+";
+    default:
+        return "?";
+    }
+}
+
+static void writeFATSV()
+{
+    struct aircraft *a;
+    static uint64_t next_update;
+
+    if (!Modes.fatsv_out.service || !Modes.fatsv_out.service->connections) {
+        return; // not enabled or no active connections
+    }
+
+    uint64_t now = mstime();
+    if (now < next_update) {
+        return;
+    }
+
+    // scan once a second at most
+    next_update = now + 1000;
+
+    for (a = Modes.aircrafts; a; a = a->next) {
+        if (!a->reliable)
+            continue;
+
+        // don't emit if it hasn't updated since last time
+        if (a->seen < a->fatsv_last_emitted) {
+            continue;
+        }
+
+        // Pretend we are "processing a message" so the validity checks work as expected
+        _messageNow = a->seen;
+
+        // some special cases:
+        int altValid = trackDataValid(&a->altitude_baro_valid);
+        int airgroundValid = trackDataValid(&a->airground_valid) && a->airground_valid.source >= SOURCE_MODE_S_CHECKED; // for non-ADS-B transponders, only trust DF11 CA field
+        int gsValid = trackDataValid(&a->gs_valid);
+        int squawkValid = trackDataValid(&a->squawk_valid);
+        int callsignValid = trackDataValid(&a->callsign_valid) && strcmp(a->callsign, "        ") != 0;
+        int positionValid = trackDataValid(&a->position_valid);
+
+        // If we are definitely on the ground, suppress any unreliable altitude info.
+        // When on the ground, ADS-B transponders don't emit an ADS-B message that includes
+        // altitude, so a corrupted Mode S altitude response from some other in-the-air AC
+        // might be taken as the "best available altitude" and produce e.g. "airGround G+ alt 31000".
+        if (airgroundValid && a->airground == AG_GROUND && a->altitude_baro_valid.source < SOURCE_MODE_S_CHECKED)
+            altValid = 0;
+
+        // if it hasn't changed altitude, heading, or speed much,
+        // don't update so often
+        int changed =
+            (altValid && abs(a->altitude_baro - a->fatsv_emitted_altitude_baro) >= 50) ||
+            (trackDataValid(&a->altitude_geom_valid) && abs(a->altitude_geom - a->fatsv_emitted_altitude_geom) >= 50) ||
+            (trackDataValid(&a->baro_rate_valid) && abs(a->baro_rate - a->fatsv_emitted_baro_rate) > 500) ||
+            (trackDataValid(&a->geom_rate_valid) && abs(a->geom_rate - a->fatsv_emitted_geom_rate) > 500) ||
+            (trackDataValid(&a->track_valid) && heading_difference(a->track, a->fatsv_emitted_track) >= 2) ||
+            (trackDataValid(&a->track_rate_valid) && fabs(a->track_rate - a->fatsv_emitted_track_rate) >= 0.5) ||
+            (trackDataValid(&a->roll_valid) && fabs(a->roll - a->fatsv_emitted_roll) >= 5.0) ||
+            (trackDataValid(&a->mag_heading_valid) && heading_difference(a->mag_heading, a->fatsv_emitted_mag_heading) >= 2) ||
+            (trackDataValid(&a->true_heading_valid) && heading_difference(a->true_heading, a->fatsv_emitted_true_heading) >= 2) ||
+            (gsValid && fabs(a->gs - a->fatsv_emitted_gs) >= 25) ||
+            (trackDataValid(&a->ias_valid) && unsigned_difference(a->ias, a->fatsv_emitted_ias) >= 25) ||
+            (trackDataValid(&a->tas_valid) && unsigned_difference(a->tas, a->fatsv_emitted_tas) >= 25) ||
+            (trackDataValid(&a->mach_valid) && fabs(a->mach - a->fatsv_emitted_mach) >= 0.02);
+
+        int immediate =
+            (trackDataValid(&a->nav_altitude_mcp_valid) && abs(a->nav_altitude_mcp - a->fatsv_emitted_nav_altitude_mcp) > 50) ||
+            (trackDataValid(&a->nav_altitude_fms_valid) && abs(a->nav_altitude_fms - a->fatsv_emitted_nav_altitude_fms) > 50) ||
+            (trackDataValid(&a->nav_altitude_src_valid) && a->nav_altitude_src != a->fatsv_emitted_nav_altitude_src) ||
+            (trackDataValid(&a->nav_heading_valid) && heading_difference(a->nav_heading, a->fatsv_emitted_nav_heading) > 2) ||
+            (trackDataValid(&a->nav_modes_valid) && a->nav_modes != a->fatsv_emitted_nav_modes) ||
+            (trackDataValid(&a->nav_qnh_valid) && fabs(a->nav_qnh - a->fatsv_emitted_nav_qnh) > 0.8) || // 0.8 is the ES message resolution
+            (callsignValid && strcmp(a->callsign, a->fatsv_emitted_callsign) != 0) ||
+            (airgroundValid && a->airground == AG_AIRBORNE && a->fatsv_emitted_airground == AG_GROUND) ||
+            (airgroundValid && a->airground == AG_GROUND && a->fatsv_emitted_airground == AG_AIRBORNE) ||
+            (squawkValid && a->squawk != a->fatsv_emitted_squawk) ||
+            (trackDataValid(&a->emergency_valid) && a->emergency != a->fatsv_emitted_emergency) ||
+            (trackDataValid(&a->mrar_source_valid) && a->mrar_source_valid.updated > a->fatsv_last_emitted) ||
+            (trackDataValid(&a->wind_valid) && a->wind_valid.updated > a->fatsv_last_emitted) ||
+            (trackDataValid(&a->pressure_valid) && a->pressure_valid.updated > a->fatsv_last_emitted) ||
+            (trackDataValid(&a->temperature_valid) && a->temperature_valid.updated > a->fatsv_last_emitted) ||
+            (trackDataValid(&a->turbulence_valid) && a->turbulence_valid.updated > a->fatsv_last_emitted) ||
+            (trackDataValid(&a->humidity_valid) && a->humidity_valid.updated > a->fatsv_last_emitted);
+
+        uint64_t minAge;
+        double adjustedMinAge;
+        if (immediate) {
+            // a change we want to emit right away
+            minAge = 0;
+        } else if (!positionValid) {
+            // don't send mode S very often
+            minAge = 30000;
+        } else if ((airgroundValid && a->airground == AG_GROUND) ||
+                   (altValid && a->altitude_baro < 500 && (!gsValid || a->gs < 200)) ||
+                   (gsValid && a->gs < 100 && (!altValid || a->altitude_baro < 1000))) {
+            // we are probably on the ground, increase the update rate
+            minAge = 1000;
+        } else if (!altValid || a->altitude_baro < 10000) {
+            // Below 10000 feet, emit up to every 5s when changing, 10s otherwise
+            minAge = (changed ? 5000 : 10000);
+        } else {
+            // Above 10000 feet, emit up to every 10s when changing, 30s otherwise
+            minAge = (changed ? 10000 : 30000);
+        }
+
+        // Adjust rate for multiplier
+        adjustedMinAge = minAge / Modes.faup_rate_multiplier;
+
+        if ((now - a->fatsv_last_emitted) < adjustedMinAge) {
+            continue;
+        }
+
+        char *p = prepareWrite(&Modes.fatsv_out, TSV_MAX_PACKET_SIZE);
+        if (!p)
+            return;
+        char *end = p + TSV_MAX_PACKET_SIZE;
+
+        p = appendFATSV(p, end, "_v",    "%s", TSV_VERSION);
+        p = appendFATSV(p, end, "clock", "%" PRIu64, messageNow() / 1000);
+        p = appendFATSV(p, end, (a->addr & MODES_NON_ICAO_ADDRESS) ? "otherid" : "hexid", "%06X", a->addr & 0xFFFFFF);
+
+        // for fields we only emit on change,
+        // occasionally re-emit them all
+        int forceEmit = (now - a->fatsv_last_force_emit) > 600000;
+
+        // these don't change often / at all, only emit when they change
+        if (forceEmit || a->addrtype != a->fatsv_emitted_addrtype) {
+            p = appendFATSV(p, end, "addrtype", "%s", addrtype_enum_string(a->addrtype));
+        }
+        if (forceEmit || a->adsb_version != a->fatsv_emitted_adsb_version) {
+            p = appendFATSV(p, end, "adsb_version", "%d", a->adsb_version);
+        }
+        if (forceEmit || a->category != a->fatsv_emitted_category) {
+            p = appendFATSV(p, end, "category", "%02X", a->category);
+        }
+        if (trackDataValid(&a->nac_p_valid) && (forceEmit || a->nac_p != a->fatsv_emitted_nac_p)) {
+            p = appendFATSVMeta(p, end, "nac_p",       a, &a->nac_p_valid,         "%u",       a->nac_p);
+        }
+        if (trackDataValid(&a->nac_v_valid) && (forceEmit || a->nac_v != a->fatsv_emitted_nac_v)) {
+            p = appendFATSVMeta(p, end, "nac_v",       a, &a->nac_v_valid,         "%u",       a->nac_v);
+        }
+        if (trackDataValid(&a->sil_valid) && (forceEmit || a->sil != a->fatsv_emitted_sil)) {
+            p = appendFATSVMeta(p, end, "sil",         a, &a->sil_valid,           "%u",       a->sil);
+        }
+        if (trackDataValid(&a->sil_valid) && (forceEmit || a->sil_type != a->fatsv_emitted_sil_type)) {
+            p = appendFATSVMeta(p, end, "sil_type",    a, &a->sil_valid,           "%s",       sil_type_enum_string(a->sil_type));
+        }
+        if (trackDataValid(&a->nic_baro_valid) && (forceEmit || a->nic_baro != a->fatsv_emitted_nic_baro)) {
+            p = appendFATSVMeta(p, end, "nic_baro",    a, &a->nic_baro_valid,      "%u",       (unsigned) a->nic_baro);
+        }
+
+        // only emit alt, speed, latlon, track etc if they have been received since the last time
+        // and are not stale
+
+        char *dataStart = p;
+
+        // special cases
+        if (airgroundValid)
+            p = appendFATSVMeta(p, end, "airGround", a, &a->airground_valid,      "%s",   airground_enum_string(a->airground));
+        if (squawkValid)
+            p = appendFATSVMeta(p, end, "squawk", a, &a->squawk_valid,        "%04x", a->squawk);
+        if (callsignValid)
+            p = appendFATSVMeta(p, end, "ident", a, &a->callsign_valid,       "{%s}", a->callsign);
+        if (altValid)
+            p = appendFATSVMeta(p, end, "alt",   a, &a->altitude_baro_valid,  "%d",   a->altitude_baro);
+        if (positionValid) {
+            p = appendFATSVMeta(p, end, "position", a, &a->position_valid,  "{%.5f %.5f %u %u}", a->lat, a->lon, a->pos_nic, a->pos_rc);
+        }
+
+        p = appendFATSVMeta(p, end, "alt_gnss",    a, &a->altitude_geom_valid,  "%d",   a->altitude_geom);
+        p = appendFATSVMeta(p, end, "vrate",       a, &a->baro_rate_valid,      "%d",   a->baro_rate);
+        p = appendFATSVMeta(p, end, "vrate_geom",  a, &a->geom_rate_valid,      "%d",   a->geom_rate);
+        p = appendFATSVMeta(p, end, "speed",       a, &a->gs_valid,             "%.1f", a->gs);
+        p = appendFATSVMeta(p, end, "speed_ias",   a, &a->ias_valid,            "%u",   a->ias);
+        p = appendFATSVMeta(p, end, "speed_tas",   a, &a->tas_valid,            "%u",   a->tas);
+        p = appendFATSVMeta(p, end, "mach",        a, &a->mach_valid,           "%.3f", a->mach);
+        p = appendFATSVMeta(p, end, "track",       a, &a->track_valid,          "%.1f", a->track);
+        p = appendFATSVMeta(p, end, "track_rate",  a, &a->track_rate_valid,     "%.2f", a->track_rate);
+        p = appendFATSVMeta(p, end, "roll",        a, &a->roll_valid,           "%.1f", a->roll);
+        p = appendFATSVMeta(p, end, "heading_magnetic", a, &a->mag_heading_valid, "%.1f", a->mag_heading);
+        p = appendFATSVMeta(p, end, "heading_true", a, &a->true_heading_valid,    "%.1f", a->true_heading);
+        p = appendFATSVMeta(p, end, "nav_alt_mcp", a, &a->nav_altitude_mcp_valid, "%d",   a->nav_altitude_mcp);
+        p = appendFATSVMeta(p, end, "nav_alt_fms", a, &a->nav_altitude_fms_valid, "%d",   a->nav_altitude_fms);
+        p = appendFATSVMeta(p, end, "nav_alt_src", a, &a->nav_altitude_src_valid, "%s", nav_altitude_source_enum_string(a->nav_altitude_src));
+        p = appendFATSVMeta(p, end, "nav_heading", a, &a->nav_heading_valid,    "%.1f", a->nav_heading);
+        p = appendFATSVMeta(p, end, "nav_modes",   a, &a->nav_modes_valid,      "{%s}", nav_modes_flags_string(a->nav_modes));
+        p = appendFATSVMeta(p, end, "nav_qnh",     a, &a->nav_qnh_valid,        "%.1f", a->nav_qnh);
+        p = appendFATSVMeta(p, end, "emergency",   a, &a->emergency_valid,      "%s",   emergency_enum_string(a->emergency));
+        p = appendFATSVMeta(p, end, "mrar_source", a, &a->mrar_source_valid,    "%s",   mrar_source_enum_string(a->mrar_source));
+        p = appendFATSVMeta(p, end, "wind_speed",  a, &a->wind_valid,           "%.0f", a->wind_speed);
+        p = appendFATSVMeta(p, end, "wind_dir",    a, &a->wind_valid,           "%.1f", a->wind_dir);
+        p = appendFATSVMeta(p, end, "temperature", a, &a->temperature_valid,    "%.2f", a->temperature);
+        p = appendFATSVMeta(p, end, "pressure",    a, &a->pressure_valid,       "%.0f", a->pressure);
+        p = appendFATSVMeta(p, end, "turbulence",  a, &a->turbulence_valid,     "%s",   hazard_enum_string(a->turbulence));
+        p = appendFATSVMeta(p, end, "humidity",    a, &a->humidity_valid,       "%.0f", a->humidity);
+
+        // if we didn't get anything interesting, bail out.
+        // We don't need to do anything special to unwind prepareWrite().
+        if (p == dataStart) {
+            continue;
+        }
+
+        --p; // remove last tab
+        p = safe_snprintf(p, end, "\n");
+
+        if (p < end)
+            completeWrite(&Modes.fatsv_out, p);
+        else
+            fprintf(stderr, "fatsv: output too large (max %d, overran by %d)\n", TSV_MAX_PACKET_SIZE, (int) (p - end));
+
+        a->fatsv_emitted_altitude_baro = a->altitude_baro;
+        a->fatsv_emitted_altitude_geom = a->altitude_geom;
+        a->fatsv_emitted_baro_rate = a->baro_rate;
+        a->fatsv_emitted_geom_rate = a->geom_rate;
+        a->fatsv_emitted_gs = a->gs;
+        a->fatsv_emitted_ias = a->ias;
+        a->fatsv_emitted_tas = a->tas;
+        a->fatsv_emitted_mach = a->mach;
+        a->fatsv_emitted_track = a->track;
+        a->fatsv_emitted_track_rate = a->track_rate;
+        a->fatsv_emitted_roll = a->roll;
+        a->fatsv_emitted_mag_heading = a->mag_heading;
+        a->fatsv_emitted_true_heading = a->true_heading;
+        a->fatsv_emitted_airground = a->airground;
+        a->fatsv_emitted_nav_altitude_mcp = a->nav_altitude_mcp;
+        a->fatsv_emitted_nav_altitude_fms = a->nav_altitude_fms;
+        a->fatsv_emitted_nav_altitude_src = a->nav_altitude_src;
+        a->fatsv_emitted_nav_heading = a->nav_heading;
+        a->fatsv_emitted_nav_modes = a->nav_modes;
+        a->fatsv_emitted_nav_qnh = a->nav_qnh;
+        memcpy(a->fatsv_emitted_callsign, a->callsign, sizeof(a->fatsv_emitted_callsign));
+        a->fatsv_emitted_addrtype = a->addrtype;
+        a->fatsv_emitted_adsb_version = a->adsb_version;
+        a->fatsv_emitted_category = a->category;
+        a->fatsv_emitted_squawk = a->squawk;
+        a->fatsv_emitted_nac_p = a->nac_p;
+        a->fatsv_emitted_nac_v = a->nac_v;
+        a->fatsv_emitted_sil = a->sil;
+        a->fatsv_emitted_sil_type = a->sil_type;
+        a->fatsv_emitted_nic_baro = a->nic_baro;
+        a->fatsv_emitted_emergency = a->emergency;
+        a->fatsv_last_emitted = now;
+        if (forceEmit) {
+            a->fatsv_last_force_emit = now;
+        }
+    }
+}
+
+//
+// Service listeners and clients that the event loop reports as ready,
+// waiting up to timeout_ms for the first of them. Returns false (without
+// waiting) if there is no event loop.
+//
+static bool modesServiceEvents(int timeout_ms)
+{
+#ifdef NET_HAVE_EPOLL
+    struct epoll_event events[NET_EPOLL_BATCH];
+    int n, batches = 0;
+
+    if (net_epoll_fd < 0)
+        return false;
+
+    do {
+        n = epoll_wait(net_epoll_fd, events, NET_EPOLL_BATCH, batches ? 0 : timeout_ms);
+        if (n < 0) {
+            if (errno != EINTR)
+                fprintf(stderr, "epoll_wait failed: %s\n", strerror(errno));
+            return true;
+        }
+
+        for (int i = 0; i < n; ++i) {
+            struct net_event_source *source = events[i].data.ptr;
+
+            if (source->type == NET_SOURCE_WAKEUP) {
+                // just clear it; the caller looks for queued output after this
+                uint64_t count;
+                if (read(source->fd, &count, sizeof(count)) < 0) {
+                    // EAGAIN: already cleared
+                }
+                continue;
+            }
+
+            if (source->type == NET_SOURCE_LISTENER) {
+                int fd;
+                while ((fd = anetTcpAccept(Modes.aneterr, source->fd)) >= 0) {
+                    createSocketClient(source->service, fd);
+                }
+                continue;
+            }
+
+            // a client; it may have been closed while handling an earlier event
+            struct client *c = source->client;
+            if (!c->service)
+                continue;
+
+            if ((events[i].events & EPOLLOUT) && !drainClientQueue(c))
+                continue;
+
+            if (c->service->read_handler && (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR))) {
+                modesReadFromClient(c);
+            } else if (events[i].events & (EPOLLHUP | EPOLLERR)) {
+                // output-only client has gone away
+                modesCloseClient(c);
+            }
+        }
+    } while (n == NET_EPOLL_BATCH && ++batches < NET_EPOLL_MAX_BATCHES);
+
+    return true;
+#else
+    MODES_NOTUSED(timeout_ms);
+    return false;
+#endif
+}
+
+//
+//=========================================================================
+//
+// io_uring backend
+//
+// With --net-io-uring the network thread hands its sockets to io_uring
+// rather than servicing them through epoll and read()/writev():
+//
+//  * each listener has a multishot accept armed, so new connections
+//    arrive as completions without a wakeup and accept() per client
+//  * each client accepted after that has a multishot receive armed that
+//    fills buffers from a shared pool registered with the kernel, so
+//    reading costs no system calls at all beyond the ring's own
+//  * output is queued per client (see sendToClients) and one gathered
+//    write is armed for every client with queued output; the whole
+//    fan-out is then submitted with a single io_uring_enter. This happens
+//    between completions as well as once per pass, since one pass can
+//    carry a lot of input (and so output) when a feed bursts
+//  * a send's completion can queue up behind a lot of receives, so while
+//    a client with a send in flight is backlogged, receives are held back
+//    (for a while; see NET_URING_HOLD_MS) until it catches up, rather than
+//    growing its queue past the limit where epoll would have written
+//    straight to the socket. Sends that complete while held receives are
+//    being worked through are picked up in between, so one slow client
+//    doesn't make the others look backlogged too
+//
+// The epoll instance stays in place, watched by a poll request on the
+// ring, so the output wakeup eventfd and any clients that existed before
+// the thread started keep working as before. If the kernel can't do what
+// we need, we log it and stay on epoll.
+//
+
+#ifdef NET_HAVE_URING
+#define NET_URING_ENTRIES 1024       // submission queue size
+#define NET_URING_BUFFERS 512        // receive buffers in the pool; must be a power of two
+#define NET_URING_BUFFER_SIZE 4096   // size of each receive buffer
+#define NET_URING_BUFFER_GROUP 0
+#define NET_URING_MAX_REAP (NET_URING_ENTRIES * 4) // most completions handled per pass
+#define NET_URING_HOLD_MS 250        // longest that receives wait for a backlogged client's send
+
+// What a completion is for, in the low bits of user_data; the rest is the
+// listener's net_event_source or the client
+#define NET_URING_ACCEPT 1
+#define NET_URING_RECV 2
+#define NET_URING_SEND 3
+#define NET_URING_POLL 4
+#define NET_URING_OP_MASK 7
+
+static struct net_uring net_uring;
+static bool net_uring_active;       // true once the network thread is using io_uring
+static bool net_uring_recv_failed;  // the kernel can't do multishot receives; use epoll for new clients
+
+// Receive completions held back while a client is backlogged, oldest first
+struct net_uring_held {
+    struct client *client;
+    int res;
+    unsigned flags;
+};
+static struct net_uring_held *net_uring_held;
+static unsigned net_uring_held_first, net_uring_held_count, net_uring_held_size;
+static uint64_t net_uring_hold_since;  // when the current backlog started holding receives, or 0
+static bool net_uring_releasing;       // netUringReleaseReceives is working through the held receives
+
+// Get an SQE, submitting what has been prepared so far if the queue is full.
+// Returns NULL if that doesn't make room.
+static struct io_uring_sqe *netUringSqe(void)
+{
+    struct io_uring_sqe *sqe = uringGetSqe(&net_uring);
+    if (!sqe && uringSubmitAndWait(&net_uring, 0, 0) > 0)
+        sqe = uringGetSqe(&net_uring);
+    return sqe;
+}
+
+// Watch the epoll instance, so that the ring wakes up when it has events
+static bool netUringArmPoll(void)
+{
+    struct io_uring_sqe *sqe = netUringSqe();
+    if (!sqe)
+        return false;
+
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = net_epoll_fd;
+    sqe->poll32_events = POLLIN;
+    sqe->user_data = NET_URING_POLL;
+    return true;
+}
+
+static bool netUringArmAccept(struct net_event_source *source)
+{
+    struct io_uring_sqe *sqe = netUringSqe();
+    if (!sqe)
+        return false;
+
+    sqe->opcode = IORING_OP_ACCEPT;
+    sqe->fd = source->fd;
+    sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+    sqe->user_data = (uintptr_t) source | NET_URING_ACCEPT;
+    return true;
+}
+
+static bool netUringArmRecv(struct client *c)
+{
+    struct io_uring_sqe *sqe = netUringSqe();
+    if (!sqe)
+        return false;
+
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = c->fd;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = NET_URING_BUFFER_GROUP;
+    sqe->user_data = (uintptr_t) c | NET_URING_RECV;
+    ++c->uring_pending;
+    return true;
+}
+
+// Arm a gathered write of the head of a client's output queue
+static void netUringArmSend(struct client *c)
+{
+    struct net_queued_write *q;
+    struct io_uring_sqe *sqe;
+    int n = 0;
+
+    if (!c->uring_iov && !(c->uring_iov = malloc(NET_IOV_BATCH * sizeof(*c->uring_iov))))
+        return; // try again next pass
+
+    if (!(sqe = netUringSqe()))
+        return;
+
+    for (q = c->sendq; q && n < NET_IOV_BATCH; q = q->next, ++n) {
+        c->uring_iov[n].iov_base = q->chunk->data + q->offset;
+        c->uring_iov[n].iov_len = q->chunk->len - q->offset;
+    }
+
+    sqe->opcode = IORING_OP_WRITEV;
+    sqe->fd = c->fd;
+    sqe->addr = (uintptr_t) c->uring_iov;
+    sqe->len = n;
+    sqe->user_data = (uintptr_t) c | NET_URING_SEND;
+    c->uring_sending = 1;
+    ++c->uring_pending;
+}
+
+// Arm a send for every io_uring client that has output waiting and none in
+// flight; this picks up any that couldn't be armed when the output arrived
+static void netUringArmSends(void)
+{
+    for (struct client *c = Modes.clients; c; c = c->next) {
+        if (c->uring && c->service && c->sendq && !c->uring_sending)
+            netUringArmSend(c);
+    }
+}
+
+// Pick up whatever output the main thread has produced, and submit the
+// sends for it (and anything else armed so far) without waiting
+static void netUringFlushOutput(void)
+{
+    sendQueuedOutput();
+    uringSubmitAndWait(&net_uring, 0, 0);
+}
+
+// Called for every new client; returns false if it should be watched by epoll instead
+static bool netUringWatchClient(struct client *c)
+{
+    if (!net_uring_active || net_uring_recv_failed)
+        return false;
+
+    // io_uring waits for the socket itself; with O_NONBLOCK set it would
+    // hand EAGAIN back to us instead
+    int flags = fcntl(c->fd, F_GETFL);
+    if (flags < 0 || fcntl(c->fd, F_SETFL, flags & ~O_NONBLOCK) < 0)
+        return false;
+
+    if (!netUringArmRecv(c)) {
+        fcntl(c->fd, F_SETFL, flags);
+        return false;
+    }
+
+    c->uring = 1;
+    c->watched = 1;
+    return true;
+}
+
+// Feed data received by io_uring through the client's read buffer
+static void netUringClientInput(struct client *c, const char *data, size_t len)
+{
+    if (!c->service->read_handler)
+        return; // output-only client; discard it
+
+    while (len && c->service) {
+        int left = MODES_CLIENT_BUF_SIZE - c->buflen - 1;
+        if (left <= 0) {
+            // buffer is full of garbage, as in modesReadFromClient
+            c->buflen = 0;
+            left = MODES_CLIENT_BUF_SIZE - 1;
+        }
+
+        size_t n = len < (size_t) left ? len : (size_t) left;
+        memcpy(c->buf + c->buflen, data, n);
+        c->buflen += n;
+        data += n;
+        len -= n;
+
+        if (consumeClientInput(c) == CLIENT_INPUT_CLOSED)
+            return;
+    }
+}
+
+static void netUringRecvComplete(struct client *c, int res, unsigned flags)
+{
+    if (flags & IORING_CQE_F_BUFFER) {
+        unsigned bid = flags >> IORING_CQE_BUFFER_SHIFT;
+        if (res > 0 && c->service)
+            netUringClientInput(c, uringBuffer(&net_uring, bid), res);
+        uringRecycleBuffer(&net_uring, bid);
+    }
+
+    if (flags & IORING_CQE_F_MORE)
+        return; // still armed
+
+    --c->uring_pending;
+    if (!c->service)
+        return; // closed
+
+    if (res > 0 || res == -ENOBUFS || res == -EINTR) {
+        // the kernel stopped the receive early (e.g. the pool ran dry); rearm it
+        if (!netUringArmRecv(c))
+            modesCloseClient(c);
+        return;
+    }
+
+    if (res == -EINVAL && !net_uring_recv_failed) {
+        fprintf(stderr, "io_uring multishot receive not supported, new network clients will use epoll\n");
+        net_uring_recv_failed = true;
+    }
+
+    // end of file, or an error
+    modesCloseClient(c);
+}
+
+static void netUringSendComplete(struct client *c, int res)
+{
+    --c->uring_pending;
+    c->uring_sending = 0;
+
+    if (!c->service) {
+        // closed while the send was in flight; modesCloseClient left this to us
+        clearClientQueue(c);
+        return;
+    }
+
+    if (res < 0 && res != -EAGAIN && res != -EINTR) {
+        modesCloseClient(c);
+        return;
+    }
+
+    if (res > 0)
+        retireClientQueue(c, res);
+    if (c->sendq)
+        netUringArmSend(c); // the rest, or output queued while this was in flight
+    else if (c->close_when_sent)
+        modesCloseClient(c);
+}
+
+// Should receives be held back? True while some client with a send in
+// flight has more than half its queue limit waiting, for up to
+// NET_URING_HOLD_MS; after that the client is probably just slow, and
+// is left to the queue limit.
+static bool netUringHoldReceives(void)
+{
+    size_t threshold = clientQueueLimit() / 2;
+    bool backlogged = false;
+
+    for (struct client *c = Modes.clients; c && !backlogged; c = c->next)
+        backlogged = (c->uring && c->uring_sending && c->sendq_bytes > threshold);
+
+    if (!backlogged) {
+        net_uring_hold_since = 0;
+        return false;
+    }
+
+    uint64_t now = mstime();
+    if (!net_uring_hold_since)
+        net_uring_hold_since = now;
+    return now - net_uring_hold_since < NET_URING_HOLD_MS;
+}
 
-        uint64_t minAge;
-        double adjustedMinAge;
-        if (immediate) {
-            // a change we want to emit right away
-            minAge = 0;
-        } else if (!positionValid) {
-            // don't send mode S very often
-            minAge = 30000;
-        } else if ((airgroundValid && a->airground == AG_GROUND) ||
-                   (altValid && a->altitude_baro < 500 && (!gsValid || a->gs < 200)) ||
-                   (gsValid && a->gs < 100 && (!altValid || a->altitude_baro < 1000))) {
-            // we are probably on the ground, increase the update rate
-            minAge = 1000;
-        } else if (!altValid || a->altitude_baro < 10000) {
-            // Below 10000 feet, emit up to every 5s when changing, 10s otherwise
-            minAge = (changed ? 5000 : 10000);
-        } else {
-            // Above 10000 feet, emit up to every 10s when changing, 30s otherwise
-            minAge = (changed ? 10000 : 30000);
-        }
+static void netUringReapCompletions(void);
 
-        // Adjust rate for multiplier
-        adjustedMinAge = minAge / Modes.faup_rate_multiplier;
+// Handle held receive completions, oldest first, while nothing is
+// backlogged (or all of them, if 'force' is set)
+static void netUringReleaseReceives(bool force)
+{
+    // receives that complete meanwhile join the back of the queue, and
+    // wait for the next call
+    unsigned last = net_uring_held_count;
+    bool releasing = net_uring_releasing;
+
+    net_uring_releasing = true;
+    while (net_uring_held_first < net_uring_held_count && net_uring_held_first < last && (force || !netUringHoldReceives())) {
+        struct net_uring_held h = net_uring_held[net_uring_held_first++];
+        netUringRecvComplete(h.client, h.res, h.flags);
+        netUringFlushOutput();
+
+        // pick up the sends that completed since, or the output from a long
+        // run of held receives piles up behind them even for clients that
+        // are keeping up
+        if (!force)
+            netUringReapCompletions();
+    }
+    net_uring_releasing = releasing;
 
-        if ((now - a->fatsv_last_emitted) < adjustedMinAge) {
-            continue;
-        }
+    if (net_uring_held_first == net_uring_held_count)
+        net_uring_held_first = net_uring_held_count = 0;
+}
 
-        char *p = prepareWrite(&Modes.fatsv_out, TSV_MAX_PACKET_SIZE);
-        if (!p)
+// Handle a receive completion now, or hold it back behind a backlog
+static void netUringReceive(struct client *c, struct io_uring_cqe *cqe)
+{
+    if (!net_uring_held_count && !netUringHoldReceives()) {
+        netUringRecvComplete(c, cqe->res, cqe->flags);
+        return;
+    }
+
+    if (net_uring_held_count == net_uring_held_size) {
+        unsigned size = net_uring_held_size ? net_uring_held_size * 2 : NET_URING_BUFFERS;
+        struct net_uring_held *held = realloc(net_uring_held, size * sizeof(*held));
+        if (!held) {
+            // can't hold it; keep things in order and carry on
+            netUringReleaseReceives(true);
+            netUringRecvComplete(c, cqe->res, cqe->flags);
             return;
-        char *end = p + TSV_MAX_PACKET_SIZE;
+        }
+        net_uring_held = held;
+        net_uring_held_size = size;
+    }
 
-        p = appendFATSV(p, end, "_v",    "%s", TSV_VERSION);
-        p = appendFATSV(p, end, "clock", "%" PRIu64, messageNow() / 1000);
-        p = appendFATSV(p, end, (a->addr & MODES_NON_ICAO_ADDRESS) ? "otherid" : "hexid", "%06X", a->addr & 0xFFFFFF);
+    net_uring_held[net_uring_held_count++] = (struct net_uring_held) { c, cqe->res, cqe->flags };
 
-        // for fields we only emit on change,
-        // occasionally re-emit them all
-        int forceEmit = (now - a->fatsv_last_force_emit) > 600000;
+    // then let go of what we can, unless this arrived while
+    // netUringReleaseReceives was already doing that
+    if (!net_uring_releasing)
+        netUringReleaseReceives(false);
+}
 
-        // these don't change often / at all, only emit when they change
-        if (forceEmit || a->addrtype != a->fatsv_emitted_addrtype) {
-            p = appendFATSV(p, end, "addrtype", "%s", addrtype_enum_string(a->addrtype));
-        }
-        if (forceEmit || a->adsb_version != a->fatsv_emitted_adsb_version) {
-            p = appendFATSV(p, end, "adsb_version", "%d", a->adsb_version);
-        }
-        if (forceEmit || a->category != a->fatsv_emitted_category) {
-            p = appendFATSV(p, end, "category", "%02X", a->category);
-        }
-        if (trackDataValid(&a->nac_p_valid) && (forceEmit || a->nac_p != a->fatsv_emitted_nac_p)) {
-            p = appendFATSVMeta(p, end, "nac_p",       a, &a->nac_p_valid,         "%u",       a->nac_p);
-        }
-        if (trackDataValid(&a->nac_v_valid) && (forceEmit || a->nac_v != a->fatsv_emitted_nac_v)) {
-            p = appendFATSVMeta(p, end, "nac_v",       a, &a->nac_v_valid,         "%u",       a->nac_v);
-        }
-        if (trackDataValid(&a->sil_valid) && (forceEmit || a->sil != a->fatsv_emitted_sil)) {
-            p = appendFATSVMeta(p, end, "sil",         a, &a->sil_valid,           "%u",       a->sil);
-        }
-        if (trackDataValid(&a->sil_valid) && (forceEmit || a->sil_type != a->fatsv_emitted_sil_type)) {
-            p = appendFATSVMeta(p, end, "sil_type",    a, &a->sil_valid,           "%s",       sil_type_enum_string(a->sil_type));
-        }
-        if (trackDataValid(&a->nic_baro_valid) && (forceEmit || a->nic_baro != a->fatsv_emitted_nic_baro)) {
-            p = appendFATSVMeta(p, end, "nic_baro",    a, &a->nic_baro_valid,      "%u",       (unsigned) a->nic_baro);
-        }
+static void netUringAcceptComplete(struct net_event_source *source, struct io_uring_cqe *cqe)
+{
+    if (cqe->res >= 0)
+        createSocketClient(source->service, cqe->res);
 
-        // only emit alt, speed, latlon, track etc if they have been received since the last time
-        // and are not stale
+    if (cqe->flags & IORING_CQE_F_MORE)
+        return; // still armed
 
-        char *dataStart = p;
+    if (cqe->res == -EINVAL || !netUringArmAccept(source)) {
+        // no multishot accept (or no room to rearm): back to epoll for this listener
+        if (!netWatch(source, true))
+            source->service->listeners_polled = 1;
+    }
+}
 
-        // special cases
-        if (airgroundValid)
-            p = appendFATSVMeta(p, end, "airGround", a, &a->airground_valid,      "%s",   airground_enum_string(a->airground));
-        if (squawkValid)
-            p = appendFATSVMeta(p, end, "squawk", a, &a->squawk_valid,        "%04x", a->squawk);
-        if (callsignValid)
-            p = appendFATSVMeta(p, end, "ident", a, &a->callsign_valid,       "{%s}", a->callsign);
-        if (altValid)
-            p = appendFATSVMeta(p, end, "alt",   a, &a->altitude_baro_valid,  "%d",   a->altitude_baro);
-        if (positionValid) {
-            p = appendFATSVMeta(p, end, "position", a, &a->position_valid,  "{%.5f %.5f %u %u}", a->lat, a->lon, a->pos_nic, a->pos_rc);
+// Handle the completions that are ready (up to NET_URING_MAX_REAP of them)
+static void netUringReapCompletions(void)
+{
+    struct io_uring_cqe *next, copy, *cqe = &copy;
+    unsigned reaped = 0;
+
+    while (reaped++ < NET_URING_MAX_REAP && (next = uringPeekCqe(&net_uring))) {
+        // handling a receive can reap completions in turn (see
+        // netUringReleaseReceives), so be done with this one first
+        copy = *next;
+        uringCqeSeen(&net_uring);
+
+        void *ptr = (void *) (uintptr_t) (cqe->user_data & ~(uint64_t) NET_URING_OP_MASK);
+
+        switch (cqe->user_data & NET_URING_OP_MASK) {
+        case NET_URING_POLL:
+            // the wakeup eventfd, or a client or listener still on epoll
+            modesServiceEvents(0);
+            if (!netUringArmPoll())
+                fprintf(stderr, "io_uring: couldn't rearm the epoll watch\n");
+            break;
+        case NET_URING_ACCEPT:
+            netUringAcceptComplete(ptr, cqe);
+            break;
+        case NET_URING_RECV:
+            netUringReceive(ptr, cqe);
+            break;
+        case NET_URING_SEND:
+            netUringSendComplete(ptr, cqe->res);
+            break;
         }
 
-        p = appendFATSVMeta(p, end, "alt_gnss",    a, &a->altitude_geom_valid,  "%d",   a->altitude_geom);
-        p = appendFATSVMeta(p, end, "vrate",       a, &a->baro_rate_valid,      "%d",   a->baro_rate);
-        p = appendFATSVMeta(p, end, "vrate_geom",  a, &a->geom_rate_valid,      "%d",   a->geom_rate);
-        p = appendFATSVMeta(p, end, "speed",       a, &a->gs_valid,             "%.1f", a->gs);
-        p = appendFATSVMeta(p, end, "speed_ias",   a, &a->ias_valid,            "%u",   a->ias);
-        p = appendFATSVMeta(p, end, "speed_tas",   a, &a->tas_valid,            "%u",   a->tas);
-        p = appendFATSVMeta(p, end, "mach",        a, &a->mach_valid,           "%.3f", a->mach);
-        p = appendFATSVMeta(p, end, "track",       a, &a->track_valid,          "%.1f", a->track);
-        p = appendFATSVMeta(p, end, "track_rate",  a, &a->track_rate_valid,     "%.2f", a->track_rate);
-        p = appendFATSVMeta(p, end, "roll",        a, &a->roll_valid,           "%.1f", a->roll);
-        p = appendFATSVMeta(p, end, "heading_magnetic", a, &a->mag_heading_valid, "%.1f", a->mag_heading);
-        p = appendFATSVMeta(p, end, "heading_true", a, &a->true_heading_valid,    "%.1f", a->true_heading);
-        p = appendFATSVMeta(p, end, "nav_alt_mcp", a, &a->nav_altitude_mcp_valid, "%d",   a->nav_altitude_mcp);
-        p = appendFATSVMeta(p, end, "nav_alt_fms", a, &a->nav_altitude_fms_valid, "%d",   a->nav_altitude_fms);
-        p = appendFATSVMeta(p, end, "nav_alt_src", a, &a->nav_altitude_src_valid, "%s", nav_altitude_source_enum_string(a->nav_altitude_src));
-        p = appendFATSVMeta(p, end, "nav_heading", a, &a->nav_heading_valid,    "%.1f", a->nav_heading);
-        p = appendFATSVMeta(p, end, "nav_modes",   a, &a->nav_modes_valid,      "{%s}", nav_modes_flags_string(a->nav_modes));
-        p = appendFATSVMeta(p, end, "nav_qnh",     a, &a->nav_qnh_valid,        "%.1f", a->nav_qnh);
-        p = appendFATSVMeta(p, end, "emergency",   a, &a->emergency_valid,      "%s",   emergency_enum_string(a->emergency));
-        p = appendFATSVMeta(p, end, "mrar_source", a, &a->mrar_source_valid,    "%s",   mrar_source_enum_string(a->mrar_source));
-        p = appendFATSVMeta(p, end, "wind_speed",  a, &a->wind_valid,           "%.0f", a->wind_speed);
-        p = appendFATSVMeta(p, end, "wind_dir",    a, &a->wind_valid,           "%.1f", a->wind_dir);
-        p = appendFATSVMeta(p, end, "temperature", a, &a->temperature_valid,    "%.2f", a->temperature);
-        p = appendFATSVMeta(p, end, "pressure",    a, &a->pressure_valid,       "%.0f", a->pressure);
-        p = appendFATSVMeta(p, end, "turbulence",  a, &a->turbulence_valid,     "%s",   hazard_enum_string(a->turbulence));
-        p = appendFATSVMeta(p, end, "humidity",    a, &a->humidity_valid,       "%.0f", a->humidity);
+        // input handled above may have produced output; send it now
+        // rather than after the rest of the completions
+        netUringFlushOutput();
+    }
+}
 
-        // if we didn't get anything interesting, bail out.
-        // We don't need to do anything special to unwind prepareWrite().
-        if (p == dataStart) {
+//
+// Submit everything prepared since the last call, wait up to timeout_ms
+// for completions, and handle them
+//
+static void netUringServiceEvents(int timeout_ms)
+{
+    // while receives are held, look again soon even if nothing completes
+    if (net_uring_held_count && (timeout_ms < 0 || timeout_ms > NET_THREAD_POLL_MS))
+        timeout_ms = NET_THREAD_POLL_MS;
+
+    int ret = uringSubmitAndWait(&net_uring, 1, timeout_ms);
+    if (ret < 0 && ret != -EBUSY)
+        fprintf(stderr, "io_uring_enter failed: %s\n", strerror(-ret));
+
+    netUringReapCompletions();
+    netUringReleaseReceives(false);
+}
+
+//
+// Network thread startup: switch to io_uring if we can. Listeners that are
+// on epoll move to multishot accepts; clients that already exist stay where
+// they are.
+//
+static void netUringStart(void)
+{
+    if (net_epoll_fd < 0)
+        return;
+
+    if (!uringInit(&net_uring, NET_URING_ENTRIES) ||
+        !uringSetupBuffers(&net_uring, NET_URING_BUFFER_GROUP, NET_URING_BUFFERS, NET_URING_BUFFER_SIZE) ||
+        !netUringArmPoll()) {
+        fprintf(stderr, "io_uring not available (%s), using epoll for network I/O\n", strerror(errno));
+        uringDestroy(&net_uring);
+        return;
+    }
+
+    for (struct net_service *s = Modes.services; s; s = s->next) {
+        if (s->listeners_polled)
             continue;
+
+        for (int i = 0; i < s->listener_count; ++i) {
+            struct net_event_source *source = &s->listener_sources[i];
+            if (epoll_ctl(net_epoll_fd, EPOLL_CTL_DEL, source->fd, NULL) < 0)
+                continue;
+            if (!netUringArmAccept(source) && !netWatch(source, true))
+                s->listeners_polled = 1;
         }
+    }
 
-        --p; // remove last tab
-        p = safe_snprintf(p, end, "\n");
+    net_uring_active = true;
+    fprintf(stderr, "Using io_uring for network I/O\n");
+}
+#endif /* NET_HAVE_URING */
 
-        if (p < end)
-            completeWrite(&Modes.fatsv_out, p);
-        else
-            fprintf(stderr, "fatsv: output too large (max %d, overran by %d)\n", TSV_MAX_PACKET_SIZE, (int) (p - end));
+//
+// Accept new connections, read from clients, and send queued output to
+// clients, waiting up to timeout_ms for something to happen. Returns
+// false if it could not wait.
+//
+static bool netServiceClients(int timeout_ms) {
+    struct client *c;
 
-        a->fatsv_emitted_altitude_baro = a->altitude_baro;
-        a->fatsv_emitted_altitude_geom = a->altitude_geom;
-        a->fatsv_emitted_baro_rate = a->baro_rate;
-        a->fatsv_emitted_geom_rate = a->geom_rate;
-        a->fatsv_emitted_gs = a->gs;
-        a->fatsv_emitted_ias = a->ias;
-        a->fatsv_emitted_tas = a->tas;
-        a->fatsv_emitted_mach = a->mach;
-        a->fatsv_emitted_track = a->track;
-        a->fatsv_emitted_track_rate = a->track_rate;
-        a->fatsv_emitted_roll = a->roll;
-        a->fatsv_emitted_mag_heading = a->mag_heading;
-        a->fatsv_emitted_true_heading = a->true_heading;
-        a->fatsv_emitted_airground = a->airground;
-        a->fatsv_emitted_nav_altitude_mcp = a->nav_altitude_mcp;
-        a->fatsv_emitted_nav_altitude_fms = a->nav_altitude_fms;
-        a->fatsv_emitted_nav_altitude_src = a->nav_altitude_src;
-        a->fatsv_emitted_nav_heading = a->nav_heading;
-        a->fatsv_emitted_nav_modes = a->nav_modes;
-        a->fatsv_emitted_nav_qnh = a->nav_qnh;
-        memcpy(a->fatsv_emitted_callsign, a->callsign, sizeof(a->fatsv_emitted_callsign));
-        a->fatsv_emitted_addrtype = a->addrtype;
-        a->fatsv_emitted_adsb_version = a->adsb_version;
-        a->fatsv_emitted_category = a->category;
-        a->fatsv_emitted_squawk = a->squawk;
-        a->fatsv_emitted_nac_p = a->nac_p;
-        a->fatsv_emitted_nac_v = a->nac_v;
-        a->fatsv_emitted_sil = a->sil;
-        a->fatsv_emitted_sil_type = a->sil_type;
-        a->fatsv_emitted_nic_baro = a->nic_baro;
-        a->fatsv_emitted_emergency = a->emergency;
-        a->fatsv_last_emitted = now;
-        if (forceEmit) {
-            a->fatsv_last_force_emit = now;
+    // Accept new connections and read from clients that have data waiting
+    bool waited;
+#ifdef NET_HAVE_URING
+    if (net_uring_active) {
+        netUringServiceEvents(timeout_ms);
+        waited = true;
+    } else
+#endif
+        waited = modesServiceEvents(timeout_ms);
+
+    // Accept new connections on listeners that the event loop isn't watching
+    modesAcceptClients();
+
+    // Read from, and send queued output to, clients that the event loop isn't watching
+    for (c = Modes.clients; c; c = c->next) {
+        if (!c->service || c->watched)
+            continue;
+        if (c->sendq && !drainClientQueue(c))
+            continue;
+        if (c->service->read_handler)
+            modesReadFromClient(c);
+    }
+
+    return waited;
+}
+
+// Unlink and free closed clients
+static void netPruneClients(void) {
+    struct client *c, **prev;
+
+    for (prev = &Modes.clients, c = *prev; c; c = *prev) {
+        if (c->fd == -1 && !c->uring_pending) {
+            // Recently closed, prune from list
+            *prev = c->next;
+            free(c->uring_iov);
+            free(c);
+        } else {
+            prev = &c->next;
         }
     }
 }
@@ -2892,20 +5581,17 @@ static void writeFATSV()
 // Perform periodic network work
 //
 void modesNetPeriodicWork(void) {
-    struct client *c, **prev;
     struct net_service *s;
     uint64_t now = mstime();
     int need_flush = 0;
 
-    // Accept new connections
-    modesAcceptClients();
-
-    // Read from clients
-    for (c = Modes.clients; c; c = c->next) {
-        if (!c->service)
-            continue;
-        if (c->service->read_handler)
-            modesReadFromClient(c);
+    if (net_threaded) {
+        // The network thread has done the socket work; pick up what it read,
+        // and give it anything that didn't fit in net_output last time
+        drainRemoteInput();
+        netOutputRetry();
+    } else {
+        netServiceClients(0);
     }
 
     // Generate FATSV output
@@ -2934,16 +5620,118 @@ void modesNetPeriodicWork(void) {
         }
     }
 
-    // Unlink and free closed clients
-    for (prev = &Modes.clients, c = *prev; c; c = *prev) {
-        if (c->fd == -1) {
-            // Recently closed, prune from list
-            *prev = c->next;
-            free(c);
-        } else {
-            prev = &c->next;
+    if (!net_threaded) {
+        netPruneClients();
+        netPublishStats(NULL);
+    }
+}
+
+static void *netThreadEntryPoint(void *arg)
+{
+    struct timespec start_time, cpu = { 0, 0 };
+    MODES_NOTUSED(arg);
+
+    set_thread_name("dump1090-net");
+    start_cpu_timing(&start_time);
+
+    while (!atomic_load(&net_thread_exit)) {
+        if (!netServiceClients(NET_THREAD_WAIT_MS)) {
+            // nothing will wake us, so just poll
+            struct timespec slp = { 0, NET_THREAD_POLL_MS * 1000 * 1000 };
+            nanosleep(&slp, NULL);
+        }
+
+        if (net_input_pushed)
+            netSignalInput();
+
+#ifdef NET_HAVE_URING
+        if (net_uring_active) {
+            netUringArmSends();
+            netUringFlushOutput();
+        } else
+#endif
+            sendQueuedOutput();
+        netPruneClients();
+
+        update_cpu_timing(&start_time, &cpu);
+        netPublishStats(&cpu);
+        cpu.tv_sec = cpu.tv_nsec = 0;
+    }
+
+    return NULL;
+}
+
+//
+// Move all socket work to a dedicated network thread. After this, only
+// the network thread may touch sockets or the client list; the main
+// thread continues to call modesNetPeriodicWork to process input and
+// generate output.
+//
+bool modesNetStartThread(void)
+{
+#ifdef NET_HAVE_EPOLL
+    if (netEventInit()) {
+        if ((net_wakeup_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) >= 0) {
+            net_wakeup_source.type = NET_SOURCE_WAKEUP;
+            net_wakeup_source.fd = net_wakeup_fd;
+            net_wakeup_source.service = NULL;
+            net_wakeup_source.client = NULL;
+            if (!netWatch(&net_wakeup_source, true)) {
+                close(net_wakeup_fd);
+                net_wakeup_fd = -1;
+            }
         }
+
+        if (net_wakeup_fd < 0)
+            fprintf(stderr, "Couldn't set up network thread wakeups (%s), output may be delayed\n", strerror(errno));
+    }
+#endif
+
+#ifdef NET_HAVE_URING
+    if (Modes.net_io_uring)
+        netUringStart();
+#endif
+
+    atomic_store(&net_thread_exit, false);
+    net_threaded = true;
+
+    int err = pthread_create(&net_thread, NULL, netThreadEntryPoint, NULL);
+    if (err) {
+        fprintf(stderr, "Failed to create network thread: %s\n", strerror(err));
+        net_threaded = false;
+        return false;
+    }
+
+    return true;
+}
+
+// Stop the network thread; socket work goes back to modesNetPeriodicWork
+void modesNetStopThread(void)
+{
+    int slot;
+
+    if (!net_threaded)
+        return;
+
+    atomic_store(&net_thread_exit, true);
+    netWakeThread();
+    pthread_mutex_lock(&net_input_mutex);
+    pthread_cond_signal(&net_input_space_cond);
+    pthread_mutex_unlock(&net_input_mutex);
+
+    pthread_join(net_thread, NULL);
+    net_threaded = false;
+
+    // discard anything still in flight
+    while ((slot = ringPeek(&net_input_ring, NET_INPUT_QUEUE_SIZE)) >= 0)
+        ringConsume(&net_input_ring);
+    while ((slot = ringPeek(&net_output_ring, NET_OUTPUT_QUEUE_SIZE)) >= 0) {
+        releaseChunk(net_output_slots[slot].chunk);
+        if (net_output_slots[slot].gzip)
+            releaseChunk(net_output_slots[slot].gzip);
+        ringConsume(&net_output_ring);
     }
+    netOutputDiscardOverflow();
 }
 
 //
@@ -26,7 +26,12 @@ struct aircraft;
 struct modesMessage;
 struct client;
 struct net_service;
+struct iovec;
+// Read handlers return 0 on success, 1 to close the client, or NET_READ_DEFER
+// to leave the message in the buffer and stop reading it until the client is
+// resumed
 typedef int (*read_fn)(struct client *, char *);
+#define NET_READ_DEFER 2
 typedef void (*heartbeat_fn)(struct net_service *);
 
 typedef enum {
@@ -36,14 +41,46 @@ typedef enum {
     READ_MODE_ASCII
 } read_mode_t;
 
+// Something that can be registered with the network event loop
+// (see netWatch in net_io.c): either a listening socket or a client
+typedef enum {
+    NET_SOURCE_LISTENER,
+    NET_SOURCE_CLIENT,
+    NET_SOURCE_WAKEUP
+} net_source_type_t;
+
+// A block of output data shared between all the clients that still need
+// to send it; freed when the last of them has
+struct net_chunk {
+    unsigned refcount;
+    int len;
+    char data[];
+};
+
+// One entry in a client's output queue
+struct net_queued_write {
+    struct net_queued_write *next;
+    struct net_chunk *chunk;
+    int offset;                  // bytes of chunk already sent
+};
+
+struct net_event_source {
+    net_source_type_t type;
+    int fd;
+    struct net_service *service;  // NET_SOURCE_LISTENER: service to accept into
+    struct client *client;        // NET_SOURCE_CLIENT: the client
+};
+
 // Describes one network service (a group of clients with common behaviour)
 struct net_service {
     struct net_service* next;
     const char *descr;
     int listener_count;  // number of listeners
     int *listener_fds;   // listening FDs
+    struct net_event_source *listener_sources; // event loop registrations, one per listener
+    int listeners_polled; // 1 if some listeners are not watched by the event loop and must be polled
 
-    int connections;     // number of active clients
+    atomic_int connections; // number of active clients (maintained by the network thread, read by the main thread)
 
     struct net_writer *writer; // shared writer state
 
@@ -62,12 +99,24 @@ struct client {
     int    modeac_requested;             // 1 if this Beast output connection has asked for A/C
     int    verbatim_requested;           // 1 if this Beast output connection has asked for verbatim mode
     int    local_requested;              // 1 if this Beast output connection has asked for local-only mode
+    struct net_event_source source;      // event loop registration
+    int    watched;                      // 1 if the event loop reports readiness for this client; 0 if it must be polled
+    struct net_queued_write *sendq;      // output not yet accepted by the socket, oldest first
+    struct net_queued_write **sendq_tail;// where to link the next queued write
+    size_t sendq_bytes;                  // bytes outstanding in sendq
+    int    uring;                        // 1 if io_uring services this client (see net_io.c)
+    int    uring_pending;                // io_uring operations in flight; the client can't be freed until they complete
+    int    uring_sending;                // 1 while an io_uring send of the head of sendq is in flight
+    struct iovec *uring_iov;             // buffers for that send
+    int    close_when_sent;              // 1 to close the client once sendq is empty (HTTP without keep-alive)
+    int    http_waiting;                 // 1 while an HTTP request waits for a snapshot to be regenerated
 };
 
 // Common writer state for all output sockets of one type
 struct net_writer {
     struct net_service *service; // owning service
-    void *data;          // shared write buffer, sized MODES_OUT_BUF_SIZE
+    void *data;          // shared write buffer
+    int size;            // size of data: the flush size plus room for one more message
     int dataUsed;        // number of bytes of write buffer currently used
     uint64_t lastWrite;  // time of last write to clients
     heartbeat_fn send_heartbeat; // function that queues a heartbeat if needed
@@ -89,12 +138,21 @@ void sendBeastSettings(struct client *c, const char *settings);
 void modesInitNet(void);
 void modesQueueOutput(struct modesMessage *mm, struct aircraft *a);
 void modesNetPeriodicWork(void);
+bool modesNetStartThread(void);
+void modesNetStopThread(void);
+void modesNetWaitForInput(int timeout_ms);
+struct stats;
+void modesNetCollectStats(struct stats *st);
 
 // TODO: move these somewhere else
 char *generateAircraftJson(const char *url_path, int *len);
+char *generateAircraftDeltaJson(const char *url_path, int *len);
 char *generateStatsJson(const char *url_path, int *len);
 char *generateReceiverJson(const char *url_path, int *len);
 char *generateHistoryJson(const char *url_path, int *len);
-void writeJsonToFile(const char *file, char * (*generator) (const char *,int*));
+void publishJson(const char *file, char * (*generator) (const char *,int*));
+bool modesJsonWanted(const char *file);
+void modesJsonInvalidate(const char *file);
+bool modesJsonRequested(const char *file);
 
 #endif
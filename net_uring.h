@@ -0,0 +1,93 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// net_uring.h: minimal io_uring wrapper for the network thread
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DUMP1090_NET_URING_H
+#define DUMP1090_NET_URING_H
+
+// io_uring is driven through the raw system calls, so all we need is a
+// kernel header new enough (Linux 6.0) to describe multishot receives.
+#if defined(__linux__) && defined(__has_include)
+#  if __has_include(<linux/io_uring.h>)
+#    include <linux/io_uring.h>
+#    ifdef IORING_RECV_MULTISHOT
+#      define NET_HAVE_URING
+#    endif
+#  endif
+#endif
+
+#ifdef NET_HAVE_URING
+
+struct net_uring {
+    int fd;
+
+    // submission queue
+    void *sq_map;
+    size_t sq_map_size;
+    unsigned *sq_head;
+    unsigned *sq_tail;
+    unsigned sq_mask;
+    unsigned sq_entries;
+    struct io_uring_sqe *sqes;
+    size_t sqes_size;
+    unsigned sqe_tail;          // next SQE to hand out; published by uringSubmitAndWait
+
+    // completion queue
+    void *cq_map;               // == sq_map if the kernel maps both rings together
+    size_t cq_map_size;
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    unsigned cq_mask;
+    struct io_uring_cqe *cqes;
+
+    // provided receive buffers
+    struct io_uring_buf_ring *buf_ring;
+    size_t buf_ring_size;
+    char *buf_base;
+    unsigned buf_count;         // power of two
+    unsigned buf_size;
+    unsigned buf_group;
+    unsigned short buf_tail;    // local copy of buf_ring->tail
+};
+
+// Set up a ring with room for 'entries' submissions. Returns false (with
+// errno set) if io_uring is unavailable or lacks the features we need.
+bool uringInit(struct net_uring *ring, unsigned entries);
+void uringDestroy(struct net_uring *ring);
+
+// Get a zeroed SQE to fill in, or NULL if the submission queue is full
+struct io_uring_sqe *uringGetSqe(struct net_uring *ring);
+
+// Submit everything prepared so far, then wait up to timeout_ms for at
+// least wait_nr completions. Returns the number submitted, or -errno.
+int uringSubmitAndWait(struct net_uring *ring, unsigned wait_nr, int timeout_ms);
+
+// Return the oldest unprocessed completion, or NULL if there is none
+struct io_uring_cqe *uringPeekCqe(struct net_uring *ring);
+// Mark the completion returned by uringPeekCqe as processed
+void uringCqeSeen(struct net_uring *ring);
+
+// Register 'count' (a power of two) receive buffers of 'size' bytes each
+// as buffer group 'group', for use with IOSQE_BUFFER_SELECT
+bool uringSetupBuffers(struct net_uring *ring, unsigned group, unsigned count, unsigned size);
+// Address of a provided buffer, given its ID from a completion
+char *uringBuffer(struct net_uring *ring, unsigned bid);
+// Give a provided buffer back to the kernel once its data has been used
+void uringRecycleBuffer(struct net_uring *ring, unsigned bid);
+
+#endif /* NET_HAVE_URING */
+
+#endif
@@ -0,0 +1,173 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// json_benchmark.c: benchmarks for json output generation
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Serializes a set of synthetic aircraft (1000 by default, or the count
+// given on the command line) the way backgroundTasks() does, and reports
+// how long each document takes to generate.
+
+#include "../dump1090.h"
+
+struct _Modes Modes;
+
+void receiverPositionChanged(float lat, float lon, float alt)
+{
+    /* nothing */
+    (void) lat;
+    (void) lon;
+    (void) alt;
+}
+
+#define VALID(a, field) do {                                            \
+        (a)->field##_valid.source = SOURCE_ADSB;                        \
+        (a)->field##_valid.updated = now - (rand() % 10000);            \
+        (a)->field##_valid.stale = (a)->field##_valid.expires = UINT64_MAX; \
+    } while (0)
+
+static double uniform(double low, double high)
+{
+    return low + (high - low) * rand() / (double) RAND_MAX;
+}
+
+static void prepare(unsigned count)
+{
+    uint64_t now = mstime();
+
+    srand(1);
+    Modes.net = 1;
+    Modes.nfix_crc = 1;
+    Modes.json_aircraft_seq = 1;
+
+    for (unsigned i = 0; i < count; ++i) {
+        struct aircraft *a = calloc(1, sizeof(*a));
+
+        a->addr = 0x400000 + i * 7;
+        a->addrtype = (i % 20 == 0 ? ADDR_TISB_ICAO : ADDR_ADSB_ICAO);
+        a->seen = now - (rand() % 5000);
+        a->messages = rand() % 10000;
+        a->reliable = 1;
+        for (int j = 0; j < 8; ++j)
+            a->signalLevel[j] = uniform(1e-4, 0.5);
+
+        VALID(a, callsign);
+        snprintf(a->callsign, sizeof(a->callsign), "BNCH%04u", i % 10000);
+        VALID(a, altitude_baro);
+        a->altitude_baro = (rand() % 1600) * 25;
+        VALID(a, altitude_geom);
+        a->altitude_geom = a->altitude_baro + 250;
+        VALID(a, gs);
+        a->gs = uniform(100, 550);
+        VALID(a, track);
+        a->track = uniform(0, 360);
+        VALID(a, baro_rate);
+        a->baro_rate = (rand() % 81 - 40) * 64;
+        VALID(a, squawk);
+        a->squawk = rand() & 0x7777;
+        a->category = 0xA3;
+        VALID(a, position);
+        a->lat = uniform(-60, 70);
+        a->lon = uniform(-180, 180);
+        a->pos_nic = 8;
+        a->pos_rc = 186;
+        a->adsb_version = 2;
+        VALID(a, nac_p);
+        a->nac_p = 9;
+        VALID(a, nac_v);
+        a->nac_v = 1;
+        VALID(a, sil);
+        a->sil = 3;
+        a->sil_type = SIL_PER_HOUR;
+
+        // about a third of aircraft also report Comm-B / EHS state
+        if (i % 3 == 0) {
+            VALID(a, ias);
+            a->ias = 250 + rand() % 100;
+            VALID(a, tas);
+            a->tas = 300 + rand() % 150;
+            VALID(a, mach);
+            a->mach = uniform(0.4, 0.85);
+            VALID(a, roll);
+            a->roll = uniform(-25, 25);
+            VALID(a, mag_heading);
+            a->mag_heading = uniform(0, 360);
+            VALID(a, nav_qnh);
+            a->nav_qnh = 1013.2;
+            VALID(a, nav_altitude_mcp);
+            a->nav_altitude_mcp = 36000;
+            VALID(a, nav_modes);
+            a->nav_modes = NAV_MODE_AUTOPILOT | NAV_MODE_VNAV | NAV_MODE_LNAV;
+        }
+
+        a->next = Modes.aircrafts;
+        if (a->next)
+            a->next->prev_next = &a->next;
+        a->prev_next = &Modes.aircrafts;
+        Modes.aircrafts = a;
+    }
+
+    for (int i = 0; i < HISTORY_SIZE; ++i)
+        trackCaptureHistory(now - (HISTORY_SIZE - i) * HISTORY_INTERVAL);
+}
+
+static void test(const char *what, unsigned count, char * (*generator) (const char *, int *))
+{
+    fprintf(stderr, "Benchmarking: %s ", what);
+
+    struct timespec total = { 0, 0 };
+    int iterations = 0;
+    int len = 0;
+    uint64_t bytes = 0;
+
+    // Run it once to warm up
+    free(generator("/data/benchmark.json", &len));
+
+    while (total.tv_sec < 5) {
+        fprintf(stderr, ".");
+
+        struct timespec start;
+        start_cpu_timing(&start);
+
+        for (int i = 0; i < 10; ++i) {
+            free(generator("/data/benchmark.json", &len));
+            bytes += len;
+        }
+
+        end_cpu_timing(&start, &total);
+        iterations += 10;
+    }
+
+    fprintf(stderr, "\n");
+
+    double nanos = total.tv_sec * 1e9 + total.tv_nsec;
+    fprintf(stderr, "  %d documents of %d bytes in %.6f seconds\n",
+            iterations, len, nanos / 1e9);
+    fprintf(stderr, "  %.1f us/document, %.0f ns/aircraft, %.1f MB/second\n",
+            nanos / iterations / 1e3, count ? nanos / iterations / count : 0.0, bytes / nanos * 1e3);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned count = 1000;
+
+    if (argc > 1)
+        count = (unsigned) atoi(argv[1]);
+
+    prepare(count);
+
+    test("aircraft.json", count, generateAircraftJson);
+    test("history.json", count * HISTORY_SIZE, generateHistoryJson);
+    test("stats.json", 0, generateStatsJson);
+}
@@ -641,19 +641,19 @@ function start_load_history() {
         let url = new URL(window.location.href);
         let params = new URLSearchParams(url.search);
 
-        // Get total number of history.json files to load
-        TotalPositionHistorySize = PositionHistorySize + UatPositionHistorySize;
+        // Get total number of history files to load; dump1090 serves all of its history in one file
+        TotalPositionHistorySize = (PositionHistorySize > 0 ? 1 : 0) + UatPositionHistorySize;
         if (TotalPositionHistorySize > 0 && params.get('nohistory') !== 'true') {
                 $("#loader_progress").attr('max', TotalPositionHistorySize);
                 console.log("Starting to load history (" + TotalPositionHistorySize + " items)");
-                // Load dump1090 history.json files
-                for (var i = 0; i < PositionHistorySize; i++) {
-                        load_history_item(i, 'data');
+                // Load dump1090 history.json
+                if (PositionHistorySize > 0) {
+                        load_history_item('history.json', 'data');
                         CurrentHistoryFetch++;
                 }
-                // Load skyaware978 history.json files
+                // Load skyaware978 history_N.json files
                 for (var i = 0; i < UatPositionHistorySize; i++) {
-                        load_history_item(i, 'data-978');
+                        load_history_item('history_' + i + '.json', 'data-978');
                         CurrentHistoryFetch++;
                 }
         } else {
@@ -663,8 +663,7 @@ function start_load_history() {
 }
 
 // Loads a history json file
-function load_history_item(i, source) {
-        var historyfile = 'history_' + i + '.json';
+function load_history_item(historyfile, source) {
         console.log('Loading ' + source + ' ' + historyfile);
         $("#loader_progress").attr('value', CurrentHistoryFetch);
 
@@ -676,9 +675,13 @@ function load_history_item(i, source) {
                  dataType: 'json' })
 
                 .done(function(data) {
-                        // Tag history.json files with the source we fetched from (/data or /data-978)
-                        data["source"] = receiver_source;
-                        PositionHistoryBuffer.push(data);
+                        // A file holding several history entries, or a single one
+                        var entries = ('history' in data ? data.history : [data]);
+                        for (var j = 0; j < entries.length; ++j) {
+                                // Tag history entries with the source we fetched from (/data or /data-978)
+                                entries[j]["source"] = receiver_source;
+                                PositionHistoryBuffer.push(entries[j]);
+                        }
                         HistoryItemsReturned++;
                         if (HistoryItemsReturned == TotalPositionHistorySize) {
                                 // End load history when all files have been loaded
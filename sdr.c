@@ -256,6 +256,36 @@ void sdrUpdateCPUTime(struct timespec *addTo)
     pthread_mutex_unlock(&Modes.reader_cpu_mutex);
 }
 
+void sdrCallbackDone(const struct timespec *start)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    int64_t elapsed_us = ((int64_t) now.tv_sec - start->tv_sec) * 1000000 + (now.tv_nsec - start->tv_nsec) / 1000;
+    if (elapsed_us < 0)
+        elapsed_us = 0;
+
+    pthread_mutex_lock(&Modes.reader_cpu_mutex);
+    Modes.reader_callback_count++;
+    Modes.reader_callback_us += elapsed_us;
+    if (elapsed_us > Modes.reader_callback_max_us)
+        Modes.reader_callback_max_us = elapsed_us;
+    pthread_mutex_unlock(&Modes.reader_cpu_mutex);
+}
+
+void sdrUpdateCallbackStats(struct stats *st)
+{
+    pthread_mutex_lock(&Modes.reader_cpu_mutex);
+    st->sdr_callbacks += Modes.reader_callback_count;
+    st->sdr_callback_us += Modes.reader_callback_us;
+    if (Modes.reader_callback_max_us > st->sdr_callback_max_us)
+        st->sdr_callback_max_us = Modes.reader_callback_max_us;
+    Modes.reader_callback_count = 0;
+    Modes.reader_callback_us = 0;
+    Modes.reader_callback_max_us = 0;
+    pthread_mutex_unlock(&Modes.reader_cpu_mutex);
+}
+
 int sdrGetGain()
 {
     return current_handler()->getgain();
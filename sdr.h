@@ -41,5 +41,10 @@ int sdrSetGain(int step);      // set gain step; return actual gain step used, o
 void sdrMonitor();
 // Retrieve CPU stats and add new CPU time to *addTo
 void sdrUpdateCPUTime(struct timespec *addTo);
+// Call from the SDR read thread at the end of each sample callback to update callback timing stats;
+// 'start' is the CLOCK_MONOTONIC time the callback was entered
+void sdrCallbackDone(const struct timespec *start);
+// Retrieve callback timing stats and add them to *st
+void sdrUpdateCallbackStats(struct stats *st);
 
 #endif
@@ -54,21 +54,45 @@
 #include <rtl-sdr.h>
 
 #if defined(__arm__) || defined(__aarch64__)
-// Assume we need to use a bounce buffer to avoid performance problems on Pis running kernel 5.x and using zerocopy
-#  define USE_BOUNCE_BUFFER
+// Reading directly from the librtlsdr buffers is slow on Pis running kernel 5.x
+// and using zerocopy, so by default take one bulk copy and convert on a separate thread
+#  define DEFAULT_CONVERT_THREAD true
+#else
+#  define DEFAULT_CONVERT_THREAD false
 #endif
 
+#define RTLSDR_RAW_BUFFERS 4
+
+// One block of samples delivered by librtlsdr
+struct rtlsdr_block {
+    uint8_t *data;              // UC8 sample data
+    unsigned samples;           // number of samples in data
+    unsigned dropped;           // number of samples dropped immediately before this block
+    uint64_t sampleTimestamp;   // 12MHz clock timestamp of the first sample
+    uint64_t sysTimestamp;      // estimated system time of the first sample
+};
+
 static struct {
     rtlsdr_dev_t *dev;
     bool digital_agc;
     int ppm_error;
     int direct_sampling;
-    uint8_t *bounce_buffer;
     iq_convert_fn converter;
     struct converter_state *converter_state;
     int *gains;
     int gain_steps;
     int current_gain;
+
+    // Conversion thread; if enabled, the callback just copies each block
+    // into "raw" and the conversion thread converts it into the FIFO
+    bool convert_thread;
+    pthread_t converter_thread;
+    pthread_mutex_t raw_mutex;            // protects raw_head, raw_tail, raw_exit
+    pthread_cond_t raw_cond;              // signalled when a block is added to "raw", or on exit
+    struct rtlsdr_block raw[RTLSDR_RAW_BUFFERS];
+    unsigned raw_head;                    // next raw block to fill (callback)
+    unsigned raw_tail;                    // next raw block to convert (conversion thread)
+    bool raw_exit;                        // tells the conversion thread to exit
 } RTLSDR;
 
 //
@@ -81,7 +105,7 @@ void rtlsdrInitConfig()
     RTLSDR.digital_agc = false;
     RTLSDR.ppm_error = 0;
     RTLSDR.direct_sampling = 0;
-    RTLSDR.bounce_buffer = NULL;
+    RTLSDR.convert_thread = DEFAULT_CONVERT_THREAD;
     RTLSDR.converter = NULL;
     RTLSDR.converter_state = NULL;
     RTLSDR.gains = NULL;
@@ -157,6 +181,8 @@ void rtlsdrShowHelp()
     printf("--enable-agc             enable digital AGC (not tuner AGC!)\n");
     printf("--ppm <correction>       set oscillator frequency correction in PPM\n");
     printf("--direct <0|1|2>         set direct sampling mode\n");
+    printf("--convert-thread         convert samples on a separate thread (default on ARM)\n");
+    printf("--no-convert-thread      convert samples directly from the USB buffers\n");
     printf("\n");
 }
 
@@ -171,6 +197,10 @@ bool rtlsdrHandleOption(int argc, char **argv, int *jptr)
         RTLSDR.ppm_error = atoi(argv[++j]);
     } else if (!strcmp(argv[j], "--direct") && more) {
         RTLSDR.direct_sampling = atoi(argv[++j]);
+    } else if (!strcmp(argv[j], "--convert-thread")) {
+        RTLSDR.convert_thread = true;
+    } else if (!strcmp(argv[j], "--no-convert-thread")) {
+        RTLSDR.convert_thread = false;
     } else {
         return false;
     }
@@ -290,13 +320,15 @@ bool rtlsdrOpen(void)
         return false;
     }
 
-#ifdef USE_BOUNCE_BUFFER
-    if (!(RTLSDR.bounce_buffer = malloc(MODES_RTL_BUF_SIZE))) {
-        fprintf(stderr, "rtlsdr: can't allocate bounce buffer\n");
-        rtlsdrClose();
-        return false;
+    if (RTLSDR.convert_thread) {
+        for (unsigned i = 0; i < RTLSDR_RAW_BUFFERS; ++i) {
+            if (!(RTLSDR.raw[i].data = malloc(MODES_RTL_BUF_SIZE))) {
+                fprintf(stderr, "rtlsdr: can't allocate sample buffers\n");
+                rtlsdrClose();
+                return false;
+            }
+        }
     }
-#endif
 
     if (Modes.adaptive_range_target == 0)
         Modes.adaptive_range_target = 30.0;
@@ -304,30 +336,15 @@ bool rtlsdrOpen(void)
     return true;
 }
 
-static void rtlsdrCallback(unsigned char *buf, uint32_t len, void *ctx)
+// Convert one block of samples into a FIFO buffer and enqueue it.
+// 'dropped' is the number of samples dropped immediately before this block.
+// Returns the number of dropped samples to carry forward to the next block.
+static unsigned convert_block(const struct rtlsdr_block *block, unsigned dropped, uint32_t timeout_ms)
 {
-    static unsigned dropped = 0;
-    static uint64_t sampleCounter = 0;
-
-    MODES_NOTUSED(ctx);
-
-    sdrMonitor();
-
-    if (Modes.exit) {
-        rtlsdr_cancel_async(RTLSDR.dev); // ask our caller to exit
-        return;
-    }
-
-    unsigned samples_read = len/2; // Drops any trailing odd sample, not much else we can do there
-    if (!samples_read)
-        return; // that wasn't useful
-
-    struct mag_buf *outbuf = fifo_acquire(0 /* don't wait */);
+    struct mag_buf *outbuf = fifo_acquire(timeout_ms);
     if (!outbuf) {
         // FIFO is full. Drop this block.
-        dropped += samples_read;
-        sampleCounter += samples_read;
-        return;
+        return dropped + block->samples;
     }
 
     outbuf->flags = 0;
@@ -340,33 +357,134 @@ static void rtlsdrCallback(unsigned char *buf, uint32_t len, void *ctx)
 
     dropped = 0;
 
-    // Compute the sample timestamp and system timestamp for the start of the block
-    outbuf->sampleTimestamp = sampleCounter * 12e6 / Modes.sample_rate;
-    sampleCounter += samples_read;
-
-    // Get the approx system time for the start of this block
-    uint64_t block_duration = 1e3 * samples_read / Modes.sample_rate;
-    outbuf->sysTimestamp = mstime() - block_duration;
+    outbuf->sampleTimestamp = block->sampleTimestamp;
+    outbuf->sysTimestamp = block->sysTimestamp;
 
     // Convert the new data
-    unsigned to_convert = samples_read;
+    unsigned to_convert = block->samples;
     if (to_convert + outbuf->overlap > outbuf->totalLength) {
         // how did that happen?
         to_convert = outbuf->totalLength - outbuf->overlap;
-        dropped = samples_read - to_convert;
+        dropped = block->samples - to_convert;
     }
 
-#ifdef USE_BOUNCE_BUFFER
-    // Work around zero-copy slowness on Pis with 5.x kernels
-    memcpy(RTLSDR.bounce_buffer, buf, to_convert * 2);
-    buf = RTLSDR.bounce_buffer;
-#endif
-
-    RTLSDR.converter(buf, &outbuf->data[outbuf->overlap], to_convert, RTLSDR.converter_state, &outbuf->mean_level, &outbuf->mean_power);
+    RTLSDR.converter(block->data, &outbuf->data[outbuf->overlap], to_convert, RTLSDR.converter_state, &outbuf->mean_level, &outbuf->mean_power);
     outbuf->validLength = outbuf->overlap + to_convert;
 
     // Push to the demodulation thread
     fifo_enqueue(outbuf);
+    return dropped;
+}
+
+// Copy one block of samples so the conversion thread can process it after the
+// USB buffer has been returned. Returns false if there was no room for it.
+static bool queue_block(const struct rtlsdr_block *block)
+{
+    pthread_mutex_lock(&RTLSDR.raw_mutex);
+    bool full = (RTLSDR.raw_head - RTLSDR.raw_tail >= RTLSDR_RAW_BUFFERS);
+    pthread_mutex_unlock(&RTLSDR.raw_mutex);
+
+    if (full)
+        return false;
+
+    // raw_head is only changed by us, so this slot stays ours until we advance raw_head
+    struct rtlsdr_block *raw = &RTLSDR.raw[RTLSDR.raw_head % RTLSDR_RAW_BUFFERS];
+    memcpy(raw->data, block->data, block->samples * 2);
+    raw->samples = block->samples;
+    raw->dropped = block->dropped;
+    raw->sampleTimestamp = block->sampleTimestamp;
+    raw->sysTimestamp = block->sysTimestamp;
+
+    pthread_mutex_lock(&RTLSDR.raw_mutex);
+    ++RTLSDR.raw_head;
+    pthread_cond_signal(&RTLSDR.raw_cond);
+    pthread_mutex_unlock(&RTLSDR.raw_mutex);
+    return true;
+}
+
+static void *converterThreadEntryPoint(void *arg)
+{
+    MODES_NOTUSED(arg);
+
+    set_thread_name("dump1090-conv");
+
+    struct timespec cpu_start;
+    start_cpu_timing(&cpu_start);
+
+    unsigned dropped = 0;
+
+    pthread_mutex_lock(&RTLSDR.raw_mutex);
+    while (!RTLSDR.raw_exit) {
+        if (RTLSDR.raw_head == RTLSDR.raw_tail) {
+            pthread_cond_wait(&RTLSDR.raw_cond, &RTLSDR.raw_mutex);
+            continue;
+        }
+
+        struct rtlsdr_block *raw = &RTLSDR.raw[RTLSDR.raw_tail % RTLSDR_RAW_BUFFERS];
+        pthread_mutex_unlock(&RTLSDR.raw_mutex);
+
+        // we're not on the USB thread, so we can wait a little for a free buffer
+        dropped = convert_block(raw, dropped + raw->dropped, 100 /* milliseconds */);
+
+        // our CPU time counts as reader CPU time
+        pthread_mutex_lock(&Modes.reader_cpu_mutex);
+        update_cpu_timing(&cpu_start, &Modes.reader_cpu_accumulator);
+        pthread_mutex_unlock(&Modes.reader_cpu_mutex);
+
+        pthread_mutex_lock(&RTLSDR.raw_mutex);
+        ++RTLSDR.raw_tail;
+    }
+    pthread_mutex_unlock(&RTLSDR.raw_mutex);
+
+    return NULL;
+}
+
+static void rtlsdrCallback(unsigned char *buf, uint32_t len, void *ctx)
+{
+    static unsigned dropped = 0;
+    static uint64_t sampleCounter = 0;
+
+    struct timespec callback_start;
+    clock_gettime(CLOCK_MONOTONIC, &callback_start);
+
+    MODES_NOTUSED(ctx);
+
+    sdrMonitor();
+
+    if (Modes.exit) {
+        rtlsdr_cancel_async(RTLSDR.dev); // ask our caller to exit
+        return;
+    }
+
+    unsigned samples_read = len/2; // Drops any trailing odd sample, not much else we can do there
+    if (!samples_read)
+        return; // that wasn't useful
+
+    struct rtlsdr_block block;
+    block.data = buf;
+    block.samples = samples_read;
+    block.dropped = dropped;
+
+    // Compute the sample timestamp and system timestamp for the start of the block
+    block.sampleTimestamp = sampleCounter * 12e6 / Modes.sample_rate;
+    sampleCounter += samples_read;
+
+    // Get the approx system time for the start of this block
+    uint64_t block_duration = 1e3 * samples_read / Modes.sample_rate;
+    block.sysTimestamp = mstime() - block_duration;
+
+    if (RTLSDR.convert_thread) {
+        // Hand off to the conversion thread
+        if (queue_block(&block))
+            dropped = 0;
+        else
+            dropped += samples_read;
+    } else {
+        // Convert directly from the USB buffer, no copy
+        dropped = convert_block(&block, dropped, 0 /* don't wait */);
+    }
+
+    sdrCallbackDone(&callback_start);
 }
 
 void rtlsdrRun()
@@ -375,12 +493,37 @@ void rtlsdrRun()
         return;
     }
 
+    if (RTLSDR.convert_thread) {
+        pthread_mutex_init(&RTLSDR.raw_mutex, NULL);
+        pthread_cond_init(&RTLSDR.raw_cond, NULL);
+        RTLSDR.raw_head = RTLSDR.raw_tail = 0;
+        RTLSDR.raw_exit = false;
+
+        if (pthread_create(&RTLSDR.converter_thread, NULL, converterThreadEntryPoint, NULL) != 0) {
+            fprintf(stderr, "rtlsdr: failed to create conversion thread, converting in the USB callback instead\n");
+            RTLSDR.convert_thread = false;
+            pthread_cond_destroy(&RTLSDR.raw_cond);
+            pthread_mutex_destroy(&RTLSDR.raw_mutex);
+        }
+    }
+
     rtlsdr_read_async(RTLSDR.dev, rtlsdrCallback, NULL,
                       /* MODES_RTL_BUFFERS */ 4,
                       MODES_RTL_BUF_SIZE);
     if (!Modes.exit) {
         fprintf(stderr, "rtlsdr: rtlsdr_read_async returned unexpectedly, probably lost the USB device, bailing out\n");
     }
+
+    if (RTLSDR.convert_thread) {
+        pthread_mutex_lock(&RTLSDR.raw_mutex);
+        RTLSDR.raw_exit = true;
+        pthread_cond_signal(&RTLSDR.raw_cond);
+        pthread_mutex_unlock(&RTLSDR.raw_mutex);
+
+        pthread_join(RTLSDR.converter_thread, NULL);
+        pthread_cond_destroy(&RTLSDR.raw_cond);
+        pthread_mutex_destroy(&RTLSDR.raw_mutex);
+    }
 }
 
 void rtlsdrStop()
@@ -405,8 +548,10 @@ void rtlsdrClose()
         RTLSDR.converter_state = NULL;
     }
 
-    free(RTLSDR.bounce_buffer);
-    RTLSDR.bounce_buffer = NULL;
+    for (unsigned i = 0; i < RTLSDR_RAW_BUFFERS; ++i) {
+        free(RTLSDR.raw[i].data);
+        RTLSDR.raw[i].data = NULL;
+    }
 
     free(RTLSDR.gains);
     RTLSDR.gains = NULL;
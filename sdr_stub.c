@@ -67,6 +67,16 @@ void sdrUpdateCPUTime(struct timespec *addTo)
     MODES_NOTUSED(addTo);
 }
 
+void sdrCallbackDone(const struct timespec *start)
+{
+    MODES_NOTUSED(start);
+}
+
+void sdrUpdateCallbackStats(struct stats *st)
+{
+    MODES_NOTUSED(st);
+}
+
 int sdrGetGain()
 {
     return -1;
@@ -211,6 +211,29 @@ void display_stats(struct stats *st) {
     printf("  %8u unique aircraft tracks\n", st->unique_aircraft);
     printf("  %8u aircraft tracks where only one message was seen\n", st->single_message_aircraft);
     printf("  %8u aircraft tracks which were not marked reliable\n", st->unreliable_aircraft);
+    if (st->aircraft_lookups)
+        printf("  %8u aircraft lookups, %.2f mean / %u max slots probed\n",
+               st->aircraft_lookups,
+               (double) st->aircraft_lookup_probes / st->aircraft_lookups,
+               st->aircraft_lookup_max_probes);
+    if (st->aircraft_pool_slots)
+        printf("  %8u of %u aircraft pool slots in use\n", st->aircraft_pool_used, st->aircraft_pool_slots);
+    if (st->icao_filter_hits + st->icao_filter_misses)
+        printf("  %8" PRIu64 " ICAO filter hits, %" PRIu64 " misses, %.2f mean / %u max buckets probed\n",
+               st->icao_filter_hits,
+               st->icao_filter_misses,
+               (double) st->icao_filter_probes / (st->icao_filter_hits + st->icao_filter_misses),
+               st->icao_filter_max_probes);
+    if (st->net_backlog_peak || st->net_backlog_disconnects)
+        printf("  %8u network clients with queued output (%" PRIu64 " bytes), %" PRIu64 " bytes peak, %u disconnected as too slow\n",
+               st->net_backlog_clients,
+               st->net_backlog_bytes,
+               st->net_backlog_peak,
+               st->net_backlog_disconnects);
+    if (st->net_backlog_alloc_failures)
+        printf("  %8u network clients disconnected as their output couldn't be queued (out of memory)\n", st->net_backlog_alloc_failures);
+    if (st->net_output_dropped)
+        printf("  %8u blocks of network output discarded as the network thread was too slow\n", st->net_output_dropped);
 
     {
         uint64_t demod_cpu_millis = (uint64_t)st->demod_cpu.tv_sec*1000UL + st->demod_cpu.tv_nsec/1000000UL;
@@ -225,6 +248,12 @@ void display_stats(struct stats *st) {
                (unsigned long long) demod_cpu_millis,
                (unsigned long long) reader_cpu_millis,
                (unsigned long long) background_cpu_millis);
+
+        if (st->sdr_callbacks)
+            printf("  %5.0f us mean, %5u us max time in SDR sample callback (%u callbacks)\n",
+                   (double) st->sdr_callback_us / st->sdr_callbacks,
+                   st->sdr_callback_max_us,
+                   st->sdr_callbacks);
     }
 
     if (Modes.stats_range_histo)
@@ -343,6 +372,10 @@ void add_stats(const struct stats *st1, const struct stats *st2, struct stats *t
     add_timespecs(&st1->reader_cpu, &st2->reader_cpu, &target->reader_cpu);
     add_timespecs(&st1->background_cpu, &st2->background_cpu, &target->background_cpu);
 
+    target->sdr_callbacks = st1->sdr_callbacks + st2->sdr_callbacks;
+    target->sdr_callback_us = st1->sdr_callback_us + st2->sdr_callback_us;
+    target->sdr_callback_max_us = (st1->sdr_callback_max_us > st2->sdr_callback_max_us ? st1->sdr_callback_max_us : st2->sdr_callback_max_us);
+
     // noise power:
     target->noise_power_sum = st1->noise_power_sum + st2->noise_power_sum;
     target->noise_power_count = st1->noise_power_count + st2->noise_power_count;
@@ -395,6 +428,25 @@ void add_stats(const struct stats *st1, const struct stats *st2, struct stats *t
     target->unique_aircraft = st1->unique_aircraft + st2->unique_aircraft;
     target->single_message_aircraft = st1->single_message_aircraft + st2->single_message_aircraft;
     target->unreliable_aircraft = st1->unreliable_aircraft + st2->unreliable_aircraft;
+    target->aircraft_lookups = st1->aircraft_lookups + st2->aircraft_lookups;
+    target->aircraft_lookup_probes = st1->aircraft_lookup_probes + st2->aircraft_lookup_probes;
+    target->aircraft_lookup_max_probes = st1->aircraft_lookup_max_probes > st2->aircraft_lookup_max_probes ? st1->aircraft_lookup_max_probes : st2->aircraft_lookup_max_probes;
+    target->aircraft_pool_used = newer->aircraft_pool_used;
+    target->aircraft_pool_slots = newer->aircraft_pool_slots;
+
+    // ICAO filter
+    target->icao_filter_hits = st1->icao_filter_hits + st2->icao_filter_hits;
+    target->icao_filter_misses = st1->icao_filter_misses + st2->icao_filter_misses;
+    target->icao_filter_probes = st1->icao_filter_probes + st2->icao_filter_probes;
+    target->icao_filter_max_probes = st1->icao_filter_max_probes > st2->icao_filter_max_probes ? st1->icao_filter_max_probes : st2->icao_filter_max_probes;
+
+    // network output backlog
+    target->net_backlog_clients = newer->net_backlog_clients;
+    target->net_backlog_bytes = newer->net_backlog_bytes;
+    target->net_backlog_peak = st1->net_backlog_peak > st2->net_backlog_peak ? st1->net_backlog_peak : st2->net_backlog_peak;
+    target->net_backlog_disconnects = st1->net_backlog_disconnects + st2->net_backlog_disconnects;
+    target->net_backlog_alloc_failures = st1->net_backlog_alloc_failures + st2->net_backlog_alloc_failures;
+    target->net_output_dropped = st1->net_output_dropped + st2->net_output_dropped;
 
     // range histogram
     for (i = 0; i < RANGE_BUCKET_COUNT; ++i)
@@ -419,3 +471,13 @@ void add_stats(const struct stats *st1, const struct stats *st2, struct stats *t
     target->adaptive_noise_dbfs = adaptive_best->adaptive_noise_dbfs;
     target->adaptive_range_gain_limit = adaptive_best->adaptive_range_gain_limit;
 }
+
+// Fold ICAO filter lookup counters (see icaoFilterCollectCounters) into st
+void add_icao_filter_counters(struct stats *st, const struct icao_filter_counters *counters)
+{
+    st->icao_filter_hits += counters->hits;
+    st->icao_filter_misses += counters->misses;
+    st->icao_filter_probes += counters->probes;
+    if (counters->max_probes > st->icao_filter_max_probes)
+        st->icao_filter_max_probes = counters->max_probes;
+}
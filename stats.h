@@ -75,6 +75,11 @@ struct stats {
     struct timespec reader_cpu;
     struct timespec background_cpu;
 
+    // SDR sample callback wall-clock time (only reported by some SDRs):
+    uint32_t sdr_callbacks;
+    uint64_t sdr_callback_us;
+    uint32_t sdr_callback_max_us;
+
     // noise floor:
     double noise_power_sum;
     uint64_t noise_power_count;
@@ -128,6 +133,31 @@ struct stats {
     unsigned int single_message_aircraft;
     // we never considered the track reliable
     unsigned int unreliable_aircraft;
+    // lookups of the aircraft address index, total / worst-case slots probed
+    unsigned int aircraft_lookups;
+    uint64_t aircraft_lookup_probes;
+    unsigned int aircraft_lookup_max_probes;
+    // aircraft pool occupancy at the end of the period
+    unsigned int aircraft_pool_used;
+    unsigned int aircraft_pool_slots;
+
+    // ICAO filter lookups: live hits / misses, total / worst-case buckets probed
+    uint64_t icao_filter_hits;
+    uint64_t icao_filter_misses;
+    uint64_t icao_filter_probes;
+    unsigned int icao_filter_max_probes;
+
+    // network output backlog: clients with queued output / bytes queued at
+    // the end of the period, largest single-client backlog seen, clients
+    // disconnected for exceeding the backlog limit, clients disconnected
+    // because their queued output couldn't be allocated, and output
+    // discarded because the network thread fell behind
+    unsigned int net_backlog_clients;
+    uint64_t net_backlog_bytes;
+    uint64_t net_backlog_peak;
+    unsigned int net_backlog_disconnects;
+    unsigned int net_backlog_alloc_failures;
+    unsigned int net_output_dropped;
 
     // range histogram
 #define RANGE_BUCKET_COUNT 76
@@ -148,6 +178,9 @@ void add_stats(const struct stats *st1, const struct stats *st2, struct stats *t
 void display_stats(struct stats *st);
 void reset_stats(struct stats *st);
 
+struct icao_filter_counters;
+void add_icao_filter_counters(struct stats *st, const struct icao_filter_counters *counters);
+
 void add_timespecs(const struct timespec *x, const struct timespec *y, struct timespec *z);
 
 #endif
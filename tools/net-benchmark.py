@@ -0,0 +1,279 @@
+#!/usr/bin/env python3
+
+#
+# Loopback benchmark for dump1090's network input path.
+#
+# Starts dump1090 in --net-only mode, opens a number of Beast input
+# connections and pushes synthetic DF17 messages through all of them at
+# once, while a few Beast output clients receive the results. When
+# dump1090's stats show that every message has been received, it reports
+# the message rate and how much CPU it took, both for the whole process
+# and for the network thread alone, as messages per second per core.
+#
+# By default it runs once with the epoll backend and once with
+# --net-io-uring, for comparison:
+#
+#   tools/net-benchmark.py --dump1090 ./dump1090 --clients 200 --messages 5000
+#
+# With --slow-client it also opens one Beast output connection that never
+# reads, and checks that only that one is disconnected (for going over the
+# output queue limit) while the other output clients get every message.
+# This is a regression check for one stalled client holding up the rest:
+#
+#   tools/net-benchmark.py --clients 1 --messages 1500000 --outputs 1 --slow-client --rate 300000
+#
+# (--rate keeps the input to what the output clients can read on a small
+# machine; a fast client that can't keep up is rightly disconnected too)
+#
+
+import argparse
+import json
+import multiprocessing
+import os
+import selectors
+import shutil
+import socket
+import subprocess
+import sys
+import tempfile
+import time
+
+CLK_TCK = os.sysconf('SC_CLK_TCK')
+
+
+def crc24(data):
+    crc = 0
+    for byte in data:
+        crc ^= byte << 16
+        for _ in range(8):
+            crc <<= 1
+            if crc & 0x1000000:
+                crc ^= 0x1FFF409
+    return crc & 0xFFFFFF
+
+
+def identification_message(icao, callsign):
+    # DF17, TC 4 (aircraft identification)
+    charset = '#ABCDEFGHIJKLMNOPQRSTUVWXYZ##### ###############0123456789######'
+    me = 4 << 51
+    for i, ch in enumerate(callsign.ljust(8)[:8]):
+        me |= charset.index(ch) << (42 - 6 * i)
+
+    body = bytes([(17 << 3) | 5]) + icao.to_bytes(3, 'big') + me.to_bytes(7, 'big')
+    return body + crc24(body).to_bytes(3, 'big')
+
+
+def beast_frame(msg, timestamp):
+    payload = timestamp.to_bytes(6, 'big') + bytes([0x80]) + msg
+    return b'\x1a3' + payload.replace(b'\x1a', b'\x1a\x1a')
+
+
+def build_stream(client, count):
+    # 16 aircraft per connection, repeated
+    icao = 0x400000 + client * 16
+    frames = [beast_frame(identification_message(icao + i, 'BENCH%03d' % (client % 1000)), i * 1000) for i in range(16)]
+    block = b''.join(frames)
+    return block * (count // 16) + b''.join(frames[:count % 16])
+
+
+def cpu_ticks(path):
+    with open(path) as f:
+        fields = f.read().rsplit(')', 1)[1].split()
+    return int(fields[11]) + int(fields[12])  # utime + stime
+
+
+def net_thread_stat(pid):
+    for tid in os.listdir('/proc/%d/task' % pid):
+        with open('/proc/%d/task/%s/comm' % (pid, tid)) as f:
+            if f.read().strip() == 'dump1090-net':
+                return '/proc/%d/task/%s/stat' % (pid, tid)
+    return None
+
+
+def total_stats(json_dir):
+    try:
+        with open(os.path.join(json_dir, 'stats.json')) as f:
+            return json.load(f)['total']
+    except (OSError, ValueError, KeyError):
+        return {}
+
+
+def received_messages(json_dir):
+    return total_stats(json_dir).get('remote', {}).get('modes', 0)
+
+
+def count_frames(data, escape):
+    # Count the Mode S long frames in a chunk of Beast output; 'escape' says
+    # the previous chunk ended in a 0x1a that might be the first of a pair
+    if escape:
+        data = b'\x1a' + data
+    # an escaped 0x1a is doubled, and a frame type is never 0x1a, so once
+    # the pairs are gone every 0x1a left starts a frame
+    data = data.replace(b'\x1a\x1a', b'')
+    return data.count(b'\x1a3'), data.endswith(b'\x1a')
+
+
+# Runs in its own process, so that reading the output keeps up with dump1090
+# however busy the process sending the input is
+def drain(sockets, stop, frames, closed):
+    sel = selectors.DefaultSelector()
+    for i, s in enumerate(sockets):
+        sel.register(s, selectors.EVENT_READ, [i, False])
+    while not stop.is_set():
+        for key, _ in sel.select(timeout=0.1):
+            i, escape = key.data
+            try:
+                data = key.fileobj.recv(1 << 20)
+            except BlockingIOError:
+                continue
+            except ConnectionError:
+                data = b''
+            if data:
+                count, key.data[1] = count_frames(data, escape)
+                frames[i] += count
+            else:
+                closed[i] = 1
+                sel.unregister(key.fileobj)
+
+
+def send_all(sockets, streams, chunk, rate):
+    # 'rate', if set, limits each connection to that many bytes per second
+    sel = selectors.DefaultSelector()
+    offsets = {}
+    for s, data in zip(sockets, streams):
+        s.setblocking(False)
+        offsets[s] = 0
+        sel.register(s, selectors.EVENT_WRITE, data)
+
+    start = time.monotonic()
+    while offsets:
+        if rate:
+            ahead = min(offsets.values()) / rate - (time.monotonic() - start)
+            if ahead > 0:
+                time.sleep(ahead)
+        for key, _ in sel.select():
+            s, data = key.fileobj, key.data
+            try:
+                offsets[s] += s.send(data[offsets[s]:offsets[s] + chunk])
+            except BlockingIOError:
+                continue
+            if offsets[s] >= len(data):
+                sel.unregister(s)
+                del offsets[s]
+
+
+def run(args, io_uring, streams, expected):
+    json_dir = tempfile.mkdtemp(prefix='net-benchmark-')
+    cmd = [args.dump1090, '--net-only', '--quiet',
+           '--net-bi-port', str(args.port), '--net-bo-port', str(args.port + 1),
+           '--net-ri-port', '0', '--net-ro-port', '0', '--net-sbs-port', '0', '--net-stratux-port', '0',
+           '--write-json', json_dir, '--json-stats-every', '0.2']
+    if io_uring:
+        cmd.append('--net-io-uring')
+
+    proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    mp = multiprocessing.get_context('fork')
+    stop = mp.Event()
+    reader = None
+    try:
+        time.sleep(1.0)
+        net_stat = net_thread_stat(proc.pid)
+
+        outputs = [socket.create_connection(('127.0.0.1', args.port + 1)) for _ in range(args.outputs)]
+        for s in outputs:
+            s.setblocking(False)
+        frames = mp.Array('q', len(outputs), lock=False)
+        closed = mp.Array('b', len(outputs), lock=False)
+        reader = mp.Process(target=drain, args=(outputs, stop, frames, closed), daemon=True)
+        reader.start()
+
+        stalled = []
+        if args.slow_client:
+            # an output client that never reads; keep its receive buffer small so it backs up quickly
+            s = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+            s.setsockopt(socket.SOL_SOCKET, socket.SO_RCVBUF, 4096)
+            s.connect(('127.0.0.1', args.port + 1))
+            stalled.append(s)
+
+        inputs = [socket.create_connection(('127.0.0.1', args.port)) for _ in range(args.clients)]
+        time.sleep(0.5)
+
+        start_wall = time.monotonic()
+        start_cpu = cpu_ticks('/proc/%d/stat' % proc.pid)
+        start_net = cpu_ticks(net_stat) if net_stat else 0
+
+        send_all(inputs, streams, args.chunk, args.rate * len(streams[0]) / args.messages)
+
+        deadline = time.monotonic() + args.timeout
+        while received_messages(json_dir) < expected:
+            if time.monotonic() > deadline:
+                raise RuntimeError('timed out: dump1090 received %d of %d messages' % (received_messages(json_dir), expected))
+            time.sleep(0.05)
+
+        # stats.json is written periodically, so the run may really have finished up to one interval ago
+        wall = time.monotonic() - start_wall
+        cpu = (cpu_ticks('/proc/%d/stat' % proc.pid) - start_cpu) / CLK_TCK
+        net = (cpu_ticks(net_stat) - start_net) / CLK_TCK if net_stat else None
+
+        check = None
+        if args.slow_client:
+            # wait for the output clients to catch up (or be disconnected)
+            deadline = time.monotonic() + args.timeout
+            while any(n < expected and not c for n, c in zip(frames, closed)) and time.monotonic() < deadline:
+                time.sleep(0.05)
+            time.sleep(0.5)  # let stats.json catch up with the last disconnect
+            disconnects = total_stats(json_dir).get('net_backlog', {}).get('disconnects', 0)
+            check = (disconnects, min(frames), sum(closed))
+
+        for s in inputs + outputs + stalled:
+            s.close()
+    finally:
+        stop.set()
+        if reader:
+            reader.join()
+        proc.terminate()
+        proc.wait()
+        shutil.rmtree(json_dir, ignore_errors=True)
+
+    return wall, cpu, net, check
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Measure dump1090 network input throughput per CPU core')
+    parser.add_argument('--dump1090', default='./dump1090', help='dump1090 binary to run')
+    parser.add_argument('--clients', type=int, default=100, help='Beast input connections')
+    parser.add_argument('--messages', type=int, default=5000, help='messages sent on each input connection')
+    parser.add_argument('--outputs', type=int, default=4, help='Beast output connections to fan out to')
+    parser.add_argument('--chunk', type=int, default=1024, help='bytes per send() on each input connection')
+    parser.add_argument('--rate', type=int, default=0, help='messages per second on each input connection (default: as fast as possible)')
+    parser.add_argument('--port', type=int, default=32004, help='Beast input port (output uses the next one)')
+    parser.add_argument('--timeout', type=float, default=120, help='seconds to wait for each run')
+    parser.add_argument('--backend', choices=['epoll', 'io_uring', 'both'], default='both')
+    parser.add_argument('--slow-client', action='store_true', help='add an output client that never reads, and check that it alone is disconnected')
+    args = parser.parse_args()
+
+    streams = [build_stream(i, args.messages) for i in range(args.clients)]
+    expected = args.clients * args.messages
+    backends = ['epoll', 'io_uring'] if args.backend == 'both' else [args.backend]
+
+    print('%d clients x %d messages, %d output clients' % (args.clients, args.messages, args.outputs))
+    print('%-9s %9s %11s %9s %15s %12s %15s' % ('backend', 'wall s', 'msgs/s', 'cpu s', 'msgs/s/core', 'net cpu s', 'net msgs/s/core'))
+    failed = False
+    for backend in backends:
+        wall, cpu, net, check = run(args, backend == 'io_uring', streams, expected)
+        print('%-9s %9.2f %11.0f %9.2f %15.0f %12s %15s' % (
+            backend, wall, expected / wall, cpu, expected / cpu if cpu else float('inf'),
+            '%.2f' % net if net is not None else '-',
+            '%.0f' % (expected / net) if net else '-'))
+        if check:
+            disconnects, frames, closed = check
+            ok = (disconnects == 1 and frames >= expected and not closed)
+            print('%-9s slow client check: %d disconnects, %d output clients closed, fewest messages received %d of %d: %s' % (
+                backend, disconnects, closed, frames, expected, 'ok' if ok else 'FAILED'))
+            failed = failed or not ok
+
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
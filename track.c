@@ -57,13 +57,187 @@ uint32_t modeAC_lastcount[4096];
 uint32_t modeAC_match[4096];
 uint32_t modeAC_age[4096];
 
+//
+// Pool allocator for aircraft structures.
+//
+// Aircraft are allocated TRACK_POOL_SLAB_SIZE at a time from slabs of
+// cache-line-aligned slots, and freed aircraft go on a freelist (linked
+// through their "next" pointer) for reuse. Slabs are never returned to the
+// heap, so the pool stays at its peak size rather than fragmenting the heap
+// with short-lived noise tracks.
+//
+
+#define AIRCRAFT_SLOT_ALIGN 64
+#define AIRCRAFT_SLOT_SIZE ((sizeof(struct aircraft) + AIRCRAFT_SLOT_ALIGN - 1) & ~(size_t) (AIRCRAFT_SLOT_ALIGN - 1))
+
+static struct aircraft *aircraft_freelist;
+static unsigned aircraft_pool_slots;
+static unsigned aircraft_pool_used;
+
+static struct aircraft *trackAllocAircraft(void)
+{
+    if (!aircraft_freelist) {
+        void *slab;
+        if (posix_memalign(&slab, AIRCRAFT_SLOT_ALIGN, AIRCRAFT_SLOT_SIZE * TRACK_POOL_SLAB_SIZE) != 0) {
+            fprintf(stderr, "out of memory allocating aircraft\n");
+            exit(1);
+        }
+
+        // thread the new slots onto the freelist in address order
+        for (unsigned i = TRACK_POOL_SLAB_SIZE; i > 0; --i) {
+            struct aircraft *slot = (struct aircraft *) ((char *) slab + (i - 1) * AIRCRAFT_SLOT_SIZE);
+            slot->next = aircraft_freelist;
+            aircraft_freelist = slot;
+        }
+        aircraft_pool_slots += TRACK_POOL_SLAB_SIZE;
+    }
+
+    struct aircraft *a = aircraft_freelist;
+    aircraft_freelist = a->next;
+    ++aircraft_pool_used;
+    return a;
+}
+
+static void trackFreeAircraft(struct aircraft *a)
+{
+    a->next = aircraft_freelist;
+    aircraft_freelist = a;
+    --aircraft_pool_used;
+}
+
+//
+// Change tracking for the aircraft delta feed (see generateAircraftDeltaJson).
+//
+// Whenever an aircraft's tracked state changes, it is tagged with the
+// sequence number of the next delta, so the delta only has to include
+// aircraft with that tag; of those, it reports only the members whose
+// output changed (see json_emitted). Reliable aircraft that are removed
+// outright are remembered here until the next delta reports them.
+//
+
+static uint32_t removed_addrs[TRACK_REMOVED_MAX];
+static unsigned removed_count;
+static bool removed_overflow;
+
+static inline void trackNoteChanged(struct aircraft *a)
+{
+    a->changed_seq = Modes.json_aircraft_seq + 1;
+}
+
+static void trackNoteRemoved(struct aircraft *a)
+{
+    if (!a->reliable)
+        return; // never reported
+    if (removed_count < TRACK_REMOVED_MAX)
+        removed_addrs[removed_count++] = a->addr;
+    else
+        removed_overflow = true;
+}
+
+const uint32_t *trackRemovedAircraft(unsigned *count, bool *overflow)
+{
+    *count = removed_count;
+    *overflow = removed_overflow;
+    return removed_addrs;
+}
+
+void trackClearRemoved(void)
+{
+    removed_count = 0;
+    removed_overflow = false;
+}
+
+//
+// Position/state history for the web map (see generateHistoryJson).
+//
+// Every HISTORY_INTERVAL each reliable aircraft's position and a few state
+// fields are recorded in a ring of HISTORY_SIZE compact entries belonging to
+// that aircraft, tagged with the capture number. The ring is allocated when
+// the aircraft is first captured and goes away with the aircraft; the time
+// of each capture is kept once, in Modes.history.
+//
+
+static inline uint16_t historyTenths(double value)
+{
+    if (value <= 0)
+        return 0;
+    if (value >= 6553.5)
+        return 65535;
+    return (uint16_t) (value * 10 + 0.5);
+}
+
+void trackCaptureHistory(uint64_t now)
+{
+    uint32_t capture = ++Modes.history_captures;
+    unsigned slot = capture % HISTORY_SIZE;
+
+    Modes.history[slot].time = now;
+    Modes.history[slot].messages = Modes.stats_current.messages_total + Modes.stats_alltime.messages_total;
+
+    _messageNow = now;
+
+    for (struct aircraft *a = Modes.aircrafts; a; a = a->next) {
+        if (!a->reliable)
+            continue;
+
+        if (!a->history && !(a->history = calloc(HISTORY_SIZE, sizeof(*a->history))))
+            continue;
+
+        struct history_entry *h = &a->history[slot];
+        memset(h, 0, sizeof(*h));
+        h->capture = capture;
+        h->addrtype = a->addrtype;
+        h->seen = historyTenths((now - a->seen) / 1000.0);
+
+        if (trackDataValid(&a->position_valid)) {
+            h->flags |= HISTORY_POSITION;
+            if (a->position_valid.source == SOURCE_MLAT)
+                h->flags |= HISTORY_POSITION_MLAT;
+            h->lat = (int32_t) lround(a->lat * 1e6);
+            h->lon = (int32_t) lround(a->lon * 1e6);
+            h->seen_pos = historyTenths((now - a->position_valid.updated) / 1000.0);
+        }
+
+        if (trackDataValid(&a->airground_valid) && a->airground_valid.source >= SOURCE_MODE_S_CHECKED && a->airground == AG_GROUND) {
+            h->flags |= HISTORY_GROUND;
+        } else if (trackDataValid(&a->altitude_baro_valid)) {
+            h->flags |= HISTORY_ALT_BARO;
+            h->altitude = a->altitude_baro;
+        } else if (trackDataValid(&a->altitude_geom_valid)) {
+            h->flags |= HISTORY_ALT_GEOM;
+            h->altitude = a->altitude_geom;
+        }
+
+        if (trackDataValid(&a->gs_valid)) {
+            h->flags |= HISTORY_GS;
+            h->gs = historyTenths(a->gs);
+        }
+
+        if (trackDataValid(&a->track_valid)) {
+            h->flags |= HISTORY_TRACK;
+            h->track = historyTenths(a->track);
+        }
+    }
+}
+
+unsigned trackHistoryCount(void)
+{
+    return Modes.history_captures < HISTORY_SIZE ? Modes.history_captures : HISTORY_SIZE;
+}
+
+void trackPoolStats(unsigned *used, unsigned *slots)
+{
+    *used = aircraft_pool_used;
+    *slots = aircraft_pool_slots;
+}
+
 //
 // Return a new aircraft structure for the linked list of tracked
 // aircraft
 //
 static struct aircraft *trackCreateAircraft(struct modesMessage *mm) {
     static struct aircraft zeroAircraft;
-    struct aircraft *a = (struct aircraft *) malloc(sizeof(*a));
+    struct aircraft *a = trackAllocAircraft();
     int i;
 
     // Default everything to zero/NULL
@@ -145,23 +319,214 @@ static struct aircraft *trackCreateAircraft(struct modesMessage *mm) {
 
 //
 //=========================================================================
+//
+// Open-addressing (linear probing) index of Modes.aircrafts, keyed on addr.
+// Modes.aircrafts remains the list used for iteration; the index only
+// speeds up lookups by address. Empty slots are NULL; deletion uses
+// backward-shift so that no tombstones are needed.
+//
+
+static struct aircraft **aircraft_index;
+static unsigned aircraft_index_bits;
+static unsigned aircraft_index_count;
+
+static inline unsigned trackIndexHash(uint32_t addr)
+{
+    // Fibonacci hashing, take the top bits of the product
+    return (uint32_t) (addr * 2654435769U) >> (32 - aircraft_index_bits);
+}
+
+static void trackIndexInsert(struct aircraft *a)
+{
+    unsigned size = 1U << aircraft_index_bits;
+
+    if (!aircraft_index || (aircraft_index_count + 1) * 2 > size) {
+        // (re)build the index at double the size
+        struct aircraft **old_index = aircraft_index;
+        unsigned old_size = old_index ? size : 0;
+
+        aircraft_index_bits = old_index ? aircraft_index_bits + 1 : 0;
+        while ((1U << aircraft_index_bits) < TRACK_INDEX_INITIAL_SIZE)
+            ++aircraft_index_bits;
+        size = 1U << aircraft_index_bits;
+
+        if (!(aircraft_index = calloc(size, sizeof(*aircraft_index)))) {
+            fprintf(stderr, "out of memory allocating the aircraft index\n");
+            exit(1);
+        }
+
+        aircraft_index_count = 0;
+        for (unsigned i = 0; i < old_size; ++i) {
+            if (old_index[i])
+                trackIndexInsert(old_index[i]);
+        }
+        free(old_index);
+    }
+
+    unsigned mask = size - 1;
+    unsigned i = trackIndexHash(a->addr);
+    while (aircraft_index[i])
+        i = (i + 1) & mask;
+
+    aircraft_index[i] = a;
+    ++aircraft_index_count;
+}
+
+static void trackIndexRemove(struct aircraft *a)
+{
+    unsigned mask = (1U << aircraft_index_bits) - 1;
+    unsigned hole = trackIndexHash(a->addr);
+    while (aircraft_index[hole] != a)
+        hole = (hole + 1) & mask;
+
+    // Shift back any following entries in the same cluster that
+    // would no longer be reachable from their home slot
+    for (unsigned j = (hole + 1) & mask; aircraft_index[j]; j = (j + 1) & mask) {
+        unsigned home = trackIndexHash(aircraft_index[j]->addr);
+        if (((j - home) & mask) >= ((j - hole) & mask)) {
+            aircraft_index[hole] = aircraft_index[j];
+            hole = j;
+        }
+    }
+
+    aircraft_index[hole] = NULL;
+    --aircraft_index_count;
+}
+
 //
 // Return the aircraft with the specified address, or NULL if no aircraft
 // exists with this address.
 //
 static struct aircraft *trackFindAircraft(uint32_t addr) {
-    struct aircraft *a = Modes.aircrafts;
+    if (!aircraft_index)
+        return NULL;
+
+    unsigned mask = (1U << aircraft_index_bits) - 1;
+    unsigned i = trackIndexHash(addr);
+    unsigned probes = 1;
+    struct aircraft *a;
+
+    while ((a = aircraft_index[i]) && a->addr != addr) {
+        i = (i + 1) & mask;
+        ++probes;
+    }
+
+    Modes.stats_current.aircraft_lookups++;
+    Modes.stats_current.aircraft_lookup_probes += probes;
+    if (probes > Modes.stats_current.aircraft_lookup_max_probes)
+        Modes.stats_current.aircraft_lookup_max_probes = probes;
+
+    return a;
+}
+
+//
+//=========================================================================
+//
+// Expiry scheduling.
+//
+// Every tracked aircraft sits in a min-heap keyed on next_expiry, which is a
+// lower bound on the earliest time that one of its data fields expires or the
+// aircraft itself times out. Periodic maintenance only visits aircraft at the
+// top of the heap whose deadline has passed. Refreshing data only ever moves
+// deadlines later, so the heap only needs adjusting when a field's new expiry
+// is earlier than the aircraft's current key.
+//
+
+static struct aircraft **expiry_heap;
+static unsigned expiry_heap_count;
+static unsigned expiry_heap_size;
+
+static inline void expiryHeapSet(unsigned i, struct aircraft *a)
+{
+    expiry_heap[i] = a;
+    a->expiry_index = i;
+}
+
+static void expiryHeapUp(unsigned i)
+{
+    struct aircraft *a = expiry_heap[i];
+
+    while (i > 0) {
+        unsigned parent = (i - 1) / 2;
+        if (expiry_heap[parent]->next_expiry <= a->next_expiry)
+            break;
+        expiryHeapSet(i, expiry_heap[parent]);
+        i = parent;
+    }
 
-    while(a) {
-        if (a->addr == addr) return (a);
-        a = a->next;
+    expiryHeapSet(i, a);
+}
+
+static void expiryHeapDown(unsigned i)
+{
+    struct aircraft *a = expiry_heap[i];
+
+    for (;;) {
+        unsigned child = 2 * i + 1;
+        if (child >= expiry_heap_count)
+            break;
+        if (child + 1 < expiry_heap_count && expiry_heap[child + 1]->next_expiry < expiry_heap[child]->next_expiry)
+            ++child;
+        if (a->next_expiry <= expiry_heap[child]->next_expiry)
+            break;
+        expiryHeapSet(i, expiry_heap[child]);
+        i = child;
+    }
+
+    expiryHeapSet(i, a);
+}
+
+static void trackExpiryInsert(struct aircraft *a, uint64_t deadline)
+{
+    if (expiry_heap_count == expiry_heap_size) {
+        unsigned new_size = expiry_heap_size ? expiry_heap_size * 2 : TRACK_POOL_SLAB_SIZE;
+        struct aircraft **new_heap = realloc(expiry_heap, new_size * sizeof(*new_heap));
+        if (!new_heap) {
+            fprintf(stderr, "out of memory allocating the aircraft expiry heap\n");
+            exit(1);
+        }
+        expiry_heap = new_heap;
+        expiry_heap_size = new_size;
+    }
+
+    a->next_expiry = deadline;
+    expiryHeapSet(expiry_heap_count++, a);
+    expiryHeapUp(a->expiry_index);
+}
+
+static void trackExpiryRemove(struct aircraft *a)
+{
+    unsigned i = a->expiry_index;
+    struct aircraft *last = expiry_heap[--expiry_heap_count];
+
+    if (last == a)
+        return;
+
+    expiryHeapSet(i, last);
+    if (i > 0 && expiry_heap[(i - 1) / 2]->next_expiry > last->next_expiry)
+        expiryHeapUp(i);
+    else
+        expiryHeapDown(i);
+}
+
+// Make sure the aircraft is visited no later than 'deadline'
+static inline void trackExpiryNoLaterThan(struct aircraft *a, uint64_t deadline)
+{
+    if (deadline < a->next_expiry) {
+        a->next_expiry = deadline;
+        expiryHeapUp(a->expiry_index);
     }
-    return (NULL);
+}
+
+// When does this aircraft time out, given its current state?
+static inline uint64_t trackAircraftDeadline(const struct aircraft *a)
+{
+    return a->seen + (a->reliable ? TRACK_AIRCRAFT_TTL : TRACK_AIRCRAFT_UNRELIABLE_TTL) + 1;
 }
 
 // Should we accept some new data from the given source?
 // If so, update the validity and return 1
-static int accept_data(data_validity *d, datasource_t source)
+static int accept_data(struct aircraft *a, data_validity *d, datasource_t source)
 {
     if (messageNow() < d->updated)
         return 0;
@@ -173,6 +538,7 @@ static int accept_data(data_validity *d, datasource_t source)
     d->updated = messageNow();
     d->stale = messageNow() + (d->stale_interval ? d->stale_interval : 60000);
     d->expires = messageNow() + (d->expire_interval ? d->expire_interval : 70000);
+    trackExpiryNoLaterThan(a, d->expires);
     return 1;
 }
 
@@ -566,7 +932,7 @@ static void updatePosition(struct aircraft *a, struct modesMessage *mm)
             // Nonfatal, try again later.
             Modes.stats_current.cpr_global_skipped++;
         } else {
-            if (accept_data(&a->position_valid, mm->source)) {
+            if (accept_data(a, &a->position_valid, mm->source)) {
                 Modes.stats_current.cpr_global_ok++;
             } else {
                 Modes.stats_current.cpr_global_skipped++;
@@ -579,7 +945,7 @@ static void updatePosition(struct aircraft *a, struct modesMessage *mm)
     if (location_result == -1) {
         location_result = doLocalCPR(a, mm, &new_lat, &new_lon, &new_nic, &new_rc);
 
-        if (location_result == 0 && accept_data(&a->position_valid, mm->source)) {
+        if (location_result == 0 && accept_data(a, &a->position_valid, mm->source)) {
             Modes.stats_current.cpr_local_ok++;
             mm->cpr_relative = 1;
         } else {
@@ -941,7 +1307,12 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm)
     if (!a) {                              // If it's a currently unknown aircraft....
         a = trackCreateAircraft(mm);       // ., create a new record for it,
         a->next = Modes.aircrafts;         // .. and put it at the head of the list
+        if (a->next)
+            a->next->prev_next = &a->next;
+        a->prev_next = &Modes.aircrafts;
         Modes.aircrafts = a;
+        trackIndexInsert(a);
+        trackExpiryInsert(a, messageNow() + TRACK_AIRCRAFT_UNRELIABLE_TTL + 1);
     }
 
     if (mm->signalLevel > 0) {
@@ -971,6 +1342,8 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm)
         return a;
     }
 
+    trackNoteChanged(a);
+
     // update addrtype, we only ever go towards "more direct" types
     if (mm->addrtype < a->addrtype)
         a->addrtype = mm->addrtype;
@@ -1033,7 +1406,7 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm)
         }
     }
 
-    if (mm->altitude_baro_valid && accept_data(&a->altitude_baro_valid, mm->source)) {
+    if (mm->altitude_baro_valid && accept_data(a, &a->altitude_baro_valid, mm->source)) {
         int alt = altitude_to_feet(mm->altitude_baro, mm->altitude_baro_unit);
         if (a->modeC_hit) {
             int new_modeC = (a->altitude_baro + 49) / 100;
@@ -1046,7 +1419,7 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm)
         a->altitude_baro = alt;
     }
 
-    if (mm->squawk_valid && accept_data(&a->squawk_valid, mm->source)) {
+    if (mm->squawk_valid && accept_data(a, &a->squawk_valid, mm->source)) {
         if (mm->squawk != a->squawk) {
             a->modeA_hit = 0;
         }
@@ -1071,22 +1444,22 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm)
                 break;
             }
 
-            if (squawk_emergency != EMERGENCY_NONE && accept_data(&a->emergency_valid, mm->source)) {
+            if (squawk_emergency != EMERGENCY_NONE && accept_data(a, &a->emergency_valid, mm->source)) {
                 a->emergency = squawk_emergency;
             }
         }
 #endif
     }
 
-    if (mm->emergency_valid && accept_data(&a->emergency_valid, mm->source)) {
+    if (mm->emergency_valid && accept_data(a, &a->emergency_valid, mm->source)) {
         a->emergency = mm->emergency;
     }
 
-    if (mm->altitude_geom_valid && accept_data(&a->altitude_geom_valid, mm->source)) {
+    if (mm->altitude_geom_valid && accept_data(a, &a->altitude_geom_valid, mm->source)) {
         a->altitude_geom = altitude_to_feet(mm->altitude_geom, mm->altitude_geom_unit);
     }
 
-    if (mm->geom_delta_valid && accept_data(&a->geom_delta_valid, mm->source)) {
+    if (mm->geom_delta_valid && accept_data(a, &a->geom_delta_valid, mm->source)) {
         a->geom_delta = mm->geom_delta;
     }
 
@@ -1098,47 +1471,47 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm)
             htype = a->adsb_tah;
         }
 
-        if (htype == HEADING_GROUND_TRACK && accept_data(&a->track_valid, mm->source)) {
+        if (htype == HEADING_GROUND_TRACK && accept_data(a, &a->track_valid, mm->source)) {
             a->track = mm->heading;
-        } else if (htype == HEADING_MAGNETIC && accept_data(&a->mag_heading_valid, mm->source)) {
+        } else if (htype == HEADING_MAGNETIC && accept_data(a, &a->mag_heading_valid, mm->source)) {
             a->mag_heading = mm->heading;
-        } else if (htype == HEADING_TRUE && accept_data(&a->true_heading_valid, mm->source)) {
+        } else if (htype == HEADING_TRUE && accept_data(a, &a->true_heading_valid, mm->source)) {
             a->true_heading = mm->heading;
         }
     }
 
-    if (mm->track_rate_valid && accept_data(&a->track_rate_valid, mm->source)) {
+    if (mm->track_rate_valid && accept_data(a, &a->track_rate_valid, mm->source)) {
         a->track_rate = mm->track_rate;
     }
 
-    if (mm->roll_valid && accept_data(&a->roll_valid, mm->source)) {
+    if (mm->roll_valid && accept_data(a, &a->roll_valid, mm->source)) {
         a->roll = mm->roll;
     }
 
     if (mm->gs_valid) {
         mm->gs.selected = (*message_version == 2 ? mm->gs.v2 : mm->gs.v0);
-        if (accept_data(&a->gs_valid, mm->source)) {
+        if (accept_data(a, &a->gs_valid, mm->source)) {
             a->gs = mm->gs.selected;
         }
     }
 
-    if (mm->ias_valid && accept_data(&a->ias_valid, mm->source)) {
+    if (mm->ias_valid && accept_data(a, &a->ias_valid, mm->source)) {
         a->ias = mm->ias;
     }
 
-    if (mm->tas_valid && accept_data(&a->tas_valid, mm->source)) {
+    if (mm->tas_valid && accept_data(a, &a->tas_valid, mm->source)) {
         a->tas = mm->tas;
     }
 
-    if (mm->mach_valid && accept_data(&a->mach_valid, mm->source)) {
+    if (mm->mach_valid && accept_data(a, &a->mach_valid, mm->source)) {
         a->mach = mm->mach;
     }
 
-    if (mm->baro_rate_valid && accept_data(&a->baro_rate_valid, mm->source)) {
+    if (mm->baro_rate_valid && accept_data(a, &a->baro_rate_valid, mm->source)) {
         a->baro_rate = mm->baro_rate;
     }
 
-    if (mm->geom_rate_valid && accept_data(&a->geom_rate_valid, mm->source)) {
+    if (mm->geom_rate_valid && accept_data(a, &a->geom_rate_valid, mm->source)) {
         a->geom_rate = mm->geom_rate;
     }
 
@@ -1147,13 +1520,13 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm)
         // If our current state is certain but new data is not, only accept the uncertain state if the certain data has gone stale
         if (mm->airground != AG_UNCERTAIN ||
             (mm->airground == AG_UNCERTAIN && !trackDataFresh(&a->airground_valid))) {
-            if (accept_data(&a->airground_valid, mm->source)) {
+            if (accept_data(a, &a->airground_valid, mm->source)) {
                 a->airground = mm->airground;
             }
         }
     }
 
-    if (mm->callsign_valid && accept_data(&a->callsign_valid, mm->source)) {
+    if (mm->callsign_valid && accept_data(a, &a->callsign_valid, mm->source)) {
         if (strcmp(a->callsign, mm->callsign) != 0) {
             // The callsign changed so tell interactive to
             // re-evaluate its callsign filter regex if it has one
@@ -1162,32 +1535,32 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm)
         memcpy(a->callsign, mm->callsign, sizeof(a->callsign));
     }
 
-    if (mm->nav.mcp_altitude_valid && accept_data(&a->nav_altitude_mcp_valid, mm->source)) {
+    if (mm->nav.mcp_altitude_valid && accept_data(a, &a->nav_altitude_mcp_valid, mm->source)) {
         a->nav_altitude_mcp = mm->nav.mcp_altitude;
     }
 
-    if (mm->nav.fms_altitude_valid && accept_data(&a->nav_altitude_fms_valid, mm->source)) {
+    if (mm->nav.fms_altitude_valid && accept_data(a, &a->nav_altitude_fms_valid, mm->source)) {
         a->nav_altitude_fms = mm->nav.fms_altitude;
     }
 
-    if (mm->nav.altitude_source != NAV_ALT_INVALID && accept_data(&a->nav_altitude_src_valid, mm->source)) {
+    if (mm->nav.altitude_source != NAV_ALT_INVALID && accept_data(a, &a->nav_altitude_src_valid, mm->source)) {
         a->nav_altitude_src = mm->nav.altitude_source;
     }
 
-    if (mm->nav.heading_valid && accept_data(&a->nav_heading_valid, mm->source)) {
+    if (mm->nav.heading_valid && accept_data(a, &a->nav_heading_valid, mm->source)) {
         a->nav_heading = mm->nav.heading;
     }
 
-    if (mm->nav.modes_valid && accept_data(&a->nav_modes_valid, mm->source)) {
+    if (mm->nav.modes_valid && accept_data(a, &a->nav_modes_valid, mm->source)) {
         a->nav_modes = mm->nav.modes;
     }
 
-    if (mm->nav.qnh_valid && accept_data(&a->nav_qnh_valid, mm->source)) {
+    if (mm->nav.qnh_valid && accept_data(a, &a->nav_qnh_valid, mm->source)) {
         a->nav_qnh = mm->nav.qnh;
     }
 
     // CPR, even
-    if (mm->cpr_valid && !mm->cpr_odd && accept_data(&a->cpr_even_valid, mm->source)) {
+    if (mm->cpr_valid && !mm->cpr_odd && accept_data(a, &a->cpr_even_valid, mm->source)) {
         a->cpr_even_type = mm->cpr_type;
         a->cpr_even_lat = mm->cpr_lat;
         a->cpr_even_lon = mm->cpr_lon;
@@ -1196,7 +1569,7 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm)
     }
 
     // CPR, odd
-    if (mm->cpr_valid && mm->cpr_odd && accept_data(&a->cpr_odd_valid, mm->source)) {
+    if (mm->cpr_valid && mm->cpr_odd && accept_data(a, &a->cpr_odd_valid, mm->source)) {
         a->cpr_odd_type = mm->cpr_type;
         a->cpr_odd_lat = mm->cpr_lat;
         a->cpr_odd_lon = mm->cpr_lon;
@@ -1204,67 +1577,67 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm)
         cpr_new = 1;
     }
 
-    if (mm->accuracy.sda_valid && accept_data(&a->sda_valid, mm->source)) {
+    if (mm->accuracy.sda_valid && accept_data(a, &a->sda_valid, mm->source)) {
         a->sda = mm->accuracy.sda;
     }
 
-    if (mm->accuracy.nic_a_valid && accept_data(&a->nic_a_valid, mm->source)) {
+    if (mm->accuracy.nic_a_valid && accept_data(a, &a->nic_a_valid, mm->source)) {
         a->nic_a = mm->accuracy.nic_a;
     }
 
-    if (mm->accuracy.nic_c_valid && accept_data(&a->nic_c_valid, mm->source)) {
+    if (mm->accuracy.nic_c_valid && accept_data(a, &a->nic_c_valid, mm->source)) {
         a->nic_c = mm->accuracy.nic_c;
     }
 
-    if (mm->accuracy.nic_baro_valid && accept_data(&a->nic_baro_valid, mm->source)) {
+    if (mm->accuracy.nic_baro_valid && accept_data(a, &a->nic_baro_valid, mm->source)) {
         a->nic_baro = mm->accuracy.nic_baro;
     }
 
-    if (mm->accuracy.nac_p_valid && accept_data(&a->nac_p_valid, mm->source)) {
+    if (mm->accuracy.nac_p_valid && accept_data(a, &a->nac_p_valid, mm->source)) {
         a->nac_p = mm->accuracy.nac_p;
     }
 
-    if (mm->accuracy.nac_v_valid && accept_data(&a->nac_v_valid, mm->source)) {
+    if (mm->accuracy.nac_v_valid && accept_data(a, &a->nac_v_valid, mm->source)) {
         a->nac_v = mm->accuracy.nac_v;
     }
 
-    if (mm->accuracy.sil_type != SIL_INVALID && accept_data(&a->sil_valid, mm->source)) {
+    if (mm->accuracy.sil_type != SIL_INVALID && accept_data(a, &a->sil_valid, mm->source)) {
         a->sil = mm->accuracy.sil;
         if (a->sil_type == SIL_INVALID || mm->accuracy.sil_type != SIL_UNKNOWN) {
             a->sil_type = mm->accuracy.sil_type;
         }
     }
 
-    if (mm->accuracy.gva_valid && accept_data(&a->gva_valid, mm->source)) {
+    if (mm->accuracy.gva_valid && accept_data(a, &a->gva_valid, mm->source)) {
         a->gva = mm->accuracy.gva;
     }
 
-    if (mm->accuracy.sda_valid && accept_data(&a->sda_valid, mm->source)) {
+    if (mm->accuracy.sda_valid && accept_data(a, &a->sda_valid, mm->source)) {
         a->sda = mm->accuracy.sda;
     }
 
-    if (mm->mrar_source_valid && accept_data(&a->mrar_source_valid, mm->source)) {
+    if (mm->mrar_source_valid && accept_data(a, &a->mrar_source_valid, mm->source)) {
         a->mrar_source = mm->mrar_source;
     }
 
-    if (mm->wind_valid && accept_data(&a->wind_valid, mm->source)) {
+    if (mm->wind_valid && accept_data(a, &a->wind_valid, mm->source)) {
         a->wind_speed = mm->wind_speed;
         a->wind_dir = mm->wind_dir;
     }
 
-    if (mm->temperature_valid && accept_data(&a->temperature_valid, mm->source)) {
+    if (mm->temperature_valid && accept_data(a, &a->temperature_valid, mm->source)) {
         a->temperature = mm->temperature;
     }
 
-    if (mm->pressure_valid && accept_data(&a->pressure_valid, mm->source)) {
+    if (mm->pressure_valid && accept_data(a, &a->pressure_valid, mm->source)) {
         a->pressure = mm->pressure;
     }
 
-    if (mm->turbulence_valid && accept_data(&a->turbulence_valid, mm->source)) {
+    if (mm->turbulence_valid && accept_data(a, &a->turbulence_valid, mm->source)) {
         a->turbulence = mm->turbulence;
     }
 
-    if (mm->humidity_valid && accept_data(&a->humidity_valid, mm->source)) {
+    if (mm->humidity_valid && accept_data(a, &a->humidity_valid, mm->source)) {
         a->humidity = mm->humidity;
     }
 
@@ -1304,6 +1677,8 @@ static void trackMatchAC(uint64_t now)
             continue;
         }
 
+        int old_hits = a->modeA_hit + 2 * a->modeC_hit;
+
         // match on Mode A
         if (trackDataValid(&a->squawk_valid)) {
             unsigned i = modeAToIndex(a->squawk);
@@ -1338,6 +1713,9 @@ static void trackMatchAC(uint64_t now)
                 modeAC_match[i] = (modeAC_match[i] ? 0xFFFFFFFF : a->addr);
             }
         }
+
+        if (a->modeA_hit + 2 * a->modeC_hit != old_hits)
+            trackNoteChanged(a);
     }
 
     // reset counts for next time
@@ -1369,16 +1747,18 @@ static void trackMatchAC(uint64_t now)
 //
 //=========================================================================
 //
-// If we don't receive new nessages within TRACK_AIRCRAFT_TTL
-// we remove the aircraft from the list.
+// Expire data fields whose deadlines have passed, and remove aircraft that we
+// have not received messages from within TRACK_AIRCRAFT_TTL (or
+// TRACK_AIRCRAFT_UNRELIABLE_TTL for unreliable aircraft). Only aircraft whose
+// scheduled expiry time has passed are examined.
 //
-static void trackRemoveStaleAircraft(uint64_t now)
+static void trackExpireAircraft(uint64_t now)
 {
-    struct aircraft *a = Modes.aircrafts;
-    struct aircraft *prev = NULL;
+    while (expiry_heap_count && expiry_heap[0]->next_expiry <= now) {
+        struct aircraft *a = expiry_heap[0];
+        uint64_t deadline = trackAircraftDeadline(a);
 
-    while(a) {
-        if ((now - a->seen) > TRACK_AIRCRAFT_TTL || (!a->reliable && (now - a->seen) > TRACK_AIRCRAFT_UNRELIABLE_TTL)) {
+        if (now >= deadline) {
             // Count aircraft where we saw only one message before reaping them.
             // These are likely to be due to messages with bad addresses.
             if (a->messages == 1)
@@ -1386,60 +1766,80 @@ static void trackRemoveStaleAircraft(uint64_t now)
             if (!a->reliable)
                 Modes.stats_current.unreliable_aircraft++;
 
-            // Remove the element from the linked list, with care
-            // if we are removing the first element
-            if (!prev) {
-                Modes.aircrafts = a->next; free(a); a = Modes.aircrafts;
-            } else {
-                prev->next = a->next; free(a); a = prev->next;
-            }
-        } else {
+            trackNoteRemoved(a);
+            trackExpiryRemove(a);
+            trackIndexRemove(a);
 
-#define EXPIRE(_f) do { if (a->_f##_valid.source != SOURCE_INVALID && now >= a->_f##_valid.expires) { a->_f##_valid.source = SOURCE_INVALID; } } while (0)
-            EXPIRE(callsign);
-            EXPIRE(altitude_baro);
-            EXPIRE(altitude_geom);
-            EXPIRE(geom_delta);
-            EXPIRE(gs);
-            EXPIRE(ias);
-            EXPIRE(tas);
-            EXPIRE(mach);
-            EXPIRE(track);
-            EXPIRE(track_rate);
-            EXPIRE(roll);
-            EXPIRE(mag_heading);
-            EXPIRE(true_heading);
-            EXPIRE(baro_rate);
-            EXPIRE(geom_rate);
-            EXPIRE(squawk);
-            EXPIRE(emergency);
-            EXPIRE(airground);
-            EXPIRE(nav_qnh);
-            EXPIRE(nav_altitude_mcp);
-            EXPIRE(nav_altitude_fms);
-            EXPIRE(nav_altitude_src);
-            EXPIRE(nav_heading);
-            EXPIRE(nav_modes);
-            EXPIRE(cpr_odd);
-            EXPIRE(cpr_even);
-            EXPIRE(position);
-            EXPIRE(nic_a);
-            EXPIRE(nic_c);
-            EXPIRE(nic_baro);
-            EXPIRE(nac_p);
-            EXPIRE(nac_v);
-            EXPIRE(sil);
-            EXPIRE(gva);
-            EXPIRE(sda);
-            EXPIRE(mrar_source);
-            EXPIRE(wind);
-            EXPIRE(temperature);
-            EXPIRE(pressure);
-            EXPIRE(turbulence);
-            EXPIRE(humidity);
-#undef EXPIRE
-            prev = a; a = a->next;
+            // Unlink from the aircraft list
+            *a->prev_next = a->next;
+            if (a->next)
+                a->next->prev_next = a->prev_next;
+
+            free(a->history);
+            trackFreeAircraft(a);
+            continue;
         }
+
+        // Expire any fields that are due, and reschedule the aircraft for
+        // the earliest remaining deadline
+        bool expired = false;
+#define EXPIRE(_f) do {                                                 \
+            if (a->_f##_valid.source != SOURCE_INVALID) {               \
+                if (now >= a->_f##_valid.expires) {                     \
+                    a->_f##_valid.source = SOURCE_INVALID;              \
+                    expired = true;                                     \
+                } else if (a->_f##_valid.expires < deadline)            \
+                    deadline = a->_f##_valid.expires;                   \
+            }                                                           \
+        } while (0)
+        EXPIRE(callsign);
+        EXPIRE(altitude_baro);
+        EXPIRE(altitude_geom);
+        EXPIRE(geom_delta);
+        EXPIRE(gs);
+        EXPIRE(ias);
+        EXPIRE(tas);
+        EXPIRE(mach);
+        EXPIRE(track);
+        EXPIRE(track_rate);
+        EXPIRE(roll);
+        EXPIRE(mag_heading);
+        EXPIRE(true_heading);
+        EXPIRE(baro_rate);
+        EXPIRE(geom_rate);
+        EXPIRE(squawk);
+        EXPIRE(emergency);
+        EXPIRE(airground);
+        EXPIRE(nav_qnh);
+        EXPIRE(nav_altitude_mcp);
+        EXPIRE(nav_altitude_fms);
+        EXPIRE(nav_altitude_src);
+        EXPIRE(nav_heading);
+        EXPIRE(nav_modes);
+        EXPIRE(cpr_odd);
+        EXPIRE(cpr_even);
+        EXPIRE(position);
+        EXPIRE(nic_a);
+        EXPIRE(nic_c);
+        EXPIRE(nic_baro);
+        EXPIRE(nac_p);
+        EXPIRE(nac_v);
+        EXPIRE(sil);
+        EXPIRE(gva);
+        EXPIRE(sda);
+        EXPIRE(mrar_source);
+        EXPIRE(wind);
+        EXPIRE(temperature);
+        EXPIRE(pressure);
+        EXPIRE(turbulence);
+        EXPIRE(humidity);
+#undef EXPIRE
+
+        if (expired)
+            trackNoteChanged(a);
+
+        a->next_expiry = deadline;
+        expiryHeapDown(0);
     }
 }
 
@@ -1456,7 +1856,7 @@ void trackPeriodicUpdate()
     // Only do updates once per second
     if (now >= next_update) {
         next_update = now + 1000;
-        trackRemoveStaleAircraft(now);
+        trackExpireAircraft(now);
         trackMatchAC(now);
     }
 }
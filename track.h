@@ -73,9 +73,46 @@
 /* Minimum number of any sort of messages required to mark a track as reliable */
 #define TRACK_RELIABLE_ANY_MESSAGES 5
 
+/* Initial number of slots in the aircraft address index (power of two);
+ * the index doubles whenever it would become more than half full.
+ */
+#define TRACK_INDEX_INITIAL_SIZE 256
+
+/* Number of aircraft slots allocated at once by the aircraft pool */
+#define TRACK_POOL_SLAB_SIZE 64
+
+/* Maximum number of removed aircraft remembered between aircraft deltas */
+#define TRACK_REMOVED_MAX 4096
+
+/* Maximum number of distinct members of an aircraft.json entry (see aircraft_json_members in net_io.c) */
+#define TRACK_JSON_MEMBERS 64
+
 /* Special value for Rc unknown */
 #define RC_UNKNOWN 0
 
+/* Flags for struct history_entry */
+#define HISTORY_POSITION      0x01 /* lat/lon/seen_pos are valid */
+#define HISTORY_POSITION_MLAT 0x02 /* position came from mlat */
+#define HISTORY_ALT_BARO      0x04 /* altitude is barometric */
+#define HISTORY_ALT_GEOM      0x08 /* altitude is geometric */
+#define HISTORY_GROUND        0x10 /* on the ground, altitude not valid */
+#define HISTORY_GS            0x20 /* gs is valid */
+#define HISTORY_TRACK         0x40 /* track is valid */
+
+/* One aircraft's position and state at a history capture (see trackCaptureHistory) */
+struct history_entry {
+    uint32_t capture;   /* capture number this was recorded at; anything else in the slot is stale */
+    int32_t  lat;       /* latitude, 1e-6 degrees */
+    int32_t  lon;       /* longitude, 1e-6 degrees */
+    int32_t  altitude;  /* feet */
+    uint16_t gs;        /* groundspeed, 0.1 knots */
+    uint16_t track;     /* track, 0.1 degrees */
+    uint16_t seen;      /* time since the last message, 0.1 seconds */
+    uint16_t seen_pos;  /* time since the last position, 0.1 seconds */
+    uint8_t  addrtype;  /* addrtype_t */
+    uint8_t  flags;     /* HISTORY_* */
+};
+
 // data moves through three states:
 //  fresh: data is valid. Updates from a less reliable source are not accepted.
 //  stale: data is valid. Updates from a less reliable source are accepted.
@@ -286,7 +323,16 @@ struct aircraft {
     uint64_t      fatsv_last_emitted;             // time (millis) aircraft was last FA emitted
     uint64_t      fatsv_last_force_emit;          // time (millis) we last emitted only-on-change data
 
+    uint64_t      next_expiry;    // Lower bound on when data next expires or the aircraft times out
+    unsigned      expiry_index;   // Position in the expiry heap
+
+    uint64_t      changed_seq;    // Aircraft delta sequence number that will next report this aircraft
+    uint64_t      json_emitted[TRACK_JSON_MEMBERS]; // Hash of each aircraft.json member as last reported in an aircraft delta, 0 if absent
+
+    struct history_entry *history; // HISTORY_SIZE entries indexed by capture % HISTORY_SIZE, or NULL if never captured
+
     struct aircraft *next;        // Next aircraft in our linked list
+    struct aircraft **prev_next;  // Link that points to this aircraft (previous aircraft's next, or Modes.aircrafts)
 };
 
 /* Mode A/C tracking is done separately, not via the aircraft list,
@@ -328,6 +374,21 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm);
 /* Call periodically */
 void trackPeriodicUpdate();
 
+/* Report aircraft pool occupancy: slots in use / slots allocated */
+void trackPoolStats(unsigned *used, unsigned *slots);
+
+/* Addresses of reliable aircraft removed since the last trackClearRemoved().
+ * Sets *overflow if more than TRACK_REMOVED_MAX were removed, so some are missing.
+ */
+const uint32_t *trackRemovedAircraft(unsigned *count, bool *overflow);
+void trackClearRemoved(void);
+
+/* Record the state of every reliable aircraft as a new history capture */
+void trackCaptureHistory(uint64_t now);
+
+/* Number of history captures currently held, up to HISTORY_SIZE */
+unsigned trackHistoryCount(void);
+
 /* Convert from a (hex) mode A value to a 0-4095 index */
 static inline unsigned modeAToIndex(unsigned modeA)
 {